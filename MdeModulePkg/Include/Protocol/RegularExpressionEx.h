@@ -0,0 +1,120 @@
+/** @file
+  EDKII Regular Expression Extended Protocol.
+
+  It allows the caller to compile a regular expression pattern once and match
+  it against many strings, instead of compiling the pattern in every
+  EFI_REGULAR_EXPRESSION_PROTOCOL.MatchString() call.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef __EDKII_REGULAR_EXPRESSION_EX_PROTOCOL_H__
+#define __EDKII_REGULAR_EXPRESSION_EX_PROTOCOL_H__
+
+#include <Protocol/RegularExpressionProtocol.h>
+
+#define EDKII_REGULAR_EXPRESSION_EX_PROTOCOL_GUID \
+    { \
+      0x257fc2e3, 0x9d40, 0x41cc, { 0x9e, 0xbc, 0x18, 0x8d, 0x01, 0xb5, 0xd2, 0x91 } \
+    }
+
+typedef struct _EDKII_REGULAR_EXPRESSION_EX_PROTOCOL EDKII_REGULAR_EXPRESSION_EX_PROTOCOL;
+
+//
+// Opaque handle of a compiled regular expression pattern.
+//
+typedef VOID *EDKII_REGEX_COMPILED_PATTERN;
+
+/**
+  Compile the regular expression pattern.
+
+  @param This          A pointer to the EDKII_REGULAR_EXPRESSION_EX_PROTOCOL instance.
+  @param Pattern       A pointer to a NULL terminated string that represents the
+                       regular expression.
+  @param SyntaxType    A pointer to the EFI_REGEX_SYNTAX_TYPE that identifies the
+                       regular expression syntax type to use. May be NULL in which
+                       case the function will use its default regular expression
+                       syntax type.
+  @param Compiled      On return, the handle of compiled pattern. It must be freed
+                       by EDKII_REGULAR_EXPRESSION_EX_PROTOCOL.FreePattern().
+
+  @retval EFI_SUCCESS            The pattern is compiled.
+  @retval EFI_UNSUPPORTED        The regular expression syntax specified by
+                                 SyntaxType is not supported by this driver.
+  @retval EFI_DEVICE_ERROR       The regular expression compilation failed.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+  @retval EFI_INVALID_PARAMETER  Pattern or Compiled is NULL.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REGULAR_EXPRESSION_COMPILE_PATTERN) (
+  IN  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL  *This,
+  IN  CHAR16                                *Pattern,
+  IN  EFI_REGEX_SYNTAX_TYPE                 *SyntaxType, OPTIONAL
+  OUT EDKII_REGEX_COMPILED_PATTERN          *Compiled
+  );
+
+/**
+  Checks if the input string matches to the compiled regular expression pattern.
+
+  @param This          A pointer to the EDKII_REGULAR_EXPRESSION_EX_PROTOCOL instance.
+  @param Compiled      The compiled pattern returned by CompilePattern().
+  @param String        A pointer to a NULL terminated string to match against the
+                       compiled pattern.
+  @param Result        On return, points to TRUE if String fully matches against
+                       the compiled pattern. Otherwise, points to FALSE.
+  @param Captures      A Pointer to an array of EFI_REGEX_CAPTURE objects to receive
+                       the captured groups in the event of a match. Same as
+                       EFI_REGULAR_EXPRESSION_PROTOCOL.MatchString().
+  @param CapturesCount On output, CapturesCount is the number of matching patterns
+                       found in String.
+
+  @retval EFI_SUCCESS            The regular expression string matching
+                                 completed successfully.
+  @retval EFI_DEVICE_ERROR       The regular expression string matching
+                                 failed.
+  @retval EFI_INVALID_PARAMETER  Compiled, String, Result, or CapturesCount is
+                                 NULL or Compiled is not a valid handle.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REGULAR_EXPRESSION_MATCH_COMPILED) (
+  IN  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL  *This,
+  IN  EDKII_REGEX_COMPILED_PATTERN          Compiled,
+  IN  CHAR16                                *String,
+  OUT BOOLEAN                               *Result,
+  OUT EFI_REGEX_CAPTURE                     **Captures, OPTIONAL
+  OUT UINTN                                 *CapturesCount
+  );
+
+/**
+  Free the compiled regular expression pattern.
+
+  @param This          A pointer to the EDKII_REGULAR_EXPRESSION_EX_PROTOCOL instance.
+  @param Compiled      The compiled pattern returned by CompilePattern().
+
+  @retval EFI_SUCCESS            The compiled pattern is freed.
+  @retval EFI_INVALID_PARAMETER  Compiled is NULL or not a valid handle.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REGULAR_EXPRESSION_FREE_PATTERN) (
+  IN  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL  *This,
+  IN  EDKII_REGEX_COMPILED_PATTERN          Compiled
+  );
+
+struct _EDKII_REGULAR_EXPRESSION_EX_PROTOCOL {
+  EDKII_REGULAR_EXPRESSION_COMPILE_PATTERN  CompilePattern;
+  EDKII_REGULAR_EXPRESSION_MATCH_COMPILED   MatchCompiled;
+  EDKII_REGULAR_EXPRESSION_FREE_PATTERN     FreePattern;
+};
+
+extern EFI_GUID gEdkiiRegularExpressionExProtocolGuid;
+
+#endif
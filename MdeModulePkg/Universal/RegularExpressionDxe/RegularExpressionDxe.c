@@ -22,73 +22,79 @@ EFI_REGULAR_EXPRESSION_PROTOCOL mProtocolInstance = {
   RegularExpressionGetInfo
 };
 
+STATIC
+EDKII_REGULAR_EXPRESSION_EX_PROTOCOL mExProtocolInstance = {
+  RegularExpressionCompilePattern,
+  RegularExpressionMatchCompiled,
+  RegularExpressionFreePattern
+};
+
+//
+// Compiled patterns of EFI_REGULAR_EXPRESSION_PROTOCOL.MatchString() in
+// least recently used order.
+//
+STATIC LIST_ENTRY  mPatternCache = INITIALIZE_LIST_HEAD_VARIABLE (mPatternCache);
+STATIC UINTN       mPatternCacheCount = 0;
 
 
 #define CHAR16_ENCODING ONIG_ENCODING_UTF16_LE
 
 /**
-  Call the Oniguruma regex match API.
+  Get the supported regular expression syntax type.
 
-  Same parameters as RegularExpressionMatch, except SyntaxType is required.
+  @param SyntaxType     A pointer to the EFI_REGEX_SYNTAX_TYPE. May be NULL in
+                        which case the default syntax type is returned.
 
-  @param String         A pointer to a NULL terminated string to match against the
-                        regular expression string specified by Pattern.
+  @return  The supported syntax type, or NULL if SyntaxType is not supported.
 
-  @param Pattern        A pointer to a NULL terminated string that represents the
-                        regular expression.
-  @param SyntaxType     A pointer to the EFI_REGEX_SYNTAX_TYPE that identifies the
-                        regular expression syntax type to use. May be NULL in which
-                        case the function will use its default regular expression
-                        syntax type.
+**/
+STATIC
+EFI_REGEX_SYNTAX_TYPE *
+GetSupportedSyntaxType (
+  IN  EFI_REGEX_SYNTAX_TYPE *SyntaxType OPTIONAL
+  )
+{
+  UINT32  Index;
 
-  @param Result         On return, points to TRUE if String fully matches against
-                        the regular expression Pattern using the regular expression
-                        SyntaxType. Otherwise, points to FALSE.
+  if (SyntaxType == NULL) {
+    return mSupportedSyntaxes[0];
+  }
 
-  @param Captures       A Pointer to an array of EFI_REGEX_CAPTURE objects to receive
-                        the captured groups in the event of a match. The full
-                        sub-string match is put in Captures[0], and the results of N
-                        capturing groups are put in Captures[1:N]. If Captures is
-                        NULL, then this function doesn't allocate the memory for the
-                        array and does not build up the elements. It only returns the
-                        number of matching patterns in CapturesCount. If Captures is
-                        not NULL, this function returns a pointer to an array and
-                        builds up the elements in the array. CapturesCount is also
-                        updated to the number of matching patterns found. It is the
-                        caller's responsibility to free the memory pool in Captures
-                        and in each CapturePtr in the array elements.
+  for (Index = 0; Index < ARRAY_SIZE (mSupportedSyntaxes); ++Index) {
+    if (CompareGuid (SyntaxType, mSupportedSyntaxes[Index])) {
+      return SyntaxType;
+    }
+  }
+  return NULL;
+}
 
-  @param CapturesCount  On output, CapturesCount is the number of matching patterns
-                        found in String. Zero means no matching patterns were found
-                        in the string.
+/**
+  Call the Oniguruma regex compile API.
 
-  @retval  EFI_SUCCESS       Regex compilation and match completed successfully.
+  @param Pattern        A pointer to a NULL terminated string that represents the
+                        regular expression.
+  @param SyntaxType     A pointer to the EFI_REGEX_SYNTAX_TYPE that identifies the
+                        regular expression syntax type to use.
+  @param OnigRegex      On return, the compiled regex. It is freed by onig_free().
+
+  @retval  EFI_SUCCESS       Regex compilation completed successfully.
+  @retval  EFI_UNSUPPORTED   SyntaxType is not supported.
   @retval  EFI_DEVICE_ERROR  Regex compilation failed.
 
 **/
 STATIC
 EFI_STATUS
-OnigurumaMatch (
-  IN  CHAR16                *String,
+OnigurumaCompile (
   IN  CHAR16                *Pattern,
   IN  EFI_REGEX_SYNTAX_TYPE *SyntaxType,
-  OUT BOOLEAN               *Result,
-  OUT EFI_REGEX_CAPTURE     **Captures,     OPTIONAL
-  OUT UINTN                 *CapturesCount
+  OUT regex_t               **OnigRegex
   )
 {
-  regex_t         *OnigRegex;
   OnigSyntaxType  *OnigSyntax;
-  OnigRegion      *Region;
   INT32           OnigResult;
   OnigErrorInfo   ErrorInfo;
   OnigUChar       ErrorMessage[ONIG_MAX_ERROR_MESSAGE_LEN];
-  UINT32          Index;
   OnigUChar       *Start;
-  EFI_STATUS      Status;
-
-
-  Status = EFI_SUCCESS;
 
   //
   // Detemine the internal syntax type
@@ -108,7 +114,7 @@ OnigurumaMatch (
   //
   Start = (OnigUChar*)Pattern;
   OnigResult = onig_new (
-                 &OnigRegex,
+                 OnigRegex,
                  Start,
                  Start + onigenc_str_bytelen_null (CHAR16_ENCODING, Start),
                  ONIG_OPTION_DEFAULT,
@@ -123,13 +129,58 @@ OnigurumaMatch (
     return EFI_DEVICE_ERROR;
   }
 
+  return EFI_SUCCESS;
+}
+
+/**
+  Call the Oniguruma regex search API with the compiled regex.
+
+  @param OnigRegex      The compiled regex.
+
+  @param String         A pointer to a NULL terminated string to match against the
+                        compiled regex.
+
+  @param Result         On return, points to TRUE if String fully matches against
+                        the compiled regex. Otherwise, points to FALSE.
+
+  @param Captures       A Pointer to an array of EFI_REGEX_CAPTURE objects to receive
+                        the captured groups in the event of a match. Same as
+                        RegularExpressionMatch.
+
+  @param CapturesCount  On output, CapturesCount is the number of matching patterns
+                        found in String. Zero means no matching patterns were found
+                        in the string.
+
+  @retval  EFI_SUCCESS       Regex match completed successfully.
+  @retval  EFI_DEVICE_ERROR  Regex match failed.
+
+**/
+STATIC
+EFI_STATUS
+OnigurumaSearch (
+  IN  regex_t               *OnigRegex,
+  IN  CHAR16                *String,
+  OUT BOOLEAN               *Result,
+  OUT EFI_REGEX_CAPTURE     **Captures,     OPTIONAL
+  OUT UINTN                 *CapturesCount
+  )
+{
+  OnigRegion      *Region;
+  INT32           OnigResult;
+  OnigUChar       ErrorMessage[ONIG_MAX_ERROR_MESSAGE_LEN];
+  UINT32          Index;
+  OnigUChar       *Start;
+  EFI_STATUS      Status;
+
+
+  Status = EFI_SUCCESS;
+
   //
   // Try to match
   //
   Start = (OnigUChar*)String;
   Region = onig_region_new ();
   if (Region == NULL) {
-    onig_free (OnigRegex);
     return EFI_OUT_OF_RESOURCES;
   }
   OnigResult = onig_search (
@@ -150,7 +201,6 @@ OnigurumaMatch (
       onig_error_code_to_str (ErrorMessage, OnigResult);
       DEBUG ((DEBUG_ERROR, "Regex match failed: %a\n", ErrorMessage));
       onig_region_free (Region, 1);
-      onig_free (OnigRegex);
       return EFI_DEVICE_ERROR;
     }
   }
@@ -189,7 +239,232 @@ OnigurumaMatch (
   }
 
   onig_region_free (Region, 1);
-  onig_free (OnigRegex);
+
+  return Status;
+}
+
+/**
+  Find the compiled regex of the pattern in the pattern cache and pin it. The
+  caller must be at TPL_NOTIFY.
+
+  @param Pattern        A pointer to a NULL terminated string that represents the
+                        regular expression.
+  @param SyntaxType     A pointer to the EFI_REGEX_SYNTAX_TYPE that identifies the
+                        regular expression syntax type to use.
+
+  @return  The pinned cache entry, or NULL if the pattern is not in the cache.
+
+**/
+STATIC
+REGEX_PATTERN_CACHE_ENTRY *
+FindCachedPattern (
+  IN  CHAR16                *Pattern,
+  IN  EFI_REGEX_SYNTAX_TYPE *SyntaxType
+  )
+{
+  LIST_ENTRY                 *Link;
+  REGEX_PATTERN_CACHE_ENTRY  *Entry;
+
+  for (Link = GetFirstNode (&mPatternCache); !IsNull (&mPatternCache, Link); Link = GetNextNode (&mPatternCache, Link)) {
+    Entry = REGEX_PATTERN_CACHE_ENTRY_FROM_LIST (Link);
+    if (CompareGuid (&Entry->SyntaxType, SyntaxType) && StrCmp (Entry->Pattern, Pattern) == 0) {
+      if (Link != GetFirstNode (&mPatternCache)) {
+        RemoveEntryList (Link);
+        InsertHeadList (&mPatternCache, Link);
+      }
+      Entry->RefCount++;
+      return Entry;
+    }
+  }
+  return NULL;
+}
+
+/**
+  Free the pattern cache entry.
+
+  @param Entry          The cache entry which is not in the cache list.
+
+**/
+STATIC
+VOID
+FreeCachedPattern (
+  IN  REGEX_PATTERN_CACHE_ENTRY *Entry
+  )
+{
+  onig_free (Entry->OnigRegex);
+  FreePool (Entry->Pattern);
+  FreePool (Entry);
+}
+
+/**
+  Get the compiled regex of the pattern from the pattern cache. The pattern is
+  compiled and added to the cache if it is not there. The least recently used
+  pattern which is not in use is dropped when the cache is full.
+
+  The cache list is accessed at TPL_NOTIFY, the pattern is compiled at the
+  caller's TPL. The returned entry is pinned until ReleaseCachedPattern() is
+  called, so it is not freed while it is in use.
+
+  @param Pattern        A pointer to a NULL terminated string that represents the
+                        regular expression.
+  @param SyntaxType     A pointer to the EFI_REGEX_SYNTAX_TYPE that identifies the
+                        regular expression syntax type to use.
+  @param CachedPattern  On return, the pinned cache entry of the compiled regex.
+
+  @retval  EFI_SUCCESS           The compiled regex is returned.
+  @retval  EFI_OUT_OF_RESOURCES  Not enough memory.
+  @retval  Others                Regex compilation failed.
+
+**/
+STATIC
+EFI_STATUS
+GetCachedPattern (
+  IN  CHAR16                     *Pattern,
+  IN  EFI_REGEX_SYNTAX_TYPE      *SyntaxType,
+  OUT REGEX_PATTERN_CACHE_ENTRY  **CachedPattern
+  )
+{
+  LIST_ENTRY                 *Link;
+  REGEX_PATTERN_CACHE_ENTRY  *Entry;
+  REGEX_PATTERN_CACHE_ENTRY  *Victim;
+  EFI_STATUS                 Status;
+  EFI_TPL                    OldTpl;
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  Entry = FindCachedPattern (Pattern, SyntaxType);
+  gBS->RestoreTPL (OldTpl);
+  if (Entry != NULL) {
+    *CachedPattern = Entry;
+    return EFI_SUCCESS;
+  }
+
+  Entry = AllocateZeroPool (sizeof (REGEX_PATTERN_CACHE_ENTRY));
+  if (Entry == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+  Entry->Pattern = AllocateCopyPool (StrSize (Pattern), Pattern);
+  if (Entry->Pattern == NULL) {
+    FreePool (Entry);
+    return EFI_OUT_OF_RESOURCES;
+  }
+  Status = OnigurumaCompile (Pattern, SyntaxType, &Entry->OnigRegex);
+  if (EFI_ERROR (Status)) {
+    FreePool (Entry->Pattern);
+    FreePool (Entry);
+    return Status;
+  }
+  CopyGuid (&Entry->SyntaxType, SyntaxType);
+  Entry->RefCount = 1;
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  //
+  // The same pattern may be added while it was compiled at the caller's TPL.
+  //
+  *CachedPattern = FindCachedPattern (Pattern, SyntaxType);
+  if (*CachedPattern != NULL) {
+    gBS->RestoreTPL (OldTpl);
+    FreeCachedPattern (Entry);
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Drop the least recently used pattern which is not in use. The cache
+  // grows over the limit if all of them are in use.
+  //
+  Victim = NULL;
+  if (mPatternCacheCount >= REGEX_PATTERN_CACHE_MAX_ENTRIES) {
+    for (Link = GetPreviousNode (&mPatternCache, &mPatternCache); !IsNull (&mPatternCache, Link); Link = GetPreviousNode (&mPatternCache, Link)) {
+      if (REGEX_PATTERN_CACHE_ENTRY_FROM_LIST (Link)->RefCount == 0) {
+        Victim = REGEX_PATTERN_CACHE_ENTRY_FROM_LIST (Link);
+        RemoveEntryList (Link);
+        mPatternCacheCount--;
+        break;
+      }
+    }
+  }
+  InsertHeadList (&mPatternCache, &Entry->List);
+  mPatternCacheCount++;
+  gBS->RestoreTPL (OldTpl);
+
+  if (Victim != NULL) {
+    FreeCachedPattern (Victim);
+  }
+
+  *CachedPattern = Entry;
+  return EFI_SUCCESS;
+}
+
+/**
+  Unpin the cache entry returned by GetCachedPattern().
+
+  @param CachedPattern  The cache entry.
+
+**/
+STATIC
+VOID
+ReleaseCachedPattern (
+  IN  REGEX_PATTERN_CACHE_ENTRY  *CachedPattern
+  )
+{
+  EFI_TPL  OldTpl;
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  ASSERT (CachedPattern->RefCount > 0);
+  CachedPattern->RefCount--;
+  gBS->RestoreTPL (OldTpl);
+}
+
+/**
+  Call the Oniguruma regex match API. The compiled pattern is kept in the
+  pattern cache for the later matches with the same pattern.
+
+  Same parameters as RegularExpressionMatch, except SyntaxType is required.
+
+  @param String         A pointer to a NULL terminated string to match against the
+                        regular expression string specified by Pattern.
+
+  @param Pattern        A pointer to a NULL terminated string that represents the
+                        regular expression.
+  @param SyntaxType     A pointer to the EFI_REGEX_SYNTAX_TYPE that identifies the
+                        regular expression syntax type to use.
+
+  @param Result         On return, points to TRUE if String fully matches against
+                        the regular expression Pattern using the regular expression
+                        SyntaxType. Otherwise, points to FALSE.
+
+  @param Captures       A Pointer to an array of EFI_REGEX_CAPTURE objects to receive
+                        the captured groups in the event of a match. Same as
+                        RegularExpressionMatch.
+
+  @param CapturesCount  On output, CapturesCount is the number of matching patterns
+                        found in String. Zero means no matching patterns were found
+                        in the string.
+
+  @retval  EFI_SUCCESS       Regex compilation and match completed successfully.
+  @retval  EFI_DEVICE_ERROR  Regex compilation failed.
+
+**/
+STATIC
+EFI_STATUS
+OnigurumaMatch (
+  IN  CHAR16                *String,
+  IN  CHAR16                *Pattern,
+  IN  EFI_REGEX_SYNTAX_TYPE *SyntaxType,
+  OUT BOOLEAN               *Result,
+  OUT EFI_REGEX_CAPTURE     **Captures,     OPTIONAL
+  OUT UINTN                 *CapturesCount
+  )
+{
+  REGEX_PATTERN_CACHE_ENTRY  *CachedPattern;
+  EFI_STATUS                 Status;
+
+  Status = GetCachedPattern (Pattern, SyntaxType, &CachedPattern);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = OnigurumaSearch (CachedPattern->OnigRegex, String, Result, Captures, CapturesCount);
+  ReleaseCachedPattern (CachedPattern);
 
   return Status;
 }
@@ -322,8 +597,6 @@ RegularExpressionMatch (
   )
 {
   EFI_STATUS  Status;
-  UINT32      Index;
-  BOOLEAN     Supported;
 
   if (This == NULL || String == NULL || Pattern == NULL || Result == NULL || CapturesCount == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -332,19 +605,9 @@ RegularExpressionMatch (
   //
   // Figure out which syntax to use
   //
+  SyntaxType = GetSupportedSyntaxType (SyntaxType);
   if (SyntaxType == NULL) {
-    SyntaxType = mSupportedSyntaxes[0];
-  } else {
-    Supported = FALSE;
-    for (Index = 0; Index < ARRAY_SIZE (mSupportedSyntaxes); ++Index) {
-      if (CompareGuid (SyntaxType, mSupportedSyntaxes[Index])) {
-        Supported = TRUE;
-        break;
-      }
-    }
-    if (!Supported) {
-      return EFI_UNSUPPORTED;
-    }
+    return EFI_UNSUPPORTED;
   }
 
   Status = OnigurumaMatch (String, Pattern, SyntaxType, Result, Captures, CapturesCount);
@@ -352,6 +615,146 @@ RegularExpressionMatch (
   return Status;
 }
 
+/**
+  Compile the regular expression pattern.
+
+  @param This          A pointer to the EDKII_REGULAR_EXPRESSION_EX_PROTOCOL instance.
+  @param Pattern       A pointer to a NULL terminated string that represents the
+                       regular expression.
+  @param SyntaxType    A pointer to the EFI_REGEX_SYNTAX_TYPE that identifies the
+                       regular expression syntax type to use. May be NULL in which
+                       case the function will use its default regular expression
+                       syntax type.
+  @param Compiled      On return, the handle of compiled pattern.
+
+  @retval EFI_SUCCESS            The pattern is compiled.
+  @retval EFI_UNSUPPORTED        The regular expression syntax specified by
+                                 SyntaxType is not supported by this driver.
+  @retval EFI_DEVICE_ERROR       The regular expression compilation failed.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+  @retval EFI_INVALID_PARAMETER  Pattern or Compiled is NULL.
+
+**/
+EFI_STATUS
+EFIAPI
+RegularExpressionCompilePattern (
+  IN  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL  *This,
+  IN  CHAR16                                *Pattern,
+  IN  EFI_REGEX_SYNTAX_TYPE                 *SyntaxType, OPTIONAL
+  OUT EDKII_REGEX_COMPILED_PATTERN          *Compiled
+  )
+{
+  EFI_STATUS              Status;
+  REGEX_COMPILED_PATTERN  *CompiledPattern;
+
+  if (This == NULL || Pattern == NULL || Compiled == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  SyntaxType = GetSupportedSyntaxType (SyntaxType);
+  if (SyntaxType == NULL) {
+    return EFI_UNSUPPORTED;
+  }
+
+  CompiledPattern = AllocateZeroPool (sizeof (REGEX_COMPILED_PATTERN));
+  if (CompiledPattern == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = OnigurumaCompile (Pattern, SyntaxType, &CompiledPattern->OnigRegex);
+  if (EFI_ERROR (Status)) {
+    FreePool (CompiledPattern);
+    return Status;
+  }
+
+  CompiledPattern->Signature = REGEX_COMPILED_PATTERN_SIGNATURE;
+  *Compiled = (EDKII_REGEX_COMPILED_PATTERN)CompiledPattern;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Checks if the input string matches to the compiled regular expression pattern.
+
+  @param This          A pointer to the EDKII_REGULAR_EXPRESSION_EX_PROTOCOL instance.
+  @param Compiled      The compiled pattern returned by CompilePattern().
+  @param String        A pointer to a NULL terminated string to match against the
+                       compiled pattern.
+  @param Result        On return, points to TRUE if String fully matches against
+                       the compiled pattern. Otherwise, points to FALSE.
+  @param Captures      A Pointer to an array of EFI_REGEX_CAPTURE objects to receive
+                       the captured groups in the event of a match.
+  @param CapturesCount On output, CapturesCount is the number of matching patterns
+                       found in String.
+
+  @retval EFI_SUCCESS            The regular expression string matching
+                                 completed successfully.
+  @retval EFI_DEVICE_ERROR       The regular expression string matching
+                                 failed.
+  @retval EFI_INVALID_PARAMETER  Compiled, String, Result, or CapturesCount is
+                                 NULL or Compiled is not a valid handle.
+
+**/
+EFI_STATUS
+EFIAPI
+RegularExpressionMatchCompiled (
+  IN  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL  *This,
+  IN  EDKII_REGEX_COMPILED_PATTERN          Compiled,
+  IN  CHAR16                                *String,
+  OUT BOOLEAN                               *Result,
+  OUT EFI_REGEX_CAPTURE                     **Captures, OPTIONAL
+  OUT UINTN                                 *CapturesCount
+  )
+{
+  REGEX_COMPILED_PATTERN  *CompiledPattern;
+
+  if (This == NULL || Compiled == NULL || String == NULL || Result == NULL || CapturesCount == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  CompiledPattern = (REGEX_COMPILED_PATTERN *)Compiled;
+  if (CompiledPattern->Signature != REGEX_COMPILED_PATTERN_SIGNATURE) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  return OnigurumaSearch (CompiledPattern->OnigRegex, String, Result, Captures, CapturesCount);
+}
+
+/**
+  Free the compiled regular expression pattern.
+
+  @param This          A pointer to the EDKII_REGULAR_EXPRESSION_EX_PROTOCOL instance.
+  @param Compiled      The compiled pattern returned by CompilePattern().
+
+  @retval EFI_SUCCESS            The compiled pattern is freed.
+  @retval EFI_INVALID_PARAMETER  Compiled is NULL or not a valid handle.
+
+**/
+EFI_STATUS
+EFIAPI
+RegularExpressionFreePattern (
+  IN  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL  *This,
+  IN  EDKII_REGEX_COMPILED_PATTERN          Compiled
+  )
+{
+  REGEX_COMPILED_PATTERN  *CompiledPattern;
+
+  if (This == NULL || Compiled == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  CompiledPattern = (REGEX_COMPILED_PATTERN *)Compiled;
+  if (CompiledPattern->Signature != REGEX_COMPILED_PATTERN_SIGNATURE) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  onig_free (CompiledPattern->OnigRegex);
+  CompiledPattern->Signature = 0;
+  FreePool (CompiledPattern);
+
+  return EFI_SUCCESS;
+}
+
 /**
   Entry point for RegularExpressionDxe.
 
@@ -374,6 +777,8 @@ RegularExpressionDxeEntry (
                   &ImageHandle,
                   &gEfiRegularExpressionProtocolGuid,
                   &mProtocolInstance,
+                  &gEdkiiRegularExpressionExProtocolGuid,
+                  &mExProtocolInstance,
                   NULL
                   );
 
@@ -15,12 +15,44 @@
 
 #include <Uefi.h>
 #include <Protocol/RegularExpressionProtocol.h>
+#include <Protocol/RegularExpressionEx.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/DebugLib.h>
 #include <Library/BaseLib.h>
 
+//
+// Maximum number of compiled patterns kept for
+// EFI_REGULAR_EXPRESSION_PROTOCOL.MatchString().
+//
+#define REGEX_PATTERN_CACHE_MAX_ENTRIES  16
+
+//
+// Compiled pattern in the cache, the most recently used one is at the head
+// of the cache list. The entry is not dropped from the cache while RefCount
+// is not zero.
+//
+typedef struct {
+  LIST_ENTRY      List;
+  CHAR16          *Pattern;
+  EFI_GUID        SyntaxType;
+  regex_t         *OnigRegex;
+  UINTN           RefCount;
+} REGEX_PATTERN_CACHE_ENTRY;
+
+#define REGEX_PATTERN_CACHE_ENTRY_FROM_LIST(a)  BASE_CR (a, REGEX_PATTERN_CACHE_ENTRY, List)
+
+//
+// Compiled pattern handed out by EDKII_REGULAR_EXPRESSION_EX_PROTOCOL.
+//
+#define REGEX_COMPILED_PATTERN_SIGNATURE  SIGNATURE_32 ('R', 'E', 'G', 'X')
+
+typedef struct {
+  UINT32          Signature;
+  regex_t         *OnigRegex;
+} REGEX_COMPILED_PATTERN;
+
 /**
   Checks if the input string matches to the regular expression pattern.
 
@@ -122,4 +154,83 @@ RegularExpressionGetInfo (
   OUT    EFI_REGEX_SYNTAX_TYPE           *RegExSyntaxTypeList
   );
 
+/**
+  Compile the regular expression pattern.
+
+  @param This          A pointer to the EDKII_REGULAR_EXPRESSION_EX_PROTOCOL instance.
+  @param Pattern       A pointer to a NULL terminated string that represents the
+                       regular expression.
+  @param SyntaxType    A pointer to the EFI_REGEX_SYNTAX_TYPE that identifies the
+                       regular expression syntax type to use. May be NULL in which
+                       case the function will use its default regular expression
+                       syntax type.
+  @param Compiled      On return, the handle of compiled pattern.
+
+  @retval EFI_SUCCESS            The pattern is compiled.
+  @retval EFI_UNSUPPORTED        The regular expression syntax specified by
+                                 SyntaxType is not supported by this driver.
+  @retval EFI_DEVICE_ERROR       The regular expression compilation failed.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+  @retval EFI_INVALID_PARAMETER  Pattern or Compiled is NULL.
+
+**/
+EFI_STATUS
+EFIAPI
+RegularExpressionCompilePattern (
+  IN  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL  *This,
+  IN  CHAR16                                *Pattern,
+  IN  EFI_REGEX_SYNTAX_TYPE                 *SyntaxType, OPTIONAL
+  OUT EDKII_REGEX_COMPILED_PATTERN          *Compiled
+  );
+
+/**
+  Checks if the input string matches to the compiled regular expression pattern.
+
+  @param This          A pointer to the EDKII_REGULAR_EXPRESSION_EX_PROTOCOL instance.
+  @param Compiled      The compiled pattern returned by CompilePattern().
+  @param String        A pointer to a NULL terminated string to match against the
+                       compiled pattern.
+  @param Result        On return, points to TRUE if String fully matches against
+                       the compiled pattern. Otherwise, points to FALSE.
+  @param Captures      A Pointer to an array of EFI_REGEX_CAPTURE objects to receive
+                       the captured groups in the event of a match.
+  @param CapturesCount On output, CapturesCount is the number of matching patterns
+                       found in String.
+
+  @retval EFI_SUCCESS            The regular expression string matching
+                                 completed successfully.
+  @retval EFI_DEVICE_ERROR       The regular expression string matching
+                                 failed.
+  @retval EFI_INVALID_PARAMETER  Compiled, String, Result, or CapturesCount is
+                                 NULL or Compiled is not a valid handle.
+
+**/
+EFI_STATUS
+EFIAPI
+RegularExpressionMatchCompiled (
+  IN  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL  *This,
+  IN  EDKII_REGEX_COMPILED_PATTERN          Compiled,
+  IN  CHAR16                                *String,
+  OUT BOOLEAN                               *Result,
+  OUT EFI_REGEX_CAPTURE                     **Captures, OPTIONAL
+  OUT UINTN                                 *CapturesCount
+  );
+
+/**
+  Free the compiled regular expression pattern.
+
+  @param This          A pointer to the EDKII_REGULAR_EXPRESSION_EX_PROTOCOL instance.
+  @param Compiled      The compiled pattern returned by CompilePattern().
+
+  @retval EFI_SUCCESS            The compiled pattern is freed.
+  @retval EFI_INVALID_PARAMETER  Compiled is NULL or not a valid handle.
+
+**/
+EFI_STATUS
+EFIAPI
+RegularExpressionFreePattern (
+  IN  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL  *This,
+  IN  EDKII_REGEX_COMPILED_PATTERN          Compiled
+  );
+
 #endif
@@ -29,11 +29,11 @@
 // EFI Redfish Resource Type Identifier.
 //
 #include <RedfishJsonStructure/Bios/v1_0_9/EfiBiosV1_0_9.h>
-CHAR8 mResourceTypeStr [] = "#Bios";
-BOOLEAN IsRevisonController = TRUE;
+STATIC CHAR8 mResourceTypeStr [] = "#Bios";
+STATIC BOOLEAN IsRevisonController = TRUE;
 
 // Support Bios V1_0_9 
-EFI_REST_JSON_STRUCTURE_SUPPORTED ResourceInterP [] = {
+STATIC EFI_REST_JSON_STRUCTURE_SUPPORTED ResourceInterP [] = {
   {
     {
       (LIST_ENTRY *)&ResourceInterP[0], (LIST_ENTRY *)&ResourceInterP[0]
@@ -50,7 +50,7 @@ EFI_REST_JSON_STRUCTURE_SUPPORTED ResourceInterP [] = {
   }
 };
 
-EFI_REST_JSON_STRUCTURE_PROTOCOL *mRestJsonStructureProt = NULL;
+STATIC EFI_REST_JSON_STRUCTURE_PROTOCOL *mRestJsonStructureProt = NULL;
 
 /**
   This function gets the string of revision number.
@@ -63,6 +63,7 @@ EFI_REST_JSON_STRUCTURE_PROTOCOL *mRestJsonStructureProt = NULL;
   @retval 0    Number not found.
 
 **/
+STATIC
 UINTN
 GetOdataTypeVersionNum (CHAR8 *Str, UINTN *StrIndex, UINTN OdataTypeStrLen)
 {
@@ -89,57 +90,70 @@ GetOdataTypeVersionNum (CHAR8 *Str, UINTN *StrIndex, UINTN OdataTypeStrLen)
 }
 
 /**
-  This function checks if the given JSON property supported by this 
+  This function checks if the given JSON object supported by this 
   Redfish JSON to C structure convertor.
   
-  @param[in]    ResoruceRaw      Given JSON property.
+  @param[in]    JsonObj          Given JSON object.
    
-  @retval EFI_SUCCESS
-  @retval Others
+  @retval TRUE   Supported.
+  @retval FALSE  Not supported.
 
 **/
+STATIC
 BOOLEAN
-CheckSupportedSchema (IN CHAR8 *ResoruceRaw)
+CheckSupportedJsonSchema (IN json_t *JsonObj)
 {
   json_t *TempJsonObj;
-  json_t *JsonObjReturned;
   CHAR8 *TempChar;
   UINTN StrIndex;
   UINTN StrMajorIndex;
   UINTN StrMinorIndex;
   UINTN StrErrataIndex;
   UINTN OdataTypeStrLen;
+  BOOLEAN Supported;
 
-  JsonObjReturned = json_loads(ResoruceRaw, 0, NULL);
-  TempJsonObj = json_object_get(JsonObjReturned, "@odata.type");
+  TempJsonObj = json_object_get(JsonObj, "@odata.type");
   if (TempJsonObj == NULL) {
-    goto Error;
+    return FALSE;
   }
   TempChar = (CHAR8 *)json_string_value(TempJsonObj);
+  if (TempChar == NULL) {
+    return FALSE;
+  }
+  //
+  // Revision numbers are terminated in place, work on a copy
+  // to keep the given JSON object intact.
+  //
+  TempChar = AllocateCopyPool (AsciiStrSize (TempChar), TempChar);
+  if (TempChar == NULL) {
+    return FALSE;
+  }
+  Supported = FALSE;
   OdataTypeStrLen = AsciiStrLen(TempChar);
   //
   // Validate odata.type
   //
   if (OdataTypeStrLen < AsciiStrLen(mResourceTypeStr)) {
-    goto Error;
+    goto Exit;
   }
  
   if (CompareMem ((VOID *)TempChar, (VOID *)mResourceTypeStr, AsciiStrLen(mResourceTypeStr)) != 0) {
-    goto Error;
+    goto Exit;
   }
   StrIndex = AsciiStrLen(mResourceTypeStr);
   if (TempChar [StrIndex] != '.' ) {
-    goto Error;
+    goto Exit;
   }
   StrIndex ++;
   if (OdataTypeStrLen < StrIndex) {
-    goto Error;
+    goto Exit;
   }
   if (!IsRevisonController) {
     //
     // No revision controllerd.
     //
-    return TRUE;
+    Supported = TRUE;
+    goto Exit;
   }
   
   //
@@ -147,7 +161,7 @@ CheckSupportedSchema (IN CHAR8 *ResoruceRaw)
   //
   StrMajorIndex = GetOdataTypeVersionNum (TempChar, &StrIndex, OdataTypeStrLen);
   if (StrMajorIndex == 0) {
-    goto Error;
+    goto Exit;
   }
 
   //
@@ -155,24 +169,23 @@ CheckSupportedSchema (IN CHAR8 *ResoruceRaw)
   //
   StrMinorIndex = GetOdataTypeVersionNum (TempChar, &StrIndex, OdataTypeStrLen);
   if (StrMajorIndex == 0) {
-    goto Error;
+    goto Exit;
   }
   //
   // Check errata revision.
   //
   StrErrataIndex = GetOdataTypeVersionNum (TempChar, &StrIndex, OdataTypeStrLen);
   if (StrMajorIndex == 0) {
-    goto Error;
+    goto Exit;
   }
   if ((AsciiStrCmp(TempChar + StrMajorIndex, ResourceInterP[0].RestResourceInterp.NameSpace.MajorVersion) == 0) && 
       (AsciiStrCmp(TempChar + StrMinorIndex, ResourceInterP[0].RestResourceInterp.NameSpace.MinorVersion) == 0) &&
       (AsciiStrCmp(TempChar + StrErrataIndex, ResourceInterP[0].RestResourceInterp.NameSpace.ErrataVersion) == 0)) {
-    json_decref(JsonObjReturned);
-    return TRUE;
+    Supported = TRUE;
   }
-Error:;
-  json_decref(JsonObjReturned);
-  return FALSE;
+Exit:;
+  FreePool (TempChar);
+  return Supported;
 }
 
 /**
@@ -189,6 +202,7 @@ Error:;
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 BiosToStruct (
@@ -205,6 +219,7 @@ BiosToStruct (
   CHAR8 *ResourceTypeMajorVersion;
   CHAR8 *ResourceTypeMinorVersion;
   CHAR8 *ResourceTypeErrataVersion;
+  json_t *JsonObj;
   EFI_STATUS Status;
 
   if (ResoruceRaw == NULL || (RsrcIdentifier != NULL && RsrcIdentifier->NameSpace.ResourceTypeName == NULL)) {
@@ -217,9 +232,15 @@ BiosToStruct (
        RsrcIdentifier->NameSpace.ErrataVersion == NULL))
        ) {
     //
-    // Support revision determination.
+    // Support revision determination. The resource is parsed once here
+    // and the same JSON object is converted to C structure below.
     //
-    if (!CheckSupportedSchema (ResoruceRaw)) {
+    JsonObj = json_loads(ResoruceRaw, 0, NULL);
+    if (JsonObj == NULL) {
+      return EFI_UNSUPPORTED;
+    }
+    if (!CheckSupportedJsonSchema (JsonObj)) {
+      json_decref(JsonObj);
       return EFI_UNSUPPORTED;
     }
   } else if ((AsciiStrCmp (RsrcIdentifier->NameSpace.MajorVersion, "1") != 0) ||
@@ -227,9 +248,18 @@ BiosToStruct (
              (AsciiStrCmp (RsrcIdentifier->NameSpace.ErrataVersion, "9") != 0) ||
              (AsciiStrCmp (RsrcIdentifier->NameSpace.ResourceTypeName, "Bios") != 0)) {
     return EFI_UNSUPPORTED;
+  } else {
+    JsonObj = json_loads(ResoruceRaw, 0, NULL);
+    if (JsonObj == NULL) {
+      return EFI_INVALID_PARAMETER;
+    }
   }
 
-  Status = (EFI_STATUS)Json_Bios_V1_0_9_To_CS (ResoruceRaw, &BiosV1_0_9Cs);
+  //
+  // The C structure holds its own reference of JsonObj.
+  //
+  Status = (EFI_STATUS)JsonObj_Bios_V1_0_9_To_CS (JsonObj, &BiosV1_0_9Cs);
+  json_decref(JsonObj);
   if (EFI_ERROR (Status)){
     return Status;
   }
@@ -274,6 +304,7 @@ BiosToStruct (
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 BiosToStructWrapper (
@@ -305,6 +336,7 @@ BiosToStructWrapper (
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 BiosToJson(
@@ -329,6 +361,7 @@ BiosToJson(
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 BiosDestoryStruct(
@@ -354,6 +387,7 @@ BiosDestoryStruct(
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 BiosDestoryJson(
@@ -29,11 +29,11 @@
 // EFI Redfish Resource Type Identifier.
 //
 #include <RedfishJsonStructure/ComputerSystemCollection/EfiComputerSystemCollection.h>
-CHAR8 mResourceTypeStr [] = "#ComputerSystemCollection";
-BOOLEAN IsRevisonController = FALSE;
+STATIC CHAR8 mResourceTypeStr [] = "#ComputerSystemCollection";
+STATIC BOOLEAN IsRevisonController = FALSE;
 
 // Support ComputerSystemCollection  
-EFI_REST_JSON_STRUCTURE_SUPPORTED ResourceInterP [] = {
+STATIC EFI_REST_JSON_STRUCTURE_SUPPORTED ResourceInterP [] = {
   {
     {
       (LIST_ENTRY *)&ResourceInterP[0], (LIST_ENTRY *)&ResourceInterP[0]
@@ -50,7 +50,7 @@ EFI_REST_JSON_STRUCTURE_SUPPORTED ResourceInterP [] = {
   }
 };
 
-EFI_REST_JSON_STRUCTURE_PROTOCOL *mRestJsonStructureProt = NULL;
+STATIC EFI_REST_JSON_STRUCTURE_PROTOCOL *mRestJsonStructureProt = NULL;
 
 /**
   This function gets the string of revision number.
@@ -63,6 +63,7 @@ EFI_REST_JSON_STRUCTURE_PROTOCOL *mRestJsonStructureProt = NULL;
   @retval 0    Number not found.
 
 **/
+STATIC
 UINTN
 GetOdataTypeVersionNum (CHAR8 *Str, UINTN *StrIndex, UINTN OdataTypeStrLen)
 {
@@ -98,6 +99,7 @@ GetOdataTypeVersionNum (CHAR8 *Str, UINTN *StrIndex, UINTN OdataTypeStrLen)
   @retval Others
 
 **/
+STATIC
 BOOLEAN
 CheckSupportedSchema (IN CHAR8 *ResoruceRaw)
 {
@@ -189,6 +191,7 @@ Error:;
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 ComputerSystemCollectionToStruct (
@@ -274,6 +277,7 @@ ComputerSystemCollectionToStruct (
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 ComputerSystemCollectionToStructWrapper (
@@ -305,6 +309,7 @@ ComputerSystemCollectionToStructWrapper (
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 ComputerSystemCollectionToJson(
@@ -329,6 +334,7 @@ ComputerSystemCollectionToJson(
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 ComputerSystemCollectionDestoryStruct(
@@ -354,6 +360,7 @@ ComputerSystemCollectionDestoryStruct(
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 ComputerSystemCollectionDestoryJson(
@@ -29,11 +29,11 @@
 // EFI Redfish Resource Type Identifier.
 //
 #include <RedfishJsonStructure/MemoryCollection/EfiMemoryCollection.h>
-CHAR8 mResourceTypeStr [] = "#MemoryCollection";
-BOOLEAN IsRevisonController = FALSE;
+STATIC CHAR8 mResourceTypeStr [] = "#MemoryCollection";
+STATIC BOOLEAN IsRevisonController = FALSE;
 
 // Support MemoryCollection  
-EFI_REST_JSON_STRUCTURE_SUPPORTED ResourceInterP [] = {
+STATIC EFI_REST_JSON_STRUCTURE_SUPPORTED ResourceInterP [] = {
   {
     {
       (LIST_ENTRY *)&ResourceInterP[0], (LIST_ENTRY *)&ResourceInterP[0]
@@ -50,7 +50,7 @@ EFI_REST_JSON_STRUCTURE_SUPPORTED ResourceInterP [] = {
   }
 };
 
-EFI_REST_JSON_STRUCTURE_PROTOCOL *mRestJsonStructureProt = NULL;
+STATIC EFI_REST_JSON_STRUCTURE_PROTOCOL *mRestJsonStructureProt = NULL;
 
 /**
   This function gets the string of revision number.
@@ -63,6 +63,7 @@ EFI_REST_JSON_STRUCTURE_PROTOCOL *mRestJsonStructureProt = NULL;
   @retval 0    Number not found.
 
 **/
+STATIC
 UINTN
 GetOdataTypeVersionNum (CHAR8 *Str, UINTN *StrIndex, UINTN OdataTypeStrLen)
 {
@@ -98,6 +99,7 @@ GetOdataTypeVersionNum (CHAR8 *Str, UINTN *StrIndex, UINTN OdataTypeStrLen)
   @retval Others
 
 **/
+STATIC
 BOOLEAN
 CheckSupportedSchema (IN CHAR8 *ResoruceRaw)
 {
@@ -189,6 +191,7 @@ Error:;
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 MemoryCollectionToStruct (
@@ -274,6 +277,7 @@ MemoryCollectionToStruct (
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 MemoryCollectionToStructWrapper (
@@ -305,6 +309,7 @@ MemoryCollectionToStructWrapper (
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 MemoryCollectionToJson(
@@ -329,6 +334,7 @@ MemoryCollectionToJson(
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 MemoryCollectionDestoryStruct(
@@ -354,6 +360,7 @@ MemoryCollectionDestoryStruct(
   @retval Others
 
 **/
+STATIC
 EFI_STATUS
 EFIAPI
 MemoryCollectionDestoryJson(
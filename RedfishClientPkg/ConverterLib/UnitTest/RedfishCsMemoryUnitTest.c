@@ -0,0 +1,301 @@
+/** @file
+  Unit tests of the memory arena used by Redfish JSON C structure converter.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/UnitTestLib.h>
+
+#include "RedfishCsCommon.h"
+#include "RedfishCsMemoryInternal.h"
+
+#define UNIT_TEST_APP_NAME     "Redfish C Structure Memory Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+typedef struct {
+  RedfishCS_void    *Next;
+  RedfishCS_uint32  Value;
+} TEST_ARRAY_INSTANCE;
+
+/**
+  Blocks allocated from an arena are zeroed, aligned and do not overlap.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+AllocateFromArenaShouldSucceed (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  RedfishCS_void  *Root;
+  RedfishCS_char  *Block[64];
+  RedfishCS_uint32 Index;
+  RedfishCS_uint32 Size;
+
+  UT_ASSERT_EQUAL (allocateCsRootMemory (32, &Root), RedfishCS_status_success);
+  for (Index = 0; Index < 32; Index++) {
+    UT_ASSERT_EQUAL (((RedfishCS_char *)Root)[Index], 0);
+  }
+
+  for (Index = 0; Index < ARRAY_SIZE (Block); Index++) {
+    Size = Index * 13 + 1;
+    UT_ASSERT_EQUAL (allocateRecordCsMemory (Root, Size, (RedfishCS_void **)&Block[Index]), RedfishCS_status_success);
+    UT_ASSERT_EQUAL ((UINTN)Block[Index] % REDFISH_CS_MEMORY_ALIGNMENT, 0);
+    UT_ASSERT_EQUAL (Block[Index][0], 0);
+    UT_ASSERT_EQUAL (Block[Index][Size - 1], 0);
+    SetMem (Block[Index], Size, (UINT8)(Index + 1));
+  }
+
+  //
+  // Each block still holds its own pattern, no block is overwritten by the
+  // following one.
+  //
+  for (Index = 0; Index < ARRAY_SIZE (Block); Index++) {
+    Size = Index * 13 + 1;
+    UT_ASSERT_EQUAL (Block[Index][0], Index + 1);
+    UT_ASSERT_EQUAL (Block[Index][Size - 1], Index + 1);
+  }
+
+  UT_ASSERT_EQUAL (DestoryCsMemory (Root), RedfishCS_status_success);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  A block larger than the arena chunk gets a chunk of its own, the spare room
+  in the current chunk is still used afterward.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+AllocateOversizedBlockShouldSucceed (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  RedfishCS_void  *Root;
+  RedfishCS_char  *Small;
+  RedfishCS_char  *Large;
+  RedfishCS_char  *Next;
+
+  UT_ASSERT_EQUAL (allocateCsRootMemory (8, &Root), RedfishCS_status_success);
+  UT_ASSERT_EQUAL (allocateRecordCsMemory (Root, 16, (RedfishCS_void **)&Small), RedfishCS_status_success);
+  UT_ASSERT_EQUAL (allocateRecordCsMemory (Root, REDFISH_CS_MEMORY_CHUNK_SIZE * 3, (RedfishCS_void **)&Large), RedfishCS_status_success);
+  SetMem (Large, REDFISH_CS_MEMORY_CHUNK_SIZE * 3, 0xa5);
+  UT_ASSERT_EQUAL (allocateRecordCsMemory (Root, 16, (RedfishCS_void **)&Next), RedfishCS_status_success);
+  UT_ASSERT_TRUE (Next == Small + 16);
+  UT_ASSERT_EQUAL (Next[0], 0);
+
+  UT_ASSERT_EQUAL (DestoryCsMemory (Root), RedfishCS_status_success);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Array instances are carved from one block and chained in order.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+AllocateArrayShouldChainInstances (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  RedfishCS_void       *Root;
+  TEST_ARRAY_INSTANCE  *Instance;
+  RedfishCS_uint32     Count;
+
+  UT_ASSERT_EQUAL (allocateCsRootMemory (8, &Root), RedfishCS_status_success);
+  UT_ASSERT_EQUAL (
+    allocateArrayRecordCsMemory (Root, sizeof (TEST_ARRAY_INSTANCE), 100, (RedfishCS_void **)&Instance),
+    RedfishCS_status_success
+    );
+  Count = 0;
+  while (Instance != NULL) {
+    UT_ASSERT_EQUAL (Instance->Value, 0);
+    Instance->Value = Count;
+    Count++;
+    Instance = Instance->Next;
+  }
+  UT_ASSERT_EQUAL (Count, 100);
+
+  UT_ASSERT_EQUAL (
+    allocateArrayRecordCsMemory (Root, sizeof (RedfishCS_void *) - 1, 4, (RedfishCS_void **)&Instance),
+    RedfishCS_status_invalid_parameter
+    );
+
+  UT_ASSERT_EQUAL (DestoryCsMemory (Root), RedfishCS_status_success);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Only the pointers returned by allocateCsRootMemory() are accepted as the
+  root C structure. Pointers into a root, blocks of the arena, memory not
+  from the arena and destroyed roots are rejected.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+NonRootPointerShouldBeRejected (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  RedfishCS_void  *Root;
+  RedfishCS_void  *Block;
+  RedfishCS_void  *Dst;
+  RedfishCS_char  NotArena[1];
+
+  UT_ASSERT_EQUAL (allocateCsRootMemory (64, &Root), RedfishCS_status_success);
+  UT_ASSERT_EQUAL (allocateRecordCsMemory (Root, 8, &Block), RedfishCS_status_success);
+
+  UT_ASSERT_EQUAL (allocateRecordCsMemory (NULL, 8, &Dst), RedfishCS_status_invalid_parameter);
+  UT_ASSERT_EQUAL (allocateRecordCsMemory (NotArena, 8, &Dst), RedfishCS_status_invalid_parameter);
+  UT_ASSERT_EQUAL (allocateRecordCsMemory ((RedfishCS_char *)Root + 8, 8, &Dst), RedfishCS_status_invalid_parameter);
+  UT_ASSERT_EQUAL (allocateRecordCsMemory (Block, 8, &Dst), RedfishCS_status_invalid_parameter);
+  UT_ASSERT_EQUAL (DestoryCsMemory (Block), RedfishCS_status_invalid_parameter);
+  UT_ASSERT_EQUAL (DestoryCsMemory (NotArena), RedfishCS_status_invalid_parameter);
+
+  UT_ASSERT_EQUAL (DestoryCsMemory (Root), RedfishCS_status_success);
+  UT_ASSERT_EQUAL (allocateRecordCsMemory (Root, 8, &Dst), RedfishCS_status_invalid_parameter);
+  UT_ASSERT_EQUAL (DestoryCsMemory (Root), RedfishCS_status_invalid_parameter);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Arenas of different roots are independent, destroying one root leaves the
+  others usable.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+MultipleRootsShouldBeIndependent (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  RedfishCS_void   *Root[4];
+  RedfishCS_uint32 *Block[4];
+  RedfishCS_uint32 Index;
+
+  for (Index = 0; Index < ARRAY_SIZE (Root); Index++) {
+    UT_ASSERT_EQUAL (allocateCsRootMemory (16, &Root[Index]), RedfishCS_status_success);
+  }
+  //
+  // Interleave the allocations so the last used arena changes every time.
+  //
+  for (Index = 0; Index < ARRAY_SIZE (Root); Index++) {
+    UT_ASSERT_EQUAL (allocateRecordCsMemory (Root[Index], sizeof (RedfishCS_uint32), (RedfishCS_void **)&Block[Index]), RedfishCS_status_success);
+    *Block[Index] = Index;
+  }
+  UT_ASSERT_EQUAL (DestoryCsMemory (Root[1]), RedfishCS_status_success);
+  UT_ASSERT_EQUAL (DestoryCsMemory (Root[3]), RedfishCS_status_success);
+  UT_ASSERT_EQUAL (*Block[0], 0);
+  UT_ASSERT_EQUAL (*Block[2], 2);
+  UT_ASSERT_EQUAL (allocateRecordCsMemory (Root[0], 8, (RedfishCS_void **)&Block[1]), RedfishCS_status_success);
+  UT_ASSERT_EQUAL (allocateRecordCsMemory (Root[2], 8, (RedfishCS_void **)&Block[3]), RedfishCS_status_success);
+  UT_ASSERT_EQUAL (DestoryCsMemory (Root[0]), RedfishCS_status_success);
+  UT_ASSERT_EQUAL (DestoryCsMemory (Root[2]), RedfishCS_status_success);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  converter memory arena and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      ArenaTests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  Status = CreateUnitTestSuite (&ArenaTests, Framework, "Redfish C Structure Memory Arena Tests", "RedfishCsMemory.Arena", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for Redfish C Structure Memory Arena Tests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite--------Description------------------------Name-----------Function----------------------------Pre---Post---Context
+  //
+  AddTestCase (ArenaTests, "Allocate blocks from arena",        "Allocate",    AllocateFromArenaShouldSucceed,      NULL, NULL, NULL);
+  AddTestCase (ArenaTests, "Allocate block larger than chunk",  "Oversized",   AllocateOversizedBlockShouldSucceed, NULL, NULL, NULL);
+  AddTestCase (ArenaTests, "Allocate chained array instances",  "Array",       AllocateArrayShouldChainInstances,   NULL, NULL, NULL);
+  AddTestCase (ArenaTests, "Reject pointer which is not root",  "NonRoot",     NonRootPointerShouldBeRejected,      NULL, NULL, NULL);
+  AddTestCase (ArenaTests, "Independent arenas of roots",       "MultiRoot",   MultipleRootsShouldBeIndependent,    NULL, NULL, NULL);
+
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+///
+/// Avoid ECC error for function name that starts with lower case letter
+///
+#define RedfishCsMemoryUnitTestMain  main
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+
+  @param[in] Argc  Number of arguments
+  @param[in] Argv  Array of pointers to arguments
+
+  @retval 0      Success
+  @retval other  Error
+**/
+INT32
+RedfishCsMemoryUnitTestMain (
+  IN INT32  Argc,
+  IN CHAR8  *Argv[]
+  )
+{
+  UnitTestingEntry ();
+  return 0;
+}
@@ -23,6 +23,9 @@ typedef RedfishBios_V1_0_9_Bios_CS EFI_REDFISH_BIOS_V1_0_9_CS;
 RedfishCS_status
 Json_Bios_V1_0_9_To_CS (RedfishCS_char *JsonRawText, EFI_REDFISH_BIOS_V1_0_9_CS **ReturnedCs);
 
+RedfishCS_status
+JsonObj_Bios_V1_0_9_To_CS (json_t *JsonPayload, EFI_REDFISH_BIOS_V1_0_9_CS **ReturnedCs);
+
 RedfishCS_status
 CS_To_Bios_V1_0_9_JSON (EFI_REDFISH_BIOS_V1_0_9_CS *CSPtr, RedfishCS_char **JsonText);
 
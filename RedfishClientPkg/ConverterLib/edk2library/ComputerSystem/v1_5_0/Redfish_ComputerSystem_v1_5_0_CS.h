@@ -23,6 +23,9 @@ typedef RedfishComputerSystem_V1_5_0_ComputerSystem_CS EFI_REDFISH_COMPUTERSYSTE
 RedfishCS_status
 Json_ComputerSystem_V1_5_0_To_CS (RedfishCS_char *JsonRawText, EFI_REDFISH_COMPUTERSYSTEM_V1_5_0_CS **ReturnedCs);
 
+RedfishCS_status
+JsonObj_ComputerSystem_V1_5_0_To_CS (json_t *JsonPayload, EFI_REDFISH_COMPUTERSYSTEM_V1_5_0_CS **ReturnedCs);
+
 RedfishCS_status
 CS_To_ComputerSystem_V1_5_0_JSON (EFI_REDFISH_COMPUTERSYSTEM_V1_5_0_CS *CSPtr, RedfishCS_char **JsonText);
 
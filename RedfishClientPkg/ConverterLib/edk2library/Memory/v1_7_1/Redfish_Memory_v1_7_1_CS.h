@@ -23,6 +23,9 @@ typedef RedfishMemory_V1_7_1_Memory_CS EFI_REDFISH_MEMORY_V1_7_1_CS;
 RedfishCS_status
 Json_Memory_V1_7_1_To_CS (RedfishCS_char *JsonRawText, EFI_REDFISH_MEMORY_V1_7_1_CS **ReturnedCs);
 
+RedfishCS_status
+JsonObj_Memory_V1_7_1_To_CS (json_t *JsonPayload, EFI_REDFISH_MEMORY_V1_7_1_CS **ReturnedCs);
+
 RedfishCS_status
 CS_To_Memory_V1_7_1_JSON (EFI_REDFISH_MEMORY_V1_7_1_CS *CSPtr, RedfishCS_char **JsonText);
 
@@ -23,7 +23,7 @@ RedfishCS_Link * GetPreviousLink ( const RedfishCS_Link *List, const RedfishCS_L
 RedfishCS_Link *RemoveLink ( const RedfishCS_Link *Link);
 RedfishCS_bool IsLinkEmpty (const RedfishCS_Link *LinkHead);
 RedfishCS_bool IsLinkAtEnd (const RedfishCS_Link *LinkHead, const RedfishCS_Link *ThisLink);
-RedfishCS_status recordCsRootMemory (void *memCs);
+RedfishCS_status allocateCsRootMemory (RedfishCS_uint32 size, RedfishCS_void **memCs);
 RedfishCS_status allocateRecordCsMemory (RedfishCS_void *rootCs, RedfishCS_uint32 size, RedfishCS_void **Dst);
 RedfishCS_status allocateRecordCsZeroMemory (RedfishCS_void *rootCs, RedfishCS_uint32 size, RedfishCS_void **Dst);
 RedfishCS_status allocateArrayRecordCsMemory(RedfishCS_void *rootCs, RedfishCS_uint32 ArrayInstanceSize, RedfishCS_uint64 ArraySize, RedfishCS_void **Dst);
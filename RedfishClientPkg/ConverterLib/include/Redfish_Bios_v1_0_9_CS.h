@@ -109,6 +109,9 @@ typedef struct _RedfishBios_V1_0_9_Bios_CS {
 RedfishCS_status
 Json_Bios_V1_0_9_To_CS (char *JsonRawText, RedfishBios_V1_0_9_Bios_CS **ReturnedCS);
 
+RedfishCS_status
+JsonObj_Bios_V1_0_9_To_CS (json_t *JsonPayload, RedfishBios_V1_0_9_Bios_CS **ReturnedCS);
+
 RedfishCS_status
 CS_To_Bios_V1_0_9_JSON (RedfishBios_V1_0_9_Bios_CS *CSPtr, char **JsonText);
 
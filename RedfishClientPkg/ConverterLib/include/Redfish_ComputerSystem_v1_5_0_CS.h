@@ -471,6 +471,9 @@ typedef struct _RedfishResource_Condition_Array_CS  {
 RedfishCS_status
 Json_ComputerSystem_V1_5_0_To_CS (char *JsonRawText, RedfishComputerSystem_V1_5_0_ComputerSystem_CS **ReturnedCS);
 
+RedfishCS_status
+JsonObj_ComputerSystem_V1_5_0_To_CS (json_t *JsonPayload, RedfishComputerSystem_V1_5_0_ComputerSystem_CS **ReturnedCS);
+
 RedfishCS_status
 CS_To_ComputerSystem_V1_5_0_JSON (RedfishComputerSystem_V1_5_0_ComputerSystem_CS *CSPtr, char **JsonText);
 
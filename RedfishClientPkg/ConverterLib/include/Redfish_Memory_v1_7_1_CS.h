@@ -397,6 +397,9 @@ typedef struct _RedfishMemory_V1_7_1_RegionSet_Array_CS  {
 RedfishCS_status
 Json_Memory_V1_7_1_To_CS (char *JsonRawText, RedfishMemory_V1_7_1_Memory_CS **ReturnedCS);
 
+RedfishCS_status
+JsonObj_Memory_V1_7_1_To_CS (json_t *JsonPayload, RedfishMemory_V1_7_1_Memory_CS **ReturnedCS);
+
 RedfishCS_status
 CS_To_Memory_V1_7_1_JSON (RedfishMemory_V1_7_1_Memory_CS *CSPtr, char **JsonText);
 
@@ -20,6 +20,7 @@ RedfishCS_status CreateCsJsonByNode (RedfishCS_void *Cs, json_t *JsonOj, Redfish
 RedfishCS_status CreateCsUriOrJsonByNode (RedfishCS_void *Cs, json_t *JsonObj, RedfishCS_char *NodeName, RedfishCS_char *ParentUri, RedfishCS_Link *LinkHead);
 RedfishCS_status CreateCsUriOrJsonByNodeArray (RedfishCS_void *Cs, json_t *JsonObj, RedfishCS_char *NodeName, RedfishCS_char *ParentUri, RedfishCS_Link *LinkHead);
 RedfishCS_status CreateJsonPayloadAndCs (char *JsonRawText, char *ResourceType, char *ResourceVersion, char *TypeName, json_t **JsonObjReturned, void **Cs, int size);
+RedfishCS_status CreateCsFromJsonPayload (json_t *JsonObj, char *ResourceType, char *ResourceVersion, char *TypeName, json_t **JsonObjReturned, void **Cs, int size);
 RedfishCS_status GetRedfishPropertyStr (RedfishCS_void *Cs, json_t *JsonObj, char *Key, RedfishCS_char **DstBuffer);
 RedfishCS_status GetRedfishPropertyBoolean (RedfishCS_void *Cs, json_t *JsonObj, char *Key, RedfishCS_bool **DstBuffer);
 RedfishCS_status GetRedfishPropertyVague (RedfishCS_void *Cs, json_t *JsonObj, char *Key, RedfishCS_Vague **DstBuffer);
@@ -480,16 +481,16 @@ RedfishCS_status DestroyBios_V1_0_9_Json(RedfishCS_char *JsonText)
 }
 
 //
-//Generate C structure for Bios.V1_0_9.Bios
+//Generate C structure for Bios.V1_0_9.Bios from JSON object
 //
 RedfishCS_status
-Json_Bios_V1_0_9_To_CS(RedfishCS_char *JsonRawText, RedfishBios_V1_0_9_Bios_CS **ReturnedCs)
+JsonObj_Bios_V1_0_9_To_CS(json_t *JsonPayload, RedfishBios_V1_0_9_Bios_CS **ReturnedCs)
 {
   RedfishCS_status  Status;
   json_t *JsonObj;
   RedfishBios_V1_0_9_Bios_CS *Cs;
 
-  Status = CreateJsonPayloadAndCs (JsonRawText, "Bios", "v1_0_9", "Bios", &JsonObj, (RedfishCS_void **)&Cs, sizeof (RedfishBios_V1_0_9_Bios_CS));
+  Status = CreateCsFromJsonPayload (JsonPayload, "Bios", "v1_0_9", "Bios", &JsonObj, (RedfishCS_void **)&Cs, sizeof (RedfishBios_V1_0_9_Bios_CS));
   if (Status != RedfishCS_status_success) {
     goto Error;
   }
@@ -557,3 +558,24 @@ Error:;
   DestroyBios_V1_0_9_CS (Cs);
   return Status;
 }
+
+//
+//Generate C structure for Bios.V1_0_9.Bios
+//
+RedfishCS_status
+Json_Bios_V1_0_9_To_CS(RedfishCS_char *JsonRawText, RedfishBios_V1_0_9_Bios_CS **ReturnedCs)
+{
+  RedfishCS_status  Status;
+  json_t *JsonObj;
+
+  if (JsonRawText == NULL) {
+    return RedfishCS_status_invalid_parameter;
+  }
+  JsonObj = json_loads(JsonRawText, 0, NULL);
+  if (JsonObj == NULL) {
+    return RedfishCS_status_unknown_error;
+  }
+  Status = JsonObj_Bios_V1_0_9_To_CS (JsonObj, ReturnedCs);
+  json_decref(JsonObj);
+  return Status;
+}
@@ -20,6 +20,7 @@ RedfishCS_status CreateCsJsonByNode (RedfishCS_void *Cs, json_t *JsonOj, Redfish
 RedfishCS_status CreateCsUriOrJsonByNode (RedfishCS_void *Cs, json_t *JsonObj, RedfishCS_char *NodeName, RedfishCS_char *ParentUri, RedfishCS_Link *LinkHead);
 RedfishCS_status CreateCsUriOrJsonByNodeArray (RedfishCS_void *Cs, json_t *JsonObj, RedfishCS_char *NodeName, RedfishCS_char *ParentUri, RedfishCS_Link *LinkHead);
 RedfishCS_status CreateJsonPayloadAndCs (char *JsonRawText, char *ResourceType, char *ResourceVersion, char *TypeName, json_t **JsonObjReturned, void **Cs, int size);
+RedfishCS_status CreateCsFromJsonPayload (json_t *JsonObj, char *ResourceType, char *ResourceVersion, char *TypeName, json_t **JsonObjReturned, void **Cs, int size);
 RedfishCS_status GetRedfishPropertyStr (RedfishCS_void *Cs, json_t *JsonObj, char *Key, RedfishCS_char **DstBuffer);
 RedfishCS_status GetRedfishPropertyBoolean (RedfishCS_void *Cs, json_t *JsonObj, char *Key, RedfishCS_bool **DstBuffer);
 RedfishCS_status GetRedfishPropertyVague (RedfishCS_void *Cs, json_t *JsonObj, char *Key, RedfishCS_Vague **DstBuffer);
@@ -2339,16 +2340,16 @@ RedfishCS_status DestroyComputerSystem_V1_5_0_Json(RedfishCS_char *JsonText)
 }
 
 //
-//Generate C structure for ComputerSystem.V1_5_0.ComputerSystem
+//Generate C structure for ComputerSystem.V1_5_0.ComputerSystem from JSON object
 //
 RedfishCS_status
-Json_ComputerSystem_V1_5_0_To_CS(RedfishCS_char *JsonRawText, RedfishComputerSystem_V1_5_0_ComputerSystem_CS **ReturnedCs)
+JsonObj_ComputerSystem_V1_5_0_To_CS(json_t *JsonPayload, RedfishComputerSystem_V1_5_0_ComputerSystem_CS **ReturnedCs)
 {
   RedfishCS_status  Status;
   json_t *JsonObj;
   RedfishComputerSystem_V1_5_0_ComputerSystem_CS *Cs;
 
-  Status = CreateJsonPayloadAndCs (JsonRawText, "ComputerSystem", "v1_5_0", "ComputerSystem", &JsonObj, (RedfishCS_void **)&Cs, sizeof (RedfishComputerSystem_V1_5_0_ComputerSystem_CS));
+  Status = CreateCsFromJsonPayload (JsonPayload, "ComputerSystem", "v1_5_0", "ComputerSystem", &JsonObj, (RedfishCS_void **)&Cs, sizeof (RedfishComputerSystem_V1_5_0_ComputerSystem_CS));
   if (Status != RedfishCS_status_success) {
     goto Error;
   }
@@ -2604,3 +2605,24 @@ Error:;
   DestroyComputerSystem_V1_5_0_CS (Cs);
   return Status;
 }
+
+//
+//Generate C structure for ComputerSystem.V1_5_0.ComputerSystem
+//
+RedfishCS_status
+Json_ComputerSystem_V1_5_0_To_CS(RedfishCS_char *JsonRawText, RedfishComputerSystem_V1_5_0_ComputerSystem_CS **ReturnedCs)
+{
+  RedfishCS_status  Status;
+  json_t *JsonObj;
+
+  if (JsonRawText == NULL) {
+    return RedfishCS_status_invalid_parameter;
+  }
+  JsonObj = json_loads(JsonRawText, 0, NULL);
+  if (JsonObj == NULL) {
+    return RedfishCS_status_unknown_error;
+  }
+  Status = JsonObj_ComputerSystem_V1_5_0_To_CS (JsonObj, ReturnedCs);
+  json_decref(JsonObj);
+  return Status;
+}
@@ -20,6 +20,7 @@ RedfishCS_status CreateCsJsonByNode (RedfishCS_void *Cs, json_t *JsonOj, Redfish
 RedfishCS_status CreateCsUriOrJsonByNode (RedfishCS_void *Cs, json_t *JsonObj, RedfishCS_char *NodeName, RedfishCS_char *ParentUri, RedfishCS_Link *LinkHead);
 RedfishCS_status CreateCsUriOrJsonByNodeArray (RedfishCS_void *Cs, json_t *JsonObj, RedfishCS_char *NodeName, RedfishCS_char *ParentUri, RedfishCS_Link *LinkHead);
 RedfishCS_status CreateJsonPayloadAndCs (char *JsonRawText, char *ResourceType, char *ResourceVersion, char *TypeName, json_t **JsonObjReturned, void **Cs, int size);
+RedfishCS_status CreateCsFromJsonPayload (json_t *JsonObj, char *ResourceType, char *ResourceVersion, char *TypeName, json_t **JsonObjReturned, void **Cs, int size);
 RedfishCS_status GetRedfishPropertyStr (RedfishCS_void *Cs, json_t *JsonObj, char *Key, RedfishCS_char **DstBuffer);
 RedfishCS_status GetRedfishPropertyBoolean (RedfishCS_void *Cs, json_t *JsonObj, char *Key, RedfishCS_bool **DstBuffer);
 RedfishCS_status GetRedfishPropertyVague (RedfishCS_void *Cs, json_t *JsonObj, char *Key, RedfishCS_Vague **DstBuffer);
@@ -1649,16 +1650,16 @@ RedfishCS_status DestroyMemory_V1_7_1_Json(RedfishCS_char *JsonText)
 }
 
 //
-//Generate C structure for Memory.V1_7_1.Memory
+//Generate C structure for Memory.V1_7_1.Memory from JSON object
 //
 RedfishCS_status
-Json_Memory_V1_7_1_To_CS(RedfishCS_char *JsonRawText, RedfishMemory_V1_7_1_Memory_CS **ReturnedCs)
+JsonObj_Memory_V1_7_1_To_CS(json_t *JsonPayload, RedfishMemory_V1_7_1_Memory_CS **ReturnedCs)
 {
   RedfishCS_status  Status;
   json_t *JsonObj;
   RedfishMemory_V1_7_1_Memory_CS *Cs;
 
-  Status = CreateJsonPayloadAndCs (JsonRawText, "Memory", "v1_7_1", "Memory", &JsonObj, (RedfishCS_void **)&Cs, sizeof (RedfishMemory_V1_7_1_Memory_CS));
+  Status = CreateCsFromJsonPayload (JsonPayload, "Memory", "v1_7_1", "Memory", &JsonObj, (RedfishCS_void **)&Cs, sizeof (RedfishMemory_V1_7_1_Memory_CS));
   if (Status != RedfishCS_status_success) {
     goto Error;
   }
@@ -1989,3 +1990,24 @@ Error:;
   DestroyMemory_V1_7_1_CS (Cs);
   return Status;
 }
+
+//
+//Generate C structure for Memory.V1_7_1.Memory
+//
+RedfishCS_status
+Json_Memory_V1_7_1_To_CS(RedfishCS_char *JsonRawText, RedfishMemory_V1_7_1_Memory_CS **ReturnedCs)
+{
+  RedfishCS_status  Status;
+  json_t *JsonObj;
+
+  if (JsonRawText == NULL) {
+    return RedfishCS_status_invalid_parameter;
+  }
+  JsonObj = json_loads(JsonRawText, 0, NULL);
+  if (JsonObj == NULL) {
+    return RedfishCS_status_unknown_error;
+  }
+  Status = JsonObj_Memory_V1_7_1_To_CS (JsonObj, ReturnedCs);
+  json_decref(JsonObj);
+  return Status;
+}
@@ -585,9 +585,12 @@ CreateCsUriOrJsonByNodeArray (void *Cs, json_t *JsonObj, RedfishCS_char *NodeNam
   return RedfishCS_status_success;
 }
 /**
-  This function creates JSON object and CS.
+  This function creates CS for the JSON object which is already
+  parsed. The reference count of JsonObj is increased and JsonObj
+  is returned in JsonObjReturned, caller releases it by json_decref
+  the same as the one returned from CreateJsonPayloadAndCs.
 
-  JsonRawText     JSON raw text.
+  JsonObj         JSON object.
   ResourceType    The Redfish resource type.
   ResourceVersion The Redfish resource version.
   TypeName        The Redfish type name.
@@ -599,25 +602,24 @@ CreateCsUriOrJsonByNodeArray (void *Cs, json_t *JsonObj, RedfishCS_char *NodeNam
 
 **/
 RedfishCS_status
-CreateJsonPayloadAndCs (char *JsonRawText, char *ResourceType, char *ResourceVersion, char *TypeName, json_t **JsonObjReturned, void **Cs, int size)
+CreateCsFromJsonPayload (json_t *JsonObj, char *ResourceType, char *ResourceVersion, char *TypeName, json_t **JsonObjReturned, void **Cs, int size)
 {
   json_t *TempJsonObj;
   RedfishCS_char *TempChar;
   RedfishCS_Header *Header;
   void *TempCS;
+  RedfishCS_status Status;
 
-  if (JsonRawText == NULL ||
+  if (JsonObj == NULL ||
       ResourceType == NULL ||
       TypeName == NULL ||
+      JsonObjReturned == NULL ||
       Cs == NULL ||
       size == 0
       ) {
     return RedfishCS_status_invalid_parameter;
   }
-  *JsonObjReturned = json_loads(JsonRawText, 0, NULL);
-  if (*JsonObjReturned == NULL) {
-    return RedfishCS_status_unknown_error;
-  }
+  *JsonObjReturned = json_incref (JsonObj);
   TempJsonObj = json_object_get(*JsonObjReturned, "@odata.type");
   if (TempJsonObj == NULL) {
     return RedfishCS_status_invalid_parameter;
@@ -626,17 +628,51 @@ CreateJsonPayloadAndCs (char *JsonRawText, char *ResourceType, char *ResourceVer
   if (TempChar == NULL || ! SupportedRedfishResource (TempChar, ResourceType, ResourceVersion, TypeName)) {
     return RedfishCS_status_unsupported;
   }
-  TempCS = malloc (size);
-  if (TempCS == NULL) {
-    return RedfishCS_status_insufficient_memory;
+  Status = allocateCsRootMemory ((RedfishCS_uint32)size, &TempCS);
+  if (Status != RedfishCS_status_success) {
+    return Status;
   }
-  memset (TempCS, 0, size);
   Header = (RedfishCS_Header *)TempCS;
   Header->ResourceType = RedfishCS_Type_CS;
   Header->KeyName = NULL;
   InitializeLinkHead (&Header->LinkEntry);
   *Cs = TempCS;
-  return recordCsRootMemory (TempCS);
+  return RedfishCS_status_success;
+}
+/**
+  This function creates JSON object and CS.
+
+  JsonRawText     JSON raw text.
+  ResourceType    The Redfish resource type.
+  ResourceVersion The Redfish resource version.
+  TypeName        The Redfish type name.
+  JsonObjReturned Pointer to retrieve JSON object.
+  Cs              Pointer to retrieve CS.
+  size            The size of CS.
+
+  Return RedfishCS_status.
+
+**/
+RedfishCS_status
+CreateJsonPayloadAndCs (char *JsonRawText, char *ResourceType, char *ResourceVersion, char *TypeName, json_t **JsonObjReturned, void **Cs, int size)
+{
+  json_t *TempJsonObj;
+  RedfishCS_status Status;
+
+  if (JsonRawText == NULL || JsonObjReturned == NULL) {
+    return RedfishCS_status_invalid_parameter;
+  }
+  *JsonObjReturned = NULL;
+  TempJsonObj = json_loads(JsonRawText, 0, NULL);
+  if (TempJsonObj == NULL) {
+    return RedfishCS_status_unknown_error;
+  }
+  Status = CreateCsFromJsonPayload (TempJsonObj, ResourceType, ResourceVersion, TypeName, JsonObjReturned, Cs, size);
+  //
+  // Drop the reference of json_loads, the one in JsonObjReturned is kept.
+  //
+  json_decref (TempJsonObj);
+  return Status;
 }
 /**
   This function returns a Redfish string property.
@@ -771,8 +807,7 @@ RedfishCS_status GetRedfishPropertyVague (void *Cs, json_t *JsonObj, char *Key,
     VagueData->DataType = RedfishCS_Vague_DataType_Bool;
     Status = GetRedfishPropertyBoolean (Cs, JsonObj, Key, &VagueData->DataValue.BoolPtr);
   } else if (json_is_null(TempJsonObj)) {
-    *DstBuffer = NULL; // No value for this key
-    free (VagueData);
+    *DstBuffer = NULL; // No value for this key, VagueData is released with CS.
     return RedfishCS_status_success;
   } else {
     return RedfishCS_status_unsupported;
@@ -13,33 +13,115 @@
 #include <stdlib.h>
 #include <string.h>
 
-RedfishCS_Link CsMemRoot = {&CsMemRoot, &CsMemRoot};
+static RedfishCS_Internal_memory_root *CsMemRoots = NULL;
 
+//
+// The arena used last. Converter allocates for the same root C Structure
+// repeatedly, so the list is rarely walked.
+//
+static RedfishCS_Internal_memory_root *lastCsMemRoot = NULL;
+
+/**
+  This function returns the arena which belongs to the
+  root C Structure instance. Only the pointer value of
+  rootCs is compared, the memory rootCs points to is not
+  accessed.
+
+  rootCs          C Structure instance.
+
+  Return pointer to arena, NULL if rootCs is not a root
+  C Structure instance.
+
+**/
+static RedfishCS_Internal_memory_root *getCsMemoryRoot (RedfishCS_void *rootCs)
+{
+  RedfishCS_Internal_memory_root *memRoot;
+
+  if (rootCs == NULL) {
+    return NULL;
+  }
+  if (lastCsMemRoot != NULL && REDFISH_CS_MEMORY_ROOT_CS (lastCsMemRoot) == rootCs) {
+    return lastCsMemRoot;
+  }
+  for (memRoot = CsMemRoots; memRoot != NULL; memRoot = memRoot->nextRoot) {
+    if (REDFISH_CS_MEMORY_ROOT_CS (memRoot) == rootCs) {
+      lastCsMemRoot = memRoot;
+      return memRoot;
+    }
+  }
+  return NULL;
+}
 /**
-  This function records the memory allocation to
-  the C Structure instance that owns the memory block.
+  This function adds a new chunk to the arena.
+
+  memRoot         The arena.
+  size            The minimum usable size of the new chunk.
+
+  Return pointer to new chunk, NULL if out of resource.
+
+**/
+static RedfishCS_Internal_memory_chunk *newCsMemoryChunk (RedfishCS_Internal_memory_root *memRoot, RedfishCS_uint64 size)
+{
+  RedfishCS_Internal_memory_chunk *memChunk;
+  RedfishCS_uint64 chunkSize;
+
+  chunkSize = REDFISH_CS_MEMORY_CHUNK_SIZE - REDFISH_CS_MEMORY_CHUNK_HEADER_SIZE;
+  if (size > chunkSize) {
+    chunkSize = size;
+  }
+  memChunk = malloc ((size_t)(REDFISH_CS_MEMORY_CHUNK_HEADER_SIZE + chunkSize));
+  if (memChunk == NULL) {
+    return NULL;
+  }
+  memChunk->size = chunkSize;
+  memChunk->used = 0;
+  if (memRoot->memChunks != NULL && size > REDFISH_CS_MEMORY_CHUNK_SIZE - REDFISH_CS_MEMORY_CHUNK_HEADER_SIZE) {
+    //
+    // Oversized block gets a chunk of its own. Keep it behind the current
+    // chunk so the spare room in current chunk is still used.
+    //
+    memChunk->nextChunk = memRoot->memChunks->nextChunk;
+    memRoot->memChunks->nextChunk = memChunk;
+  } else {
+    memChunk->nextChunk = memRoot->memChunks;
+    memRoot->memChunks = memChunk;
+  }
+  return memChunk;
+}
+/**
+  This function allocates the root C Structure instance
+  together with the arena that owns all of its memory
+  blocks.
+
+  size           The size of C Structure instance.
+  memCs          Pointer to retrieve the C Structure instance.
 
-  memCs          C Structure instance.
   Return RedfishCS_status
 
 **/
-RedfishCS_status recordCsRootMemory (void *memCs)
+RedfishCS_status allocateCsRootMemory (RedfishCS_uint32 size, RedfishCS_void **memCs)
 {
   RedfishCS_Internal_memory_root *memRoot;
 
-  memRoot = malloc (sizeof(RedfishCS_Internal_memory_root));
+  if (memCs == NULL || size == 0) {
+    return RedfishCS_status_invalid_parameter;
+  }
+  memRoot = malloc ((size_t)(REDFISH_CS_MEMORY_ROOT_HEADER_SIZE + size));
   if (memRoot == NULL) {
     return RedfishCS_status_insufficient_memory;
   }
-  InitializeLinkHead (&memRoot->nextRoot);
-  InitializeLinkHead (&memRoot->memBlocks);
-  memRoot->CsPtr = memCs;
-  InsertTailLink (&CsMemRoot, &memRoot->nextRoot);
+  memset (memRoot, 0, (size_t)(REDFISH_CS_MEMORY_ROOT_HEADER_SIZE + size));
+  memRoot->memChunks = NULL;
+  memRoot->nextRoot = CsMemRoots;
+  CsMemRoots = memRoot;
+  lastCsMemRoot = memRoot;
+  *memCs = REDFISH_CS_MEMORY_ROOT_CS (memRoot);
   return RedfishCS_status_success;
 }
 /**
-  This function allocates and records the memory allocation
-  to the C Structure instance that owns the memory block.
+  This function allocates the memory block from the arena
+  of the C Structure instance that owns the memory block.
+  The memory block is zeroed out.
 
   rootCs          C Structure instance.
   size            The size to allocate.
@@ -51,38 +133,25 @@ RedfishCS_status recordCsRootMemory (void *memCs)
 RedfishCS_status allocateRecordCsMemory (RedfishCS_void *rootCs, RedfishCS_uint32 size, RedfishCS_void **Dst)
 {
   RedfishCS_Internal_memory_root *memRoot;
-  RedfishCS_Internal_memory_link *memLink;
+  RedfishCS_Internal_memory_chunk *memChunk;
+  RedfishCS_uint64 alignedSize;
 
-  if (IsLinkEmpty (&CsMemRoot)) {
+  memRoot = getCsMemoryRoot (rootCs);
+  if (memRoot == NULL || Dst == NULL) {
     return RedfishCS_status_invalid_parameter;
   }
-  memRoot = (RedfishCS_Internal_memory_root *)GetFirstLink (&CsMemRoot);
-  while (RedfishCS_boolean_true){
-    if (memRoot->CsPtr == rootCs) {
-      // Allocation memory and record it.
-      memLink = malloc (sizeof(RedfishCS_Internal_memory_link));
-      if (memLink == NULL) {
-        return RedfishCS_status_insufficient_memory;
-      }
-      *Dst = malloc (size);
-      if (*Dst == NULL) {
-        free (memLink);
-        return RedfishCS_status_insufficient_memory;
-      }
-      memset (*Dst, 0, size);
-      memset (memLink, 0, sizeof(RedfishCS_Internal_memory_link));
-      InitializeLinkHead (&memLink->nextLink);
-      memLink->memoryPtr = *Dst;
-      InsertTailLink (&memRoot->memBlocks, &memLink->nextLink);
-      return RedfishCS_status_success;
-    }
-    if (IsLinkAtEnd (&CsMemRoot, (RedfishCS_Link *)&memRoot->nextRoot)) {
-      break;
+  alignedSize = REDFISH_CS_MEMORY_ALIGN ((RedfishCS_uint64)size);
+  memChunk = memRoot->memChunks;
+  if (memChunk == NULL || memChunk->size - memChunk->used < alignedSize) {
+    memChunk = newCsMemoryChunk (memRoot, alignedSize);
+    if (memChunk == NULL) {
+      return RedfishCS_status_insufficient_memory;
     }
-    memRoot = (RedfishCS_Internal_memory_root *)GetNextLink (&CsMemRoot, &memRoot->nextRoot);
-  };
-
-  return RedfishCS_status_invalid_parameter;
+  }
+  *Dst = (RedfishCS_char *)memChunk + REDFISH_CS_MEMORY_CHUNK_HEADER_SIZE + memChunk->used;
+  memChunk->used += alignedSize;
+  memset (*Dst, 0, size);
+  return RedfishCS_status_success;
 }
 /**
   This function allocates, records and zero out the memory
@@ -97,14 +166,10 @@ RedfishCS_status allocateRecordCsMemory (RedfishCS_void *rootCs, RedfishCS_uint3
 **/
 RedfishCS_status allocateRecordCsZeroMemory (RedfishCS_void *rootCs, RedfishCS_uint32 size, RedfishCS_void **Dst)
 {
-  RedfishCS_status Status;
-
-  Status = allocateRecordCsMemory (rootCs, size, Dst);
-  if (Status != RedfishCS_status_success || *Dst == NULL) {
-    return Status;
-  }
-  memset (*Dst, 0, size);
-  return RedfishCS_status_success;
+  //
+  // Memory blocks from arena are always zeroed out.
+  //
+  return allocateRecordCsMemory (rootCs, size, Dst);
 }
 /**
   This function destroies all memory allocations belong
@@ -118,38 +183,30 @@ RedfishCS_status allocateRecordCsZeroMemory (RedfishCS_void *rootCs, RedfishCS_u
 RedfishCS_status DestoryCsMemory (RedfishCS_void *rootCs)
 {
   RedfishCS_Internal_memory_root *memRoot;
-  RedfishCS_Internal_memory_link *memLink;
+  RedfishCS_Internal_memory_root **prevRoot;
+  RedfishCS_Internal_memory_chunk *memChunk;
+  RedfishCS_Internal_memory_chunk *nextChunk;
 
-  if (IsLinkEmpty (&CsMemRoot)) {
+  memRoot = getCsMemoryRoot (rootCs);
+  if (memRoot == NULL) {
     return RedfishCS_status_invalid_parameter;
   }
-  memRoot = (RedfishCS_Internal_memory_root *)GetFirstLink (&CsMemRoot);
-  while (RedfishCS_boolean_true){
-    if (memRoot->CsPtr == rootCs) {
-      if (IsLinkEmpty (&memRoot->memBlocks)) {
-        return RedfishCS_status_success;
-      }
-      while (RedfishCS_boolean_true) {
-        memLink = (RedfishCS_Internal_memory_link *)GetLastLink(&memRoot->memBlocks);
-        if (memLink->memoryPtr != NULL) {
-          free (memLink->memoryPtr);
-          RemoveLink (&memLink->nextLink);
-          free (memLink);
-        }
-        if (IsLinkEmpty (&memRoot->memBlocks)) {
-          RemoveLink (&memRoot->nextRoot);
-          free (memRoot);
-          free (rootCs);
-          return RedfishCS_status_success;
-        }
-      }
-    }
-    if (IsLinkAtEnd (&CsMemRoot, (RedfishCS_Link *)&memRoot->nextRoot)) {
-      break;
-    }
-    memRoot = (RedfishCS_Internal_memory_root *)GetNextLink (&CsMemRoot, &memRoot->nextRoot);
-  };
-  return RedfishCS_status_invalid_parameter;
+  prevRoot = &CsMemRoots;
+  while (*prevRoot != memRoot) {
+    prevRoot = &(*prevRoot)->nextRoot;
+  }
+  *prevRoot = memRoot->nextRoot;
+  memChunk = memRoot->memChunks;
+  while (memChunk != NULL) {
+    nextChunk = memChunk->nextChunk;
+    free (memChunk);
+    memChunk = nextChunk;
+  }
+  if (lastCsMemRoot == memRoot) {
+    lastCsMemRoot = NULL;
+  }
+  free (memRoot);
+  return RedfishCS_status_success;
 }
 
 /**
@@ -167,31 +224,32 @@ RedfishCS_status DestoryCsMemory (RedfishCS_void *rootCs)
 **/
 RedfishCS_status allocateArrayRecordCsMemory(RedfishCS_void *rootCs, RedfishCS_uint32 ArrayInstanceSize, RedfishCS_uint64 ArraySize, RedfishCS_void **Dst)
 {
-  RedfishCS_uint16 Index;
-  RedfishCS_void *ArrayInstance;
-  RedfishCS_void *PreArrayInstance;
+  RedfishCS_uint64 Index;
+  RedfishCS_uint64 InstanceSize;
+  RedfishCS_char *ArrayInstance;
   RedfishCS_status Status;
-  RedfishCS_uint16 SizeOfVoid;
 
-  for (Index = 0; Index < ArraySize; Index ++) {
-    Status = allocateRecordCsMemory(rootCs, ArrayInstanceSize, &ArrayInstance);
-    if (Status != RedfishCS_status_success) {
-      return Status;
-    }
-    memset (ArrayInstance, 0, ArrayInstanceSize);
-    if (Index == 0) {
-      *Dst = ArrayInstance;
-    } else {
-      SizeOfVoid = sizeof (RedfishCS_void *);
-      if (SizeOfVoid == sizeof (RedfishCS_uint32)) {
-        *((RedfishCS_uint32 *)PreArrayInstance) = (RedfishCS_uint32)(unsigned long long)ArrayInstance; // Next link.
-      } else if (SizeOfVoid == sizeof (RedfishCS_uint64)){
-        *((RedfishCS_uint64 *)PreArrayInstance) = (RedfishCS_uint64)ArrayInstance; // Next link.
-      } else {
-        return RedfishCS_status_invalid_parameter;
-      }
-    }
-    PreArrayInstance = ArrayInstance;
+  if (ArraySize == 0) {
+    return RedfishCS_status_success;
+  }
+  if (ArrayInstanceSize < sizeof (RedfishCS_void *)) {
+    return RedfishCS_status_invalid_parameter;
+  }
+  //
+  // All the array instances are carved out of one memory block,
+  // then chained through the next link in the head of each instance.
+  //
+  InstanceSize = REDFISH_CS_MEMORY_ALIGN ((RedfishCS_uint64)ArrayInstanceSize);
+  if (ArraySize > 0xffffffffULL / InstanceSize) {
+    return RedfishCS_status_insufficient_memory;
+  }
+  Status = allocateRecordCsMemory(rootCs, (RedfishCS_uint32)(InstanceSize * ArraySize), (RedfishCS_void **)&ArrayInstance);
+  if (Status != RedfishCS_status_success) {
+    return Status;
+  }
+  for (Index = 0; Index < ArraySize - 1; Index ++) {
+    *((RedfishCS_void **)(ArrayInstance + Index * InstanceSize)) = ArrayInstance + (Index + 1) * InstanceSize; // Next link.
   }
+  *Dst = ArrayInstance;
   return RedfishCS_status_success;
 }
@@ -24,17 +24,29 @@ RedfishCS_Link *RemoveLink ( const RedfishCS_Link *Link);
 RedfishCS_bool IsLinkEmpty (const RedfishCS_Link *LinkHead);
 RedfishCS_bool IsLinkAtEnd (const RedfishCS_Link *LinkHead, const RedfishCS_Link *ThisLink);
 
-typedef struct _RedfishCS_Internal_memory_link {
-  RedfishCS_Link nextLink;
-  void           *memoryPtr;
-} RedfishCS_Internal_memory_link;
+//
+// Memory owned by a root C Structure is carved out of an arena. The arena
+// header lives right in front of the root C Structure in the same block.
+// Arenas are recorded in a list, a C Structure pointer is only treated as
+// a root when it is found in the list.
+//
+#define REDFISH_CS_MEMORY_CHUNK_SIZE       4096
+#define REDFISH_CS_MEMORY_ALIGNMENT        8
+#define REDFISH_CS_MEMORY_ALIGN(Size)      (((Size) + (REDFISH_CS_MEMORY_ALIGNMENT - 1)) & ~((RedfishCS_uint64)REDFISH_CS_MEMORY_ALIGNMENT - 1))
+
+typedef struct _RedfishCS_Internal_memory_chunk {
+  struct _RedfishCS_Internal_memory_chunk *nextChunk;
+  RedfishCS_uint64                        size;   // Usable bytes in this chunk.
+  RedfishCS_uint64                        used;   // Bytes handed out so far.
+} RedfishCS_Internal_memory_chunk;
 
 typedef struct _RedfishCS_Internal_memory_root {
-  RedfishCS_Link  nextRoot;
-  RedfishCS_Link  memBlocks;
-  void            *CsPtr;
+  struct _RedfishCS_Internal_memory_root *nextRoot;
+  RedfishCS_Internal_memory_chunk        *memChunks;    // Current chunk is at the head.
 } RedfishCS_Internal_memory_root;
 
-#endif
-
+#define REDFISH_CS_MEMORY_CHUNK_HEADER_SIZE  REDFISH_CS_MEMORY_ALIGN (sizeof (RedfishCS_Internal_memory_chunk))
+#define REDFISH_CS_MEMORY_ROOT_HEADER_SIZE   REDFISH_CS_MEMORY_ALIGN (sizeof (RedfishCS_Internal_memory_root))
+#define REDFISH_CS_MEMORY_ROOT_CS(memRoot)   ((RedfishCS_char *)(memRoot) + REDFISH_CS_MEMORY_ROOT_HEADER_SIZE)
 
+#endif
@@ -17,7 +17,7 @@ REDFISH_RESOURCE_COMMON_PRIVATE *mRedfishResourcePrivate = NULL;
   Consume resource from given URI.
 
   @param[in]   This                Pointer to REDFISH_RESOURCE_COMMON_PRIVATE instance.
-  @param[in]   Json                The JSON to consume.
+  @param[in]   JsonValue           The JSON value to consume.
   @param[in]   HeaderEtag          The Etag string returned in HTTP header.
 
   @retval EFI_SUCCESS              Value is returned successfully.
@@ -27,7 +27,7 @@ REDFISH_RESOURCE_COMMON_PRIVATE *mRedfishResourcePrivate = NULL;
 EFI_STATUS
 RedfishConsumeResourceCommon (
   IN  REDFISH_RESOURCE_COMMON_PRIVATE *Private,
-  IN  CHAR8                           *Json,
+  IN  EDKII_JSON_VALUE                JsonValue,
   IN  CHAR8                           *HeaderEtag OPTIONAL
   )
 {
@@ -38,7 +38,7 @@ RedfishConsumeResourceCommon (
   RedfishCS_Type_EmptyProp_CS_Data   *EmptyPropCs;
 
 
-  if (Private == NULL || IS_EMPTY_STRING (Json)) {
+  if (Private == NULL || JsonValue == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
@@ -46,12 +46,11 @@ RedfishConsumeResourceCommon (
   BiosCs = NULL;
   ConfigureLang = NULL;
 
-  Status = Private->JsonStructProtocol->ToStructure (
-                                          Private->JsonStructProtocol,
-                                          NULL,
-                                          Json,
-                                          (EFI_REST_JSON_STRUCTURE_HEADER **)&Bios
-                                          );
+  Status = JsonValueToJsonStructure (
+             Private->JsonStructProtocol,
+             JsonValue,
+             (EFI_REST_JSON_STRUCTURE_HEADER **)&Bios
+             );
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a, ToStructure() failed: %r\n", __FUNCTION__, Status));
     return Status;
@@ -682,7 +681,7 @@ HandleResource (
   // Check and see if this is target resource that we want to handle.
   // Some resource is handled by other provider so we have to make sure this first.
   //
-  DEBUG ((REDFISH_DEBUG_TRACE, "%s Identify for %s\n", __FUNCTION__, Uri));
+  DEBUG ((REDFISH_DEBUG_TRACE, "%a Identify for %s\n", __FUNCTION__, Uri));
   ConfigLang = RedfishGetConfigLanguage (Uri);
   if (ConfigLang == NULL) {
     Status = EdkIIRedfishResourceConfigIdentify (&SchemaInfo, Uri, Private->InformationExchange);
@@ -147,8 +147,20 @@ RedfishResourceConsumeResource (
     //
     RedfishSettingsUri = JsonValueGetUnicodeString (JsonValue);
 
-    Status = GetResourceByUri (Private->RedfishService, RedfishSettingsUri, &RedfishSettingsResponse);
-    if (EFI_ERROR (Status)) {
+    //
+    // Pending settings are consumed only when they are changed since last consume.
+    //
+    Status = GetResourceByUriIfNoneMatch (Private->RedfishService, RedfishSettingsUri, &RedfishSettingsResponse);
+    if (Status == EFI_ALREADY_STARTED) {
+      DEBUG ((DEBUG_INFO, "%a, ETAG: %s has no change, ignore consume action\n", __FUNCTION__, RedfishSettingsUri));
+      RedfishFreeResponse (
+        Response.StatusCode,
+        Response.HeaderCount,
+        Response.Headers,
+        Response.Payload
+        );
+      return Status;
+    } else if (EFI_ERROR (Status)) {
       DEBUG ((DEBUG_ERROR, "%a, @Redfish.Settings exists, get resource from: %s failed\n", __FUNCTION__, RedfishSettingsUri));
     } else {
       Uri              = RedfishSettingsUri;
@@ -160,9 +172,6 @@ RedfishResourceConsumeResource (
   Private->Payload = ExpectedResponse->Payload;
   ASSERT (Private->Payload != NULL);
 
-  Private->Json = JsonDumpString (RedfishJsonInPayload (Private->Payload), EDKII_JSON_COMPACT);
-  ASSERT (Private->Json != NULL);
-
   //
   // Find etag in HTTP response header
   //
@@ -172,7 +181,7 @@ RedfishResourceConsumeResource (
     DEBUG ((DEBUG_ERROR, "%a, failed to get ETag from HTTP header\n", __FUNCTION__));
   }
 
-  Status = RedfishConsumeResourceCommon (Private, Private->Json, Etag);
+  Status = RedfishConsumeResourceCommon (Private, RedfishJsonInPayload (Private->Payload), Etag);
   if (EFI_ERROR (Status)) {
     if (Status != EFI_ALREADY_STARTED) {
       DEBUG ((DEBUG_ERROR, "%a, failed to consume resource from: %s: %r\n", __FUNCTION__, Uri, Status));
@@ -497,7 +506,7 @@ RedfishResourceInit (
 
   Private = REDFISH_RESOURCE_COMMON_PRIVATE_DATA_FROM_CONFIG_PROTOCOL (This);
 
-  Private->RedfishService = RedfishCreateService (RedfishConfigServiceInfo);
+  Private->RedfishService = RedfishAcquireSharedService (RedfishConfigServiceInfo);
   if (Private->RedfishService == NULL) {
     return EFI_DEVICE_ERROR;
   }
@@ -530,7 +539,7 @@ RedfishResourceStop (
   }
 
   if (Private->RedfishService != NULL) {
-    RedfishCleanupService (Private->RedfishService);
+    RedfishReleaseSharedService (Private->RedfishService);
     Private->RedfishService = NULL;
   }
 
@@ -670,8 +679,9 @@ RedfishExternalResourceResourceFeatureCallback (
   REDFISH_SERVICE                  RedfishService;
   REDFISH_RESOURCE_COMMON_PRIVATE  *Private;
   EFI_STRING                       ResourceUri;
+  EFI_STRING                       PrefetchUri;
 
-  if (FeatureAction != CallbackActionStartOperation) {
+  if (FeatureAction != CallbackActionStartOperation && FeatureAction != CallbackActionPrefetch) {
     return EFI_UNSUPPORTED;
   }
 
@@ -682,11 +692,6 @@ RedfishExternalResourceResourceFeatureCallback (
     return EFI_NOT_READY;
   }
 
-  //
-  // Save in private structure.
-  //
-  Private->InformationExchange = InformationExchange;
-
   //
   // Find Redfish version on BMC
   //
@@ -704,6 +709,26 @@ RedfishExternalResourceResourceFeatureCallback (
   StrCatS (ResourceUri, MAX_URI_LENGTH, Private->RedfishVersion);
   StrCatS (ResourceUri, MAX_URI_LENGTH, InformationExchange->SendInformation.FullUri);
 
+  if (FeatureAction == CallbackActionPrefetch) {
+    //
+    // Only start reading the resource, CallbackActionStartOperation follows.
+    //
+    PrefetchUri = RedfishGetUri (ResourceUri);
+    FreePool (ResourceUri);
+    if (PrefetchUri == NULL) {
+      return EFI_NOT_FOUND;
+    }
+
+    Status = PrefetchResourceByUri (RedfishService, PrefetchUri, FALSE);
+    FreePool (PrefetchUri);
+    return Status;
+  }
+
+  //
+  // Save in private structure.
+  //
+  Private->InformationExchange = InformationExchange;
+
   //
   // Initialize collection path
   //
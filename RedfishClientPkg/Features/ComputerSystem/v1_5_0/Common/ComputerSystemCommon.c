@@ -17,7 +17,7 @@ REDFISH_RESOURCE_COMMON_PRIVATE *mRedfishResourcePrivate = NULL;
   Consume resource from given URI.
 
   @param[in]   This                Pointer to REDFISH_RESOURCE_COMMON_PRIVATE instance.
-  @param[in]   Json                The JSON to consume.
+  @param[in]   JsonValue           The JSON value to consume.
   @param[in]   HeaderEtag          The Etag string returned in HTTP header.
 
   @retval EFI_SUCCESS              Value is returned successfully.
@@ -27,7 +27,7 @@ REDFISH_RESOURCE_COMMON_PRIVATE *mRedfishResourcePrivate = NULL;
 EFI_STATUS
 RedfishConsumeResourceCommon (
   IN  REDFISH_RESOURCE_COMMON_PRIVATE *Private,
-  IN  CHAR8                           *Json,
+  IN  EDKII_JSON_VALUE                JsonValue,
   IN  CHAR8                           *HeaderEtag OPTIONAL
   )
 {
@@ -37,7 +37,7 @@ RedfishConsumeResourceCommon (
   EFI_STRING                   ConfigureLang;
 
 
-  if (Private == NULL || IS_EMPTY_STRING (Json)) {
+  if (Private == NULL || JsonValue == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
@@ -45,12 +45,11 @@ RedfishConsumeResourceCommon (
   ComputerSystemCs = NULL;
   ConfigureLang = NULL;
 
-  Status = Private->JsonStructProtocol->ToStructure (
-                                          Private->JsonStructProtocol,
-                                          NULL,
-                                          Json,
-                                          (EFI_REST_JSON_STRUCTURE_HEADER **)&ComputerSystem
-                                          );
+  Status = JsonValueToJsonStructure (
+             Private->JsonStructProtocol,
+             JsonValue,
+             (EFI_REST_JSON_STRUCTURE_HEADER **)&ComputerSystem
+             );
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a, ToStructure() failed: %r\n", __FUNCTION__, Status));
     return Status;
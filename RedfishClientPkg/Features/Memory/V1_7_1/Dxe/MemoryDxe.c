@@ -107,8 +107,14 @@ RedfishResourceConsumeResource (
     return EFI_NOT_READY;
   }
 
-  Status = GetResourceByUri (Private->RedfishService, Uri, &Response);
-  if (EFI_ERROR (Status)) {
+  //
+  // Ask for the resource only when it is changed since last consume.
+  //
+  Status = GetResourceByUriIfNoneMatch (Private->RedfishService, Uri, &Response);
+  if (Status == EFI_ALREADY_STARTED) {
+    DEBUG ((DEBUG_INFO, "%a, ETAG: %s has no change, ignore consume action\n", __FUNCTION__, Uri));
+    return Status;
+  } else if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a, get resource from: %s failed\n", __FUNCTION__, Uri));
     return Status;
   }
@@ -117,9 +123,6 @@ RedfishResourceConsumeResource (
   Private->Payload = Response.Payload;
   ASSERT (Private->Payload != NULL);
 
-  Private->Json = JsonDumpString (RedfishJsonInPayload (Private->Payload), EDKII_JSON_COMPACT);
-  ASSERT (Private->Json != NULL);
-
   //
   // Find etag in HTTP response header
   //
@@ -129,7 +132,7 @@ RedfishResourceConsumeResource (
     DEBUG ((DEBUG_ERROR, "%a, failed to get ETag from HTTP header\n", __FUNCTION__));
   }
 
-  Status = RedfishConsumeResourceCommon (Private, Private->Json, Etag);
+  Status = RedfishConsumeResourceCommon (Private, RedfishJsonInPayload (Private->Payload), Etag);
   if (EFI_ERROR (Status)) {
     if (Status != EFI_ALREADY_STARTED) {
       DEBUG ((DEBUG_ERROR, "%a, failed to consume resource from: %s: %r\n", __FUNCTION__, Uri, Status));
@@ -442,7 +445,7 @@ RedfishResourceInit (
 
   Private = REDFISH_RESOURCE_COMMON_PRIVATE_DATA_FROM_CONFIG_PROTOCOL (This);
 
-  Private->RedfishService = RedfishCreateService (RedfishConfigServiceInfo);
+  Private->RedfishService = RedfishAcquireSharedService (RedfishConfigServiceInfo);
   if (Private->RedfishService == NULL) {
     return EFI_DEVICE_ERROR;
   }
@@ -475,7 +478,7 @@ RedfishResourceStop (
   }
 
   if (Private->RedfishService != NULL) {
-    RedfishCleanupService (Private->RedfishService);
+    RedfishReleaseSharedService (Private->RedfishService);
     Private->RedfishService = NULL;
   }
 
@@ -121,6 +121,90 @@ HandleResource (
   return Status;
 }
 
+/**
+  Start getting all collection members at once, so the member resources are
+  in flight on the connection at the same time instead of one round trip
+  after another. The responses are kept in the HTTP cache of RedfishLib for
+  the following HandleResource() calls.
+
+  @param[in]  Private   Pointer to private data.
+  @param[in]  Members   The member list of the collection.
+
+**/
+VOID
+PrefetchCollectionMembers (
+  IN  REDFISH_COLLECTION_PRIVATE  *Private,
+  IN  RedfishCS_Link              *Members
+  )
+{
+  EFI_STATUS                              Status;
+  RedfishCS_Link                          *List;
+  RedfishCS_Header                        *Header;
+  REDFISH_ASYNC_REQUEST                   *Requests;
+  UINTN                                   Count;
+  UINTN                                   Index;
+
+  Count = 0;
+  List = GetFirstLink (Members);
+  while (TRUE) {
+    Header = (RedfishCS_Header *)List;
+    if (Header->ResourceType == RedfishCS_Type_Uri) {
+      Count++;
+    }
+
+    if (IsLinkAtEnd (Members, List)) {
+      break;
+    }
+
+    List = GetNextLink (Members, List);
+  }
+
+  if (Count < 2) {
+    return;
+  }
+
+  Requests = AllocateZeroPool (sizeof (REDFISH_ASYNC_REQUEST) * Count);
+  if (Requests == NULL) {
+    return;
+  }
+
+  Index = 0;
+  List = GetFirstLink (Members);
+  while (Index < Count) {
+    Header = (RedfishCS_Header *)List;
+    if (Header->ResourceType == RedfishCS_Type_Uri) {
+      Status = RedfishGetByUriAsync (Private->RedfishService, ((RedfishCS_Type_Uri_Data *)Header)->Uri, &Requests[Index]);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_ERROR, "%a, prefetch %a failed: %r\n", __FUNCTION__, ((RedfishCS_Type_Uri_Data *)Header)->Uri, Status));
+        Requests[Index].Status = Status;
+      }
+
+      Index++;
+    }
+
+    if (IsLinkAtEnd (Members, List)) {
+      break;
+    }
+
+    List = GetNextLink (Members, List);
+  }
+
+  RedfishWaitAsyncRequests (Private->RedfishService, Count, Requests);
+
+  for (Index = 0; Index < Count; Index++) {
+    if (Requests[Index].Status == EFI_SUCCESS) {
+      RedfishFreeResponse (
+        Requests[Index].Response.StatusCode,
+        Requests[Index].Response.HeaderCount,
+        Requests[Index].Response.Headers,
+        Requests[Index].Response.Payload
+        );
+    }
+  }
+
+  FreePool (Requests);
+}
+
 EFI_STATUS
 HandleCollectionResource (
   IN  REDFISH_COLLECTION_PRIVATE  *Private
@@ -168,6 +252,8 @@ HandleCollectionResource (
     return EFI_NOT_FOUND;
   }
 
+  PrefetchCollectionMembers (Private, &CollectionCs->Members);
+
   List = GetFirstLink (&CollectionCs->Members);
   while (TRUE) {
 
@@ -285,9 +371,10 @@ CollectionHandler (
   DEBUG ((REDFISH_DEBUG_TRACE, "%a, collection handler for %s\n", __FUNCTION__, Private->CollectionUri));
 
   //
-  // Query collection from Redfish service.
+  // Query collection from Redfish service. The members come along when
+  // the service supports $expand.
   //
-  Status = GetResourceByUri (Private->RedfishService, Private->CollectionUri, &Private->RedResponse);
+  Status = GetCollectionByUri (Private->RedfishService, Private->CollectionUri, &Private->RedResponse);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a, unable to get resource from: %s :%r\n", __FUNCTION__, Private->CollectionUri, Status));
     goto ON_RELEASE;
@@ -340,8 +427,9 @@ RedfishCollectionFeatureCallback (
   REDFISH_SERVICE              RedfishService;
   REDFISH_COLLECTION_PRIVATE   *Private;
   EFI_STRING                   ResourceUri;
+  EFI_STRING                   PrefetchUri;
 
-  if (FeatureAction != CallbackActionStartOperation) {
+  if (FeatureAction != CallbackActionStartOperation && FeatureAction != CallbackActionPrefetch) {
     return EFI_UNSUPPORTED;
   }
 
@@ -352,11 +440,6 @@ RedfishCollectionFeatureCallback (
     return EFI_NOT_READY;
   }
 
-  //
-  // Save in private structure.
-  //
-  Private->InformationExchange = InformationExchange;
-
   //
   // Find Redfish version on BMC
   //
@@ -373,6 +456,26 @@ RedfishCollectionFeatureCallback (
   StrCatS (ResourceUri, MAX_URI_LENGTH, Private->RedfishVersion);
   StrCatS (ResourceUri, MAX_URI_LENGTH, InformationExchange->SendInformation.FullUri);
 
+  if (FeatureAction == CallbackActionPrefetch) {
+    //
+    // Only start reading the resource, CallbackActionStartOperation follows.
+    //
+    PrefetchUri = RedfishGetUri (ResourceUri);
+    FreePool (ResourceUri);
+    if (PrefetchUri == NULL) {
+      return EFI_NOT_FOUND;
+    }
+
+    Status = PrefetchResourceByUri (RedfishService, PrefetchUri, TRUE);
+    FreePool (PrefetchUri);
+    return Status;
+  }
+
+  //
+  // Save in private structure.
+  //
+  Private->InformationExchange = InformationExchange;
+
   //
   // Initialize collection path
   //
@@ -416,7 +519,7 @@ RedfishCollectionInit (
 
   Private = REDFISH_COLLECTION_PRIVATE_DATA_FROM_PROTOCOL (This);
 
-  Private->RedfishService = RedfishCreateService (RedfishConfigServiceInfo);
+  Private->RedfishService = RedfishAcquireSharedService (RedfishConfigServiceInfo);
   if (Private->RedfishService == NULL) {
     return EFI_DEVICE_ERROR;
   }
@@ -444,7 +547,7 @@ RedfishCollectionStop (
   Private = REDFISH_COLLECTION_PRIVATE_DATA_FROM_PROTOCOL (This);
 
   if (Private->RedfishService != NULL) {
-    RedfishCleanupService (Private->RedfishService);
+    RedfishReleaseSharedService (Private->RedfishService);
     Private->RedfishService = NULL;
   }
 
@@ -12,6 +12,7 @@
 
 #include <Library/RedfishLib.h>
 #include <Protocol/EdkIIRedfishPlatformConfig.h>
+#include <Protocol/RestJsonStructure.h>
 #include <RedfishJsonStructure/RedfishCsCommon.h>
 
 //
@@ -49,6 +50,132 @@ GetResourceByUri (
   OUT REDFISH_RESPONSE          *Response
   );
 
+/**
+
+  Read redfish resource by given resource URI only when the resource is
+  changed since the ETag kept in system. The kept ETag is sent with
+  If-None-Match header so that the service does not send the resource back
+  when it is not changed.
+
+  @param[in]  Service       Redfish srvice instacne to make query.
+  @param[in]  ResourceUri   Target resource URI.
+  @param[out] Response      HTTP response from redfish service.
+
+  @retval     EFI_SUCCESS           Resrouce is returned successfully.
+  @retval     EFI_ALREADY_STARTED   Resource is not changed. Nothing is returned
+                                    in Response.
+  @retval     Others                Errors occur.
+
+**/
+EFI_STATUS
+GetResourceByUriIfNoneMatch (
+  IN  REDFISH_SERVICE           *Service,
+  IN  EFI_STRING                ResourceUri,
+  OUT REDFISH_RESPONSE          *Response
+  );
+
+/**
+
+  Read redfish collection by given collection URI. When Redfish service
+  supports $expand query, the members are retrieved inline in the same
+  request and kept in the HTTP cache of RedfishLib, so reading member
+  resources afterwards doesn't go to Redfish service again. The returned
+  collection always carries the links to members only, the same as one
+  retrieved without $expand.
+
+  @param[in]  Service         Redfish srvice instacne to make query.
+  @param[in]  CollectionUri   Target collection URI.
+  @param[out] Response        HTTP response from redfish service.
+
+  @retval     EFI_SUCCESS     Collection is returned successfully.
+  @retval     Others          Errors occur.
+
+**/
+EFI_STATUS
+GetCollectionByUri (
+  IN  REDFISH_SERVICE           *Service,
+  IN  EFI_STRING                CollectionUri,
+  OUT REDFISH_RESPONSE          *Response
+  );
+
+/**
+
+  Start reading redfish resource by given resource URI in background, so that
+  the network wait overlaps with other work. The following GetResourceByUri()
+  or GetCollectionByUri() of the same resource gets the response without
+  sending another request to Redfish service.
+
+  @param[in]  Service       Redfish srvice instacne to make query.
+  @param[in]  ResourceUri   Target resource URI.
+  @param[in]  IsCollection  TRUE if the resource is read by GetCollectionByUri().
+
+  @retval     EFI_SUCCESS     The resource is on the way or already read.
+  @retval     Others          Errors occur.
+
+**/
+EFI_STATUS
+PrefetchResourceByUri (
+  IN  REDFISH_SERVICE           *Service,
+  IN  EFI_STRING                ResourceUri,
+  IN  BOOLEAN                   IsCollection
+  );
+
+/**
+
+  Get the Redfish service of given Redfish service information. The session
+  of the service is shared with other feature drivers through Redfish service
+  pool, so session login happens once for all of them. The service itself is
+  created in this driver with the shared session token, and it is created
+  with this driver's own login when the pool is not available.
+
+  @param[in]  RedfishConfigServiceInfo  Redfish service information.
+
+  @retval     REDFISH_SERVICE   The Redfish service. Caller releases it by
+                                RedfishReleaseSharedService().
+  @retval     NULL              Errors occur.
+
+**/
+REDFISH_SERVICE
+RedfishAcquireSharedService (
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION  *RedfishConfigServiceInfo
+  );
+
+/**
+
+  Release the Redfish service returned by RedfishAcquireSharedService().
+
+  @param[in]  RedfishService  The Redfish service to release.
+
+**/
+VOID
+RedfishReleaseSharedService (
+  IN  REDFISH_SERVICE  RedfishService
+  );
+
+/**
+
+  Convert the given JSON value to JSON C structure. The resource type is taken
+  from "@odata.type" of the JSON value here, so RestJsonStructureDxe looks up
+  the converter without parsing the resource. The JSON value is given to
+  converter in text format. Converter links its own JsonLib, the JSON value
+  created in this image can't be used by converter.
+
+  @param[in]  JsonStructProtocol  EFI_REST_JSON_STRUCTURE_PROTOCOL instance.
+  @param[in]  JsonValue           JSON value to convert.
+  @param[out] JsonStructure       Pointer to receive JSON C structure. Caller
+                                  releases it by JsonStructProtocol->DestoryStructure().
+
+  @retval     EFI_SUCCESS     JSON C structure is returned successfully.
+  @retval     Others          Errors occur.
+
+**/
+EFI_STATUS
+JsonValueToJsonStructure (
+  IN  EFI_REST_JSON_STRUCTURE_PROTOCOL  *JsonStructProtocol,
+  IN  EDKII_JSON_VALUE                  JsonValue,
+  OUT EFI_REST_JSON_STRUCTURE_HEADER    **JsonStructure
+  );
+
 /**
 
   Check if this is the Redpath array. Usually the Redpath array represents
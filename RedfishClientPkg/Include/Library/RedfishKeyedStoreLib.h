@@ -0,0 +1,164 @@
+/** @file
+  This file defines the Redfish keyed store library interface.
+
+  Keyed store keeps key and value pairs in memory with hash index in both
+  directions, and saves them to a series of UEFI variables. Each variable
+  holds a chunk of the records and only the chunks which are changed since
+  last flush are written again.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef REDFISH_KEYED_STORE_LIB_H_
+#define REDFISH_KEYED_STORE_LIB_H_
+
+#include <Uefi.h>
+
+typedef struct _REDFISH_KEYED_STORE REDFISH_KEYED_STORE;
+
+/**
+  Create keyed store and load the records saved in UEFI variables
+  whose name starts with VariableName.
+
+  @param[in]  VariableName  The name prefix of UEFI variables keeping this store.
+  @param[out] Store         Returned keyed store.
+
+  @retval EFI_SUCCESS             Store is created. Store is empty when there is
+                                  no record saved in UEFI variables.
+  @retval EFI_INVALID_PARAMETER   VariableName or Store is NULL.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishKeyedStoreOpen (
+  IN  EFI_STRING            VariableName,
+  OUT REDFISH_KEYED_STORE   **Store
+  );
+
+/**
+  Release keyed store. Records which are not flushed are discarded.
+
+  @param[in]  Store   The keyed store to release.
+
+**/
+VOID
+EFIAPI
+RedfishKeyedStoreClose (
+  IN  REDFISH_KEYED_STORE   *Store
+  );
+
+/**
+  Return the number of records in keyed store.
+
+  @param[in]  Store   The keyed store.
+
+  @retval UINTN       The number of records.
+
+**/
+UINTN
+EFIAPI
+RedfishKeyedStoreCount (
+  IN  REDFISH_KEYED_STORE   *Store
+  );
+
+/**
+  Find the value of given key. The returned value is owned by keyed store and
+  it is valid until the next RedfishKeyedStoreSet() or RedfishKeyedStoreClose().
+
+  @param[in]  Store       The keyed store.
+  @param[in]  Key         The key to search.
+  @param[in]  KeySize     The size of Key in bytes.
+  @param[out] Value       Returned value of Key.
+  @param[out] ValueSize   Returned size of Value in bytes. Optional.
+
+  @retval EFI_SUCCESS             The value is found.
+  @retval EFI_NOT_FOUND           There is no record of Key.
+  @retval EFI_INVALID_PARAMETER   Store, Key or Value is NULL, or KeySize is 0.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishKeyedStoreGet (
+  IN  REDFISH_KEYED_STORE   *Store,
+  IN  CONST VOID            *Key,
+  IN  UINTN                 KeySize,
+  OUT CONST VOID            **Value,
+  OUT UINTN                 *ValueSize  OPTIONAL
+  );
+
+/**
+  Find the key of given value. When several keys have the same value, the key
+  which is set first is returned. The returned key is owned by keyed store and
+  it is valid until the next RedfishKeyedStoreSet() or RedfishKeyedStoreClose().
+
+  @param[in]  Store       The keyed store.
+  @param[in]  Value       The value to search.
+  @param[in]  ValueSize   The size of Value in bytes.
+  @param[out] Key         Returned key of Value.
+  @param[out] KeySize     Returned size of Key in bytes. Optional.
+
+  @retval EFI_SUCCESS             The key is found.
+  @retval EFI_NOT_FOUND           There is no record of Value.
+  @retval EFI_INVALID_PARAMETER   Store, Value or Key is NULL, or ValueSize is 0.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishKeyedStoreGetByValue (
+  IN  REDFISH_KEYED_STORE   *Store,
+  IN  CONST VOID            *Value,
+  IN  UINTN                 ValueSize,
+  OUT CONST VOID            **Key,
+  OUT UINTN                 *KeySize  OPTIONAL
+  );
+
+/**
+  Set the value of given key. The record is replaced when the key exists
+  already. Setting the same value again doesn't change the store.
+
+  @param[in]  Store       The keyed store.
+  @param[in]  Key         The key to set.
+  @param[in]  KeySize     The size of Key in bytes.
+  @param[in]  Value       The value of Key. If Value is NULL, the record of Key
+                          is removed.
+  @param[in]  ValueSize   The size of Value in bytes.
+
+  @retval EFI_SUCCESS             The record is set or removed.
+  @retval EFI_NOT_FOUND           Value is NULL and there is no record of Key.
+  @retval EFI_INVALID_PARAMETER   Store or Key is NULL, KeySize is 0, or Value is
+                                  not NULL and ValueSize is 0.
+  @retval EFI_BAD_BUFFER_SIZE     The record doesn't fit in one UEFI variable.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishKeyedStoreSet (
+  IN  REDFISH_KEYED_STORE   *Store,
+  IN  CONST VOID            *Key,
+  IN  UINTN                 KeySize,
+  IN  CONST VOID            *Value      OPTIONAL,
+  IN  UINTN                 ValueSize
+  );
+
+/**
+  Save the records changed since last flush to UEFI variables.
+
+  @param[in]  Store   The keyed store.
+
+  @retval EFI_SUCCESS             The changed records are saved.
+  @retval EFI_INVALID_PARAMETER   Store is NULL.
+  @retval Others                  Failed to write UEFI variable.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishKeyedStoreFlush (
+  IN  REDFISH_KEYED_STORE   *Store
+  );
+
+#endif
@@ -22,6 +22,8 @@ typedef struct _EDKII_REDFISH_FEATURE_PROTOCOL EDKII_REDFISH_FEATURE_PROTOCOL;
 typedef enum {
   CallbackActionNone = 0,       ///< Invalid action
   CallbackActionStartOperation, ///< Start the operations on Redfish resource
+  CallbackActionPrefetch,       ///< Start retrieving Redfish resource without waiting for it.
+                                ///< CallbackActionStartOperation of the same resource follows.
   CallbackActionMax
 } FEATURE_CALLBACK_ACTION;
 
@@ -32,8 +34,11 @@ typedef enum {
   @param[in]     FeatureAction       The action Redfish feature driver should take.
   @param[in]     Context             The context of Redfish feature driver.
   @param[in,out] ExchangeInformation The pointer to RESOURCE_INFORMATION_EXCHANGE.
+                                     It is valid until CallbackActionStartOperation of
+                                     the same resource returns.
 
   @retval EFI_SUCCESS              Redfish feature driver callback is executed successfully.
+  @retval EFI_UNSUPPORTED          FeatureAction is not supported by Redfish feature driver.
   @retval Others                   Some errors happened.
 
 **/
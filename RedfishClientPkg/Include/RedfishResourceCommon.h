@@ -69,7 +69,7 @@ typedef struct _REDFISH_RESOURCE_COMMON_PRIVATE {
   Consume resource from given URI.
 
   @param[in]   This                Pointer to REDFISH_RESOURCE_COMMON_PRIVATE instance.
-  @param[in]   Json                The JSON to consume.
+  @param[in]   JsonValue           The JSON value to consume.
   @param[in]   HeaderEtag          The Etag string returned in HTTP header.
 
   @retval EFI_SUCCESS              Value is returned successfully.
@@ -79,7 +79,7 @@ typedef struct _REDFISH_RESOURCE_COMMON_PRIVATE {
 EFI_STATUS
 RedfishConsumeResourceCommon (
   IN     REDFISH_RESOURCE_COMMON_PRIVATE  *Private,
-  IN     CHAR8                            *Json,
+  IN     EDKII_JSON_VALUE                 JsonValue,
   IN     CHAR8                            *HeaderEtag OPTIONAL
   );
 
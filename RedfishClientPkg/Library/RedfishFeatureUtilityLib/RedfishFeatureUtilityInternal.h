@@ -20,6 +20,7 @@
 #include <Library/DebugLib.h>
 #include <Library/JsonLib.h>
 #include <Library/MemoryAllocationLib.h>
+#include <Library/RedfishEventLib.h>
 #include <Library/RedfishLib.h>
 #include <Library/RedfishFeatureUtilityLib.h>
 #include <Library/RedfishPlatformConfigLib.h>
@@ -33,6 +34,7 @@
 
 #include <Protocol/EdkIIRedfishETagProtocol.h>
 #include <Protocol/EdkIIRedfishConfigLangMapProtocol.h>
+#include <Protocol/EdkIIRedfishServicePoolProtocol.h>
 
 #define INDEX_VARIABLE_SIZE       64
 #define INDEX_STRING_SIZE         16
@@ -44,9 +46,24 @@
 #define MAX_CONF_LANG_LEN         128
 #define MAX_REDFISH_URL_LEN       255
 #define REGULAR_EXPRESSION_ARRAY  L"\\[.*\\]/.*"
+#define RESOURCE_TYPE_NOVERSIONED "NOVERSIONED"
 
 #define BIOS_CONFIG_TO_REDFISH_REDPATH_ARRAY_START_SIGNATURE L"{"
 #define BIOS_CONFIG_TO_REDFISH_REDPATH_ARRAY_END_SIGNATURE   L"}"
 #define BIOS_CONFIG_TO_REDFISH_REDPATH_POOL_SIZE             64
 
+//
+// Definition of REDFISH_SHARED_SERVICE. It tracks the service created with
+// the session from Redfish service pool, and the service information the
+// session is released with.
+//
+typedef struct {
+  LIST_ENTRY                          List;
+  REDFISH_SERVICE                     Service;
+  REDFISH_CONFIG_SERVICE_INFORMATION  ServiceInfo;
+  CHAR16                              *Location;
+} REDFISH_SHARED_SERVICE;
+
+#define REDFISH_SHARED_SERVICE_FROM_LIST(a)  BASE_CR (a, REDFISH_SHARED_SERVICE, List)
+
 #endif
@@ -12,6 +12,10 @@
 
 EDKII_REDFISH_ETAG_PROTOCOL             *mEtagProtocol = NULL;
 EDKII_REDFISH_CONFIG_LANG_MAP_PROTOCOL  *mConfigLangMapProtocol = NULL;
+EDKII_REDFISH_SERVICE_POOL_PROTOCOL     *mServicePoolProtocol = NULL;
+LIST_ENTRY                              mSharedServiceList = INITIALIZE_LIST_HEAD_VARIABLE (mSharedServiceList);
+EFI_EVENT                               mReadyToProvisioningEvent = NULL;
+EFI_EVENT                               mAfterProvisioningEvent = NULL;
 
 /**
 
@@ -459,7 +463,35 @@ ApplyFeatureSettingsBooleanType (
 
 /**
 
-  Apply property value to UEFI HII database in vague type.
+  Get Redfish value type of the given vague value.
+
+  @param[in]  VagueValue      Pointer of vague value.
+
+  @retval     EDKII_REDFISH_VALUE_TYPES   Redfish value type. REDFISH_VALUE_TYPE_UNKNOWN
+                                          is returned when data type is not supported.
+
+**/
+EDKII_REDFISH_VALUE_TYPES
+VagueValueToRedfishValueType (
+  IN  RedfishCS_Vague  *VagueValue
+  )
+{
+  if (VagueValue->DataType == RedfishCS_Vague_DataType_String) {
+    return REDFISH_VALUE_TYPE_STRING;
+  } else if (VagueValue->DataType == RedfishCS_Vague_DataType_Bool) {
+    return REDFISH_VALUE_TYPE_BOOLEAN;
+  } else if (VagueValue->DataType == RedfishCS_Vague_DataType_Int64) {
+    return REDFISH_VALUE_TYPE_INTEGER;
+  }
+
+  return REDFISH_VALUE_TYPE_UNKNOWN;
+}
+
+/**
+
+  Apply property value to UEFI HII database in vague type. All vague values
+  are read and written in batch, so the changed values on the same HII storage
+  are submitted together.
 
   @param[in]  Schema          Property schema.
   @param[in]  Version         Property schema version.
@@ -480,163 +512,178 @@ ApplyFeatureSettingsVagueType (
   IN  UINT32                            NumberOfVagueValues
   )
 {
-  EFI_STATUS                Status;
-  UINTN                     StrSize;
-  CHAR8                     *ConfigureLangAscii;
-  CHAR8                     *ConfigureLangKeyAscii;
-  EFI_STRING                ConfigureKeyLang;
-  EDKII_REDFISH_VALUE       RedfishValue;
-  EDKII_REDFISH_VALUE_TYPES PropertyDatatype;
-  RedfishCS_EmptyProp_KeyValue *CurrentVagueValuePtr;
+  EFI_STATUS                                Status;
+  UINTN                                     StrSize;
+  UINTN                                     Index;
+  UINTN                                     ValueCount;
+  UINTN                                     SetCount;
+  EFI_STRING                                ConfigureKeyLang;
+  EDKII_REDFISH_VALUE                       *RedfishValue;
+  EDKII_REDFISH_VALUE_TYPES                 PropertyDatatype;
+  EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY *ValueList;
+  EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY *SetValueList;
+  RedfishCS_EmptyProp_KeyValue              **VagueValueList;
+  RedfishCS_EmptyProp_KeyValue              *CurrentVagueValuePtr;
 
   if (IS_EMPTY_STRING (Schema) || IS_EMPTY_STRING (Version) || IS_EMPTY_STRING (ConfigureLang) || VagueValuePtr == NULL || NumberOfVagueValues == 0) {
     return EFI_INVALID_PARAMETER;
   }
 
-  ConfigureLangAscii = AllocatePool (StrLen (ConfigureLang) + 1);
-  if (ConfigureLangAscii == NULL) {
+  ValueCount = 0;
+  SetCount = 0;
+  ValueList = AllocateZeroPool (sizeof (EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY) * NumberOfVagueValues);
+  SetValueList = AllocateZeroPool (sizeof (EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY) * NumberOfVagueValues);
+  VagueValueList = AllocateZeroPool (sizeof (RedfishCS_EmptyProp_KeyValue *) * NumberOfVagueValues);
+  if (ValueList == NULL || SetValueList == NULL || VagueValueList == NULL) {
     Status = EFI_OUT_OF_RESOURCES;
-    DEBUG ((DEBUG_ERROR, "%a, Allocate memory for generate ConfigureLang of vague key of %a.%a %s failed: %r\n", __FUNCTION__, Schema, Version, ConfigureLang, Status));
-    return Status;
-  }
-  Status = UnicodeStrToAsciiStrS (ConfigureLang, ConfigureLangAscii, StrLen (ConfigureLang) + 1);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a, Convert the configureLang of vague key of %a.%a %s failed: %r\n", __FUNCTION__, Schema, Version, ConfigureLang, Status));
-    return Status;
+    DEBUG ((DEBUG_ERROR, "%a, Allocate memory for vague key of %a.%a %s failed: %r\n", __FUNCTION__, Schema, Version, ConfigureLang, Status));
+    goto ON_RELEASE;
   }
 
+  //
+  // Generate ConfigureLang with the key name for all vague values.
+  //
   CurrentVagueValuePtr = VagueValuePtr;
-  while (CurrentVagueValuePtr != NULL) {
-    //
-    // Generate ConfigureLang with the key name
-    //
-    //ConfigureKeyLang = GetConfigureLang (ConfigureLangAscii, CurrentVagueValuePtr->KeyNamePtr);
-    StrSize = AsciiStrLen (ConfigureLangAscii) + AsciiStrLen (CurrentVagueValuePtr->KeyNamePtr) + 2;
-    ConfigureLangKeyAscii = AllocateZeroPool (StrSize);
+  while (CurrentVagueValuePtr != NULL && ValueCount < NumberOfVagueValues) {
+    if (VagueValueToRedfishValueType (CurrentVagueValuePtr->Value) == REDFISH_VALUE_TYPE_UNKNOWN) {
+      DEBUG ((DEBUG_ERROR, "%a, %a.%a %s/%a Unsupported Redfish property data type\n", __FUNCTION__, Schema, Version, ConfigureLang, CurrentVagueValuePtr->KeyNamePtr));
+      CurrentVagueValuePtr = CurrentVagueValuePtr->NextKeyValuePtr;
+      continue;
+    }
+
+    StrSize = StrLen (ConfigureLang) + AsciiStrLen (CurrentVagueValuePtr->KeyNamePtr) + 2;
     ConfigureKeyLang = AllocateZeroPool (StrSize * sizeof (CHAR16));
-    if (ConfigureLangKeyAscii == NULL || ConfigureKeyLang == NULL) {
-        DEBUG ((DEBUG_ERROR, "%a, Generate ConfigureLang of vague key of %a.%a %s %a failed!\n", __FUNCTION__, Schema, Version, ConfigureLang, CurrentVagueValuePtr->KeyNamePtr));
-        goto ErrorContinue;
-    }
-    AsciiStrCatS(ConfigureLangKeyAscii, StrSize, ConfigureLangAscii);
-    AsciiStrCatS(ConfigureLangKeyAscii, StrSize, "/");
-    AsciiStrCatS(ConfigureLangKeyAscii, StrSize, CurrentVagueValuePtr->KeyNamePtr);
-    AsciiStrToUnicodeStrS(ConfigureLangKeyAscii, ConfigureKeyLang, StrSize);
-    FreePool (ConfigureLangKeyAscii);
-    ConfigureLangKeyAscii = NULL;
-    //
-    // Initial property data type and value.
-    //
-    if (CurrentVagueValuePtr->Value->DataType == RedfishCS_Vague_DataType_String) {
-      PropertyDatatype = REDFISH_VALUE_TYPE_STRING;
-    } else if (CurrentVagueValuePtr->Value->DataType == RedfishCS_Vague_DataType_Bool) {
-      PropertyDatatype = REDFISH_VALUE_TYPE_BOOLEAN;
-    } else if (CurrentVagueValuePtr->Value->DataType == RedfishCS_Vague_DataType_Int64) {
-      PropertyDatatype = REDFISH_VALUE_TYPE_INTEGER;
-    } else {
-      DEBUG((DEBUG_ERROR, "%a, %a.%a %s Unsupported Redfish property data type\n", __FUNCTION__, Schema, Version, ConfigureLang));
-      goto ErrorContinue;
+    if (ConfigureKeyLang == NULL) {
+      DEBUG ((DEBUG_ERROR, "%a, Generate ConfigureLang of vague key of %a.%a %s %a failed!\n", __FUNCTION__, Schema, Version, ConfigureLang, CurrentVagueValuePtr->KeyNamePtr));
+      CurrentVagueValuePtr = CurrentVagueValuePtr->NextKeyValuePtr;
+      continue;
     }
 
-    //
-    // Get the current value from HII
-    //
-    Status = RedfishPlatformConfigGetValue (Schema, Version, ConfigureKeyLang, &RedfishValue);
-    if (EFI_ERROR (Status)) {
-      DEBUG ((DEBUG_ERROR, "%a, %a.%a %s failed: %r\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, Status));
-    } else {
-      if (RedfishValue.Type != PropertyDatatype) {
-        DEBUG((DEBUG_ERROR, "%a, %a.%a %s mismatched data type\n", __FUNCTION__, Schema, Version, ConfigureKeyLang));
-        goto ErrorContinue;
+    UnicodeSPrint (ConfigureKeyLang, StrSize * sizeof (CHAR16), L"%s/%a", ConfigureLang, CurrentVagueValuePtr->KeyNamePtr);
+
+    ValueList[ValueCount].Schema = Schema;
+    ValueList[ValueCount].Version = Version;
+    ValueList[ValueCount].ConfigureLang = ConfigureKeyLang;
+    VagueValueList[ValueCount] = CurrentVagueValuePtr;
+    ++ValueCount;
+
+    CurrentVagueValuePtr = CurrentVagueValuePtr->NextKeyValuePtr;
+  }
+
+  if (ValueCount == 0) {
+    goto ON_RELEASE;
+  }
+
+  //
+  // Get the current values from HII
+  //
+  RedfishPlatformConfigGetValues (ValueCount, ValueList);
+
+  for (Index = 0; Index < ValueCount; Index++) {
+    ConfigureKeyLang = ValueList[Index].ConfigureLang;
+    RedfishValue = &ValueList[Index].Value;
+    CurrentVagueValuePtr = VagueValueList[Index];
+    PropertyDatatype = VagueValueToRedfishValueType (CurrentVagueValuePtr->Value);
+
+    if (EFI_ERROR (ValueList[Index].Status)) {
+      DEBUG ((DEBUG_ERROR, "%a, %a.%a %s failed: %r\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, ValueList[Index].Status));
+      continue;
+    }
+
+    if (RedfishValue->Type != PropertyDatatype) {
+      DEBUG ((DEBUG_ERROR, "%a, %a.%a %s mismatched data type\n", __FUNCTION__, Schema, Version, ConfigureKeyLang));
+      if (RedfishValue->Type == REDFISH_VALUE_TYPE_STRING && RedfishValue->Value.Buffer != NULL) {
+        FreePool (RedfishValue->Value.Buffer);
       }
-      if (PropertyDatatype == REDFISH_VALUE_TYPE_STRING) {
-        //
-        // This is a string property.
-        //
-        if (AsciiStrCmp (CurrentVagueValuePtr->Value->DataValue.CharPtr, RedfishValue.Value.Buffer) != 0) {
-          //
-          // Apply settings from redfish
-          //
-          DEBUG ((DEBUG_INFO, "%a, %a.%a apply %s from %a to %a\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, RedfishValue.Value.Buffer, CurrentVagueValuePtr->Value->DataValue.CharPtr));
-          FreePool (RedfishValue.Value.Buffer);
-          RedfishValue.Value.Buffer = CurrentVagueValuePtr->Value->DataValue.CharPtr;
-          Status = RedfishPlatformConfigSetValue (Schema, Version, ConfigureKeyLang, RedfishValue);
-          if (EFI_ERROR (Status)) {
-            DEBUG ((DEBUG_ERROR, "%a, apply %a to %a failed: %r\n", __FUNCTION__, ConfigureKeyLang, CurrentVagueValuePtr->Value->DataValue.CharPtr, Status));
-          }
-        } else {
-          DEBUG ((DEBUG_INFO, "%a, %a.%a %s value is: %a\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, RedfishValue.Value.Buffer, Status));
-        }
-      } else if (PropertyDatatype == REDFISH_VALUE_TYPE_BOOLEAN) {
-        //
-        // This is a boolean property.
-        //
-        if (RedfishValue.Value.Boolean != *CurrentVagueValuePtr->Value->DataValue.BoolPtr) {
-          //
-          // Apply settings from redfish
-          //
-          DEBUG ((DEBUG_INFO, "%a, %a.%a apply %s from %a to %a\n",
-                  __FUNCTION__,
-                  Schema,
-                  Version,
-                  ConfigureKeyLang,
-                  (RedfishValue.Value.Boolean ? "True" : "False"),
-                  (*CurrentVagueValuePtr->Value->DataValue.BoolPtr ? "True" : "False")));
-
-          RedfishValue.Value.Boolean = (BOOLEAN)*CurrentVagueValuePtr->Value->DataValue.BoolPtr;
-          Status = RedfishPlatformConfigSetValue (Schema, Version, ConfigureKeyLang, RedfishValue);
-          if (EFI_ERROR (Status)) {
-            DEBUG ((DEBUG_ERROR, "%a, apply %s to %a failed: %r\n", __FUNCTION__, ConfigureKeyLang, (*CurrentVagueValuePtr->Value->DataValue.BoolPtr ? "True" : "False"), Status));
-          }
-        } else {
-          DEBUG ((DEBUG_INFO, "%a, %a.%a %s value is: %a\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, (RedfishValue.Value.Boolean ? "True" : "False"), Status));
-        }
-      } else if (PropertyDatatype == REDFISH_VALUE_TYPE_INTEGER) {
-        //
-        // This is a integer property.
-        //
-        if (RedfishValue.Value.Integer != *CurrentVagueValuePtr->Value->DataValue.Int64Ptr) {
-          //
-          // Apply settings from redfish
-          //
-          DEBUG ((DEBUG_INFO, "%a, %a.%a apply %s from 0x%x to 0x%x\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, RedfishValue.Value.Integer, *CurrentVagueValuePtr->Value->DataValue.Int64Ptr));
 
-          RedfishValue.Value.Integer = (INT64)*CurrentVagueValuePtr->Value->DataValue.Int64Ptr;
-          Status = RedfishPlatformConfigSetValue (Schema, Version, ConfigureKeyLang, RedfishValue);
-          if (EFI_ERROR (Status)) {
-            DEBUG ((DEBUG_ERROR, "%a, apply %s to 0x%x failed: %r\n", __FUNCTION__, ConfigureKeyLang, *CurrentVagueValuePtr->Value->DataValue.Int64Ptr, Status));
-          }
-        } else {
-          DEBUG ((DEBUG_INFO, "%a, %a.%a %s value is: 0x%x\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, RedfishValue.Value.Integer, Status));
-        }
+      continue;
+    }
+
+    SetValueList[SetCount].Schema = Schema;
+    SetValueList[SetCount].Version = Version;
+    SetValueList[SetCount].ConfigureLang = ConfigureKeyLang;
+    SetValueList[SetCount].Value.Type = PropertyDatatype;
+
+    if (PropertyDatatype == REDFISH_VALUE_TYPE_STRING) {
+      //
+      // This is a string property.
+      //
+      if (AsciiStrCmp (CurrentVagueValuePtr->Value->DataValue.CharPtr, RedfishValue->Value.Buffer) != 0) {
+        DEBUG ((DEBUG_INFO, "%a, %a.%a apply %s from %a to %a\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, RedfishValue->Value.Buffer, CurrentVagueValuePtr->Value->DataValue.CharPtr));
+        SetValueList[SetCount].Value.Value.Buffer = CurrentVagueValuePtr->Value->DataValue.CharPtr;
+        ++SetCount;
       } else {
-        DEBUG((DEBUG_ERROR, "%a, %a.%a %s Unsupported Redfish property data type\n", __FUNCTION__, Schema, Version, ConfigureLang));
-        goto ErrorContinue;
+        DEBUG ((DEBUG_INFO, "%a, %a.%a %s value is: %a\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, RedfishValue->Value.Buffer));
+      }
+
+      FreePool (RedfishValue->Value.Buffer);
+      RedfishValue->Value.Buffer = NULL;
+    } else if (PropertyDatatype == REDFISH_VALUE_TYPE_BOOLEAN) {
+      //
+      // This is a boolean property.
+      //
+      if (RedfishValue->Value.Boolean != *CurrentVagueValuePtr->Value->DataValue.BoolPtr) {
+        DEBUG ((DEBUG_INFO, "%a, %a.%a apply %s from %a to %a\n",
+                __FUNCTION__,
+                Schema,
+                Version,
+                ConfigureKeyLang,
+                (RedfishValue->Value.Boolean ? "True" : "False"),
+                (*CurrentVagueValuePtr->Value->DataValue.BoolPtr ? "True" : "False")));
+        SetValueList[SetCount].Value.Value.Boolean = (BOOLEAN)*CurrentVagueValuePtr->Value->DataValue.BoolPtr;
+        ++SetCount;
+      } else {
+        DEBUG ((DEBUG_INFO, "%a, %a.%a %s value is: %a\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, (RedfishValue->Value.Boolean ? "True" : "False")));
+      }
+    } else {
+      //
+      // This is a integer property.
+      //
+      if (RedfishValue->Value.Integer != *CurrentVagueValuePtr->Value->DataValue.Int64Ptr) {
+        DEBUG ((DEBUG_INFO, "%a, %a.%a apply %s from 0x%x to 0x%x\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, RedfishValue->Value.Integer, *CurrentVagueValuePtr->Value->DataValue.Int64Ptr));
+        SetValueList[SetCount].Value.Value.Integer = (INT64)*CurrentVagueValuePtr->Value->DataValue.Int64Ptr;
+        ++SetCount;
+      } else {
+        DEBUG ((DEBUG_INFO, "%a, %a.%a %s value is: 0x%x\n", __FUNCTION__, Schema, Version, ConfigureKeyLang, RedfishValue->Value.Integer));
       }
     }
+  }
 
-ErrorContinue:;
-    if (ConfigureLangKeyAscii != NULL) {
-      FreePool (ConfigureLangKeyAscii);
-      ConfigureLangKeyAscii = NULL;
+  //
+  // Apply settings from redfish. Changed values are submitted together.
+  //
+  if (SetCount > 0) {
+    Status = RedfishPlatformConfigSetValues (SetCount, SetValueList);
+    if (EFI_ERROR (Status)) {
+      for (Index = 0; Index < SetCount; Index++) {
+        if (EFI_ERROR (SetValueList[Index].Status)) {
+          DEBUG ((DEBUG_ERROR, "%a, apply %s failed: %r\n", __FUNCTION__, SetValueList[Index].ConfigureLang, SetValueList[Index].Status));
+        }
+      }
     }
-    if (ConfigureKeyLang != NULL) {
-      FreePool (ConfigureKeyLang);
-      ConfigureKeyLang = NULL;
+  }
+
+  Status = EFI_SUCCESS;
+
+ON_RELEASE:
+
+  if (ValueList != NULL) {
+    for (Index = 0; Index < ValueCount; Index++) {
+      FreePool (ValueList[Index].ConfigureLang);
     }
-    CurrentVagueValuePtr = CurrentVagueValuePtr->NextKeyValuePtr;
-  };
 
-  if (ConfigureLangAscii != NULL) {
-    FreePool (ConfigureLangAscii);
+    FreePool (ValueList);
   }
-  if (ConfigureLangKeyAscii != NULL) {
-    FreePool (ConfigureLangKeyAscii);
+
+  if (SetValueList != NULL) {
+    FreePool (SetValueList);
   }
-  if (ConfigureKeyLang != NULL) {
-    FreePool (ConfigureKeyLang);
+
+  if (VagueValueList != NULL) {
+    FreePool (VagueValueList);
   }
-  return EFI_SUCCESS;
+
+  return Status;
 }
 
 /**
@@ -1034,6 +1081,531 @@ GetResourceByUri (
   return Status;
 }
 
+/**
+
+  Read redfish collection by given collection URI. When Redfish service
+  supports $expand query, the members are retrieved inline in the same
+  request and kept in the HTTP cache of RedfishLib, so reading member
+  resources afterwards doesn't go to Redfish service again. The returned
+  collection always carries the links to members only, the same as one
+  retrieved without $expand.
+
+  @param[in]  Service         Redfish srvice instacne to make query.
+  @param[in]  CollectionUri   Target collection URI.
+  @param[out] Response        HTTP response from redfish service.
+
+  @retval     EFI_SUCCESS     Collection is returned successfully.
+  @retval     Others          Errors occur.
+
+**/
+EFI_STATUS
+GetCollectionByUri (
+  IN  REDFISH_SERVICE           *Service,
+  IN  EFI_STRING                CollectionUri,
+  OUT REDFISH_RESPONSE          *Response
+  )
+{
+  EFI_STATUS  Status;
+  CHAR8       *AsciiCollectionUri;
+  UINT32      QueryFeatures;
+  UINTN       CachedCount;
+
+  if (Service == NULL || Response == NULL || IS_EMPTY_STRING (CollectionUri)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  QueryFeatures = RedfishGetQueryFeatures (Service);
+  if ((QueryFeatures & REDFISH_QUERY_FEATURE_EXPAND_NO_LINKS) == 0 ||
+      (QueryFeatures & REDFISH_QUERY_FEATURE_EXPAND_LEVELS) == 0) {
+    return GetResourceByUri (Service, CollectionUri, Response);
+  }
+
+  AsciiCollectionUri = StrUnicodeToAscii (CollectionUri);
+  if (AsciiCollectionUri == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = RedfishGetByUriWithQuery (
+             Service,
+             AsciiCollectionUri,
+             REDFISH_QUERY_EXPAND_ONE_LEVEL,
+             Response
+             );
+  if (!EFI_ERROR (Status)) {
+    Status = RedfishCacheExpandedMembers (Service, Response->Payload, &CachedCount);
+    DEBUG ((REDFISH_DEBUG_TRACE, "%a, %a: %d members expanded: %r\n", __FUNCTION__, AsciiCollectionUri, CachedCount, Status));
+    if (EFI_ERROR (Status)) {
+      RedfishFreeResponse (Response->StatusCode, Response->HeaderCount, Response->Headers, Response->Payload);
+      ZeroMem (Response, sizeof (REDFISH_RESPONSE));
+    }
+  } else {
+    DEBUG ((DEBUG_WARN, "%a, $expand of %a failed: %r\n", __FUNCTION__, AsciiCollectionUri, Status));
+    RedfishFreeResponse (Response->StatusCode, Response->HeaderCount, Response->Headers, Response->Payload);
+    ZeroMem (Response, sizeof (REDFISH_RESPONSE));
+  }
+
+  FreePool (AsciiCollectionUri);
+
+  if (EFI_ERROR (Status)) {
+    //
+    // Service claims the support but rejects the query. Read the collection as usual.
+    //
+    return GetResourceByUri (Service, CollectionUri, Response);
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+
+  Start reading redfish resource by given resource URI in background, so that
+  the network wait overlaps with other work. The following GetResourceByUri()
+  or GetCollectionByUri() of the same resource gets the response without
+  sending another request to Redfish service.
+
+  @param[in]  Service       Redfish srvice instacne to make query.
+  @param[in]  ResourceUri   Target resource URI.
+  @param[in]  IsCollection  TRUE if the resource is read by GetCollectionByUri().
+
+  @retval     EFI_SUCCESS     The resource is on the way or already read.
+  @retval     Others          Errors occur.
+
+**/
+EFI_STATUS
+PrefetchResourceByUri (
+  IN  REDFISH_SERVICE           *Service,
+  IN  EFI_STRING                ResourceUri,
+  IN  BOOLEAN                   IsCollection
+  )
+{
+  EFI_STATUS  Status;
+  CHAR8       *AsciiResourceUri;
+  CHAR8       *QueryUri;
+  UINTN       QueryUriSize;
+  UINT32      QueryFeatures;
+
+  if (Service == NULL || IS_EMPTY_STRING (ResourceUri)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  AsciiResourceUri = StrUnicodeToAscii (ResourceUri);
+  if (AsciiResourceUri == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // GetCollectionByUri() asks for the collection with $expand query when
+  // Redfish service supports it. Prefetch the same URI.
+  //
+  QueryUri = NULL;
+  if (IsCollection) {
+    QueryFeatures = RedfishGetQueryFeatures (Service);
+    if ((QueryFeatures & REDFISH_QUERY_FEATURE_EXPAND_NO_LINKS) != 0 &&
+        (QueryFeatures & REDFISH_QUERY_FEATURE_EXPAND_LEVELS) != 0) {
+      QueryUriSize = AsciiStrLen (AsciiResourceUri) + 1 + AsciiStrSize (REDFISH_QUERY_EXPAND_ONE_LEVEL);
+      QueryUri = AllocatePool (QueryUriSize);
+      if (QueryUri == NULL) {
+        FreePool (AsciiResourceUri);
+        return EFI_OUT_OF_RESOURCES;
+      }
+
+      AsciiSPrint (QueryUri, QueryUriSize, "%a%c%a", AsciiResourceUri, (AsciiStrStr (AsciiResourceUri, "?") == NULL) ? '?' : '&', REDFISH_QUERY_EXPAND_ONE_LEVEL);
+    }
+  }
+
+  Status = RedfishPrefetchByUri (Service, (QueryUri != NULL) ? QueryUri : AsciiResourceUri);
+  if (EFI_ERROR (Status) && Status != EFI_UNSUPPORTED) {
+    DEBUG ((DEBUG_WARN, "%a, prefetch %a failed: %r\n", __FUNCTION__, AsciiResourceUri, Status));
+  }
+
+  if (QueryUri != NULL) {
+    FreePool (QueryUri);
+  }
+
+  FreePool (AsciiResourceUri);
+
+  return Status;
+}
+
+/**
+
+  Get the Redfish service of given Redfish service information. The session
+  of the service is shared with other feature drivers through Redfish service
+  pool, so session login happens once for all of them. The service itself is
+  created in this driver with the shared session token, and it is created
+  with this driver's own login when the pool is not available.
+
+  @param[in]  RedfishConfigServiceInfo  Redfish service information.
+
+  @retval     REDFISH_SERVICE   The Redfish service. Caller releases it by
+                                RedfishReleaseSharedService().
+  @retval     NULL              Errors occur.
+
+**/
+REDFISH_SERVICE
+RedfishAcquireSharedService (
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION  *RedfishConfigServiceInfo
+  )
+{
+  EFI_STATUS              Status;
+  REDFISH_SERVICE         RedfishService;
+  CHAR8                   *SessionToken;
+  REDFISH_SHARED_SERVICE  *SharedService;
+
+  if (RedfishConfigServiceInfo == NULL || RedfishConfigServiceInfo->RedfishServiceLocation == NULL) {
+    return NULL;
+  }
+
+  Status = RedfishLocateProtocol ((VOID **)&mServicePoolProtocol, &gEdkIIRedfishServicePoolProtocolGuid);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((REDFISH_DEBUG_TRACE, "%a, service pool is not available, create own service\n", __FUNCTION__));
+    return RedfishCreateService (RedfishConfigServiceInfo);
+  }
+
+  SharedService = AllocateZeroPool (sizeof (REDFISH_SHARED_SERVICE));
+  if (SharedService == NULL) {
+    return NULL;
+  }
+
+  SharedService->Location = AllocateCopyPool (StrSize (RedfishConfigServiceInfo->RedfishServiceLocation), RedfishConfigServiceInfo->RedfishServiceLocation);
+  if (SharedService->Location == NULL) {
+    FreePool (SharedService);
+    return NULL;
+  }
+
+  //
+  // Keep what the pool identifies the service with, so it can be released later.
+  //
+  SharedService->ServiceInfo.RedfishServiceRestExHandle = RedfishConfigServiceInfo->RedfishServiceRestExHandle;
+  SharedService->ServiceInfo.RedfishServiceVersion      = RedfishConfigServiceInfo->RedfishServiceVersion;
+  SharedService->ServiceInfo.RedfishServiceLocation     = SharedService->Location;
+  SharedService->ServiceInfo.RedfishServiceUseHttps     = RedfishConfigServiceInfo->RedfishServiceUseHttps;
+
+  SessionToken = NULL;
+  Status       = mServicePoolProtocol->Acquire (mServicePoolProtocol, RedfishConfigServiceInfo, &SessionToken);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, can not get Redfish session from pool: %r\n", __FUNCTION__, Status));
+    FreePool (SharedService->Location);
+    FreePool (SharedService);
+    return NULL;
+  }
+
+  //
+  // The service keeps JSON objects of this image, so only the session token
+  // comes from the pool. Without Redfish session there is nothing to share.
+  //
+  if (SessionToken != NULL) {
+    RedfishService = RedfishCreateServiceWithSessionToken (RedfishConfigServiceInfo, SessionToken);
+    ZeroMem (SessionToken, AsciiStrLen (SessionToken));
+    FreePool (SessionToken);
+  } else {
+    RedfishService = RedfishCreateService (RedfishConfigServiceInfo);
+  }
+
+  if (RedfishService == NULL) {
+    DEBUG ((DEBUG_ERROR, "%a, can not create Redfish service\n", __FUNCTION__));
+    mServicePoolProtocol->Release (mServicePoolProtocol, &SharedService->ServiceInfo);
+    FreePool (SharedService->Location);
+    FreePool (SharedService);
+    return NULL;
+  }
+
+  SharedService->Service = RedfishService;
+  InsertTailList (&mSharedServiceList, &SharedService->List);
+
+  return RedfishService;
+}
+
+/**
+
+  Release the Redfish service returned by RedfishAcquireSharedService().
+
+  @param[in]  RedfishService  The Redfish service to release.
+
+**/
+VOID
+RedfishReleaseSharedService (
+  IN  REDFISH_SERVICE  RedfishService
+  )
+{
+  LIST_ENTRY              *Node;
+  REDFISH_SHARED_SERVICE  *SharedService;
+
+  if (RedfishService == NULL) {
+    return;
+  }
+
+  RedfishCleanupService (RedfishService);
+
+  //
+  // Hand the session back to the pool if the service is created with it.
+  //
+  Node = GetFirstNode (&mSharedServiceList);
+  while (!IsNull (&mSharedServiceList, Node)) {
+    SharedService = REDFISH_SHARED_SERVICE_FROM_LIST (Node);
+    if (SharedService->Service == RedfishService) {
+      RemoveEntryList (&SharedService->List);
+      if (mServicePoolProtocol != NULL) {
+        mServicePoolProtocol->Release (mServicePoolProtocol, &SharedService->ServiceInfo);
+      }
+
+      FreePool (SharedService->Location);
+      FreePool (SharedService);
+      return;
+    }
+
+    Node = GetNextNode (&mSharedServiceList, Node);
+  }
+}
+
+/**
+
+  Read redfish resource by given resource URI only when the resource is
+  changed since the ETag kept in system. The kept ETag is sent with
+  If-None-Match header so that the service does not send the resource back
+  when it is not changed.
+
+  @param[in]  Service       Redfish srvice instacne to make query.
+  @param[in]  ResourceUri   Target resource URI.
+  @param[out] Response      HTTP response from redfish service.
+
+  @retval     EFI_SUCCESS           Resrouce is returned successfully.
+  @retval     EFI_ALREADY_STARTED   Resource is not changed. Nothing is returned
+                                    in Response.
+  @retval     Others                Errors occur.
+
+**/
+EFI_STATUS
+GetResourceByUriIfNoneMatch (
+  IN  REDFISH_SERVICE           *Service,
+  IN  EFI_STRING                ResourceUri,
+  OUT REDFISH_RESPONSE          *Response
+  )
+{
+  EFI_STATUS  Status;
+  CHAR8       *AsciiResourceUri;
+  CHAR8       *Etag;
+
+  if (Service == NULL || Response == NULL || IS_EMPTY_STRING (ResourceUri)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  AsciiResourceUri = StrUnicodeToAscii (ResourceUri);
+  if (AsciiResourceUri == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Etag = GetEtagWithUri (ResourceUri);
+
+  //
+  // Get resource from redfish service.
+  //
+  Status = RedfishGetByUriIfNoneMatch (
+             Service,
+             AsciiResourceUri,
+             Etag,
+             Response
+             );
+  if (Status == EFI_ALREADY_STARTED) {
+    DEBUG ((REDFISH_DEBUG_TRACE, "%a, %a is not modified\n", __FUNCTION__, AsciiResourceUri));
+  } else if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, RedfishGetByUriIfNoneMatch to %a failed: %r\n", __FUNCTION__, AsciiResourceUri, Status));
+    if (Response->Payload != NULL) {
+      RedfishDumpPayload (Response->Payload);
+      RedfishFreeResponse (
+        NULL,
+        0,
+        NULL,
+        Response->Payload
+        );
+      Response->Payload = NULL;
+    }
+  }
+
+  if (Etag != NULL) {
+    FreePool (Etag);
+  }
+
+  FreePool (AsciiResourceUri);
+
+  return Status;
+}
+
+/**
+
+  Get the resource type identifier from "@odata.type" of the given JSON value.
+  "#Bios.v1_0_9.Bios" gives resource type "Bios" with version "1", "0" and "9".
+  "#MemoryCollection.MemoryCollection" gives resource type "MemoryCollection"
+  with version "NOVERSIONED", which is the version registered by converters of
+  resource without version.
+
+  @param[in]  JsonValue           JSON value of the resource.
+  @param[out] RsrcIdentifier      Resource type identifier. The strings point to
+                                  the memory returned in Buffer.
+  @param[out] Buffer              Memory of the strings in RsrcIdentifier. Caller
+                                  frees it with FreePool().
+
+  @retval     EFI_SUCCESS           RsrcIdentifier is returned.
+  @retval     EFI_NOT_FOUND         No "@odata.type" in JsonValue.
+  @retval     EFI_UNSUPPORTED       "@odata.type" is not in the expected format.
+  @retval     EFI_OUT_OF_RESOURCES  System is out of memory.
+
+**/
+EFI_STATUS
+GetResourceTypeIdentifier (
+  IN  EDKII_JSON_VALUE                        JsonValue,
+  OUT EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER  *RsrcIdentifier,
+  OUT CHAR8                                   **Buffer
+  )
+{
+  CONST CHAR8                            *OdataType;
+  CHAR8                                  *TypeString;
+  CHAR8                                  *Char;
+  EFI_REST_JSON_RESOURCE_TYPE_NAMESPACE  *NameSpace;
+
+  if (!JsonValueIsObject (JsonValue)) {
+    return EFI_NOT_FOUND;
+  }
+
+  OdataType = JsonValueGetAsciiString (JsonObjectGetValue (JsonValueGetObject (JsonValue), "@odata.type"));
+  if (OdataType == NULL || *OdataType != '#') {
+    return EFI_NOT_FOUND;
+  }
+
+  TypeString = AllocateCopyPool (AsciiStrSize (OdataType), OdataType);
+  if (TypeString == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  NameSpace = &RsrcIdentifier->NameSpace;
+
+  //
+  // Resource type name.
+  //
+  NameSpace->ResourceTypeName = TypeString + 1;
+  for (Char = NameSpace->ResourceTypeName; *Char != '.' && *Char != '\0'; Char++);
+  if (*Char != '.' || Char == NameSpace->ResourceTypeName) {
+    goto ON_UNSUPPORTED;
+  }
+
+  *Char = '\0';
+  Char++;
+
+  if (*Char != 'v' || *(Char + 1) < '0' || *(Char + 1) > '9') {
+    NameSpace->MajorVersion  = RESOURCE_TYPE_NOVERSIONED;
+    NameSpace->MinorVersion  = RESOURCE_TYPE_NOVERSIONED;
+    NameSpace->ErrataVersion = RESOURCE_TYPE_NOVERSIONED;
+  } else {
+    //
+    // Version in "vMajor_Minor_Errata." format.
+    //
+    NameSpace->MajorVersion = ++Char;
+    for ( ; *Char != '_' && *Char != '\0'; Char++);
+    if (*Char != '_') {
+      goto ON_UNSUPPORTED;
+    }
+
+    *Char = '\0';
+    NameSpace->MinorVersion = ++Char;
+    for ( ; *Char != '_' && *Char != '\0'; Char++);
+    if (*Char != '_') {
+      goto ON_UNSUPPORTED;
+    }
+
+    *Char = '\0';
+    NameSpace->ErrataVersion = ++Char;
+    for ( ; *Char != '.' && *Char != '\0'; Char++);
+    if (*Char != '.') {
+      goto ON_UNSUPPORTED;
+    }
+
+    *Char = '\0';
+    Char++;
+  }
+
+  //
+  // The data type follows the version.
+  //
+  if (*Char == '\0') {
+    goto ON_UNSUPPORTED;
+  }
+
+  RsrcIdentifier->DataType = Char;
+  *Buffer                  = TypeString;
+  return EFI_SUCCESS;
+
+ON_UNSUPPORTED:
+
+  FreePool (TypeString);
+  return EFI_UNSUPPORTED;
+}
+
+/**
+
+  Convert the given JSON value to JSON C structure. The resource type is taken
+  from "@odata.type" of the JSON value here, so RestJsonStructureDxe looks up
+  the converter without parsing the resource. The JSON value is given to
+  converter in text format. Converter links its own JsonLib, the JSON value
+  created in this image can't be used by converter.
+
+  @param[in]  JsonStructProtocol  EFI_REST_JSON_STRUCTURE_PROTOCOL instance.
+  @param[in]  JsonValue           JSON value to convert.
+  @param[out] JsonStructure       Pointer to receive JSON C structure. Caller
+                                  releases it by JsonStructProtocol->DestoryStructure().
+
+  @retval     EFI_SUCCESS     JSON C structure is returned successfully.
+  @retval     Others          Errors occur.
+
+**/
+EFI_STATUS
+JsonValueToJsonStructure (
+  IN  EFI_REST_JSON_STRUCTURE_PROTOCOL  *JsonStructProtocol,
+  IN  EDKII_JSON_VALUE                  JsonValue,
+  OUT EFI_REST_JSON_STRUCTURE_HEADER    **JsonStructure
+  )
+{
+  EFI_STATUS                              Status;
+  CHAR8                                   *Json;
+  EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER  RsrcIdentifier;
+  CHAR8                                   *RsrcIdentifierBuffer;
+
+  if (JsonStructProtocol == NULL || JsonValue == NULL || JsonStructure == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Without "@odata.type", RestJsonStructureDxe finds out the converter by
+  // itself.
+  //
+  RsrcIdentifierBuffer = NULL;
+  Status = GetResourceTypeIdentifier (JsonValue, &RsrcIdentifier, &RsrcIdentifierBuffer);
+  if (Status == EFI_OUT_OF_RESOURCES) {
+    return Status;
+  }
+
+  Json = JsonDumpString (JsonValue, EDKII_JSON_COMPACT);
+  if (Json == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ON_EXIT;
+  }
+
+  Status = JsonStructProtocol->ToStructure (
+                                 JsonStructProtocol,
+                                 (RsrcIdentifierBuffer != NULL) ? &RsrcIdentifier : NULL,
+                                 Json,
+                                 JsonStructure
+                                 );
+  FreePool (Json);
+
+ON_EXIT:
+
+  if (RsrcIdentifierBuffer != NULL) {
+    FreePool (RsrcIdentifierBuffer);
+  }
+
+  return Status;
+}
+
 /**
 
   Check if this is the Redpath array. Usually the Redpath array represents
@@ -3434,6 +4006,25 @@ CompareRedfishPropertyVagueValues (
   return TRUE;
 }
 
+/**
+  Callback function executed when a Redfish provisioning cycle begins or ends.
+  Redfish responses cached in previous cycle are dropped so that feature
+  driver always sees the latest resources in a new cycle.
+
+  @param[in]  Event    Event whose notification function is being invoked.
+  @param[in]  Context  Pointer to the notification function's context.
+
+**/
+VOID
+EFIAPI
+RedfishFeatureUtilityOnProvisioning (
+  IN  EFI_EVENT  Event,
+  IN  VOID       *Context
+  )
+{
+  RedfishFlushHttpCache (NULL);
+}
+
 /**
 
   Install Boot Maintenance Manager Menu driver.
@@ -3452,6 +4043,17 @@ RedfishFeatureUtilityLibConstructor (
   IN EFI_SYSTEM_TABLE                      *SystemTable
   )
 {
+  EFI_STATUS  Status;
+
+  Status = CreateReadyToProvisioningEvent (RedfishFeatureUtilityOnProvisioning, NULL, &mReadyToProvisioningEvent);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, failed to create ready to provisioning event: %r\n", __FUNCTION__, Status));
+  }
+
+  Status = CreateAfterProvisioningEvent (RedfishFeatureUtilityOnProvisioning, NULL, &mAfterProvisioningEvent);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, failed to create after provisioning event: %r\n", __FUNCTION__, Status));
+  }
 
   return EFI_SUCCESS;
 }
@@ -3472,5 +4074,15 @@ RedfishFeatureUtilityLibDestructor (
   IN EFI_SYSTEM_TABLE                      *SystemTable
   )
 {
+  if (mReadyToProvisioningEvent != NULL) {
+    gBS->CloseEvent (mReadyToProvisioningEvent);
+  }
+
+  if (mAfterProvisioningEvent != NULL) {
+    gBS->CloseEvent (mAfterProvisioningEvent);
+  }
+
+  RedfishFlushHttpCache (NULL);
+
   return EFI_SUCCESS;
 }
@@ -0,0 +1,107 @@
+/** @file
+  Internal definitions of Redfish keyed store library.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef REDFISH_KEYED_STORE_INTERNAL_H_
+#define REDFISH_KEYED_STORE_INTERNAL_H_
+
+#include <Uefi.h>
+#include <RedfishBase.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
+#include <Library/PrintLib.h>
+#include <Library/RedfishKeyedStoreLib.h>
+#include <Library/UefiLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
+
+#include <Guid/VariableFormat.h>
+
+#define REDFISH_KEYED_STORE_SIGNATURE         SIGNATURE_32 ('R', 'F', 'K', 'S')
+#define REDFISH_KEYED_STORE_VERSION           0x0001
+#define REDFISH_KEYED_STORE_INITIAL_BUCKETS   64
+#define REDFISH_KEYED_STORE_MAX_CHUNKS        0x10000
+//
+// The chunk variable name is the store variable name followed by
+// four hexadecimal digits of chunk index.
+//
+#define REDFISH_KEYED_STORE_CHUNK_NAME_SUFFIX_LENGTH  4
+
+#pragma pack(1)
+
+//
+// Chunk variable starts with REDFISH_KEYED_STORE_CHUNK_HEADER, followed by
+// RecordCount of records. Each record is REDFISH_KEYED_STORE_RECORD_HEADER
+// followed by key and value.
+//
+typedef struct {
+  UINT32    Signature;
+  UINT16    Version;
+  UINT16    RecordCount;
+} REDFISH_KEYED_STORE_CHUNK_HEADER;
+
+typedef struct {
+  UINT16    KeySize;
+  UINT16    ValueSize;
+} REDFISH_KEYED_STORE_RECORD_HEADER;
+
+#pragma pack()
+
+//
+// Definition of REDFISH_KEYED_STORE_RECORD. Key and value are kept in the
+// same allocation after the record.
+//
+typedef struct {
+  LIST_ENTRY    KeyLink;
+  LIST_ENTRY    ValueLink;
+  LIST_ENTRY    ChunkLink;
+  UINT32        KeyHash;
+  UINT32        ValueHash;
+  UINTN         Chunk;
+  UINTN         KeySize;
+  UINTN         ValueSize;
+  UINT8         *Key;
+  UINT8         *Value;
+} REDFISH_KEYED_STORE_RECORD;
+
+#define REDFISH_KEYED_STORE_RECORD_FROM_KEY_LINK(a)    BASE_CR (a, REDFISH_KEYED_STORE_RECORD, KeyLink)
+#define REDFISH_KEYED_STORE_RECORD_FROM_VALUE_LINK(a)  BASE_CR (a, REDFISH_KEYED_STORE_RECORD, ValueLink)
+#define REDFISH_KEYED_STORE_RECORD_FROM_CHUNK_LINK(a)  BASE_CR (a, REDFISH_KEYED_STORE_RECORD, ChunkLink)
+
+#define REDFISH_KEYED_STORE_RECORD_FLASH_SIZE(KeySize, ValueSize) \
+  (sizeof (REDFISH_KEYED_STORE_RECORD_HEADER) + (KeySize) + (ValueSize))
+
+//
+// Definition of REDFISH_KEYED_STORE_CHUNK. One chunk is saved in one UEFI variable.
+//
+typedef struct {
+  LIST_ENTRY    Records;
+  UINTN         RecordCount;
+  UINTN         UsedSize;       ///< Variable size of this chunk, including chunk header.
+  BOOLEAN       Dirty;          ///< Chunk is changed since last flush.
+} REDFISH_KEYED_STORE_CHUNK;
+
+//
+// Definition of REDFISH_KEYED_STORE
+//
+struct _REDFISH_KEYED_STORE {
+  EFI_STRING                   VariableName;
+  UINTN                        ChunkVariableSize;
+  LIST_ENTRY                   *KeyBuckets;
+  LIST_ENTRY                   *ValueBuckets;
+  UINTN                        BucketCount;
+  UINTN                        Count;
+  REDFISH_KEYED_STORE_CHUNK    **Chunks;
+  UINTN                        ChunkCount;
+  UINTN                        FlashChunkCount;   ///< Number of chunk variables on flash.
+};
+
+#endif
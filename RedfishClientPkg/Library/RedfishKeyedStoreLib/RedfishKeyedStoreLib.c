@@ -0,0 +1,1002 @@
+/** @file
+  Redfish keyed store library implementation.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishKeyedStoreInternal.h"
+
+/**
+  Calculate the hash value of given data.
+
+  @param[in]    Data    Data to hash.
+  @param[in]    Size    The size of Data in bytes.
+
+  @retval UINT32        Hash value of Data.
+
+**/
+UINT32
+KeyedStoreHash (
+  IN CONST VOID  *Data,
+  IN UINTN       Size
+  )
+{
+  CONST UINT8  *Byte;
+  UINT32       Hash;
+
+  //
+  // FNV-1a
+  //
+  Hash = 2166136261U;
+  for (Byte = Data; Size > 0; Size--, Byte++) {
+    Hash ^= (UINT32)*Byte;
+    Hash *= 16777619U;
+  }
+
+  return Hash;
+}
+
+/**
+  Make sure the hash index has room for the given number of new records
+  without exceeding one record per bucket on average. Buckets are doubled
+  and records are rehashed when the index grows.
+
+  @param[in, out]   Store           The keyed store.
+  @param[in]        NewRecordCount  Number of records about to be inserted.
+
+  @retval EFI_SUCCESS               Index is ready for insertion.
+  @retval EFI_OUT_OF_RESOURCES      No bucket can be allocated.
+
+**/
+EFI_STATUS
+KeyedStoreReserve (
+  IN OUT REDFISH_KEYED_STORE  *Store,
+  IN     UINTN                NewRecordCount
+  )
+{
+  UINTN                       BucketCount;
+  UINTN                       Index;
+  LIST_ENTRY                  *KeyBuckets;
+  LIST_ENTRY                  *ValueBuckets;
+  LIST_ENTRY                  *Node;
+  REDFISH_KEYED_STORE_RECORD  *Record;
+
+  BucketCount = (Store->BucketCount == 0) ? REDFISH_KEYED_STORE_INITIAL_BUCKETS : Store->BucketCount;
+  while (BucketCount < Store->Count + NewRecordCount) {
+    BucketCount *= 2;
+  }
+
+  if (BucketCount == Store->BucketCount) {
+    return EFI_SUCCESS;
+  }
+
+  KeyBuckets   = AllocatePool (sizeof (LIST_ENTRY) * BucketCount);
+  ValueBuckets = AllocatePool (sizeof (LIST_ENTRY) * BucketCount);
+  if ((KeyBuckets == NULL) || (ValueBuckets == NULL)) {
+    if (KeyBuckets != NULL) {
+      FreePool (KeyBuckets);
+    }
+
+    if (ValueBuckets != NULL) {
+      FreePool (ValueBuckets);
+    }
+
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (Index = 0; Index < BucketCount; Index++) {
+    InitializeListHead (&KeyBuckets[Index]);
+    InitializeListHead (&ValueBuckets[Index]);
+  }
+
+  //
+  // Move records to new buckets. Records in one old bucket keep their
+  // order in the new bucket, so the first record set is still found first.
+  //
+  for (Index = 0; Index < Store->BucketCount; Index++) {
+    while (!IsListEmpty (&Store->KeyBuckets[Index])) {
+      Node   = GetFirstNode (&Store->KeyBuckets[Index]);
+      Record = REDFISH_KEYED_STORE_RECORD_FROM_KEY_LINK (Node);
+      RemoveEntryList (Node);
+      InsertTailList (&KeyBuckets[Record->KeyHash & (BucketCount - 1)], Node);
+    }
+
+    while (!IsListEmpty (&Store->ValueBuckets[Index])) {
+      Node   = GetFirstNode (&Store->ValueBuckets[Index]);
+      Record = REDFISH_KEYED_STORE_RECORD_FROM_VALUE_LINK (Node);
+      RemoveEntryList (Node);
+      InsertTailList (&ValueBuckets[Record->ValueHash & (BucketCount - 1)], Node);
+    }
+  }
+
+  if (Store->KeyBuckets != NULL) {
+    FreePool (Store->KeyBuckets);
+    FreePool (Store->ValueBuckets);
+  }
+
+  Store->KeyBuckets   = KeyBuckets;
+  Store->ValueBuckets = ValueBuckets;
+  Store->BucketCount  = BucketCount;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Find the record of given key.
+
+  @param[in]    Store     The keyed store.
+  @param[in]    Key       The key to search.
+  @param[in]    KeySize   The size of Key in bytes.
+
+  @retval REDFISH_KEYED_STORE_RECORD  The record is found.
+  @retval NULL                        There is no record of Key.
+
+**/
+REDFISH_KEYED_STORE_RECORD *
+KeyedStoreFindRecord (
+  IN REDFISH_KEYED_STORE  *Store,
+  IN CONST VOID           *Key,
+  IN UINTN                KeySize
+  )
+{
+  UINT32                      Hash;
+  LIST_ENTRY                  *Bucket;
+  LIST_ENTRY                  *Node;
+  REDFISH_KEYED_STORE_RECORD  *Record;
+
+  if (Store->Count == 0) {
+    return NULL;
+  }
+
+  Hash   = KeyedStoreHash (Key, KeySize);
+  Bucket = &Store->KeyBuckets[Hash & (Store->BucketCount - 1)];
+  for (Node = GetFirstNode (Bucket); !IsNull (Bucket, Node); Node = GetNextNode (Bucket, Node)) {
+    Record = REDFISH_KEYED_STORE_RECORD_FROM_KEY_LINK (Node);
+    if ((Record->KeyHash == Hash) && (Record->KeySize == KeySize) && (CompareMem (Record->Key, Key, KeySize) == 0)) {
+      return Record;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Find the first record of given value.
+
+  @param[in]    Store       The keyed store.
+  @param[in]    Value       The value to search.
+  @param[in]    ValueSize   The size of Value in bytes.
+
+  @retval REDFISH_KEYED_STORE_RECORD  The record is found.
+  @retval NULL                        There is no record of Value.
+
+**/
+REDFISH_KEYED_STORE_RECORD *
+KeyedStoreFindRecordByValue (
+  IN REDFISH_KEYED_STORE  *Store,
+  IN CONST VOID           *Value,
+  IN UINTN                ValueSize
+  )
+{
+  UINT32                      Hash;
+  LIST_ENTRY                  *Bucket;
+  LIST_ENTRY                  *Node;
+  REDFISH_KEYED_STORE_RECORD  *Record;
+
+  if (Store->Count == 0) {
+    return NULL;
+  }
+
+  Hash   = KeyedStoreHash (Value, ValueSize);
+  Bucket = &Store->ValueBuckets[Hash & (Store->BucketCount - 1)];
+  for (Node = GetFirstNode (Bucket); !IsNull (Bucket, Node); Node = GetNextNode (Bucket, Node)) {
+    Record = REDFISH_KEYED_STORE_RECORD_FROM_VALUE_LINK (Node);
+    if ((Record->ValueHash == Hash) && (Record->ValueSize == ValueSize) && (CompareMem (Record->Value, Value, ValueSize) == 0)) {
+      return Record;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Append new empty chunk to keyed store.
+
+  @param[in, out]   Store           The keyed store.
+  @param[out]       ChunkIndex      Returned chunk index.
+
+  @retval EFI_SUCCESS             The chunk is created.
+  @retval EFI_OUT_OF_RESOURCES    No chunk can be created.
+
+**/
+EFI_STATUS
+KeyedStoreNewChunk (
+  IN OUT REDFISH_KEYED_STORE  *Store,
+  OUT    UINTN                *ChunkIndex
+  )
+{
+  REDFISH_KEYED_STORE_CHUNK  **Chunks;
+  REDFISH_KEYED_STORE_CHUNK  *Chunk;
+
+  if (Store->ChunkCount >= REDFISH_KEYED_STORE_MAX_CHUNKS) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Chunk = AllocateZeroPool (sizeof (REDFISH_KEYED_STORE_CHUNK));
+  if (Chunk == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Chunks = ReallocatePool (
+             sizeof (REDFISH_KEYED_STORE_CHUNK *) * Store->ChunkCount,
+             sizeof (REDFISH_KEYED_STORE_CHUNK *) * (Store->ChunkCount + 1),
+             Store->Chunks
+             );
+  if (Chunks == NULL) {
+    FreePool (Chunk);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  InitializeListHead (&Chunk->Records);
+  Chunk->UsedSize = sizeof (REDFISH_KEYED_STORE_CHUNK_HEADER);
+
+  Store->Chunks                    = Chunks;
+  Store->Chunks[Store->ChunkCount] = Chunk;
+  *ChunkIndex                      = Store->ChunkCount;
+  Store->ChunkCount++;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Find a chunk which has room for the record of given size. A new chunk
+  is created when all chunks are full.
+
+  @param[in, out]   Store           The keyed store.
+  @param[in]        RecordSize      The size of record on flash.
+  @param[in]        PreferredChunk  The chunk to try first.
+  @param[in]        ReleasedSize    The size which is released from PreferredChunk
+                                    once the new record is added, e.g. the old
+                                    record it replaces.
+  @param[out]       ChunkIndex      Returned chunk index.
+
+  @retval EFI_SUCCESS             The chunk is found.
+  @retval EFI_OUT_OF_RESOURCES    No chunk can be created.
+
+**/
+EFI_STATUS
+KeyedStoreFindChunk (
+  IN OUT REDFISH_KEYED_STORE  *Store,
+  IN     UINTN                RecordSize,
+  IN     UINTN                PreferredChunk,
+  IN     UINTN                ReleasedSize,
+  OUT    UINTN                *ChunkIndex
+  )
+{
+  REDFISH_KEYED_STORE_CHUNK  *Chunk;
+  UINTN                      Index;
+
+  if ((PreferredChunk < Store->ChunkCount) &&
+      (Store->Chunks[PreferredChunk]->UsedSize - ReleasedSize + RecordSize <= Store->ChunkVariableSize) &&
+      (Store->Chunks[PreferredChunk]->RecordCount < MAX_UINT16))
+  {
+    *ChunkIndex = PreferredChunk;
+    return EFI_SUCCESS;
+  }
+
+  for (Index = 0; Index < Store->ChunkCount; Index++) {
+    Chunk = Store->Chunks[Index];
+    if ((Chunk->UsedSize + RecordSize <= Store->ChunkVariableSize) && (Chunk->RecordCount < MAX_UINT16)) {
+      *ChunkIndex = Index;
+      return EFI_SUCCESS;
+    }
+  }
+
+  return KeyedStoreNewChunk (Store, ChunkIndex);
+}
+
+/**
+  Add new record to keyed store. Caller makes sure the key doesn't exist,
+  the index has room for one more record and the chunk has room for the record.
+
+  @param[in, out]   Store       The keyed store.
+  @param[in]        Key         The key of new record.
+  @param[in]        KeySize     The size of Key in bytes.
+  @param[in]        Value       The value of new record.
+  @param[in]        ValueSize   The size of Value in bytes.
+  @param[in]        ChunkIndex  The chunk which keeps new record.
+
+  @retval EFI_SUCCESS             The record is added.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+EFI_STATUS
+KeyedStoreAddRecord (
+  IN OUT REDFISH_KEYED_STORE  *Store,
+  IN     CONST VOID           *Key,
+  IN     UINTN                KeySize,
+  IN     CONST VOID           *Value,
+  IN     UINTN                ValueSize,
+  IN     UINTN                ChunkIndex
+  )
+{
+  REDFISH_KEYED_STORE_RECORD  *Record;
+  REDFISH_KEYED_STORE_CHUNK   *Chunk;
+
+  Record = AllocatePool (sizeof (REDFISH_KEYED_STORE_RECORD) + KeySize + ValueSize);
+  if (Record == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Record->Key       = (UINT8 *)(Record + 1);
+  Record->Value     = Record->Key + KeySize;
+  Record->KeySize   = KeySize;
+  Record->ValueSize = ValueSize;
+  Record->KeyHash   = KeyedStoreHash (Key, KeySize);
+  Record->ValueHash = KeyedStoreHash (Value, ValueSize);
+  Record->Chunk     = ChunkIndex;
+  CopyMem (Record->Key, Key, KeySize);
+  CopyMem (Record->Value, Value, ValueSize);
+
+  InsertTailList (&Store->KeyBuckets[Record->KeyHash & (Store->BucketCount - 1)], &Record->KeyLink);
+  InsertTailList (&Store->ValueBuckets[Record->ValueHash & (Store->BucketCount - 1)], &Record->ValueLink);
+
+  Chunk = Store->Chunks[ChunkIndex];
+  InsertTailList (&Chunk->Records, &Record->ChunkLink);
+  Chunk->RecordCount++;
+  Chunk->UsedSize += REDFISH_KEYED_STORE_RECORD_FLASH_SIZE (KeySize, ValueSize);
+
+  Store->Count++;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Remove record from keyed store and release it.
+
+  @param[in, out]   Store     The keyed store.
+  @param[in]        Record    The record to remove.
+
+**/
+VOID
+KeyedStoreRemoveRecord (
+  IN OUT REDFISH_KEYED_STORE         *Store,
+  IN     REDFISH_KEYED_STORE_RECORD  *Record
+  )
+{
+  REDFISH_KEYED_STORE_CHUNK  *Chunk;
+
+  RemoveEntryList (&Record->KeyLink);
+  RemoveEntryList (&Record->ValueLink);
+  RemoveEntryList (&Record->ChunkLink);
+
+  Chunk = Store->Chunks[Record->Chunk];
+  Chunk->RecordCount--;
+  Chunk->UsedSize -= REDFISH_KEYED_STORE_RECORD_FLASH_SIZE (Record->KeySize, Record->ValueSize);
+  Chunk->Dirty     = TRUE;
+
+  Store->Count--;
+
+  FreePool (Record);
+}
+
+/**
+  Return the UEFI variable name of given chunk.
+
+  @param[in]    Store       The keyed store.
+  @param[in]    ChunkIndex  The chunk index.
+
+  @retval EFI_STRING        The variable name. Caller frees it.
+  @retval NULL              Not enough memory.
+
+**/
+EFI_STRING
+KeyedStoreChunkVariableName (
+  IN REDFISH_KEYED_STORE  *Store,
+  IN UINTN                ChunkIndex
+  )
+{
+  EFI_STRING  Name;
+  UINTN       NameSize;
+
+  NameSize = StrSize (Store->VariableName) + REDFISH_KEYED_STORE_CHUNK_NAME_SUFFIX_LENGTH * sizeof (CHAR16);
+  Name     = AllocatePool (NameSize);
+  if (Name == NULL) {
+    return NULL;
+  }
+
+  UnicodeSPrint (Name, NameSize, L"%s%04x", Store->VariableName, ChunkIndex);
+
+  return Name;
+}
+
+/**
+  Load the records in chunk variable data. Chunk with corrupted data is
+  dropped and marked dirty, so it is rewritten on next flush.
+
+  @param[in, out]   Store       The keyed store.
+  @param[in]        ChunkIndex  The chunk index.
+  @param[in]        Data        The chunk variable data.
+  @param[in]        DataSize    The size of Data in bytes.
+
+  @retval EFI_SUCCESS             The chunk is loaded.
+  @retval EFI_VOLUME_CORRUPTED    The chunk data is corrupted.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+EFI_STATUS
+KeyedStoreLoadChunk (
+  IN OUT REDFISH_KEYED_STORE  *Store,
+  IN     UINTN                ChunkIndex,
+  IN     UINT8                *Data,
+  IN     UINTN                DataSize
+  )
+{
+  EFI_STATUS                         Status;
+  REDFISH_KEYED_STORE_CHUNK_HEADER   *ChunkHeader;
+  REDFISH_KEYED_STORE_RECORD_HEADER  *RecordHeader;
+  REDFISH_KEYED_STORE_RECORD         *Record;
+  UINT8                              *Seeker;
+  UINTN                              Index;
+  UINTN                              Pass;
+
+  ChunkHeader = (REDFISH_KEYED_STORE_CHUNK_HEADER *)Data;
+  if ((DataSize < sizeof (REDFISH_KEYED_STORE_CHUNK_HEADER)) ||
+      (DataSize > Store->ChunkVariableSize) ||
+      (ChunkHeader->Signature != REDFISH_KEYED_STORE_SIGNATURE) ||
+      (ChunkHeader->Version != REDFISH_KEYED_STORE_VERSION))
+  {
+    Store->Chunks[ChunkIndex]->Dirty = TRUE;
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  Status = KeyedStoreReserve (Store, ChunkHeader->RecordCount);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Validate all records in the first pass and add them in the second pass,
+  // so a corrupted chunk doesn't leave part of its records in the store.
+  //
+  for (Pass = 0; Pass < 2; Pass++) {
+    Seeker = Data + sizeof (REDFISH_KEYED_STORE_CHUNK_HEADER);
+    for (Index = 0; Index < ChunkHeader->RecordCount; Index++) {
+      RecordHeader = (REDFISH_KEYED_STORE_RECORD_HEADER *)Seeker;
+      if (Pass == 0) {
+        if ((Seeker + sizeof (REDFISH_KEYED_STORE_RECORD_HEADER) > Data + DataSize) ||
+            (RecordHeader->KeySize == 0) ||
+            (RecordHeader->ValueSize == 0) ||
+            (Seeker + REDFISH_KEYED_STORE_RECORD_FLASH_SIZE (RecordHeader->KeySize, RecordHeader->ValueSize) > Data + DataSize))
+        {
+          DEBUG ((DEBUG_ERROR, "%a, %s chunk %d corrupted\n", __FUNCTION__, Store->VariableName, ChunkIndex));
+          Store->Chunks[ChunkIndex]->Dirty = TRUE;
+          return EFI_VOLUME_CORRUPTED;
+        }
+      } else {
+        Record = KeyedStoreFindRecord (Store, RecordHeader + 1, RecordHeader->KeySize);
+        if (Record != NULL) {
+          //
+          // Duplicate key, the later one wins.
+          //
+          KeyedStoreRemoveRecord (Store, Record);
+        }
+
+        Status = KeyedStoreAddRecord (
+                   Store,
+                   RecordHeader + 1,
+                   RecordHeader->KeySize,
+                   (UINT8 *)(RecordHeader + 1) + RecordHeader->KeySize,
+                   RecordHeader->ValueSize,
+                   ChunkIndex
+                   );
+        if (EFI_ERROR (Status)) {
+          return Status;
+        }
+      }
+
+      Seeker += REDFISH_KEYED_STORE_RECORD_FLASH_SIZE (RecordHeader->KeySize, RecordHeader->ValueSize);
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Write chunk to UEFI variable. Chunk without record is written with chunk
+  header only, unless DeleteEmpty is TRUE.
+
+  @param[in]    Store         The keyed store.
+  @param[in]    ChunkIndex    The chunk index.
+  @param[in]    DeleteEmpty   Delete the variable of empty chunk.
+
+  @retval EFI_SUCCESS         The chunk is written.
+  @retval Others              Failed to write UEFI variable.
+
+**/
+EFI_STATUS
+KeyedStoreWriteChunk (
+  IN REDFISH_KEYED_STORE  *Store,
+  IN UINTN                ChunkIndex,
+  IN BOOLEAN              DeleteEmpty
+  )
+{
+  EFI_STATUS                         Status;
+  REDFISH_KEYED_STORE_CHUNK          *Chunk;
+  REDFISH_KEYED_STORE_CHUNK_HEADER   *ChunkHeader;
+  REDFISH_KEYED_STORE_RECORD_HEADER  *RecordHeader;
+  REDFISH_KEYED_STORE_RECORD         *Record;
+  LIST_ENTRY                         *Node;
+  EFI_STRING                         Name;
+  UINT8                              *Data;
+  UINT8                              *Seeker;
+
+  Chunk = Store->Chunks[ChunkIndex];
+  Name  = KeyedStoreChunkVariableName (Store, ChunkIndex);
+  if (Name == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  if (DeleteEmpty && (Chunk->RecordCount == 0)) {
+    Status = gRT->SetVariable (Name, &gEfiRedfishClientVariableGuid, VARIABLE_ATTRIBUTE_NV_BS, 0, NULL);
+    if (Status == EFI_NOT_FOUND) {
+      Status = EFI_SUCCESS;
+    }
+
+    FreePool (Name);
+    return Status;
+  }
+
+  Data = AllocatePool (Chunk->UsedSize);
+  if (Data == NULL) {
+    FreePool (Name);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  ChunkHeader              = (REDFISH_KEYED_STORE_CHUNK_HEADER *)Data;
+  ChunkHeader->Signature   = REDFISH_KEYED_STORE_SIGNATURE;
+  ChunkHeader->Version     = REDFISH_KEYED_STORE_VERSION;
+  ChunkHeader->RecordCount = (UINT16)Chunk->RecordCount;
+
+  Seeker = Data + sizeof (REDFISH_KEYED_STORE_CHUNK_HEADER);
+  for (Node = GetFirstNode (&Chunk->Records); !IsNull (&Chunk->Records, Node); Node = GetNextNode (&Chunk->Records, Node)) {
+    Record                  = REDFISH_KEYED_STORE_RECORD_FROM_CHUNK_LINK (Node);
+    RecordHeader            = (REDFISH_KEYED_STORE_RECORD_HEADER *)Seeker;
+    RecordHeader->KeySize   = (UINT16)Record->KeySize;
+    RecordHeader->ValueSize = (UINT16)Record->ValueSize;
+    Seeker                 += sizeof (REDFISH_KEYED_STORE_RECORD_HEADER);
+    CopyMem (Seeker, Record->Key, Record->KeySize);
+    Seeker += Record->KeySize;
+    CopyMem (Seeker, Record->Value, Record->ValueSize);
+    Seeker += Record->ValueSize;
+  }
+
+  ASSERT ((UINTN)(Seeker - Data) == Chunk->UsedSize);
+
+  Status = gRT->SetVariable (Name, &gEfiRedfishClientVariableGuid, VARIABLE_ATTRIBUTE_NV_BS, Chunk->UsedSize, Data);
+
+  FreePool (Data);
+  FreePool (Name);
+
+  return Status;
+}
+
+/**
+  Create keyed store and load the records saved in UEFI variables
+  whose name starts with VariableName.
+
+  @param[in]  VariableName  The name prefix of UEFI variables keeping this store.
+  @param[out] Store         Returned keyed store.
+
+  @retval EFI_SUCCESS             Store is created. Store is empty when there is
+                                  no record saved in UEFI variables.
+  @retval EFI_INVALID_PARAMETER   VariableName or Store is NULL.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishKeyedStoreOpen (
+  IN  EFI_STRING            VariableName,
+  OUT REDFISH_KEYED_STORE   **Store
+  )
+{
+  EFI_STATUS           Status;
+  REDFISH_KEYED_STORE  *NewStore;
+  EFI_STRING           Name;
+  UINT8                *Data;
+  UINTN                DataSize;
+  UINTN                ChunkIndex;
+
+  if (IS_EMPTY_STRING (VariableName) || (Store == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  NewStore = AllocateZeroPool (sizeof (REDFISH_KEYED_STORE));
+  if (NewStore == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  NewStore->ChunkVariableSize = PcdGet32 (PcdRedfishKeyedStoreChunkSize);
+  NewStore->VariableName      = AllocateCopyPool (StrSize (VariableName), VariableName);
+  if (NewStore->VariableName == NULL) {
+    FreePool (NewStore);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = KeyedStoreReserve (NewStore, 0);
+  if (EFI_ERROR (Status)) {
+    goto ON_ERROR;
+  }
+
+  //
+  // Chunk variables are numbered from 0 without gap.
+  //
+  for (ChunkIndex = 0; ChunkIndex < REDFISH_KEYED_STORE_MAX_CHUNKS; ChunkIndex++) {
+    Name = KeyedStoreChunkVariableName (NewStore, ChunkIndex);
+    if (Name == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      goto ON_ERROR;
+    }
+
+    Status = GetVariable2 (Name, &gEfiRedfishClientVariableGuid, (VOID **)&Data, &DataSize);
+    FreePool (Name);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    //
+    // Each chunk variable has its chunk, even the empty one.
+    //
+    Status = KeyedStoreNewChunk (NewStore, &ChunkIndex);
+    if (!EFI_ERROR (Status)) {
+      Status = KeyedStoreLoadChunk (NewStore, ChunkIndex, Data, DataSize);
+    }
+
+    FreePool (Data);
+    NewStore->FlashChunkCount = ChunkIndex + 1;
+    if (Status == EFI_OUT_OF_RESOURCES) {
+      goto ON_ERROR;
+    }
+  }
+
+  *Store = NewStore;
+
+  return EFI_SUCCESS;
+
+ON_ERROR:
+
+  RedfishKeyedStoreClose (NewStore);
+
+  return Status;
+}
+
+/**
+  Release keyed store. Records which are not flushed are discarded.
+
+  @param[in]  Store   The keyed store to release.
+
+**/
+VOID
+EFIAPI
+RedfishKeyedStoreClose (
+  IN  REDFISH_KEYED_STORE   *Store
+  )
+{
+  UINTN                       Index;
+  REDFISH_KEYED_STORE_RECORD  *Record;
+
+  if (Store == NULL) {
+    return;
+  }
+
+  for (Index = 0; Index < Store->ChunkCount; Index++) {
+    while (!IsListEmpty (&Store->Chunks[Index]->Records)) {
+      Record = REDFISH_KEYED_STORE_RECORD_FROM_CHUNK_LINK (GetFirstNode (&Store->Chunks[Index]->Records));
+      KeyedStoreRemoveRecord (Store, Record);
+    }
+
+    FreePool (Store->Chunks[Index]);
+  }
+
+  if (Store->Chunks != NULL) {
+    FreePool (Store->Chunks);
+  }
+
+  if (Store->KeyBuckets != NULL) {
+    FreePool (Store->KeyBuckets);
+    FreePool (Store->ValueBuckets);
+  }
+
+  FreePool (Store->VariableName);
+  FreePool (Store);
+}
+
+/**
+  Return the number of records in keyed store.
+
+  @param[in]  Store   The keyed store.
+
+  @retval UINTN       The number of records.
+
+**/
+UINTN
+EFIAPI
+RedfishKeyedStoreCount (
+  IN  REDFISH_KEYED_STORE   *Store
+  )
+{
+  if (Store == NULL) {
+    return 0;
+  }
+
+  return Store->Count;
+}
+
+/**
+  Find the value of given key. The returned value is owned by keyed store and
+  it is valid until the next RedfishKeyedStoreSet() or RedfishKeyedStoreClose().
+
+  @param[in]  Store       The keyed store.
+  @param[in]  Key         The key to search.
+  @param[in]  KeySize     The size of Key in bytes.
+  @param[out] Value       Returned value of Key.
+  @param[out] ValueSize   Returned size of Value in bytes. Optional.
+
+  @retval EFI_SUCCESS             The value is found.
+  @retval EFI_NOT_FOUND           There is no record of Key.
+  @retval EFI_INVALID_PARAMETER   Store, Key or Value is NULL, or KeySize is 0.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishKeyedStoreGet (
+  IN  REDFISH_KEYED_STORE   *Store,
+  IN  CONST VOID            *Key,
+  IN  UINTN                 KeySize,
+  OUT CONST VOID            **Value,
+  OUT UINTN                 *ValueSize  OPTIONAL
+  )
+{
+  REDFISH_KEYED_STORE_RECORD  *Record;
+
+  if ((Store == NULL) || (Key == NULL) || (KeySize == 0) || (Value == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Record = KeyedStoreFindRecord (Store, Key, KeySize);
+  if (Record == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  *Value = Record->Value;
+  if (ValueSize != NULL) {
+    *ValueSize = Record->ValueSize;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Find the key of given value. When several keys have the same value, the key
+  which is set first is returned. The returned key is owned by keyed store and
+  it is valid until the next RedfishKeyedStoreSet() or RedfishKeyedStoreClose().
+
+  @param[in]  Store       The keyed store.
+  @param[in]  Value       The value to search.
+  @param[in]  ValueSize   The size of Value in bytes.
+  @param[out] Key         Returned key of Value.
+  @param[out] KeySize     Returned size of Key in bytes. Optional.
+
+  @retval EFI_SUCCESS             The key is found.
+  @retval EFI_NOT_FOUND           There is no record of Value.
+  @retval EFI_INVALID_PARAMETER   Store, Value or Key is NULL, or ValueSize is 0.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishKeyedStoreGetByValue (
+  IN  REDFISH_KEYED_STORE   *Store,
+  IN  CONST VOID            *Value,
+  IN  UINTN                 ValueSize,
+  OUT CONST VOID            **Key,
+  OUT UINTN                 *KeySize  OPTIONAL
+  )
+{
+  REDFISH_KEYED_STORE_RECORD  *Record;
+
+  if ((Store == NULL) || (Value == NULL) || (ValueSize == 0) || (Key == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Record = KeyedStoreFindRecordByValue (Store, Value, ValueSize);
+  if (Record == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  *Key = Record->Key;
+  if (KeySize != NULL) {
+    *KeySize = Record->KeySize;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Set the value of given key. The record is replaced when the key exists
+  already. Setting the same value again doesn't change the store.
+
+  @param[in]  Store       The keyed store.
+  @param[in]  Key         The key to set.
+  @param[in]  KeySize     The size of Key in bytes.
+  @param[in]  Value       The value of Key. If Value is NULL, the record of Key
+                          is removed.
+  @param[in]  ValueSize   The size of Value in bytes.
+
+  @retval EFI_SUCCESS             The record is set or removed.
+  @retval EFI_NOT_FOUND           Value is NULL and there is no record of Key.
+  @retval EFI_INVALID_PARAMETER   Store or Key is NULL, KeySize is 0, or Value is
+                                  not NULL and ValueSize is 0.
+  @retval EFI_BAD_BUFFER_SIZE     The record doesn't fit in one UEFI variable.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishKeyedStoreSet (
+  IN  REDFISH_KEYED_STORE   *Store,
+  IN  CONST VOID            *Key,
+  IN  UINTN                 KeySize,
+  IN  CONST VOID            *Value      OPTIONAL,
+  IN  UINTN                 ValueSize
+  )
+{
+  EFI_STATUS                  Status;
+  REDFISH_KEYED_STORE_RECORD  *Record;
+  UINTN                       PreferredChunk;
+  UINTN                       ReleasedSize;
+  UINTN                       ChunkIndex;
+  UINTN                       RecordSize;
+
+  if ((Store == NULL) || (Key == NULL) || (KeySize == 0) || ((Value != NULL) && (ValueSize == 0))) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Record = KeyedStoreFindRecord (Store, Key, KeySize);
+  if (Value == NULL) {
+    if (Record == NULL) {
+      return EFI_NOT_FOUND;
+    }
+
+    KeyedStoreRemoveRecord (Store, Record);
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Nothing to write when the value doesn't change.
+  //
+  if ((Record != NULL) && (Record->ValueSize == ValueSize) && (CompareMem (Record->Value, Value, ValueSize) == 0)) {
+    return EFI_SUCCESS;
+  }
+
+  RecordSize = REDFISH_KEYED_STORE_RECORD_FLASH_SIZE (KeySize, ValueSize);
+  if ((KeySize > MAX_UINT16) || (ValueSize > MAX_UINT16) ||
+      (sizeof (REDFISH_KEYED_STORE_CHUNK_HEADER) + RecordSize > Store->ChunkVariableSize))
+  {
+    return EFI_BAD_BUFFER_SIZE;
+  }
+
+  Status = KeyedStoreReserve (Store, 1);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Keep the new record in the same chunk as the old one if possible,
+  // so only one chunk is changed.
+  //
+  PreferredChunk = MAX_UINTN;
+  ReleasedSize   = 0;
+  if (Record != NULL) {
+    PreferredChunk = Record->Chunk;
+    ReleasedSize   = REDFISH_KEYED_STORE_RECORD_FLASH_SIZE (Record->KeySize, Record->ValueSize);
+  }
+
+  //
+  // The old record is dropped only after the new one is added, so the old
+  // value is kept if there is no room for the new one.
+  //
+  Status = KeyedStoreFindChunk (Store, RecordSize, PreferredChunk, ReleasedSize, &ChunkIndex);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = KeyedStoreAddRecord (Store, Key, KeySize, Value, ValueSize, ChunkIndex);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Store->Chunks[ChunkIndex]->Dirty = TRUE;
+
+  if (Record != NULL) {
+    KeyedStoreRemoveRecord (Store, Record);
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Save the records changed since last flush to UEFI variables.
+
+  @param[in]  Store   The keyed store.
+
+  @retval EFI_SUCCESS             The changed records are saved.
+  @retval EFI_INVALID_PARAMETER   Store is NULL.
+  @retval Others                  Failed to write UEFI variable.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishKeyedStoreFlush (
+  IN  REDFISH_KEYED_STORE   *Store
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       ChunkIndex;
+  UINTN       UsedChunkCount;
+
+  if (Store == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Empty chunks at the end are deleted. Empty chunks in the middle are kept
+  // on flash, because chunk variables are loaded until the first missing one.
+  //
+  UsedChunkCount = Store->ChunkCount;
+  while ((UsedChunkCount > 0) && (Store->Chunks[UsedChunkCount - 1]->RecordCount == 0)) {
+    UsedChunkCount--;
+  }
+
+  //
+  // Delete from the last one, so the chunks left on flash have no gap if
+  // the deletion is interrupted.
+  //
+  for (ChunkIndex = Store->FlashChunkCount; ChunkIndex > UsedChunkCount; ChunkIndex--) {
+    Status = KeyedStoreWriteChunk (Store, ChunkIndex - 1, TRUE);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    Store->FlashChunkCount = ChunkIndex - 1;
+  }
+
+  for (ChunkIndex = 0; ChunkIndex < UsedChunkCount; ChunkIndex++) {
+    if (!Store->Chunks[ChunkIndex]->Dirty && (ChunkIndex < Store->FlashChunkCount)) {
+      continue;
+    }
+
+    Status = KeyedStoreWriteChunk (Store, ChunkIndex, FALSE);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    Store->Chunks[ChunkIndex]->Dirty = FALSE;
+    if (ChunkIndex >= Store->FlashChunkCount) {
+      Store->FlashChunkCount = ChunkIndex + 1;
+    }
+  }
+
+  //
+  // Release the empty chunks at the end.
+  //
+  while (Store->ChunkCount > UsedChunkCount) {
+    Store->ChunkCount--;
+    FreePool (Store->Chunks[Store->ChunkCount]);
+  }
+
+  return EFI_SUCCESS;
+}
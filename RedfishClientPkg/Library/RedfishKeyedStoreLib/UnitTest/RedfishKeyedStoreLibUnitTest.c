@@ -0,0 +1,637 @@
+/** @file
+  Unit tests of RedfishKeyedStoreLib.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/PcdLib.h>
+#include <Library/PrintLib.h>
+#include <Library/UnitTestLib.h>
+#include <Library/RedfishKeyedStoreLib.h>
+
+#define UNIT_TEST_APP_NAME     "RedfishKeyedStoreLib Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+#define MOCK_VARIABLE_MAX        0x400
+#define MOCK_VARIABLE_NAME_SIZE  64
+#define TEST_STORE_NAME          L"KeyedStoreTest"
+
+///
+/// Variable kept by the mock UEFI variable services.
+///
+typedef struct {
+  BOOLEAN    InUse;
+  CHAR16     Name[MOCK_VARIABLE_NAME_SIZE];
+  EFI_GUID   Guid;
+  UINT32     Attributes;
+  UINTN      DataSize;
+  VOID       *Data;
+} MOCK_VARIABLE;
+
+STATIC MOCK_VARIABLE  mMockVariables[MOCK_VARIABLE_MAX];
+STATIC UINTN          mSetVariableCount;
+
+/**
+  Find the variable in the mock variable store.
+
+  @param[in]  VariableName  Name of variable.
+  @param[in]  VendorGuid    Guid of variable.
+
+  @retval MOCK_VARIABLE     The variable is found.
+  @retval NULL              There is no such variable.
+**/
+STATIC
+MOCK_VARIABLE *
+MockFindVariable (
+  IN CONST CHAR16    *VariableName,
+  IN CONST EFI_GUID  *VendorGuid
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < MOCK_VARIABLE_MAX; Index++) {
+    if (mMockVariables[Index].InUse &&
+        (StrCmp (mMockVariables[Index].Name, VariableName) == 0) &&
+        CompareGuid (&mMockVariables[Index].Guid, VendorGuid))
+    {
+      return &mMockVariables[Index];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Mock of EFI_RUNTIME_SERVICES.GetVariable().
+
+  @param[in]       VariableName  Name of variable.
+  @param[in]       VendorGuid    Guid of variable.
+  @param[out]      Attributes    Attributes of variable.
+  @param[in, out]  DataSize      Size of Data.
+  @param[out]      Data          Buffer to receive the data of variable.
+
+  @retval EFI_SUCCESS           The variable is returned.
+  @retval EFI_NOT_FOUND         The variable doesn't exist.
+  @retval EFI_BUFFER_TOO_SMALL  DataSize is too small.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockGetVariable (
+  IN     CHAR16    *VariableName,
+  IN     EFI_GUID  *VendorGuid,
+  OUT    UINT32    *Attributes OPTIONAL,
+  IN OUT UINTN     *DataSize,
+  OUT    VOID      *Data OPTIONAL
+  )
+{
+  MOCK_VARIABLE  *Variable;
+
+  Variable = MockFindVariable (VariableName, VendorGuid);
+  if (Variable == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  if (*DataSize < Variable->DataSize) {
+    *DataSize = Variable->DataSize;
+    return EFI_BUFFER_TOO_SMALL;
+  }
+
+  if (Attributes != NULL) {
+    *Attributes = Variable->Attributes;
+  }
+
+  *DataSize = Variable->DataSize;
+  CopyMem (Data, Variable->Data, Variable->DataSize);
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_RUNTIME_SERVICES.SetVariable().
+
+  @param[in]  VariableName  Name of variable.
+  @param[in]  VendorGuid    Guid of variable.
+  @param[in]  Attributes    Attributes of variable.
+  @param[in]  DataSize      Size of Data. Zero deletes the variable.
+  @param[in]  Data          Data of variable.
+
+  @retval EFI_SUCCESS           The variable is set or deleted.
+  @retval EFI_NOT_FOUND         The variable to delete doesn't exist.
+  @retval EFI_OUT_OF_RESOURCES  Mock variable store is full.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockSetVariable (
+  IN CHAR16    *VariableName,
+  IN EFI_GUID  *VendorGuid,
+  IN UINT32    Attributes,
+  IN UINTN     DataSize,
+  IN VOID      *Data
+  )
+{
+  MOCK_VARIABLE  *Variable;
+  UINTN          Index;
+
+  mSetVariableCount++;
+
+  Variable = MockFindVariable (VariableName, VendorGuid);
+  if (DataSize == 0) {
+    if (Variable == NULL) {
+      return EFI_NOT_FOUND;
+    }
+
+    FreePool (Variable->Data);
+    ZeroMem (Variable, sizeof (MOCK_VARIABLE));
+    return EFI_SUCCESS;
+  }
+
+  if (Variable == NULL) {
+    for (Index = 0; Index < MOCK_VARIABLE_MAX; Index++) {
+      if (!mMockVariables[Index].InUse) {
+        Variable = &mMockVariables[Index];
+        break;
+      }
+    }
+
+    if ((Variable == NULL) || (StrSize (VariableName) > sizeof (Variable->Name))) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Variable->InUse = TRUE;
+    StrCpyS (Variable->Name, MOCK_VARIABLE_NAME_SIZE, VariableName);
+    CopyGuid (&Variable->Guid, VendorGuid);
+  } else {
+    FreePool (Variable->Data);
+  }
+
+  Variable->Attributes = Attributes;
+  Variable->DataSize   = DataSize;
+  Variable->Data       = AllocateCopyPool (DataSize, Data);
+  return (Variable->Data == NULL) ? EFI_OUT_OF_RESOURCES : EFI_SUCCESS;
+}
+
+///
+/// Mock version of the UEFI Runtime Services Table
+///
+EFI_RUNTIME_SERVICES  MockRuntime = {
+  {
+    EFI_RUNTIME_SERVICES_SIGNATURE,     // Signature
+    EFI_RUNTIME_SERVICES_REVISION,      // Revision
+    sizeof (EFI_RUNTIME_SERVICES),      // HeaderSize
+    0,                                  // CRC32
+    0                                   // Reserved
+  },
+  NULL,               // GetTime
+  NULL,               // SetTime
+  NULL,               // GetWakeupTime
+  NULL,               // SetWakeupTime
+  NULL,               // SetVirtualAddressMap
+  NULL,               // ConvertPointer
+  MockGetVariable,    // GetVariable
+  NULL,               // GetNextVariableName
+  MockSetVariable,    // SetVariable
+  NULL,               // GetNextHighMonotonicCount
+  NULL,               // ResetSystem
+  NULL,               // UpdateCapsule
+  NULL,               // QueryCapsuleCapabilities
+  NULL                // QueryVariableInfo
+};
+
+/**
+  Count the variables in the mock variable store.
+
+  @retval Number of variables.
+**/
+STATIC
+UINTN
+MockVariableCount (
+  VOID
+  )
+{
+  UINTN  Index;
+  UINTN  Count;
+
+  Count = 0;
+  for (Index = 0; Index < MOCK_VARIABLE_MAX; Index++) {
+    if (mMockVariables[Index].InUse) {
+      Count++;
+    }
+  }
+
+  return Count;
+}
+
+/**
+  Remove all variables from the mock variable store before each test.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED  The mock variable store is empty.
+**/
+STATIC
+UNIT_TEST_STATUS
+EFIAPI
+ClearMockVariables (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < MOCK_VARIABLE_MAX; Index++) {
+    if (mMockVariables[Index].InUse) {
+      FreePool (mMockVariables[Index].Data);
+    }
+  }
+
+  ZeroMem (mMockVariables, sizeof (mMockVariables));
+  mSetVariableCount = 0;
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Build the test key and value of given index.
+
+  @param[in]   Index   Index of the record.
+  @param[out]  Key     Buffer to receive key string.
+  @param[out]  Value   Buffer to receive value string.
+**/
+STATIC
+VOID
+TestRecord (
+  IN  UINTN  Index,
+  OUT CHAR8  Key[64],
+  OUT CHAR8  Value[32]
+  )
+{
+  AsciiSPrint (Key, 64, "/redfish/v1/Systems/1/Memory/%d", Index);
+  AsciiSPrint (Value, 32, "W/\"%d\"", Index);
+}
+
+/**
+  Records set in the store are returned by key and by value.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+SetAndGetShouldSucceed (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  REDFISH_KEYED_STORE  *Store;
+  CHAR8                Key[64];
+  CHAR8                Value[32];
+  CONST VOID           *Result;
+  UINTN                ResultSize;
+  UINTN                Index;
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreOpen (TEST_STORE_NAME, &Store));
+  UT_ASSERT_EQUAL (RedfishKeyedStoreCount (Store), 0);
+
+  for (Index = 0; Index < 100; Index++) {
+    TestRecord (Index, Key, Value);
+    UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreSet (Store, Key, AsciiStrSize (Key), Value, AsciiStrSize (Value)));
+  }
+
+  UT_ASSERT_EQUAL (RedfishKeyedStoreCount (Store), 100);
+
+  for (Index = 0; Index < 100; Index++) {
+    TestRecord (Index, Key, Value);
+    UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreGet (Store, Key, AsciiStrSize (Key), &Result, &ResultSize));
+    UT_ASSERT_EQUAL (ResultSize, AsciiStrSize (Value));
+    UT_ASSERT_MEM_EQUAL (Result, Value, ResultSize);
+
+    UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreGetByValue (Store, Value, AsciiStrSize (Value), &Result, &ResultSize));
+    UT_ASSERT_EQUAL (ResultSize, AsciiStrSize (Key));
+    UT_ASSERT_MEM_EQUAL (Result, Key, ResultSize);
+  }
+
+  UT_ASSERT_STATUS_EQUAL (RedfishKeyedStoreGet (Store, "NotExist", sizeof ("NotExist"), &Result, &ResultSize), EFI_NOT_FOUND);
+  UT_ASSERT_STATUS_EQUAL (RedfishKeyedStoreSet (Store, Key, 0, Value, AsciiStrSize (Value)), EFI_INVALID_PARAMETER);
+  UT_ASSERT_STATUS_EQUAL (RedfishKeyedStoreSet (Store, Key, AsciiStrSize (Key), Value, 0), EFI_INVALID_PARAMETER);
+
+  RedfishKeyedStoreClose (Store);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Setting an existing key replaces its value. Setting the same value again
+  doesn't change the store.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+OverwriteShouldReplaceValue (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  REDFISH_KEYED_STORE  *Store;
+  CHAR8                Key[64];
+  CHAR8                Value[32];
+  CONST VOID           *Result;
+  UINTN                ResultSize;
+  UINTN                SetCount;
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreOpen (TEST_STORE_NAME, &Store));
+
+  TestRecord (1, Key, Value);
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreSet (Store, Key, AsciiStrSize (Key), Value, AsciiStrSize (Value)));
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreSet (Store, Key, AsciiStrSize (Key), "W/\"Longer value\"", sizeof ("W/\"Longer value\"")));
+  UT_ASSERT_EQUAL (RedfishKeyedStoreCount (Store), 1);
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreGet (Store, Key, AsciiStrSize (Key), &Result, &ResultSize));
+  UT_ASSERT_EQUAL (ResultSize, sizeof ("W/\"Longer value\""));
+  UT_ASSERT_MEM_EQUAL (Result, "W/\"Longer value\"", ResultSize);
+  UT_ASSERT_STATUS_EQUAL (RedfishKeyedStoreGetByValue (Store, Value, AsciiStrSize (Value), &Result, &ResultSize), EFI_NOT_FOUND);
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreFlush (Store));
+  SetCount = mSetVariableCount;
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreSet (Store, Key, AsciiStrSize (Key), "W/\"Longer value\"", sizeof ("W/\"Longer value\"")));
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreFlush (Store));
+  UT_ASSERT_EQUAL (mSetVariableCount, SetCount);
+
+  RedfishKeyedStoreClose (Store);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Setting NULL value removes the record of key.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+DeleteShouldRemoveRecord (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  REDFISH_KEYED_STORE  *Store;
+  CHAR8                Key[64];
+  CHAR8                Value[32];
+  CONST VOID           *Result;
+  UINTN                ResultSize;
+  UINTN                Index;
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreOpen (TEST_STORE_NAME, &Store));
+  for (Index = 0; Index < 10; Index++) {
+    TestRecord (Index, Key, Value);
+    UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreSet (Store, Key, AsciiStrSize (Key), Value, AsciiStrSize (Value)));
+  }
+
+  TestRecord (3, Key, Value);
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreSet (Store, Key, AsciiStrSize (Key), NULL, 0));
+  UT_ASSERT_EQUAL (RedfishKeyedStoreCount (Store), 9);
+  UT_ASSERT_STATUS_EQUAL (RedfishKeyedStoreGet (Store, Key, AsciiStrSize (Key), &Result, &ResultSize), EFI_NOT_FOUND);
+  UT_ASSERT_STATUS_EQUAL (RedfishKeyedStoreGetByValue (Store, Value, AsciiStrSize (Value), &Result, &ResultSize), EFI_NOT_FOUND);
+  UT_ASSERT_STATUS_EQUAL (RedfishKeyedStoreSet (Store, Key, AsciiStrSize (Key), NULL, 0), EFI_NOT_FOUND);
+
+  TestRecord (4, Key, Value);
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreGet (Store, Key, AsciiStrSize (Key), &Result, &ResultSize));
+  UT_ASSERT_MEM_EQUAL (Result, Value, ResultSize);
+
+  RedfishKeyedStoreClose (Store);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Flushed records are loaded again from the chunk variables. Chunk variables
+  which become empty at the end are deleted.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+FlushShouldPersistRecords (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  REDFISH_KEYED_STORE  *Store;
+  CHAR8                Key[64];
+  CHAR8                Value[32];
+  CONST VOID           *Result;
+  UINTN                ResultSize;
+  UINTN                Index;
+  UINTN                VariableCount;
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreOpen (TEST_STORE_NAME, &Store));
+  for (Index = 0; Index < 200; Index++) {
+    TestRecord (Index, Key, Value);
+    UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreSet (Store, Key, AsciiStrSize (Key), Value, AsciiStrSize (Value)));
+  }
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreFlush (Store));
+  VariableCount = MockVariableCount ();
+  UT_ASSERT_TRUE (VariableCount > 1);
+  RedfishKeyedStoreClose (Store);
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreOpen (TEST_STORE_NAME, &Store));
+  UT_ASSERT_EQUAL (RedfishKeyedStoreCount (Store), 200);
+  for (Index = 0; Index < 200; Index++) {
+    TestRecord (Index, Key, Value);
+    UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreGet (Store, Key, AsciiStrSize (Key), &Result, &ResultSize));
+    UT_ASSERT_MEM_EQUAL (Result, Value, ResultSize);
+  }
+
+  for (Index = 0; Index < 200; Index++) {
+    TestRecord (Index, Key, Value);
+    UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreSet (Store, Key, AsciiStrSize (Key), NULL, 0));
+  }
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreFlush (Store));
+  UT_ASSERT_EQUAL (MockVariableCount (), 0);
+  RedfishKeyedStoreClose (Store);
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreOpen (TEST_STORE_NAME, &Store));
+  UT_ASSERT_EQUAL (RedfishKeyedStoreCount (Store), 0);
+  RedfishKeyedStoreClose (Store);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  When the new value has no room in the store, the set fails and the old
+  value of key is kept. The test component sets a small chunk variable size
+  so the store runs out of chunks quickly.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+FullStoreShouldKeepOldValue (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  REDFISH_KEYED_STORE  *Store;
+  CHAR8                Key[16];
+  UINTN                ChunkSize;
+  CHAR8                *LargeValue;
+  UINTN                LargeValueSize;
+  CONST VOID           *Result;
+  UINTN                ResultSize;
+  UINTN                Index;
+  EFI_STATUS           Status;
+
+  ChunkSize  = PcdGet32 (PcdRedfishKeyedStoreChunkSize);
+  LargeValue = AllocatePool (ChunkSize);
+  UT_ASSERT_NOT_NULL (LargeValue);
+
+  //
+  // Both "a" and "b" are kept in the first chunk.
+  //
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreOpen (TEST_STORE_NAME, &Store));
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreSet (Store, "a", sizeof ("a"), "1", sizeof ("1")));
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreSet (Store, "b", sizeof ("b"), "2", sizeof ("2")));
+
+  //
+  // The record which doesn't fit in one chunk variable is rejected.
+  //
+  SetMem (LargeValue, ChunkSize, 'a');
+  UT_ASSERT_STATUS_EQUAL (RedfishKeyedStoreSet (Store, "a", sizeof ("a"), LargeValue, ChunkSize), EFI_BAD_BUFFER_SIZE);
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreGet (Store, "a", sizeof ("a"), &Result, &ResultSize));
+  UT_ASSERT_MEM_EQUAL (Result, "1", sizeof ("1"));
+
+  //
+  // Fill every chunk the store can have. Each record below takes more than
+  // half of a chunk, so every new record takes a new chunk.
+  //
+  LargeValueSize = ChunkSize / 2 + 8;
+  for (Index = 0; ; Index++) {
+    AsciiSPrint (Key, sizeof (Key), "%d", Index);
+    Status = RedfishKeyedStoreSet (Store, Key, AsciiStrSize (Key), LargeValue, LargeValueSize);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+  }
+
+  UT_ASSERT_STATUS_EQUAL (Status, EFI_OUT_OF_RESOURCES);
+  UT_ASSERT_EQUAL (RedfishKeyedStoreCount (Store), Index + 2);
+
+  //
+  // New value of "a" fits in one chunk, but neither in the first chunk
+  // next to "b" nor in any other chunk.
+  //
+  LargeValueSize = ChunkSize - 18;
+  SetMem (LargeValue, LargeValueSize, 'b');
+  UT_ASSERT_STATUS_EQUAL (RedfishKeyedStoreSet (Store, "a", sizeof ("a"), LargeValue, LargeValueSize), EFI_OUT_OF_RESOURCES);
+  UT_ASSERT_EQUAL (RedfishKeyedStoreCount (Store), Index + 2);
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreGet (Store, "a", sizeof ("a"), &Result, &ResultSize));
+  UT_ASSERT_EQUAL (ResultSize, sizeof ("1"));
+  UT_ASSERT_MEM_EQUAL (Result, "1", ResultSize);
+
+  //
+  // A value which fits in the chunk of old record once the old record is
+  // dropped still replaces it.
+  //
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreSet (Store, "a", sizeof ("a"), "W/\"New\"", sizeof ("W/\"New\"")));
+  UT_ASSERT_EQUAL (RedfishKeyedStoreCount (Store), Index + 2);
+  UT_ASSERT_NOT_EFI_ERROR (RedfishKeyedStoreGet (Store, "a", sizeof ("a"), &Result, &ResultSize));
+  UT_ASSERT_EQUAL (ResultSize, sizeof ("W/\"New\""));
+  UT_ASSERT_MEM_EQUAL (Result, "W/\"New\"", ResultSize);
+
+  FreePool (LargeValue);
+  RedfishKeyedStoreClose (Store);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  Redfish keyed store library and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      KeyedStoreTests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  Status = CreateUnitTestSuite (&KeyedStoreTests, Framework, "Redfish Keyed Store Tests", "RedfishKeyedStoreLib", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for Redfish Keyed Store Tests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite-------------Description--------------------------Name---------Function--------------------Pre-----------------Post---Context
+  //
+  AddTestCase (KeyedStoreTests, "Set and get records",               "SetGet",    SetAndGetShouldSucceed,      ClearMockVariables, NULL, NULL);
+  AddTestCase (KeyedStoreTests, "Overwrite the value of key",        "Overwrite", OverwriteShouldReplaceValue, ClearMockVariables, NULL, NULL);
+  AddTestCase (KeyedStoreTests, "Delete the record of key",          "Delete",    DeleteShouldRemoveRecord,    ClearMockVariables, NULL, NULL);
+  AddTestCase (KeyedStoreTests, "Reload flushed records",            "Flush",     FlushShouldPersistRecords,   ClearMockVariables, NULL, NULL);
+  AddTestCase (KeyedStoreTests, "Keep old value when store is full", "Full",      FullStoreShouldKeepOldValue, ClearMockVariables, NULL, NULL);
+
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+///
+/// Avoid ECC error for function name that starts with lower case letter
+///
+#define RedfishKeyedStoreLibUnitTestMain  main
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+
+  @param[in] Argc  Number of arguments
+  @param[in] Argv  Array of pointers to arguments
+
+  @retval 0      Success
+  @retval other  Error
+**/
+INT32
+RedfishKeyedStoreLibUnitTestMain (
+  IN INT32  Argc,
+  IN CHAR8  *Argv[]
+  )
+{
+  UnitTestingEntry ();
+  return 0;
+}
@@ -77,6 +77,24 @@
 #define ODATA_TYPE_NAME_MAX_SIZE  128
 #define ODATA_TYPE_MAX_SIZE       128
 
+///
+/// Query parameters Redfish service supports, reported in ProtocolFeaturesSupported
+/// of service root. See RedfishGetQueryFeatures().
+///
+#define REDFISH_QUERY_FEATURE_EXPAND_ALL       BIT0   ///< $expand=*
+#define REDFISH_QUERY_FEATURE_EXPAND_LINKS     BIT1   ///< $expand=~
+#define REDFISH_QUERY_FEATURE_EXPAND_NO_LINKS  BIT2   ///< $expand=.
+#define REDFISH_QUERY_FEATURE_EXPAND_LEVELS    BIT3   ///< $levels in $expand
+#define REDFISH_QUERY_FEATURE_SELECT           BIT4   ///< $select
+#define REDFISH_QUERY_FEATURE_ONLY             BIT5   ///< only
+#define REDFISH_QUERY_FEATURE_FILTER           BIT6   ///< $filter
+
+///
+/// Expand the subordinate resources, not the ones under Links, by one level.
+/// A collection returned with this query carries its members inline.
+///
+#define REDFISH_QUERY_EXPAND_ONE_LEVEL         "$expand=.($levels=1)"
+
 ///
 /// Library class public defines
 ///
@@ -93,6 +111,17 @@ typedef struct {
   REDFISH_PAYLOAD       Payload;
 } REDFISH_RESPONSE;
 
+///
+/// The asynchronous GET request of RedfishGetByUriAsync().
+///
+typedef struct {
+  EFI_STATUS            Status;       ///< EFI_NOT_READY until the request completes, then the
+                                      ///< status RedfishGetByUri() returns for the same URI.
+  REDFISH_RESPONSE      Response;     ///< The Redfish response once the request completes.
+  CHAR8                 *Uri;         ///< Internal use.
+  VOID                  *Context;     ///< Internal use.
+} REDFISH_ASYNC_REQUEST;
+
 ///
 /// Odata type-name mapping structure.
 ///
@@ -132,6 +161,45 @@ RedfishCleanupService (
   IN REDFISH_SERVICE   RedfishService
   );
 
+/**
+  Create a Redfish service which uses the Redfish session of given X-Auth-Token.
+  The session is logged in by the caller, e.g. by another driver, and this
+  function does not log in again. The service root versions are retrieved and
+  kept in the returned service, so it works only in the image calling this
+  function.
+
+  Callers are responsible for freeing the returned service by RedfishCleanupService().
+  The session is not logged out when the service is freed.
+
+  @param[in]  RedfishConfigServiceInfo Redfish service information the EFI Redfish
+                                       feature driver communicates with.
+  @param[in]  SessionToken             X-Auth-Token of the Redfish session.
+
+  @return     New created Redfish Service, or NULL if error happens.
+
+**/
+REDFISH_SERVICE
+EFIAPI
+RedfishCreateServiceWithSessionToken (
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION   *RedfishConfigServiceInfo,
+  IN  CONST CHAR8                          *SessionToken
+  );
+
+/**
+  Get the X-Auth-Token of the Redfish session the given service logged in.
+
+  @param[in]    RedfishService     The Service to access the Redfish resources.
+
+  @return     The X-Auth-Token owned by RedfishService, or NULL if the service
+              does not use Redfish session.
+
+**/
+CONST CHAR8 *
+EFIAPI
+RedfishGetSessionToken (
+  IN REDFISH_SERVICE   RedfishService
+  );
+
 /**
   Create REDFISH_PAYLOAD instance in local with JSON represented resource value and
   the Redfish Service.
@@ -214,6 +282,9 @@ RedfishBuildPathWithSystemUuid (
   Get a redfish response addressed by a RedPath string, including HTTP StatusCode, Headers
   and Payload which record any HTTP response messages.
 
+  The URI a RedPath is resolved to is remembered, so the following request of the same
+  RedPath retrieves the URI directly as long as the resource carries the same ETag.
+
   Callers are responsible for freeing the HTTP StatusCode, Headers and Payload returned in
   redfish response data.
 
@@ -271,6 +342,186 @@ RedfishGetByUri (
   OUT    REDFISH_RESPONSE     *RedResponse
   );
 
+/**
+  Get a redfish response addressed by URI only when the resource is changed, including
+  HTTP StatusCode, Headers and Payload which record any HTTP response messages.
+
+  The ETag in IfNoneMatch is sent in If-None-Match header, and the service replies
+  HTTP 304 without message body if the resource still carries the same ETag.
+
+  Callers are responsible for freeing the HTTP StatusCode, Headers and Payload returned in
+  redfish response data.
+
+  @param[in]    RedfishService    The Service to access the URI resources.
+  @param[in]    Uri               String to address a resource.
+  @param[in]    IfNoneMatch       ETag of the resource callers already have. If NULL,
+                                  the resource is always returned.
+  @param[out]   RedResponse       Pointer to the Redfish response data.
+
+  @retval EFI_SUCCESS             The opeartion is successful, indicates the HTTP StatusCode is not
+                                  NULL and the value is 2XX. The corresponding redfish resource has
+                                  been returned in Payload within RedResponse.
+  @retval EFI_ALREADY_STARTED     The resource is not changed since IfNoneMatch. Nothing is
+                                  returned in RedResponse.
+  @retval EFI_INVALID_PARAMETER   RedfishService, Uri, or RedResponse is NULL.
+  @retval EFI_DEVICE_ERROR        An unexpected system or network error occurred. Callers can get
+                                  more error info from returned HTTP StatusCode, Headers and Payload
+                                  within RedResponse:
+                                  1. If the returned Payload is NULL, indicates any error happen.
+                                  2. If the returned StatusCode is NULL, indicates any error happen.
+                                  3. If the returned StatusCode is not 2XX, indicates any error happen.
+**/
+EFI_STATUS
+EFIAPI
+RedfishGetByUriIfNoneMatch (
+  IN     REDFISH_SERVICE      RedfishService,
+  IN     CONST CHAR8          *Uri,
+  IN     CONST CHAR8          *IfNoneMatch OPTIONAL,
+  OUT    REDFISH_RESPONSE     *RedResponse
+  );
+
+/**
+  Start getting a redfish response addressed by URI without waiting for it. Several
+  requests are in flight on the connection at the same time, RedfishWaitAsyncRequests()
+  waits for them to complete.
+
+  The request completes right away if the response is in cache, or if REST EX driver
+  doesn't support asynchronous request, in which case the resource is retrieved by
+  RedfishGetByUri() before this function returns.
+
+  Callers are responsible for freeing the HTTP StatusCode, Headers and Payload returned in
+  Response of the completed request by RedfishFreeResponse() as usual.
+
+  @param[in]    RedfishService    The Service to access the URI resources.
+  @param[in]    Uri               String to address a resource.
+  @param[out]   Request           The asynchronous request to start.
+
+  @retval EFI_SUCCESS             The request is started or completed. Check Status in Request
+                                  for the result.
+  @retval EFI_INVALID_PARAMETER   RedfishService, Uri, or Request is NULL.
+  @retval Others                  Fail to start the request.
+**/
+EFI_STATUS
+EFIAPI
+RedfishGetByUriAsync (
+  IN     REDFISH_SERVICE          RedfishService,
+  IN     CONST CHAR8              *Uri,
+  OUT    REDFISH_ASYNC_REQUEST    *Request
+  );
+
+/**
+  Wait for the asynchronous requests started by RedfishGetByUriAsync() to complete.
+  The successful responses are kept in cache, so RedfishGetByUri() of the same URI
+  doesn't go to Redfish service again.
+
+  @param[in]      RedfishService    The Service the requests are sent to.
+  @param[in]      RequestCount      Number of requests in Requests.
+  @param[in,out]  Requests          Array of asynchronous requests.
+
+  @retval EFI_SUCCESS             All requests complete. Check Status in each request for
+                                  the result.
+  @retval EFI_INVALID_PARAMETER   RedfishService or Requests is NULL.
+**/
+EFI_STATUS
+EFIAPI
+RedfishWaitAsyncRequests (
+  IN     REDFISH_SERVICE          RedfishService,
+  IN     UINTN                    RequestCount,
+  IN OUT REDFISH_ASYNC_REQUEST    *Requests
+  );
+
+/**
+  Start getting a redfish resource addressed by URI in background. Nothing is
+  returned to caller. The response is kept in cache once it arrives, and the
+  following RedfishGetByUri() of the same URI waits for this request instead
+  of sending another one.
+
+  Unlike RedfishGetByUriAsync(), this function never waits for Redfish service.
+
+  @param[in]    RedfishService    The Service to access the URI resources.
+  @param[in]    Uri               String to address a resource.
+
+  @retval EFI_SUCCESS             The request is started, or the resource is in
+                                  cache or on the way already.
+  @retval EFI_INVALID_PARAMETER   RedfishService or Uri is NULL.
+  @retval EFI_UNSUPPORTED         REST EX driver doesn't support asynchronous request.
+  @retval Others                  Fail to start the request.
+**/
+EFI_STATUS
+EFIAPI
+RedfishPrefetchByUri (
+  IN     REDFISH_SERVICE      RedfishService,
+  IN     CONST CHAR8          *Uri
+  );
+
+/**
+  Return the query parameters the Redfish service supports. The service root is
+  retrieved on the first call, and the result is kept in RedfishService.
+
+  @param[in]    RedfishService    The Service to check.
+
+  @return       The REDFISH_QUERY_FEATURE_XXX bits. 0 if the service doesn't report
+                ProtocolFeaturesSupported or any error happens.
+**/
+UINT32
+EFIAPI
+RedfishGetQueryFeatures (
+  IN     REDFISH_SERVICE      RedfishService
+  );
+
+/**
+  Get a redfish response addressed by URI with OData query options, for example
+  REDFISH_QUERY_EXPAND_ONE_LEVEL or "$select=Name,Status". Callers should check
+  RedfishGetQueryFeatures() before using the query options, services reject or
+  ignore the ones they don't support.
+
+  Callers are responsible for freeing the HTTP StatusCode, Headers and Payload returned in
+  redfish response data.
+
+  @param[in]    RedfishService    The Service to access the URI resources.
+  @param[in]    Uri               String to address a resource.
+  @param[in]    Query             Query options without the leading '?'. Options are
+                                  separated by '&'.
+  @param[out]   RedResponse       Pointer to the Redfish response data.
+
+  @retval EFI_SUCCESS             The HTTP StatusCode is 2XX, the resource is in Payload.
+  @retval EFI_INVALID_PARAMETER   RedfishService, Uri, Query or RedResponse is NULL.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to build the request.
+  @retval EFI_DEVICE_ERROR        Any error happens. See RedfishGetByUri().
+**/
+EFI_STATUS
+EFIAPI
+RedfishGetByUriWithQuery (
+  IN     REDFISH_SERVICE      RedfishService,
+  IN     CONST CHAR8          *Uri,
+  IN     CONST CHAR8          *Query,
+  OUT    REDFISH_RESPONSE     *RedResponse
+  );
+
+/**
+  Keep the members expanded inline in a collection payload in cache, so the
+  following RedfishGetByUri() of member URIs doesn't go to Redfish service, and
+  replace them with the links to members. The collection payload looks the same
+  as one retrieved without $expand afterwards.
+
+  @param[in]      RedfishService    The Service the collection comes from.
+  @param[in,out]  Payload           The collection payload.
+  @param[out]     CachedCount       Number of members kept in cache. Optional.
+
+  @retval EFI_SUCCESS             The expanded members are kept in cache. Members which
+                                  are links already are left as is.
+  @retval EFI_INVALID_PARAMETER   RedfishService or Payload is NULL, or Payload is not
+                                  a collection.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory.
+**/
+EFI_STATUS
+EFIAPI
+RedfishCacheExpandedMembers (
+  IN     REDFISH_SERVICE      RedfishService,
+  IN OUT REDFISH_PAYLOAD      Payload,
+  OUT    UINTN                *CachedCount OPTIONAL
+  );
+
 /**
   Get a redfish response addressed by the input Payload and relative RedPath string,
   including HTTP StatusCode, Headers and Payload which record any HTTP response messages.
@@ -497,6 +748,21 @@ RedfishFreeResponse (
   IN EFI_HTTP_HEADER       *Headers,
   IN REDFISH_PAYLOAD       Payload
   );
+/**
+  Drop the cached Redfish GET responses. Responses retrieved by RedfishGetByUri()
+  are kept until the resource is changed by PATCH, POST or DELETE, or this
+  function is called. Callers should flush the cache when a provisioning cycle
+  begins or ends so that stale resources are never used.
+
+  @param[in]  RedfishService  Drop the responses of this service only. If NULL,
+                              all cached responses are dropped.
+
+**/
+VOID
+EFIAPI
+RedfishFlushHttpCache (
+  IN REDFISH_SERVICE  RedfishService OPTIONAL
+  );
 
 /**
   Check if the "@odata.type" in Payload is valid or not.
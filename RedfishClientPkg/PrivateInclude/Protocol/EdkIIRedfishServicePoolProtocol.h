@@ -0,0 +1,83 @@
+/** @file
+  This file defines the EDKII_REDFISH_SERVICE_POOL_PROTOCOL interface.
+
+  Redfish service pool keeps one Redfish service for each Redfish service
+  information and shares its authenticated session among all the feature
+  drivers, so the session login is done once and the session is released when
+  the last feature driver stops using it.
+
+  Only plain data crosses the image boundary. The Redfish service itself keeps
+  JSON objects which belong to the image creating them, so each feature driver
+  creates its own service with the shared session token by
+  RedfishCreateServiceWithSessionToken().
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef EDKII_REDFISH_SERVICE_POOL_PROTOCOL_H_
+#define EDKII_REDFISH_SERVICE_POOL_PROTOCOL_H_
+
+#include <Library/RedfishLib.h>
+
+typedef struct _EDKII_REDFISH_SERVICE_POOL_PROTOCOL EDKII_REDFISH_SERVICE_POOL_PROTOCOL;
+
+/**
+  Get the session of given Redfish service information. The session is logged
+  in when this is the first request of the service, otherwise the existing
+  session is returned and its reference count is increased.
+
+  Each successful call must be paired with one call of
+  EDKII_REDFISH_SERVICE_POOL_PROTOCOL.Release() with the same service information.
+
+  @param[in]   This                      Pointer to EDKII_REDFISH_SERVICE_POOL_PROTOCOL instance.
+  @param[in]   RedfishConfigServiceInfo  Redfish service information.
+  @param[out]  SessionToken              On return, a copy of the X-Auth-Token of the
+                                         session. Caller frees it by FreePool(). It is
+                                         NULL when the platform does not use Redfish
+                                         session, and caller creates its own service
+                                         by RedfishCreateService() in this case.
+
+  @retval EFI_SUCCESS              The session token is returned.
+  @retval EFI_INVALID_PARAMETER    RedfishConfigServiceInfo or SessionToken is NULL.
+  @retval EFI_DEVICE_ERROR         Failed to create the service.
+  @retval EFI_OUT_OF_RESOURCES     Not enough memory.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REDFISH_SERVICE_POOL_ACQUIRE) (
+  IN  EDKII_REDFISH_SERVICE_POOL_PROTOCOL  *This,
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION   *RedfishConfigServiceInfo,
+  OUT CHAR8                                **SessionToken
+  );
+
+/**
+  Release the session returned by EDKII_REDFISH_SERVICE_POOL_PROTOCOL.Acquire().
+  The service in the pool is freed when it is not used by anyone.
+
+  @param[in]   This                      Pointer to EDKII_REDFISH_SERVICE_POOL_PROTOCOL instance.
+  @param[in]   RedfishConfigServiceInfo  Redfish service information given to Acquire().
+
+  @retval EFI_SUCCESS              The session is released.
+  @retval EFI_INVALID_PARAMETER    RedfishConfigServiceInfo is NULL.
+  @retval EFI_NOT_FOUND            There is no session of RedfishConfigServiceInfo in the pool.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REDFISH_SERVICE_POOL_RELEASE) (
+  IN  EDKII_REDFISH_SERVICE_POOL_PROTOCOL  *This,
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION   *RedfishConfigServiceInfo
+  );
+
+struct _EDKII_REDFISH_SERVICE_POOL_PROTOCOL {
+  EDKII_REDFISH_SERVICE_POOL_ACQUIRE  Acquire;
+  EDKII_REDFISH_SERVICE_POOL_RELEASE  Release;
+};
+
+extern EFI_GUID gEdkIIRedfishServicePoolProtocolGuid;
+
+#endif
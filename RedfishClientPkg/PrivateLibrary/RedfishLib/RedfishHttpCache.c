@@ -0,0 +1,820 @@
+/** @file
+  Redfish HTTP response cache.
+
+  Feature drivers retrieve the same resource several times during one
+  provisioning cycle (schema detection, identify, check, consume and update).
+  The successful GET responses are kept here, keyed by Redfish service, URI
+  and the ETag the service reported, so that only the first retrieval goes to
+  the wire. Any PATCH, POST or DELETE against the URI invalidates its entry
+  and the whole cache is flushed at provisioning cycle boundaries.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishMisc.h"
+
+//
+// Definition of REDFISH_HTTP_CACHE_DATA
+//
+typedef struct {
+  LIST_ENTRY              List;
+  LIST_ENTRY              BucketList;
+  UINT32                  Hash;
+  REDFISH_SERVICE         Service;
+  CHAR8                   *Uri;
+  CHAR8                   *ETag;
+  EFI_HTTP_STATUS_CODE    StatusCode;
+  UINTN                   HeaderCount;
+  EFI_HTTP_HEADER         *Headers;
+  EDKII_JSON_VALUE        JsonValue;
+} REDFISH_HTTP_CACHE_DATA;
+
+#define REDFISH_HTTP_CACHE_DATA_FROM_LIST(a)    BASE_CR (a, REDFISH_HTTP_CACHE_DATA, List)
+#define REDFISH_HTTP_CACHE_DATA_FROM_BUCKET(a)  BASE_CR (a, REDFISH_HTTP_CACHE_DATA, BucketList)
+
+#define REDFISH_HTTP_CACHE_INITIAL_BUCKETS  64
+
+LIST_ENTRY  mRedfishHttpCacheList = INITIALIZE_LIST_HEAD_VARIABLE (mRedfishHttpCacheList);
+
+//
+// Hash index of the cache entries. The key is the service and the URI, the
+// number of buckets is power of two.
+//
+LIST_ENTRY  *mRedfishHttpCacheBucket     = NULL;
+UINTN       mRedfishHttpCacheBucketCount = 0;
+UINTN       mRedfishHttpCacheCount       = 0;
+
+/**
+  Calculate the hash value of the given service and URI.
+
+  @param[in]  RedfishService  The Service the URI belongs to.
+  @param[in]  Uri             Relative path to address the resource.
+
+  @retval UINT32              Hash value of RedfishService and Uri.
+
+**/
+UINT32
+RedfishHttpCacheHash (
+  IN REDFISH_SERVICE  RedfishService,
+  IN CONST CHAR8      *Uri
+  )
+{
+  UINT32       Hash;
+  UINTN        Service;
+  UINTN        Index;
+  CONST CHAR8  *Char;
+
+  //
+  // FNV-1a over the service pointer and the URI.
+  //
+  Hash    = 2166136261U;
+  Service = (UINTN)RedfishService;
+  for (Index = 0; Index < sizeof (UINTN); Index++) {
+    Hash    ^= (UINT32)(Service & 0xFF);
+    Hash    *= 16777619U;
+    Service >>= 8;
+  }
+
+  for (Char = Uri; *Char != '\0'; Char++) {
+    Hash ^= (UINT32)(UINT8)*Char;
+    Hash *= 16777619U;
+  }
+
+  return Hash;
+}
+
+/**
+  Make sure the hash index has room for one more entry without exceeding one
+  entry per bucket on average. Buckets are doubled and entries are rehashed
+  when the cache grows.
+
+  @retval EFI_SUCCESS             The index is ready for insertion.
+  @retval EFI_OUT_OF_RESOURCES    No bucket can be allocated.
+
+**/
+EFI_STATUS
+RedfishHttpCacheReserve (
+  VOID
+  )
+{
+  UINTN                    BucketCount;
+  UINTN                    BucketIndex;
+  LIST_ENTRY               *Bucket;
+  LIST_ENTRY               *Node;
+  REDFISH_HTTP_CACHE_DATA  *CacheData;
+
+  BucketCount = (mRedfishHttpCacheBucketCount == 0) ? REDFISH_HTTP_CACHE_INITIAL_BUCKETS : mRedfishHttpCacheBucketCount;
+  while (BucketCount < mRedfishHttpCacheCount + 1) {
+    BucketCount *= 2;
+  }
+
+  if (BucketCount == mRedfishHttpCacheBucketCount) {
+    return EFI_SUCCESS;
+  }
+
+  Bucket = AllocatePool (BucketCount * sizeof (LIST_ENTRY));
+  if (Bucket == NULL) {
+    //
+    // Index still works with longer chains as long as there is a bucket.
+    //
+    return (mRedfishHttpCacheBucket == NULL) ? EFI_OUT_OF_RESOURCES : EFI_SUCCESS;
+  }
+
+  for (BucketIndex = 0; BucketIndex < BucketCount; BucketIndex++) {
+    InitializeListHead (&Bucket[BucketIndex]);
+  }
+
+  for (BucketIndex = 0; BucketIndex < mRedfishHttpCacheBucketCount; BucketIndex++) {
+    while (!IsListEmpty (&mRedfishHttpCacheBucket[BucketIndex])) {
+      Node = GetFirstNode (&mRedfishHttpCacheBucket[BucketIndex]);
+      RemoveEntryList (Node);
+      CacheData = REDFISH_HTTP_CACHE_DATA_FROM_BUCKET (Node);
+      InsertTailList (&Bucket[CacheData->Hash & (BucketCount - 1)], Node);
+    }
+  }
+
+  if (mRedfishHttpCacheBucket != NULL) {
+    FreePool (mRedfishHttpCacheBucket);
+  }
+
+  mRedfishHttpCacheBucket      = Bucket;
+  mRedfishHttpCacheBucketCount = BucketCount;
+  return EFI_SUCCESS;
+}
+
+/**
+  Duplicate the given HTTP header array.
+
+  @param[in]  HeaderCount     Number of HTTP header structures in Headers list.
+  @param[in]  Headers         Array containing list of HTTP headers.
+
+  @return     Newly allocated copy of Headers, or NULL if error happens.
+
+**/
+EFI_HTTP_HEADER *
+RedfishHttpCacheCopyHeaders (
+  IN UINTN            HeaderCount,
+  IN EFI_HTTP_HEADER  *Headers
+  )
+{
+  EFI_HTTP_HEADER  *Buffer;
+  UINTN            Index;
+
+  if (HeaderCount == 0 || Headers == NULL) {
+    return NULL;
+  }
+
+  Buffer = AllocateZeroPool (sizeof (EFI_HTTP_HEADER) * HeaderCount);
+  if (Buffer == NULL) {
+    return NULL;
+  }
+
+  for (Index = 0; Index < HeaderCount; Index++) {
+    Buffer[Index].FieldName  = AllocateCopyPool (AsciiStrSize (Headers[Index].FieldName), Headers[Index].FieldName);
+    Buffer[Index].FieldValue = AllocateCopyPool (AsciiStrSize (Headers[Index].FieldValue), Headers[Index].FieldValue);
+    if (Buffer[Index].FieldName == NULL || Buffer[Index].FieldValue == NULL) {
+      HttpFreeHeaderFields (Buffer, Index + 1);
+      return NULL;
+    }
+  }
+
+  return Buffer;
+}
+
+/**
+  Get the ETag of a Redfish response. The ETag in HTTP header takes
+  precedence over "@odata.etag" in the resource.
+
+  @param[in]  HeaderCount     Number of HTTP header structures in Headers list.
+  @param[in]  Headers         Array containing list of HTTP headers.
+  @param[in]  JsonValue       The JSON resource in the response.
+
+  @return     Pointer to the ETag string, or NULL if there is no ETag.
+              The string is owned by Headers or JsonValue.
+
+**/
+CONST CHAR8 *
+RedfishHttpCacheGetETag (
+  IN UINTN             HeaderCount,
+  IN EFI_HTTP_HEADER   *Headers,
+  IN EDKII_JSON_VALUE  JsonValue
+  )
+{
+  EFI_HTTP_HEADER   *Header;
+  EDKII_JSON_VALUE  OdataETag;
+
+  if (HeaderCount != 0 && Headers != NULL) {
+    Header = HttpFindHeader (HeaderCount, Headers, HTTP_HEADER_ETAG);
+    if (Header != NULL && Header->FieldValue != NULL) {
+      return Header->FieldValue;
+    }
+  }
+
+  if (JsonValueIsObject (JsonValue)) {
+    OdataETag = JsonObjectGetValue (JsonValueGetObject (JsonValue), "@odata.etag");
+    if (JsonValueIsString (OdataETag)) {
+      return JsonValueGetAsciiString (OdataETag);
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Release a cache entry and remove it from the cache list.
+
+  @param[in]  CacheData       The cache entry to release.
+
+**/
+VOID
+RedfishHttpCacheReleaseData (
+  IN REDFISH_HTTP_CACHE_DATA  *CacheData
+  )
+{
+  RemoveEntryList (&CacheData->List);
+  RemoveEntryList (&CacheData->BucketList);
+  mRedfishHttpCacheCount--;
+
+  if (CacheData->Uri != NULL) {
+    FreePool (CacheData->Uri);
+  }
+
+  if (CacheData->ETag != NULL) {
+    FreePool (CacheData->ETag);
+  }
+
+  if (CacheData->HeaderCount != 0 && CacheData->Headers != NULL) {
+    HttpFreeHeaderFields (CacheData->Headers, CacheData->HeaderCount);
+  }
+
+  if (CacheData->JsonValue != NULL) {
+    JsonValueFree (CacheData->JsonValue);
+  }
+
+  FreePool (CacheData);
+}
+
+/**
+  Find the cache entry of the given URI on the given Redfish service.
+
+  @param[in]  RedfishService  The Service the URI belongs to.
+  @param[in]  Uri             Relative path to address the resource.
+
+  @return     Pointer to the cache entry, or NULL if the URI is not cached.
+
+**/
+REDFISH_HTTP_CACHE_DATA *
+RedfishHttpCacheFind (
+  IN REDFISH_SERVICE  RedfishService,
+  IN CONST CHAR8      *Uri
+  )
+{
+  LIST_ENTRY               *Bucket;
+  LIST_ENTRY               *Node;
+  REDFISH_HTTP_CACHE_DATA  *CacheData;
+  UINT32                   Hash;
+
+  if (mRedfishHttpCacheBucket == NULL) {
+    return NULL;
+  }
+
+  Hash   = RedfishHttpCacheHash (RedfishService, Uri);
+  Bucket = &mRedfishHttpCacheBucket[Hash & (mRedfishHttpCacheBucketCount - 1)];
+  for (Node = GetFirstNode (Bucket); !IsNull (Bucket, Node); Node = GetNextNode (Bucket, Node)) {
+    CacheData = REDFISH_HTTP_CACHE_DATA_FROM_BUCKET (Node);
+    if (CacheData->Hash == Hash && CacheData->Service == RedfishService && AsciiStrCmp (CacheData->Uri, Uri) == 0) {
+      return CacheData;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Look up the cached response of the given URI. On cache hit, a copy of the
+  cached StatusCode, Headers and Payload is returned in RedResponse and callers
+  are responsible for freeing them by RedfishFreeResponse() as usual.
+
+  @param[in]    RedfishService    The Service to access the URI resources.
+  @param[in]    Uri               String to address a resource.
+  @param[in]    IfNoneMatch       If not NULL and the cached response carries
+                                  the same ETag, the resource is not changed and
+                                  nothing is returned in RedResponse.
+  @param[out]   RedResponse       Pointer to the Redfish response data.
+
+  @retval EFI_SUCCESS             The cached response is returned in RedResponse.
+  @retval EFI_ALREADY_STARTED     The cached response matches IfNoneMatch.
+  @retval EFI_NOT_FOUND           There is no cached response.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to copy the cached response.
+
+**/
+EFI_STATUS
+RedfishHttpCacheLookup (
+  IN     REDFISH_SERVICE   RedfishService,
+  IN     CONST CHAR8       *Uri,
+  IN     CONST CHAR8       *IfNoneMatch OPTIONAL,
+  OUT    REDFISH_RESPONSE  *RedResponse
+  )
+{
+  REDFISH_HTTP_CACHE_DATA  *CacheData;
+  EDKII_JSON_VALUE         JsonValue;
+
+  if (RedfishService == NULL || Uri == NULL || RedResponse == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  CacheData = RedfishHttpCacheFind (RedfishService, Uri);
+  if (CacheData == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  if (IfNoneMatch != NULL && CacheData->ETag != NULL && AsciiStrCmp (CacheData->ETag, IfNoneMatch) == 0) {
+    DEBUG ((DEBUG_VERBOSE, "%a: not modified: %a\n", __FUNCTION__, Uri));
+    return EFI_ALREADY_STARTED;
+  }
+
+  ZeroMem (RedResponse, sizeof (REDFISH_RESPONSE));
+
+  //
+  // Callers own and may modify what is returned, hand out a deep copy.
+  //
+  JsonValue = JsonValueClone (CacheData->JsonValue);
+  if (JsonValue == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  RedResponse->Payload = createRedfishPayload (JsonValue, RedfishService);
+  if (RedResponse->Payload == NULL) {
+    JsonValueFree (JsonValue);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  RedResponse->StatusCode = AllocateCopyPool (sizeof (EFI_HTTP_STATUS_CODE), &CacheData->StatusCode);
+  if (RedResponse->StatusCode == NULL) {
+    goto ON_ERROR;
+  }
+
+  if (CacheData->HeaderCount != 0) {
+    RedResponse->Headers = RedfishHttpCacheCopyHeaders (CacheData->HeaderCount, CacheData->Headers);
+    if (RedResponse->Headers == NULL) {
+      goto ON_ERROR;
+    }
+
+    RedResponse->HeaderCount = CacheData->HeaderCount;
+  }
+
+  DEBUG ((DEBUG_VERBOSE, "%a: cache hit: %a\n", __FUNCTION__, Uri));
+
+  return EFI_SUCCESS;
+
+ON_ERROR:
+
+  RedfishFreeResponse (RedResponse->StatusCode, RedResponse->HeaderCount, RedResponse->Headers, RedResponse->Payload);
+  ZeroMem (RedResponse, sizeof (REDFISH_RESPONSE));
+
+  return EFI_OUT_OF_RESOURCES;
+}
+
+/**
+  Keep a copy of the JSON resource and HTTP headers of a successful GET
+  response in cache. The existing entry of the same URI is replaced.
+
+  @param[in]    RedfishService    The Service the response comes from.
+  @param[in]    Uri               String to address a resource.
+  @param[in]    StatusCode        The HTTP StatusCode of the response.
+  @param[in]    HeaderCount       Number of HTTP header structures in Headers list.
+  @param[in]    Headers           Array containing list of HTTP headers.
+  @param[in]    JsonValue         The JSON resource in the response.
+
+  @retval EFI_SUCCESS             The response is kept in cache.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to keep the response.
+
+**/
+EFI_STATUS
+RedfishHttpCacheAddJsonValue (
+  IN     REDFISH_SERVICE       RedfishService,
+  IN     CONST CHAR8           *Uri,
+  IN     EFI_HTTP_STATUS_CODE  StatusCode,
+  IN     UINTN                 HeaderCount,
+  IN     EFI_HTTP_HEADER       *Headers,
+  IN     EDKII_JSON_VALUE      JsonValue
+  )
+{
+  REDFISH_HTTP_CACHE_DATA  *CacheData;
+  CONST CHAR8              *ETag;
+
+  RedfishHttpCacheInvalidate (RedfishService, Uri);
+
+  if (EFI_ERROR (RedfishHttpCacheReserve ())) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  CacheData = AllocateZeroPool (sizeof (REDFISH_HTTP_CACHE_DATA));
+  if (CacheData == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  CacheData->Hash = RedfishHttpCacheHash (RedfishService, Uri);
+  InsertTailList (&mRedfishHttpCacheList, &CacheData->List);
+  InsertTailList (&mRedfishHttpCacheBucket[CacheData->Hash & (mRedfishHttpCacheBucketCount - 1)], &CacheData->BucketList);
+  mRedfishHttpCacheCount++;
+  CacheData->Service    = RedfishService;
+  CacheData->StatusCode = StatusCode;
+  CacheData->Uri        = AllocateCopyPool (AsciiStrSize (Uri), Uri);
+  if (CacheData->Uri == NULL) {
+    goto ON_ERROR;
+  }
+
+  ETag = RedfishHttpCacheGetETag (HeaderCount, Headers, JsonValue);
+  if (ETag != NULL) {
+    CacheData->ETag = AllocateCopyPool (AsciiStrSize (ETag), ETag);
+    if (CacheData->ETag == NULL) {
+      goto ON_ERROR;
+    }
+  }
+
+  if (HeaderCount != 0) {
+    CacheData->Headers = RedfishHttpCacheCopyHeaders (HeaderCount, Headers);
+    if (CacheData->Headers == NULL) {
+      goto ON_ERROR;
+    }
+
+    CacheData->HeaderCount = HeaderCount;
+  }
+
+  CacheData->JsonValue = JsonValueClone (JsonValue);
+  if (CacheData->JsonValue == NULL) {
+    goto ON_ERROR;
+  }
+
+  return EFI_SUCCESS;
+
+ON_ERROR:
+
+  RedfishHttpCacheReleaseData (CacheData);
+
+  return EFI_OUT_OF_RESOURCES;
+}
+
+/**
+  Keep a copy of a successful GET response in cache. The existing entry of
+  the same URI is replaced.
+
+  @param[in]    RedfishService    The Service the response comes from.
+  @param[in]    Uri               String to address a resource.
+  @param[in]    RedResponse       The Redfish response to keep.
+
+  @retval EFI_SUCCESS             The response is kept in cache.
+  @retval EFI_INVALID_PARAMETER   The response is not a successful response.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to keep the response.
+
+**/
+EFI_STATUS
+RedfishHttpCacheAdd (
+  IN     REDFISH_SERVICE   RedfishService,
+  IN     CONST CHAR8       *Uri,
+  IN     REDFISH_RESPONSE  *RedResponse
+  )
+{
+  EDKII_JSON_VALUE         JsonValue;
+
+  if (RedfishService == NULL || Uri == NULL || RedResponse == NULL ||
+      RedResponse->Payload == NULL || RedResponse->StatusCode == NULL)
+  {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (*(RedResponse->StatusCode) < HTTP_STATUS_200_OK || \
+      *(RedResponse->StatusCode) > HTTP_STATUS_206_PARTIAL_CONTENT) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  JsonValue = RedfishJsonInPayload (RedResponse->Payload);
+  if (JsonValue == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  return RedfishHttpCacheAddJsonValue (
+           RedfishService,
+           Uri,
+           *(RedResponse->StatusCode),
+           RedResponse->HeaderCount,
+           RedResponse->Headers,
+           JsonValue
+           );
+}
+
+/**
+  Tell if the collection member is expanded inline, and return its URI.
+
+  @param[in]  Member          The collection member.
+
+  @return     "@odata.id" of the expanded member, or NULL if the member is a
+              link only.
+
+**/
+EDKII_JSON_VALUE
+RedfishHttpCacheExpandedMemberId (
+  IN EDKII_JSON_VALUE  Member
+  )
+{
+  EDKII_JSON_VALUE  OdataId;
+
+  if (!JsonValueIsObject (Member)) {
+    return NULL;
+  }
+
+  OdataId = JsonObjectGetValue (JsonValueGetObject (Member), "@odata.id");
+  if (!JsonValueIsString (OdataId) || JsonObjectSize (JsonValueGetObject (Member)) == 1) {
+    return NULL;
+  }
+
+  return OdataId;
+}
+
+/**
+  Drop the cached responses of the expanded members before the given index.
+
+  @param[in]  RedfishService  The Service the collection comes from.
+  @param[in]  Members         The expanded member array.
+  @param[in]  Count           Number of members to handle.
+
+**/
+VOID
+RedfishHttpCacheDropExpandedMembers (
+  IN REDFISH_SERVICE   RedfishService,
+  IN EDKII_JSON_VALUE  Members,
+  IN UINTN             Count
+  )
+{
+  UINTN             Index;
+  EDKII_JSON_VALUE  OdataId;
+
+  for (Index = 0; Index < Count; Index++) {
+    OdataId = RedfishHttpCacheExpandedMemberId (JsonArrayGetValue (JsonValueGetArray (Members), Index));
+    if (OdataId != NULL) {
+      RedfishHttpCacheInvalidate (RedfishService, JsonValueGetAsciiString (OdataId));
+    }
+  }
+}
+
+/**
+  Keep the members expanded inline in a collection payload in cache, so the
+  following RedfishGetByUri() of member URIs doesn't go to Redfish service, and
+  replace them with the links to members. The collection payload looks the same
+  as one retrieved without $expand afterwards.
+
+  The link-only member array is built completely before the cache is touched.
+  On failure, the members cached by this call are dropped again and the
+  collection payload is left expanded.
+
+  @param[in]      RedfishService    The Service the collection comes from.
+  @param[in,out]  Payload           The collection payload.
+  @param[out]     CachedCount       Number of members kept in cache. Optional.
+
+  @retval EFI_SUCCESS             The expanded members are kept in cache. Members which
+                                  are links already are left as is.
+  @retval EFI_INVALID_PARAMETER   RedfishService or Payload is NULL, or Payload is not
+                                  a collection.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory.
+  @retval Others                  The error returned by JsonLib.
+**/
+EFI_STATUS
+EFIAPI
+RedfishCacheExpandedMembers (
+  IN     REDFISH_SERVICE      RedfishService,
+  IN OUT REDFISH_PAYLOAD      Payload,
+  OUT    UINTN                *CachedCount OPTIONAL
+  )
+{
+  EFI_STATUS        Status;
+  EDKII_JSON_VALUE  JsonValue;
+  EDKII_JSON_VALUE  Members;
+  EDKII_JSON_VALUE  Member;
+  EDKII_JSON_VALUE  OdataId;
+  EDKII_JSON_VALUE  Links;
+  EDKII_JSON_VALUE  Link;
+  UINTN             Index;
+  UINTN             MemberCount;
+  UINTN             Count;
+
+  if (CachedCount != NULL) {
+    *CachedCount = 0;
+  }
+
+  if (RedfishService == NULL || Payload == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  JsonValue = RedfishJsonInPayload (Payload);
+  if (!JsonValueIsObject (JsonValue)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Members = JsonObjectGetValue (JsonValueGetObject (JsonValue), "Members");
+  if (!JsonValueIsArray (Members)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Build the link-only member array first.
+  //
+  Links = JsonValueInitArray ();
+  if (Links == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status      = EFI_SUCCESS;
+  MemberCount = JsonArrayCount (JsonValueGetArray (Members));
+  for (Index = 0; Index < MemberCount; Index++) {
+    Member  = JsonArrayGetValue (JsonValueGetArray (Members), Index);
+    OdataId = RedfishHttpCacheExpandedMemberId (Member);
+    if (OdataId == NULL) {
+      if (!JsonValueIsObject (Member)) {
+        continue;
+      }
+
+      //
+      // Not expanded.
+      //
+      Status = JsonArrayAppendValue (JsonValueGetArray (Links), Member);
+      if (EFI_ERROR (Status)) {
+        break;
+      }
+
+      continue;
+    }
+
+    Link = JsonValueInitObject ();
+    if (Link == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      break;
+    }
+
+    Status = JsonObjectSetValue (JsonValueGetObject (Link), "@odata.id", OdataId);
+    if (!EFI_ERROR (Status)) {
+      Status = JsonArrayAppendValue (JsonValueGetArray (Links), Link);
+    }
+
+    JsonValueFree (Link);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+  }
+
+  if (EFI_ERROR (Status)) {
+    JsonValueFree (Links);
+    return Status;
+  }
+
+  //
+  // Then keep the expanded members in cache.
+  //
+  Count = 0;
+  for (Index = 0; Index < MemberCount; Index++) {
+    OdataId = RedfishHttpCacheExpandedMemberId (JsonArrayGetValue (JsonValueGetArray (Members), Index));
+    if (OdataId == NULL) {
+      continue;
+    }
+
+    Status = RedfishHttpCacheAddJsonValue (
+               RedfishService,
+               JsonValueGetAsciiString (OdataId),
+               HTTP_STATUS_200_OK,
+               0,
+               NULL,
+               JsonArrayGetValue (JsonValueGetArray (Members), Index)
+               );
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    Count++;
+  }
+
+  if (EFI_ERROR (Status)) {
+    RedfishHttpCacheDropExpandedMembers (RedfishService, Members, Index);
+    JsonValueFree (Links);
+    return Status;
+  }
+
+  //
+  // Swap the link-only member array in. Members is freed by the swap, so it
+  // is still referenced here in case the swap fails.
+  //
+  JsonIncreaseReference (Members);
+  Status = JsonObjectSetValue (JsonValueGetObject (JsonValue), "Members", Links);
+  JsonValueFree (Links);
+  if (EFI_ERROR (Status)) {
+    RedfishHttpCacheDropExpandedMembers (RedfishService, Members, MemberCount);
+    JsonDecreaseReference (Members);
+    return Status;
+  }
+
+  JsonDecreaseReference (Members);
+
+  DEBUG ((DEBUG_VERBOSE, "%a: %d expanded members cached\n", __FUNCTION__, Count));
+
+  if (CachedCount != NULL) {
+    *CachedCount = Count;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Drop the cached response of the given URI.
+
+  @param[in]    RedfishService    The Service the URI belongs to.
+  @param[in]    Uri               String to address a resource.
+
+**/
+VOID
+RedfishHttpCacheInvalidate (
+  IN     REDFISH_SERVICE  RedfishService,
+  IN     CONST CHAR8      *Uri
+  )
+{
+  REDFISH_HTTP_CACHE_DATA  *CacheData;
+
+  if (RedfishService == NULL || Uri == NULL) {
+    return;
+  }
+
+  CacheData = RedfishHttpCacheFind (RedfishService, Uri);
+  if (CacheData != NULL) {
+    DEBUG ((DEBUG_VERBOSE, "%a: %a\n", __FUNCTION__, Uri));
+    RedfishHttpCacheReleaseData (CacheData);
+  }
+}
+
+/**
+  Drop the cached response of the resource which the given payload represents.
+  The URI is taken from "@odata.id" in payload.
+
+  @param[in]    Payload           The Redfish payload.
+
+**/
+VOID
+RedfishHttpCacheInvalidatePayload (
+  IN     REDFISH_PAYLOAD  Payload
+  )
+{
+  EDKII_JSON_VALUE  JsonValue;
+  EDKII_JSON_VALUE  OdataId;
+
+  if (Payload == NULL) {
+    return;
+  }
+
+  JsonValue = RedfishJsonInPayload (Payload);
+  if (!JsonValueIsObject (JsonValue)) {
+    return;
+  }
+
+  OdataId = JsonObjectGetValue (JsonValueGetObject (JsonValue), "@odata.id");
+  if (!JsonValueIsString (OdataId)) {
+    return;
+  }
+
+  RedfishHttpCacheInvalidate (((redfishPayload *)Payload)->service, JsonValueGetAsciiString (OdataId));
+}
+
+/**
+  Drop the cached responses. This is called at the beginning and the end of
+  each provisioning cycle so that data retrieved in previous cycle is never
+  used.
+
+  @param[in]  RedfishService  Drop the responses of this service only. If NULL,
+                              all cached responses are dropped.
+
+**/
+VOID
+EFIAPI
+RedfishFlushHttpCache (
+  IN REDFISH_SERVICE  RedfishService OPTIONAL
+  )
+{
+  LIST_ENTRY               *Node;
+  LIST_ENTRY               *NextNode;
+  REDFISH_HTTP_CACHE_DATA  *CacheData;
+
+  //
+  // Responses still on the way belong to this cycle as well.
+  //
+  RedfishCompletePrefetch (RedfishService, NULL);
+
+  Node = GetFirstNode (&mRedfishHttpCacheList);
+  while (!IsNull (&mRedfishHttpCacheList, Node)) {
+    NextNode  = GetNextNode (&mRedfishHttpCacheList, Node);
+    CacheData = REDFISH_HTTP_CACHE_DATA_FROM_LIST (Node);
+    if (RedfishService == NULL || CacheData->Service == RedfishService) {
+      RedfishHttpCacheReleaseData (CacheData);
+    }
+
+    Node = NextNode;
+  }
+}
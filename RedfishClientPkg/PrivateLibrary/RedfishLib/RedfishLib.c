@@ -11,6 +11,19 @@
 
 #include "RedfishMisc.h"
 
+//
+// Definition of REDFISH_PREFETCH_REQUEST
+//
+typedef struct {
+  LIST_ENTRY              List;
+  REDFISH_SERVICE         Service;
+  REDFISH_ASYNC_REQUEST   Request;
+} REDFISH_PREFETCH_REQUEST;
+
+#define REDFISH_PREFETCH_REQUEST_FROM_LIST(a)  BASE_CR (a, REDFISH_PREFETCH_REQUEST, List)
+
+LIST_ENTRY  mRedfishPrefetchList = INITIALIZE_LIST_HEAD_VARIABLE (mRedfishPrefetchList);
+
 /**
   This function uses REST EX protocol provided in RedfishConfigServiceInfo.
   The service enumerator will also handle the authentication flow automatically
@@ -92,8 +105,74 @@ RedfishCleanupService (
     return;
   }
 
+  RedfishFlushHttpCache (RedfishService);
+  RedfishFlushPathCache (RedfishService);
   cleanupServiceEnumerator (RedfishService);
 }
+
+/**
+  Create a Redfish service which uses the Redfish session of given X-Auth-Token.
+  The session is logged in by the caller, e.g. by another driver, and this
+  function does not log in again. The service root versions are retrieved and
+  kept in the returned service, so it works only in the image calling this
+  function.
+
+  Callers are responsible for freeing the returned service by RedfishCleanupService().
+  The session is not logged out when the service is freed.
+
+  @param[in]  RedfishConfigServiceInfo Redfish service information the EFI Redfish
+                                       feature driver communicates with.
+  @param[in]  SessionToken             X-Auth-Token of the Redfish session.
+
+  @return     New created Redfish Service, or NULL if error happens.
+
+**/
+REDFISH_SERVICE
+EFIAPI
+RedfishCreateServiceWithSessionToken (
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION   *RedfishConfigServiceInfo,
+  IN  CONST CHAR8                          *SessionToken
+  )
+{
+  enumeratorAuthentication  Auth;
+
+  if (RedfishConfigServiceInfo == NULL || SessionToken == NULL) {
+    return NULL;
+  }
+
+  ZeroMem (&Auth, sizeof (Auth));
+  Auth.authType                  = REDFISH_AUTH_BEARER_TOKEN;
+  Auth.authCodes.authToken.token = (char *)SessionToken;
+
+  return (REDFISH_SERVICE)createServiceEnumerator (
+                            RedfishConfigServiceInfo,
+                            NULL,
+                            &Auth,
+                            (unsigned int)REDFISH_FLAG_SERVICE_NO_VERSION_DOC
+                            );
+}
+
+/**
+  Get the X-Auth-Token of the Redfish session the given service logged in.
+
+  @param[in]    RedfishService     The Service to access the Redfish resources.
+
+  @return     The X-Auth-Token owned by RedfishService, or NULL if the service
+              does not use Redfish session.
+
+**/
+CONST CHAR8 *
+EFIAPI
+RedfishGetSessionToken (
+  IN REDFISH_SERVICE   RedfishService
+  )
+{
+  if (RedfishService == NULL) {
+    return NULL;
+  }
+
+  return ((redfishService *)RedfishService)->sessionToken;
+}
 /**
   Create REDFISH_PAYLOAD instance in local with JSON represented resource value and
   the Redfish Service.
@@ -230,6 +309,9 @@ RedfishBuildPathWithSystemUuid (
   Get a redfish response addressed by a RedPath string, including HTTP StatusCode, Headers
   and Payload which record any HTTP response messages.
 
+  The URI a RedPath is resolved to is remembered, so the following request of the same
+  RedPath retrieves the URI directly as long as the resource carries the same ETag.
+
   Callers are responsible for freeing the HTTP StatusCode, Headers and Payload returned in
   redfish response data.
 
@@ -263,7 +345,19 @@ RedfishGetByService (
 
   ZeroMem (RedResponse, sizeof (REDFISH_RESPONSE));
 
-  RedResponse->Payload = (REDFISH_PAYLOAD) getPayloadByPath (RedfishService, RedPath, &(RedResponse->StatusCode));
+  //
+  // A RedPath resolved before costs a GET of the resource URI and of the
+  // member each predicate selected, instead of scanning the collections.
+  //
+  if (!EFI_ERROR (RedfishPathCacheGet (RedfishService, RedPath, RedResponse))) {
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Otherwise resolve it from the service root. The resolution is kept in the
+  // path cache when it succeeds.
+  //
+  RedfishPathCacheResolve (RedfishService, RedPath, RedResponse);
 
   //
   // 1. If the returned Payload is NULL, indicates any error happen.
@@ -315,6 +409,47 @@ RedfishGetByUri (
   OUT    REDFISH_RESPONSE     *RedResponse
   )
 {
+  return RedfishGetByUriIfNoneMatch (RedfishService, Uri, NULL, RedResponse);
+}
+/**
+  Get a redfish response addressed by URI only when the resource is changed, including
+  HTTP StatusCode, Headers and Payload which record any HTTP response messages.
+
+  The ETag in IfNoneMatch is sent in If-None-Match header, and the service replies
+  HTTP 304 without message body if the resource still carries the same ETag.
+
+  Callers are responsible for freeing the HTTP StatusCode, Headers and Payload returned in
+  redfish response data.
+
+  @param[in]    RedfishService    The Service to access the URI resources.
+  @param[in]    Uri               String to address a resource.
+  @param[in]    IfNoneMatch       ETag of the resource callers already have. If NULL,
+                                  the resource is always returned.
+  @param[out]   RedResponse       Pointer to the Redfish response data.
+
+  @retval EFI_SUCCESS             The opeartion is successful, indicates the HTTP StatusCode is not
+                                  NULL and the value is 2XX. The corresponding redfish resource has
+                                  been returned in Payload within RedResponse.
+  @retval EFI_ALREADY_STARTED     The resource is not changed since IfNoneMatch. Nothing is
+                                  returned in RedResponse.
+  @retval EFI_INVALID_PARAMETER   RedfishService, Uri, or RedResponse is NULL.
+  @retval EFI_DEVICE_ERROR        An unexpected system or network error occurred. Callers can get
+                                  more error info from returned HTTP StatusCode, Headers and Payload
+                                  within RedResponse:
+                                  1. If the returned Payload is NULL, indicates any error happen.
+                                  2. If the returned StatusCode is NULL, indicates any error happen.
+                                  3. If the returned StatusCode is not 2XX, indicates any error happen.
+**/
+EFI_STATUS
+EFIAPI
+RedfishGetByUriIfNoneMatch (
+  IN     REDFISH_SERVICE      RedfishService,
+  IN     CONST CHAR8          *Uri,
+  IN     CONST CHAR8          *IfNoneMatch OPTIONAL,
+  OUT    REDFISH_RESPONSE     *RedResponse
+  )
+{
+  EFI_STATUS       Status;
   EDKII_JSON_VALUE JsonValue;
 
   if (RedfishService == NULL || Uri == NULL || RedResponse == NULL) {
@@ -323,7 +458,532 @@ RedfishGetByUri (
 
   ZeroMem (RedResponse, sizeof (REDFISH_RESPONSE));
 
-  JsonValue = getUriFromServiceEx (RedfishService, Uri, &RedResponse->Headers, &RedResponse->HeaderCount, &RedResponse->StatusCode);
+  //
+  // The resource may be on the way already.
+  //
+  RedfishCompletePrefetch (RedfishService, Uri);
+
+  //
+  // The same resource is retrieved several times in one provisioning cycle.
+  // Use the response we already have if it is still valid.
+  //
+  Status = RedfishHttpCacheLookup (RedfishService, Uri, IfNoneMatch, RedResponse);
+  if (Status == EFI_SUCCESS || Status == EFI_ALREADY_STARTED) {
+    return Status;
+  }
+
+  JsonValue = getUriFromServiceIfNoneMatch (
+                RedfishService,
+                Uri,
+                IfNoneMatch,
+                &RedResponse->Headers,
+                &RedResponse->HeaderCount,
+                &RedResponse->StatusCode
+                );
+
+  return RedfishCompleteGetResponse (RedfishService, Uri, IfNoneMatch, JsonValue, RedResponse);
+}
+
+/**
+  Start getting a redfish response addressed by URI without waiting for it. Several
+  requests are in flight on the connection at the same time, RedfishWaitAsyncRequests()
+  waits for them to complete.
+
+  The request completes right away if the response is in cache, or if REST EX driver
+  doesn't support asynchronous request, in which case the resource is retrieved by
+  RedfishGetByUri() before this function returns.
+
+  Callers are responsible for freeing the HTTP StatusCode, Headers and Payload returned in
+  Response of the completed request by RedfishFreeResponse() as usual.
+
+  @param[in]    RedfishService    The Service to access the URI resources.
+  @param[in]    Uri               String to address a resource.
+  @param[out]   Request           The asynchronous request to start.
+
+  @retval EFI_SUCCESS             The request is started or completed. Check Status in Request
+                                  for the result.
+  @retval EFI_INVALID_PARAMETER   RedfishService, Uri, or Request is NULL.
+  @retval Others                  Fail to start the request.
+**/
+EFI_STATUS
+EFIAPI
+RedfishGetByUriAsync (
+  IN     REDFISH_SERVICE          RedfishService,
+  IN     CONST CHAR8              *Uri,
+  OUT    REDFISH_ASYNC_REQUEST    *Request
+  )
+{
+  EFI_STATUS  Status;
+
+  if (RedfishService == NULL || Uri == NULL || Request == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  ZeroMem (Request, sizeof (REDFISH_ASYNC_REQUEST));
+
+  RedfishCompletePrefetch (RedfishService, Uri);
+
+  Status = RedfishHttpCacheLookup (RedfishService, Uri, NULL, &Request->Response);
+  if (Status == EFI_SUCCESS) {
+    Request->Status = EFI_SUCCESS;
+    return EFI_SUCCESS;
+  }
+
+  Request->Uri = AllocateCopyPool (AsciiStrSize (Uri), Uri);
+  if (Request->Uri == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = getUriFromServiceAsync (RedfishService, Uri, &Request->Context);
+  if (EFI_ERROR (Status)) {
+    FreePool (Request->Uri);
+    Request->Uri = NULL;
+    if (Status != EFI_UNSUPPORTED) {
+      return Status;
+    }
+
+    //
+    // REST EX driver doesn't support asynchronous request.
+    //
+    Request->Status = RedfishGetByUri (RedfishService, Uri, &Request->Response);
+    return EFI_SUCCESS;
+  }
+
+  Request->Status = EFI_NOT_READY;
+  return EFI_SUCCESS;
+}
+
+/**
+  Wait for the asynchronous requests started by RedfishGetByUriAsync() to complete.
+  The successful responses are kept in cache, so RedfishGetByUri() of the same URI
+  doesn't go to Redfish service again.
+
+  When none of the pending requests completes in REDFISH_HTTP_RESPONSE_TIMEOUT
+  milliseconds, e.g. REST EX driver makes no progress, the pending requests are
+  given up with EFI_TIMEOUT. Their REST EX tokens may still be signaled later,
+  so the memory of those requests is not freed.
+
+  @param[in]      RedfishService    The Service the requests are sent to.
+  @param[in]      RequestCount      Number of requests in Requests.
+  @param[in,out]  Requests          Array of asynchronous requests.
+
+  @retval EFI_SUCCESS             All requests complete. Check Status in each request for
+                                  the result.
+  @retval EFI_INVALID_PARAMETER   RedfishService or Requests is NULL.
+  @retval Others                  Fail to create the timeout timer. The pending
+                                  requests are given up with this status.
+**/
+EFI_STATUS
+EFIAPI
+RedfishWaitAsyncRequests (
+  IN     REDFISH_SERVICE          RedfishService,
+  IN     UINTN                    RequestCount,
+  IN OUT REDFISH_ASYNC_REQUEST    *Requests
+  )
+{
+  EFI_STATUS             Status;
+  EDKII_JSON_VALUE       JsonValue;
+  REDFISH_ASYNC_REQUEST  *Request;
+  UINTN                  Index;
+  UINTN                  Pending;
+  UINTN                  Completed;
+  EFI_EVENT              TimeoutEvent;
+  EFI_STATUS             TimerStatus;
+
+  if (RedfishService == NULL || Requests == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  TimerStatus = gBS->CreateEvent (EVT_TIMER, TPL_CALLBACK, NULL, NULL, &TimeoutEvent);
+  if (!EFI_ERROR (TimerStatus)) {
+    TimerStatus = gBS->SetTimer (TimeoutEvent, TimerRelative, MultU64x32 (REDFISH_HTTP_RESPONSE_TIMEOUT, 10000));
+    if (EFI_ERROR (TimerStatus)) {
+      gBS->CloseEvent (TimeoutEvent);
+    }
+  }
+
+  while (TRUE) {
+    Pending   = 0;
+    Completed = 0;
+    for (Index = 0; Index < RequestCount; Index++) {
+      Request = &Requests[Index];
+      if (Request->Status != EFI_NOT_READY || Request->Context == NULL) {
+        continue;
+      }
+
+      JsonValue = getUriFromServiceAsyncResult (
+                    RedfishService,
+                    Request->Context,
+                    &Status,
+                    &Request->Response.Headers,
+                    &Request->Response.HeaderCount,
+                    &Request->Response.StatusCode
+                    );
+      if (Status == EFI_NOT_READY) {
+        Pending++;
+        continue;
+      }
+
+      //
+      // The request which fails without response gets EFI_DEVICE_ERROR, the
+      // same as RedfishGetByUri().
+      //
+      Request->Context = NULL;
+      Request->Status  = RedfishCompleteGetResponse (RedfishService, Request->Uri, NULL, JsonValue, &Request->Response);
+      FreePool (Request->Uri);
+      Request->Uri = NULL;
+      Completed++;
+    }
+
+    if (Pending == 0 || EFI_ERROR (TimerStatus)) {
+      break;
+    }
+
+    if (Completed != 0) {
+      //
+      // Progress is made, restart the timeout.
+      //
+      gBS->SetTimer (TimeoutEvent, TimerRelative, MultU64x32 (REDFISH_HTTP_RESPONSE_TIMEOUT, 10000));
+    } else if (!EFI_ERROR (gBS->CheckEvent (TimeoutEvent))) {
+      break;
+    }
+
+    gBS->Stall (REDFISH_ASYNC_WAIT_STALL);
+  }
+
+  if (!EFI_ERROR (TimerStatus)) {
+    gBS->CloseEvent (TimeoutEvent);
+  }
+
+  if (Pending == 0) {
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Give up the requests still pending.
+  //
+  DEBUG ((DEBUG_ERROR, "%a: %d requests are not complete in time\n", __FUNCTION__, Pending));
+  for (Index = 0; Index < RequestCount; Index++) {
+    Request = &Requests[Index];
+    if (Request->Status != EFI_NOT_READY || Request->Context == NULL) {
+      continue;
+    }
+
+    Request->Context = NULL;
+    Request->Status  = EFI_ERROR (TimerStatus) ? TimerStatus : EFI_TIMEOUT;
+    FreePool (Request->Uri);
+    Request->Uri = NULL;
+  }
+
+  return EFI_ERROR (TimerStatus) ? TimerStatus : EFI_SUCCESS;
+}
+
+/**
+  Start getting a redfish resource addressed by URI in background. Nothing is
+  returned to caller. The response is kept in cache once it arrives, and the
+  following RedfishGetByUri() of the same URI waits for this request instead
+  of sending another one.
+
+  Unlike RedfishGetByUriAsync(), this function never waits for Redfish service.
+
+  @param[in]    RedfishService    The Service to access the URI resources.
+  @param[in]    Uri               String to address a resource.
+
+  @retval EFI_SUCCESS             The request is started, or the resource is in
+                                  cache or on the way already.
+  @retval EFI_INVALID_PARAMETER   RedfishService or Uri is NULL.
+  @retval EFI_UNSUPPORTED         REST EX driver doesn't support asynchronous request.
+  @retval Others                  Fail to start the request.
+**/
+EFI_STATUS
+EFIAPI
+RedfishPrefetchByUri (
+  IN     REDFISH_SERVICE      RedfishService,
+  IN     CONST CHAR8          *Uri
+  )
+{
+  EFI_STATUS                Status;
+  LIST_ENTRY                *Node;
+  REDFISH_PREFETCH_REQUEST  *Prefetch;
+  REDFISH_RESPONSE          Response;
+
+  if (RedfishService == NULL || Uri == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  for (Node = GetFirstNode (&mRedfishPrefetchList); !IsNull (&mRedfishPrefetchList, Node); Node = GetNextNode (&mRedfishPrefetchList, Node)) {
+    Prefetch = REDFISH_PREFETCH_REQUEST_FROM_LIST (Node);
+    if (Prefetch->Service == RedfishService && AsciiStrCmp (Prefetch->Request.Uri, Uri) == 0) {
+      return EFI_SUCCESS;
+    }
+  }
+
+  Status = RedfishHttpCacheLookup (RedfishService, Uri, NULL, &Response);
+  if (Status == EFI_SUCCESS) {
+    RedfishFreeResponse (Response.StatusCode, Response.HeaderCount, Response.Headers, Response.Payload);
+    return EFI_SUCCESS;
+  }
+
+  Prefetch = AllocateZeroPool (sizeof (REDFISH_PREFETCH_REQUEST));
+  if (Prefetch == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Prefetch->Request.Uri = AllocateCopyPool (AsciiStrSize (Uri), Uri);
+  if (Prefetch->Request.Uri == NULL) {
+    FreePool (Prefetch);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = getUriFromServiceAsync (RedfishService, Uri, &Prefetch->Request.Context);
+  if (EFI_ERROR (Status)) {
+    FreePool (Prefetch->Request.Uri);
+    FreePool (Prefetch);
+    return Status;
+  }
+
+  Prefetch->Service        = RedfishService;
+  Prefetch->Request.Status = EFI_NOT_READY;
+  InsertTailList (&mRedfishPrefetchList, &Prefetch->List);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Wait for the requests started by RedfishPrefetchByUri() to complete. The
+  successful responses are kept in cache.
+
+  @param[in]    RedfishService    The Service the requests are sent to. If NULL,
+                                  the requests of all services are completed.
+  @param[in]    Uri               Complete the request of this URI only. If NULL,
+                                  all requests of RedfishService are completed.
+
+**/
+VOID
+RedfishCompletePrefetch (
+  IN     REDFISH_SERVICE      RedfishService OPTIONAL,
+  IN     CONST CHAR8          *Uri OPTIONAL
+  )
+{
+  LIST_ENTRY                *Node;
+  LIST_ENTRY                *NextNode;
+  REDFISH_PREFETCH_REQUEST  *Prefetch;
+
+  Node = GetFirstNode (&mRedfishPrefetchList);
+  while (!IsNull (&mRedfishPrefetchList, Node)) {
+    NextNode = GetNextNode (&mRedfishPrefetchList, Node);
+    Prefetch = REDFISH_PREFETCH_REQUEST_FROM_LIST (Node);
+    if ((RedfishService == NULL || Prefetch->Service == RedfishService) &&
+        (Uri == NULL || AsciiStrCmp (Prefetch->Request.Uri, Uri) == 0)) {
+      RemoveEntryList (&Prefetch->List);
+      RedfishWaitAsyncRequests (Prefetch->Service, 1, &Prefetch->Request);
+      RedfishFreeResponse (
+        Prefetch->Request.Response.StatusCode,
+        Prefetch->Request.Response.HeaderCount,
+        Prefetch->Request.Response.Headers,
+        Prefetch->Request.Response.Payload
+        );
+      FreePool (Prefetch);
+    }
+
+    Node = NextNode;
+  }
+}
+
+/**
+  Return the query parameters the Redfish service supports. The service root is
+  retrieved on the first call, and the result is kept in RedfishService.
+
+  @param[in]    RedfishService    The Service to check.
+
+  @return       The REDFISH_QUERY_FEATURE_XXX bits. 0 if the service doesn't report
+                ProtocolFeaturesSupported or any error happens.
+**/
+UINT32
+EFIAPI
+RedfishGetQueryFeatures (
+  IN     REDFISH_SERVICE      RedfishService
+  )
+{
+  redfishService        *Service;
+  redfishPayload        *Root;
+  EFI_HTTP_STATUS_CODE  *StatusCode;
+  EDKII_JSON_OBJECT     Features;
+  EDKII_JSON_OBJECT     Expand;
+  UINT32                QueryFeatures;
+
+  if (RedfishService == NULL) {
+    return 0;
+  }
+
+  Service = (redfishService *)RedfishService;
+  if (Service->QueryFeaturesDetected) {
+    return Service->QueryFeatures;
+  }
+
+  StatusCode = NULL;
+  Root = getRedfishServiceRoot (Service, NULL, &StatusCode);
+  if (Root == NULL || StatusCode == NULL ||
+      *StatusCode < HTTP_STATUS_200_OK || *StatusCode > HTTP_STATUS_206_PARTIAL_CONTENT) {
+    DEBUG ((DEBUG_ERROR, "%a: unable to get service root\n", __FUNCTION__));
+    if (Root != NULL) {
+      cleanupPayload (Root);
+    }
+
+    if (StatusCode != NULL) {
+      FreePool (StatusCode);
+    }
+
+    return 0;
+  }
+
+  QueryFeatures = 0;
+  Features = JsonValueGetObject (JsonObjectGetValue (JsonValueGetObject ((EDKII_JSON_VALUE)Root->json), "ProtocolFeaturesSupported"));
+  if (Features != NULL) {
+    Expand = JsonValueGetObject (JsonObjectGetValue (Features, "ExpandQuery"));
+    if (Expand != NULL) {
+      if (JsonValueIsTrue (JsonObjectGetValue (Expand, "ExpandAll"))) {
+        QueryFeatures |= REDFISH_QUERY_FEATURE_EXPAND_ALL;
+      }
+
+      if (JsonValueIsTrue (JsonObjectGetValue (Expand, "Links"))) {
+        QueryFeatures |= REDFISH_QUERY_FEATURE_EXPAND_LINKS;
+      }
+
+      if (JsonValueIsTrue (JsonObjectGetValue (Expand, "NoLinks"))) {
+        QueryFeatures |= REDFISH_QUERY_FEATURE_EXPAND_NO_LINKS;
+      }
+
+      if (JsonValueIsTrue (JsonObjectGetValue (Expand, "Levels"))) {
+        QueryFeatures |= REDFISH_QUERY_FEATURE_EXPAND_LEVELS;
+      }
+    }
+
+    if (JsonValueIsTrue (JsonObjectGetValue (Features, "SelectQuery"))) {
+      QueryFeatures |= REDFISH_QUERY_FEATURE_SELECT;
+    }
+
+    if (JsonValueIsTrue (JsonObjectGetValue (Features, "OnlyMemberQuery"))) {
+      QueryFeatures |= REDFISH_QUERY_FEATURE_ONLY;
+    }
+
+    if (JsonValueIsTrue (JsonObjectGetValue (Features, "FilterQuery"))) {
+      QueryFeatures |= REDFISH_QUERY_FEATURE_FILTER;
+    }
+  }
+
+  DEBUG ((DEBUG_INFO, "%a: query features 0x%x\n", __FUNCTION__, QueryFeatures));
+
+  Service->QueryFeatures         = QueryFeatures;
+  Service->QueryFeaturesDetected = TRUE;
+
+  cleanupPayload (Root);
+  FreePool (StatusCode);
+
+  return QueryFeatures;
+}
+
+/**
+  Get a redfish response addressed by URI with OData query options, for example
+  REDFISH_QUERY_EXPAND_ONE_LEVEL or "$select=Name,Status". Callers should check
+  RedfishGetQueryFeatures() before using the query options, services reject or
+  ignore the ones they don't support.
+
+  Callers are responsible for freeing the HTTP StatusCode, Headers and Payload returned in
+  redfish response data.
+
+  @param[in]    RedfishService    The Service to access the URI resources.
+  @param[in]    Uri               String to address a resource.
+  @param[in]    Query             Query options without the leading '?'. Options are
+                                  separated by '&'.
+  @param[out]   RedResponse       Pointer to the Redfish response data.
+
+  @retval EFI_SUCCESS             The HTTP StatusCode is 2XX, the resource is in Payload.
+  @retval EFI_INVALID_PARAMETER   RedfishService, Uri, Query or RedResponse is NULL.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to build the request.
+  @retval EFI_DEVICE_ERROR        Any error happens. See RedfishGetByUri().
+**/
+EFI_STATUS
+EFIAPI
+RedfishGetByUriWithQuery (
+  IN     REDFISH_SERVICE      RedfishService,
+  IN     CONST CHAR8          *Uri,
+  IN     CONST CHAR8          *Query,
+  OUT    REDFISH_RESPONSE     *RedResponse
+  )
+{
+  EFI_STATUS  Status;
+  CHAR8       *QueryUri;
+  UINTN       QueryUriSize;
+
+  if (RedfishService == NULL || Uri == NULL || Query == NULL || RedResponse == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (*Query == '\0') {
+    return RedfishGetByUri (RedfishService, Uri, RedResponse);
+  }
+
+  //
+  // Uri might carry query options already.
+  //
+  QueryUriSize = AsciiStrLen (Uri) + 1 + AsciiStrSize (Query);
+  QueryUri = AllocatePool (QueryUriSize);
+  if (QueryUri == NULL) {
+    ZeroMem (RedResponse, sizeof (REDFISH_RESPONSE));
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  AsciiSPrint (QueryUri, QueryUriSize, "%a%c%a", Uri, (AsciiStrStr (Uri, "?") == NULL) ? '?' : '&', Query);
+
+  //
+  // The response is cached by the URI with query options, it never hits the
+  // cache entry of the same resource retrieved without query.
+  //
+  Status = RedfishGetByUri (RedfishService, QueryUri, RedResponse);
+
+  FreePool (QueryUri);
+
+  return Status;
+}
+
+/**
+  Turn the JSON value and HTTP response of a GET request into Redfish response,
+  and keep the successful response in cache.
+
+  @param[in]      RedfishService    The Service the response comes from.
+  @param[in]      Uri               String to address the resource.
+  @param[in]      IfNoneMatch       ETag sent in If-None-Match header, or NULL.
+  @param[in]      JsonValue         The JSON value of response body, or NULL.
+  @param[in,out]  RedResponse       The Redfish response with StatusCode and Headers
+                                    already filled in.
+
+  @retval EFI_SUCCESS             The HTTP StatusCode is 2XX, the resource is in Payload.
+  @retval EFI_ALREADY_STARTED     The resource is not changed since IfNoneMatch.
+  @retval EFI_DEVICE_ERROR        Any error happens. See RedfishGetByUri().
+**/
+EFI_STATUS
+RedfishCompleteGetResponse (
+  IN     REDFISH_SERVICE      RedfishService,
+  IN     CONST CHAR8          *Uri,
+  IN     CONST CHAR8          *IfNoneMatch OPTIONAL,
+  IN     EDKII_JSON_VALUE     JsonValue,
+  IN OUT REDFISH_RESPONSE     *RedResponse
+  )
+{
+  //
+  // The resource is not changed, there is no message body.
+  //
+  if (IfNoneMatch != NULL && RedResponse->StatusCode != NULL &&
+      *(RedResponse->StatusCode) == HTTP_STATUS_304_NOT_MODIFIED) {
+    if (JsonValue != NULL) {
+      JsonValueFree (JsonValue);
+    }
+    RedfishFreeResponse (RedResponse->StatusCode, RedResponse->HeaderCount, RedResponse->Headers, NULL);
+    ZeroMem (RedResponse, sizeof (REDFISH_RESPONSE));
+    return EFI_ALREADY_STARTED;
+  }
+
   RedResponse->Payload = createRedfishPayload(JsonValue, RedfishService);
 
   //
@@ -343,6 +1003,9 @@ RedfishGetByUri (
       *(RedResponse->StatusCode) > HTTP_STATUS_206_PARTIAL_CONTENT) {
     return EFI_DEVICE_ERROR;
   }
+
+  RedfishHttpCacheAdd (RedfishService, Uri, RedResponse);
+
   return EFI_SUCCESS;
 }
 /**
@@ -459,6 +1122,7 @@ RedfishPatchToUri (
   }
 
   ZeroMem (RedResponse, sizeof (REDFISH_RESPONSE));
+  RedfishHttpCacheInvalidate (RedfishService, Uri);
 
   JsonValue = (EDKII_JSON_VALUE) patchUriFromService (
                                    RedfishService,
@@ -540,6 +1204,7 @@ RedfishPatchToPayload (
   }
 
   ZeroMem (RedResponse, sizeof (REDFISH_RESPONSE));
+  RedfishHttpCacheInvalidatePayload (Target);
 
   RedResponse->Payload = (REDFISH_PAYLOAD) patchPayloadEx (
                                              Target,
@@ -608,6 +1273,7 @@ RedfishPostToPayload (
   }
 
   ZeroMem (RedResponse, sizeof (REDFISH_RESPONSE));
+  RedfishHttpCacheInvalidatePayload (Target);
 
   RedResponse->Payload = (REDFISH_PAYLOAD) postPayloadEx (
                                              Target,
@@ -682,6 +1348,7 @@ RedfishDeleteByUri (
   }
 
   ZeroMem (RedResponse, sizeof (REDFISH_RESPONSE));
+  RedfishHttpCacheInvalidate (RedfishService, Uri);
 
   JsonValue = (EDKII_JSON_VALUE) deleteUriFromService (
                                    RedfishService,
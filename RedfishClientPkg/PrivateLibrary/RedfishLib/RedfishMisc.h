@@ -24,6 +24,13 @@
 
 #define ARRAY_SIZE(Array) (sizeof (Array) / sizeof ((Array)[0]))
 
+//
+// RedfishWaitAsyncRequests() stalls this many microseconds between two
+// passes over the pending requests. It gives up the requests when none of
+// them completes in REDFISH_HTTP_RESPONSE_TIMEOUT milliseconds.
+//
+#define REDFISH_ASYNC_WAIT_STALL  1000
+
 /**
   Creates a REDFISH_SERVICE which can be later used to access the Redfish resources.
 
@@ -79,4 +86,187 @@ RedfishGetAuthInfo (
   OUT  CHAR8                              **Password
   );
 
+/**
+  Look up the cached response of the given URI. On cache hit, a copy of the
+  cached StatusCode, Headers and Payload is returned in RedResponse and callers
+  are responsible for freeing them by RedfishFreeResponse() as usual.
+
+  @param[in]    RedfishService    The Service to access the URI resources.
+  @param[in]    Uri               String to address a resource.
+  @param[in]    IfNoneMatch       If not NULL and the cached response carries
+                                  the same ETag, the resource is not changed and
+                                  nothing is returned in RedResponse.
+  @param[out]   RedResponse       Pointer to the Redfish response data.
+
+  @retval EFI_SUCCESS             The cached response is returned in RedResponse.
+  @retval EFI_ALREADY_STARTED     The cached response matches IfNoneMatch.
+  @retval EFI_NOT_FOUND           There is no cached response.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to copy the cached response.
+
+**/
+EFI_STATUS
+RedfishHttpCacheLookup (
+  IN     REDFISH_SERVICE   RedfishService,
+  IN     CONST CHAR8       *Uri,
+  IN     CONST CHAR8       *IfNoneMatch OPTIONAL,
+  OUT    REDFISH_RESPONSE  *RedResponse
+  );
+
+/**
+  Keep a copy of a successful GET response in cache. The existing entry of
+  the same URI is replaced.
+
+  @param[in]    RedfishService    The Service the response comes from.
+  @param[in]    Uri               String to address a resource.
+  @param[in]    RedResponse       The Redfish response to keep.
+
+  @retval EFI_SUCCESS             The response is kept in cache.
+  @retval EFI_INVALID_PARAMETER   The response is not a successful response.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to keep the response.
+
+**/
+EFI_STATUS
+RedfishHttpCacheAdd (
+  IN     REDFISH_SERVICE   RedfishService,
+  IN     CONST CHAR8       *Uri,
+  IN     REDFISH_RESPONSE  *RedResponse
+  );
+
+/**
+  Turn the JSON value and HTTP response of a GET request into Redfish response,
+  and keep the successful response in cache.
+
+  @param[in]      RedfishService    The Service the response comes from.
+  @param[in]      Uri               String to address the resource.
+  @param[in]      IfNoneMatch       ETag sent in If-None-Match header, or NULL.
+  @param[in]      JsonValue         The JSON value of response body, or NULL.
+  @param[in,out]  RedResponse       The Redfish response with StatusCode and Headers
+                                    already filled in.
+
+  @retval EFI_SUCCESS             The HTTP StatusCode is 2XX, the resource is in Payload.
+  @retval EFI_ALREADY_STARTED     The resource is not changed since IfNoneMatch.
+  @retval EFI_DEVICE_ERROR        Any error happens. See RedfishGetByUri().
+**/
+EFI_STATUS
+RedfishCompleteGetResponse (
+  IN     REDFISH_SERVICE      RedfishService,
+  IN     CONST CHAR8          *Uri,
+  IN     CONST CHAR8          *IfNoneMatch OPTIONAL,
+  IN     EDKII_JSON_VALUE     JsonValue,
+  IN OUT REDFISH_RESPONSE     *RedResponse
+  );
+
+/**
+  Get the ETag of a Redfish response. The ETag in HTTP header takes
+  precedence over "@odata.etag" in the resource.
+
+  @param[in]  HeaderCount     Number of HTTP header structures in Headers list.
+  @param[in]  Headers         Array containing list of HTTP headers.
+  @param[in]  JsonValue       The JSON resource in the response.
+
+  @return     Pointer to the ETag string, or NULL if there is no ETag.
+              The string is owned by Headers or JsonValue.
+
+**/
+CONST CHAR8 *
+RedfishHttpCacheGetETag (
+  IN UINTN             HeaderCount,
+  IN EFI_HTTP_HEADER   *Headers,
+  IN EDKII_JSON_VALUE  JsonValue
+  );
+
+/**
+  Drop the cached response of the given URI.
+
+  @param[in]    RedfishService    The Service the URI belongs to.
+  @param[in]    Uri               String to address a resource.
+
+**/
+VOID
+RedfishHttpCacheInvalidate (
+  IN     REDFISH_SERVICE  RedfishService,
+  IN     CONST CHAR8      *Uri
+  );
+
+/**
+  Drop the cached response of the resource which the given payload represents.
+  The URI is taken from "@odata.id" in payload.
+
+  @param[in]    Payload           The Redfish payload.
+
+**/
+VOID
+RedfishHttpCacheInvalidatePayload (
+  IN     REDFISH_PAYLOAD  Payload
+  );
+
+/**
+  Get a redfish response addressed by a RedPath string which was resolved
+  before. Every predicate of the RedPath is evaluated again on the member it
+  selected, and the cached URI of the RedPath is retrieved only when all of
+  them still hold. The cache entry is dropped otherwise.
+
+  @param[in]    RedfishService    The Service to access the Redfish resources.
+  @param[in]    RedPath           RedPath string to address a resource.
+  @param[out]   RedResponse       Pointer to the Redfish response data.
+
+  @retval EFI_SUCCESS             The response of the cached URI is returned in RedResponse.
+  @retval EFI_NOT_FOUND           The RedPath is not cached, or the cached URI is no longer
+                                  valid. Nothing is returned in RedResponse.
+
+**/
+EFI_STATUS
+RedfishPathCacheGet (
+  IN     REDFISH_SERVICE   RedfishService,
+  IN     CONST CHAR8       *RedPath,
+  OUT    REDFISH_RESPONSE  *RedResponse
+  );
+
+/**
+  Resolve a RedPath string node by node from the service root, and keep the
+  resolution in cache when it succeeds. The URI of the member every predicate
+  selects is recorded along the way, so that the resolution can be validated
+  later without scanning the collections again.
+
+  The result is returned in RedResponse the same way as getPayloadByPath().
+
+  @param[in]    RedfishService    The Service to access the Redfish resources.
+  @param[in]    RedPath           RedPath string to address a resource.
+  @param[out]   RedResponse       Pointer to the Redfish response data.
+
+**/
+VOID
+RedfishPathCacheResolve (
+  IN     REDFISH_SERVICE   RedfishService,
+  IN     CONST CHAR8       *RedPath,
+  OUT    REDFISH_RESPONSE  *RedResponse
+  );
+
+/**
+  Wait for the requests started by RedfishPrefetchByUri() to complete. The
+  successful responses are kept in cache.
+
+  @param[in]    RedfishService    The Service the requests are sent to. If NULL,
+                                  the requests of all services are completed.
+  @param[in]    Uri               Complete the request of this URI only. If NULL,
+                                  all requests of RedfishService are completed.
+
+**/
+VOID
+RedfishCompletePrefetch (
+  IN     REDFISH_SERVICE      RedfishService OPTIONAL,
+  IN     CONST CHAR8          *Uri OPTIONAL
+  );
+
+/**
+  Drop the cached RedPath resolutions of the given Redfish service.
+
+  @param[in]  RedfishService  The Service the RedPaths belong to.
+
+**/
+VOID
+RedfishFlushPathCache (
+  IN REDFISH_SERVICE  RedfishService
+  );
+
 #endif
@@ -0,0 +1,490 @@
+/** @file
+  Redfish RedPath resolution cache.
+
+  Resolving a RedPath such as "/v1/Systems[UUID=%g]/Bios" walks every node
+  from the service root and scans the whole collection to evaluate each
+  predicate. The URI ("@odata.id") of the resolved resource is kept here,
+  keyed by Redfish service and RedPath, together with the URI of the member
+  each predicate selected. The following resolution of the same RedPath
+  evaluates every predicate again on the member it selected before and then
+  GETs the kept URI, instead of scanning the collections. The RedPath is
+  resolved again once a predicate no longer holds on its member, or any of
+  the GETs fails, e.g. the member is removed or moved.
+
+  Unlike the HTTP response cache, the entries live across provisioning cycles
+  and are dropped only when the Redfish service is cleaned up.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishMisc.h"
+
+//
+// Definition of REDFISH_PATH_CACHE_DATA
+//
+typedef struct {
+  LIST_ENTRY              List;
+  REDFISH_SERVICE         Service;
+  CHAR8                   *RedPath;
+  CHAR8                   *Uri;
+  UINTN                   ParentCount;
+  CHAR8                   **ParentUri;
+} REDFISH_PATH_CACHE_DATA;
+
+#define REDFISH_PATH_CACHE_DATA_FROM_LIST(a)  BASE_CR (a, REDFISH_PATH_CACHE_DATA, List)
+
+LIST_ENTRY  mRedfishPathCacheList = INITIALIZE_LIST_HEAD_VARIABLE (mRedfishPathCacheList);
+
+/**
+  Release a cache entry and remove it from the cache list.
+
+  @param[in]  CacheData       The cache entry to release.
+
+**/
+VOID
+RedfishPathCacheReleaseData (
+  IN REDFISH_PATH_CACHE_DATA  *CacheData
+  )
+{
+  UINTN  Index;
+
+  RemoveEntryList (&CacheData->List);
+
+  if (CacheData->RedPath != NULL) {
+    FreePool (CacheData->RedPath);
+  }
+
+  if (CacheData->Uri != NULL) {
+    FreePool (CacheData->Uri);
+  }
+
+  if (CacheData->ParentUri != NULL) {
+    for (Index = 0; Index < CacheData->ParentCount; Index++) {
+      if (CacheData->ParentUri[Index] != NULL) {
+        FreePool (CacheData->ParentUri[Index]);
+      }
+    }
+
+    FreePool (CacheData->ParentUri);
+  }
+
+  FreePool (CacheData);
+}
+
+/**
+  Find the cache entry of the given RedPath on the given Redfish service.
+
+  @param[in]  RedfishService  The Service the RedPath belongs to.
+  @param[in]  RedPath         RedPath string to address the resource.
+
+  @return     Pointer to the cache entry, or NULL if the RedPath is not cached.
+
+**/
+REDFISH_PATH_CACHE_DATA *
+RedfishPathCacheFind (
+  IN REDFISH_SERVICE  RedfishService,
+  IN CONST CHAR8      *RedPath
+  )
+{
+  LIST_ENTRY               *Node;
+  REDFISH_PATH_CACHE_DATA  *CacheData;
+
+  Node = GetFirstNode (&mRedfishPathCacheList);
+  while (!IsNull (&mRedfishPathCacheList, Node)) {
+    CacheData = REDFISH_PATH_CACHE_DATA_FROM_LIST (Node);
+    if (CacheData->Service == RedfishService && AsciiStrCmp (CacheData->RedPath, RedPath) == 0) {
+      return CacheData;
+    }
+
+    Node = GetNextNode (&mRedfishPathCacheList, Node);
+  }
+
+  return NULL;
+}
+
+/**
+  Check whether the predicate of a RedPath node still holds on the member it
+  selected when the RedPath was resolved.
+
+  @param[in]  RedfishService  The Service to access the Redfish resources.
+  @param[in]  PredicateNode   The RedPath node of the predicate. The node is
+                              evaluated alone, the nodes after it are ignored.
+  @param[in]  ParentUri       The URI of the member the predicate selected.
+
+  @retval TRUE                The predicate holds on the member.
+  @retval FALSE               The predicate doesn't hold, or the member can't
+                              be retrieved.
+
+**/
+BOOLEAN
+RedfishPathCacheCheckPredicate (
+  IN REDFISH_SERVICE  RedfishService,
+  IN redPathNode      *PredicateNode,
+  IN CONST CHAR8      *ParentUri
+  )
+{
+  EFI_STATUS            Status;
+  REDFISH_RESPONSE      Response;
+  redPathNode           *NextNode;
+  redfishPayload        *Result;
+  EFI_HTTP_STATUS_CODE  *StatusCode;
+
+  //
+  // The member is likely in HTTP cache already in the same provisioning cycle.
+  //
+  Status = RedfishGetByUri (RedfishService, ParentUri, &Response);
+  if (EFI_ERROR (Status)) {
+    RedfishFreeResponse (Response.StatusCode, Response.HeaderCount, Response.Headers, Response.Payload);
+    return FALSE;
+  }
+
+  NextNode            = PredicateNode->next;
+  PredicateNode->next = NULL;
+  StatusCode          = NULL;
+  Result              = getPayloadForPath ((redfishPayload *)Response.Payload, PredicateNode, &StatusCode);
+  PredicateNode->next = NextNode;
+
+  if (StatusCode != NULL) {
+    FreePool (StatusCode);
+  }
+
+  //
+  // The member itself is returned when the predicate holds.
+  //
+  if ((Result != NULL) && (Result != (redfishPayload *)Response.Payload)) {
+    cleanupPayload (Result);
+  }
+
+  RedfishFreeResponse (Response.StatusCode, Response.HeaderCount, Response.Headers, Response.Payload);
+
+  return (BOOLEAN)(Result != NULL);
+}
+
+/**
+  Get a redfish response addressed by a RedPath string which was resolved
+  before. Every predicate of the RedPath is evaluated again on the member it
+  selected, and the cached URI of the RedPath is retrieved only when all of
+  them still hold. The cache entry is dropped otherwise.
+
+  @param[in]    RedfishService    The Service to access the Redfish resources.
+  @param[in]    RedPath           RedPath string to address a resource.
+  @param[out]   RedResponse       Pointer to the Redfish response data.
+
+  @retval EFI_SUCCESS             The response of the cached URI is returned in RedResponse.
+  @retval EFI_NOT_FOUND           The RedPath is not cached, or the cached URI is no longer
+                                  valid. Nothing is returned in RedResponse.
+
+**/
+EFI_STATUS
+RedfishPathCacheGet (
+  IN     REDFISH_SERVICE   RedfishService,
+  IN     CONST CHAR8       *RedPath,
+  OUT    REDFISH_RESPONSE  *RedResponse
+  )
+{
+  EFI_STATUS               Status;
+  REDFISH_PATH_CACHE_DATA  *CacheData;
+  redPathNode              *RedPathList;
+  redPathNode              *Node;
+  UINTN                    Index;
+
+  CacheData = RedfishPathCacheFind (RedfishService, RedPath);
+  if (CacheData == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  RedPathList = parseRedPath (RedPath);
+  if (RedPathList == NULL) {
+    goto ON_INVALID;
+  }
+
+  Index = 0;
+  for (Node = RedPathList; Node != NULL; Node = Node->next) {
+    if (Node->op == NULL) {
+      continue;
+    }
+
+    if ((Index >= CacheData->ParentCount) ||
+        !RedfishPathCacheCheckPredicate (RedfishService, Node, CacheData->ParentUri[Index]))
+    {
+      break;
+    }
+
+    Index++;
+  }
+
+  cleanupRedPath (RedPathList);
+  if (Node != NULL) {
+    goto ON_INVALID;
+  }
+
+  Status = RedfishGetByUri (RedfishService, CacheData->Uri, RedResponse);
+  if (!EFI_ERROR (Status)) {
+    return EFI_SUCCESS;
+  }
+
+  RedfishFreeResponse (RedResponse->StatusCode, RedResponse->HeaderCount, RedResponse->Headers, RedResponse->Payload);
+  ZeroMem (RedResponse, sizeof (REDFISH_RESPONSE));
+
+ON_INVALID:
+
+  DEBUG ((DEBUG_VERBOSE, "%a: %a is no longer %a\n", __FUNCTION__, RedPath, CacheData->Uri));
+
+  RedfishPathCacheReleaseData (CacheData);
+
+  return EFI_NOT_FOUND;
+}
+
+/**
+  Keep the URI of the resource a RedPath is resolved to, and the URIs of the
+  members the predicates of the RedPath selected. The existing entry of the
+  same RedPath is replaced. Nothing is kept if the resource has no
+  "@odata.id", e.g. the RedPath addresses a property inside a resource.
+
+  @param[in]    RedfishService    The Service the response comes from.
+  @param[in]    RedPath           RedPath string the resource is resolved from.
+  @param[in]    RedResponse       The Redfish response of the RedPath.
+  @param[in]    ParentCount       Number of the predicates in RedPath.
+  @param[in]    ParentUri         The URIs of the members the predicates selected, in
+                                  RedPath order. The array and the URIs are owned by the
+                                  cache entry on success.
+
+  @retval EFI_SUCCESS             The URIs are kept in cache.
+  @retval EFI_UNSUPPORTED         The resource has no "@odata.id".
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to keep the URI.
+
+**/
+EFI_STATUS
+RedfishPathCacheAdd (
+  IN     REDFISH_SERVICE   RedfishService,
+  IN     CONST CHAR8       *RedPath,
+  IN     REDFISH_RESPONSE  *RedResponse,
+  IN     UINTN             ParentCount,
+  IN     CHAR8             **ParentUri
+  )
+{
+  REDFISH_PATH_CACHE_DATA  *CacheData;
+  EDKII_JSON_VALUE         JsonValue;
+  EDKII_JSON_VALUE         OdataId;
+
+  JsonValue = RedfishJsonInPayload (RedResponse->Payload);
+  if (!JsonValueIsObject (JsonValue)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  OdataId = JsonObjectGetValue (JsonValueGetObject (JsonValue), "@odata.id");
+  if (!JsonValueIsString (OdataId)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  CacheData = RedfishPathCacheFind (RedfishService, RedPath);
+  if (CacheData != NULL) {
+    RedfishPathCacheReleaseData (CacheData);
+  }
+
+  CacheData = AllocateZeroPool (sizeof (REDFISH_PATH_CACHE_DATA));
+  if (CacheData == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  InsertTailList (&mRedfishPathCacheList, &CacheData->List);
+  CacheData->Service = RedfishService;
+  CacheData->RedPath = AllocateCopyPool (AsciiStrSize (RedPath), RedPath);
+  CacheData->Uri     = AllocateCopyPool (AsciiStrSize (JsonValueGetAsciiString (OdataId)), JsonValueGetAsciiString (OdataId));
+  if ((CacheData->RedPath == NULL) || (CacheData->Uri == NULL)) {
+    //
+    // ParentUri is still owned by the caller.
+    //
+    RedfishPathCacheReleaseData (CacheData);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  CacheData->ParentCount = ParentCount;
+  CacheData->ParentUri   = ParentUri;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Resolve a RedPath string node by node from the service root, and keep the
+  resolution in cache when it succeeds. The URI of the member every predicate
+  selects is recorded along the way, so that the resolution can be validated
+  later without scanning the collections again.
+
+  The result is returned in RedResponse the same way as getPayloadByPath().
+
+  @param[in]    RedfishService    The Service to access the Redfish resources.
+  @param[in]    RedPath           RedPath string to address a resource.
+  @param[out]   RedResponse       Pointer to the Redfish response data.
+
+**/
+VOID
+RedfishPathCacheResolve (
+  IN     REDFISH_SERVICE   RedfishService,
+  IN     CONST CHAR8       *RedPath,
+  OUT    REDFISH_RESPONSE  *RedResponse
+  )
+{
+  redPathNode           *RedPathList;
+  redPathNode           *Node;
+  redPathNode           *NextNode;
+  redfishPayload        *Payload;
+  redfishPayload        *NextPayload;
+  EFI_HTTP_STATUS_CODE  *StatusCode;
+  EFI_HTTP_STATUS_CODE  *NextStatusCode;
+  EDKII_JSON_VALUE      OdataId;
+  CHAR8                 **ParentUri;
+  UINTN                 ParentCount;
+  UINTN                 Index;
+  BOOLEAN               Cacheable;
+
+  ParentUri   = NULL;
+  ParentCount = 0;
+  Cacheable   = TRUE;
+  Payload     = NULL;
+  StatusCode  = NULL;
+
+  RedPathList = parseRedPath (RedPath);
+  if ((RedPathList == NULL) || !RedPathList->isRoot) {
+    goto ON_EXIT;
+  }
+
+  for (Node = RedPathList; Node != NULL; Node = Node->next) {
+    if (Node->op != NULL) {
+      ParentCount++;
+    }
+  }
+
+  if (ParentCount != 0) {
+    ParentUri = AllocateZeroPool (ParentCount * sizeof (CHAR8 *));
+    if (ParentUri == NULL) {
+      Cacheable = FALSE;
+    }
+  }
+
+  Payload = getRedfishServiceRoot (RedfishService, RedPathList->version, &StatusCode);
+  if ((StatusCode == NULL) || (*StatusCode < HTTP_STATUS_200_OK) || (*StatusCode > HTTP_STATUS_206_PARTIAL_CONTENT)) {
+    goto ON_EXIT;
+  }
+
+  Index = 0;
+  for (Node = RedPathList->next; Node != NULL; Node = Node->next) {
+    NextNode       = Node->next;
+    Node->next     = NULL;
+    NextStatusCode = NULL;
+    NextPayload    = getPayloadForPath (Payload, Node, &NextStatusCode);
+    Node->next     = NextNode;
+
+    if ((NextPayload != Payload) && (Payload != NULL)) {
+      cleanupPayload (Payload);
+    }
+
+    Payload = NextPayload;
+
+    //
+    // Keep the status of the last resource retrieved from server. The nodes
+    // parsed from that resource directly report no status.
+    //
+    if ((NextStatusCode != NULL) || (NextPayload == NULL)) {
+      if (StatusCode != NULL) {
+        FreePool (StatusCode);
+      }
+
+      StatusCode = NextStatusCode;
+    }
+
+    if ((Payload == NULL) || (StatusCode == NULL) ||
+        (*StatusCode < HTTP_STATUS_200_OK) || (*StatusCode > HTTP_STATUS_206_PARTIAL_CONTENT))
+    {
+      goto ON_EXIT;
+    }
+
+    if ((Node->op == NULL) || !Cacheable) {
+      continue;
+    }
+
+    //
+    // The predicate is validated on the member it selects. Nothing is kept if
+    // it selects more than one member, or a property inside a resource.
+    //
+    OdataId = NULL;
+    if (JsonValueIsObject ((EDKII_JSON_VALUE)Payload->json)) {
+      OdataId = JsonObjectGetValue (JsonValueGetObject ((EDKII_JSON_VALUE)Payload->json), "@odata.id");
+    }
+
+    if (!JsonValueIsString (OdataId)) {
+      Cacheable = FALSE;
+      continue;
+    }
+
+    ParentUri[Index] = AllocateCopyPool (AsciiStrSize (JsonValueGetAsciiString (OdataId)), JsonValueGetAsciiString (OdataId));
+    if (ParentUri[Index] == NULL) {
+      Cacheable = FALSE;
+      continue;
+    }
+
+    Index++;
+  }
+
+  if (Cacheable) {
+    RedResponse->Payload    = (REDFISH_PAYLOAD)Payload;
+    RedResponse->StatusCode = StatusCode;
+
+    //
+    // The response is returned anyway. A RedPath not kept in cache is only
+    // resolved again next time.
+    //
+    if (!EFI_ERROR (RedfishPathCacheAdd (RedfishService, RedPath, RedResponse, ParentCount, ParentUri))) {
+      ParentUri = NULL;
+    }
+  }
+
+ON_EXIT:
+
+  if (ParentUri != NULL) {
+    for (Index = 0; Index < ParentCount; Index++) {
+      if (ParentUri[Index] != NULL) {
+        FreePool (ParentUri[Index]);
+      }
+    }
+
+    FreePool (ParentUri);
+  }
+
+  if (RedPathList != NULL) {
+    cleanupRedPath (RedPathList);
+  }
+
+  RedResponse->Payload    = (REDFISH_PAYLOAD)Payload;
+  RedResponse->StatusCode = StatusCode;
+}
+
+/**
+  Drop the cached RedPath resolutions of the given Redfish service.
+
+  @param[in]  RedfishService  The Service the RedPaths belong to.
+
+**/
+VOID
+RedfishFlushPathCache (
+  IN REDFISH_SERVICE  RedfishService
+  )
+{
+  LIST_ENTRY               *Node;
+  LIST_ENTRY               *NextNode;
+  REDFISH_PATH_CACHE_DATA  *CacheData;
+
+  Node = GetFirstNode (&mRedfishPathCacheList);
+  while (!IsNull (&mRedfishPathCacheList, Node)) {
+    NextNode  = GetNextNode (&mRedfishPathCacheList, Node);
+    CacheData = REDFISH_PATH_CACHE_DATA_FROM_LIST (Node);
+    if (CacheData->Service == RedfishService) {
+      RedfishPathCacheReleaseData (CacheData);
+    }
+
+    Node = NextNode;
+  }
+}
@@ -26,13 +26,16 @@
 #include <Library/HttpLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/NetLib.h>
+#include <Library/PcdLib.h>
 #include <Library/RedfishContentCodingLib.h>
+#include <Library/RedfishPerfLib.h>
 #include <Library/UefiRuntimeServicesTableLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 
 #include <Include/Library/RedfishCrtLib.h>
 
 #include <Protocol/EdkIIRedfishConfigHandler.h>
+#include <Protocol/EdkIIRedfishRestExPipeline.h>
 #include <Protocol/RestEx.h>
 
 #include <jansson.h>
@@ -49,6 +52,16 @@ typedef struct {
     //
     char* HostHeaderValue;
     EFI_REST_EX_PROTOCOL *RestEx;
+    //
+    // Optional, NULL if REST EX driver doesn't provide it.
+    //
+    EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL *RestExPipeline;
+    //
+    // REDFISH_QUERY_FEATURE_XXX bits from ProtocolFeaturesSupported in service root.
+    // Valid only when QueryFeaturesDetected is TRUE.
+    //
+    UINT32 QueryFeatures;
+    BOOLEAN QueryFeaturesDetected;
 } redfishService;
 
 typedef struct {
@@ -92,6 +105,9 @@ typedef struct {
 redfishService* createServiceEnumerator(REDFISH_CONFIG_SERVICE_INFORMATION *RedfishConfigServiceInfo, const char* rootUri, enumeratorAuthentication* auth, unsigned int flags);
 json_t* getUriFromService(redfishService* service, const char* uri, EFI_HTTP_STATUS_CODE** StatusCode);
 json_t* getUriFromServiceEx(redfishService* service, const char* uri, EFI_HTTP_HEADER **Headers, UINTN *HeaderCount, EFI_HTTP_STATUS_CODE **StatusCode);
+json_t* getUriFromServiceIfNoneMatch(redfishService* service, const char* uri, const char* etag, EFI_HTTP_HEADER **Headers, UINTN *HeaderCount, EFI_HTTP_STATUS_CODE **StatusCode);
+EFI_STATUS getUriFromServiceAsync(redfishService* service, const char* uri, void** asyncRequest);
+json_t* getUriFromServiceAsyncResult(redfishService* service, void* asyncRequest, EFI_STATUS* AsyncStatus, EFI_HTTP_HEADER **Headers, UINTN *HeaderCount, EFI_HTTP_STATUS_CODE **StatusCode);
 json_t* patchUriFromService(redfishService* service, const char* uri, const char* content, EFI_HTTP_STATUS_CODE** StatusCode);
 json_t* patchUriFromServiceEx(redfishService* service, const char* uri, const char* content, EFI_HTTP_HEADER **Headers, UINTN *HeaderCount, EFI_HTTP_STATUS_CODE** StatusCode);
 json_t* postUriFromService(redfishService* service, const char* uri, const char* content, size_t contentLength, const char* contentType, EFI_HTTP_STATUS_CODE** StatusCode);
@@ -23,6 +23,7 @@ static int initRest(redfishService* service, void * restProtocol);
 static redfishService* createServiceEnumeratorNoAuth(const char* host, const char* rootUri, bool enumerate, unsigned int flags, void * restProtocol);
 static redfishService* createServiceEnumeratorBasicAuth(const char* host, const char* rootUri, const char* username, const char* password, unsigned int flags, void * restProtocol);
 static redfishService* createServiceEnumeratorSessionAuth(const char* host, const char* rootUri, const char* username, const char* password, unsigned int flags, void * restProtocol);
+static redfishService* createServiceEnumeratorToken(const char* host, const char* rootUri, const char* token, unsigned int flags, void * restProtocol);
 static char* makeUrlForService(redfishService* service, const char* uri);
 static json_t* getVersions(redfishService* service, const char* rootUri);
 static void addStringToJsonObject(json_t* object, const char* key, const char* value);
@@ -207,6 +208,172 @@ DecodeResponseContent (
   return Status;
 }
 
+/**
+  Record the measurement of HTTP request. The request is counted as failed
+  when no response is received or the HTTP status code is 4XX or 5XX.
+
+  @param[in]   StartTick             Time stamp returned by RedfishPerfStart().
+  @param[in]   Status                Status of sending the request.
+  @param[in]   RequestMsg            HTTP request message.
+  @param[in]   ResponseMsg           HTTP response message.
+
+**/
+VOID
+recordHttpRequest (
+  IN UINT64            StartTick,
+  IN EFI_STATUS        Status,
+  IN EFI_HTTP_MESSAGE  *RequestMsg,
+  IN EFI_HTTP_MESSAGE  *ResponseMsg
+  )
+{
+  BOOLEAN  Failed;
+  UINT64   Bytes;
+
+  if (StartTick == 0) {
+    return;
+  }
+
+  Bytes  = RequestMsg->BodyLength;
+  Failed = TRUE;
+  if (!EFI_ERROR (Status)) {
+    Bytes += ResponseMsg->BodyLength;
+    if ((ResponseMsg->Data.Response != NULL) && (ResponseMsg->Data.Response->StatusCode < HTTP_STATUS_400_BAD_REQUEST)) {
+      Failed = FALSE;
+    }
+  }
+
+  RedfishPerfEndUnicode (RedfishPerfHttpRequest, RequestMsg->Data.Request->Url, StartTick, 1, Bytes, Failed);
+}
+
+/**
+  Send HTTP request to Redfish service and receive the response.
+
+  @param[in]   service               The Redfish service.
+  @param[in]   RequestMsg            HTTP request message.
+  @param[out]  ResponseMsg           HTTP response message.
+
+  @retval      Status returned by EFI_REST_EX_PROTOCOL.SendReceive().
+
+**/
+EFI_STATUS
+sendReceiveRequest (
+  IN  redfishService    *service,
+  IN  EFI_HTTP_MESSAGE  *RequestMsg,
+  OUT EFI_HTTP_MESSAGE  *ResponseMsg
+  )
+{
+  EFI_STATUS  Status;
+  UINT64      StartTick;
+
+  StartTick = RedfishPerfStart ();
+  Status    = service->RestEx->SendReceive (service->RestEx, RequestMsg, ResponseMsg);
+  recordHttpRequest (StartTick, Status, RequestMsg, ResponseMsg);
+
+  return Status;
+}
+
+/**
+  Parse the JSON text in the message body of HTTP response.
+
+  @param[in]   RequestMsg            HTTP request message.
+  @param[in]   ResponseMsg           HTTP response message.
+
+  @retval      JSON value, or NULL if the text is not valid JSON.
+
+**/
+json_t *
+loadResponseBody (
+  IN EFI_HTTP_MESSAGE  *RequestMsg,
+  IN EFI_HTTP_MESSAGE  *ResponseMsg
+  )
+{
+  json_t  *ret;
+  UINT64  StartTick;
+
+  StartTick = RedfishPerfStart ();
+  ret       = json_loadb (ResponseMsg->Body, ResponseMsg->BodyLength, 0, NULL);
+  RedfishPerfEndUnicode (RedfishPerfJsonParse, RequestMsg->Data.Request->Url, StartTick, 1, ResponseMsg->BodyLength, (BOOLEAN)(ret == NULL));
+
+  return ret;
+}
+
+/**
+  This function sets the message body of PATCH request. The content is
+  encoded with gzip only when it is not shorter than
+  PcdRedfishRequestContentEncodingThreshold, because not every Redfish
+  service accepts encoded request. Content-Encoding and Content-Length
+  headers are set to match the message body.
+
+  @param[in]   HttpIoHeader          HTTP headers of the request.
+  @param[in]   Content               Request content.
+  @param[out]  EncodedContent        Pointer to receive message body. It is
+                                     Content when the content is not encoded,
+                                     otherwise caller frees it.
+  @param[out]  EncodedContentLength  Length of message body.
+
+  @retval EFI_SUCCESS              Message body and headers are set.
+  @retval Others                   Fail to encode the content or set headers.
+
+**/
+EFI_STATUS
+setPatchRequestBody (
+  IN  HTTP_IO_HEADER  *HttpIoHeader,
+  IN  CONST CHAR8     *Content,
+  OUT CHAR8           **EncodedContent,
+  OUT UINTN           *EncodedContentLength
+)
+{
+  EFI_STATUS  Status;
+  UINTN       ContentLength;
+  UINT32      Threshold;
+  CHAR8       *Encoding;
+  CHAR8       ContentLengthStr[80];
+
+  ContentLength = AsciiStrLen (Content);
+  *EncodedContent = (CHAR8 *)Content;
+  *EncodedContentLength = ContentLength;
+  Encoding = HTTP_CONTENT_ENCODING_IDENTITY;
+
+  Threshold = PcdGet32 (PcdRedfishRequestContentEncodingThreshold);
+  if (Threshold != 0 && ContentLength >= Threshold) {
+    //
+    // We currently only support gzip Content-Encoding.
+    //
+    Status = EncodeRequestContent ((CHAR8 *)HTTP_CONTENT_ENCODING_GZIP, (CHAR8 *)Content, (VOID **)EncodedContent, EncodedContentLength);
+    if (Status == EFI_SUCCESS && *EncodedContentLength >= ContentLength) {
+      //
+      // The content doesn't compress, send it as is.
+      //
+      FreePool (*EncodedContent);
+      *EncodedContent = (CHAR8 *)Content;
+      *EncodedContentLength = ContentLength;
+    } else if (Status == EFI_SUCCESS) {
+      Encoding = HTTP_CONTENT_ENCODING_GZIP;
+    } else if (Status == EFI_UNSUPPORTED) {
+      DEBUG((DEBUG_INFO, "No content coding for %a! Use raw data instead.\n", HTTP_CONTENT_ENCODING_GZIP));
+    } else {
+      DEBUG((DEBUG_ERROR, "%a: Error to encode content: %r\n", __FUNCTION__, Status));
+      return Status;
+    }
+  }
+
+  Status = HttpIoSetHeader (HttpIoHeader, "Content-Encoding", Encoding);
+  if (!EFI_ERROR (Status)) {
+    //
+    // Content-Length is the length of message body after encoding.
+    //
+    AsciiSPrint (ContentLengthStr, sizeof (ContentLengthStr), "%lu", (UINT64)*EncodedContentLength);
+    Status = HttpIoSetHeader (HttpIoHeader, "Content-Length", ContentLengthStr);
+  }
+
+  if (EFI_ERROR (Status) && *EncodedContent != Content) {
+    FreePool (*EncodedContent);
+    *EncodedContent = (CHAR8 *)Content;
+  }
+
+  return Status;
+}
+
 /**
   Create a HTTP URL string for specific Redfish resource.
 
@@ -285,11 +452,13 @@ redfishService* createServiceEnumerator(REDFISH_CONFIG_SERVICE_INFORMATION *Redf
   CHAR16               *HttpUrl;
   CHAR8                *AsciiHost;
   EFI_REST_EX_PROTOCOL *RestEx;
+  EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL *RestExPipeline;
   redfishService       *ret;
 
   HttpUrl = NULL;
   AsciiHost = NULL;
   RestEx = NULL;
+  RestExPipeline = NULL;
   ret = NULL;
 
   if (RedfishConfigServiceInfo->RedfishServiceRestExHandle == NULL) {
@@ -315,17 +484,32 @@ redfishService* createServiceEnumerator(REDFISH_CONFIG_SERVICE_INFORMATION *Redf
   if (EFI_ERROR (Status)) {
     goto ON_EXIT;
   }
+  //
+  // The pipeline protocol is optional, it drives the asynchronous requests.
+  //
+  gBS->HandleProtocol (
+         RedfishConfigServiceInfo->RedfishServiceRestExHandle,
+         &gEdkIIRedfishRestExPipelineProtocolGuid,
+         (VOID **)&RestExPipeline
+         );
   if(auth == NULL) {
     ret = createServiceEnumeratorNoAuth(AsciiHost, rootUri, true, flags, RestEx);
   } else if(auth->authType == REDFISH_AUTH_BASIC) {
     ret = createServiceEnumeratorBasicAuth(AsciiHost, rootUri, auth->authCodes.userPass.username, auth->authCodes.userPass.password, flags, RestEx);
   } else if(auth->authType == REDFISH_AUTH_SESSION) {
     ret = createServiceEnumeratorSessionAuth(AsciiHost, rootUri, auth->authCodes.userPass.username, auth->authCodes.userPass.password, flags, RestEx);
+  } else if(auth->authType == REDFISH_AUTH_BEARER_TOKEN) {
+    ret = createServiceEnumeratorToken(AsciiHost, rootUri, auth->authCodes.authToken.token, flags, RestEx);
   } else {
     goto ON_EXIT;
   }
 
+  if (ret == NULL) {
+    goto ON_EXIT;
+  }
+
   ret->RestEx = RestEx;
+  ret->RestExPipeline = RestExPipeline;
 ON_EXIT:
   if (HttpUrl != NULL) {
     FreePool (HttpUrl);
@@ -363,25 +547,42 @@ EFI_HTTP_HEADER *cloneHttpHeaders(EFI_HTTP_MESSAGE *message, UINTN *HeaderCount)
   return Buffer;
 }
 
-json_t* getUriFromServiceEx(redfishService* service, const char* uri, EFI_HTTP_HEADER **Headers, UINTN *HeaderCount, EFI_HTTP_STATUS_CODE **StatusCode)
+///
+/// The HTTP GET request of getUriFromServiceIfNoneMatch() and getUriFromServiceAsync().
+///
+typedef struct {
+  HTTP_IO_HEADER          *HttpIoHeader;
+  EFI_HTTP_REQUEST_DATA   *RequestData;
+  EFI_HTTP_MESSAGE        RequestMsg;
+  EFI_HTTP_MESSAGE        ResponseMsg;
+  EFI_REST_EX_TOKEN       Token;
+  UINT64                  PerfStartTick;
+} redfishGetRequest;
+
+static void freeGetRequest(redfishGetRequest* request)
 {
-  char* url;
-  json_t* ret;
-  HTTP_IO_HEADER                    *HttpIoHeader = NULL;
-  EFI_STATUS                        Status;
-  EFI_HTTP_REQUEST_DATA             *RequestData = NULL;
-  EFI_HTTP_MESSAGE                  *RequestMsg = NULL;
-  EFI_HTTP_MESSAGE                  ResponseMsg;
-  EFI_HTTP_HEADER                   *ContentEncodedHeader;
+  if (request->HttpIoHeader != NULL) {
+    HttpIoFreeHeader (request->HttpIoHeader);
+  }
 
-  if(service == NULL || uri == NULL || Headers == NULL || HeaderCount == NULL ||StatusCode == NULL)
-  {
-      return NULL;
+  if (request->RequestData != NULL) {
+    RestConfigFreeHttpRequestData (request->RequestData);
   }
 
-  *StatusCode = NULL;
-  *HeaderCount = 0;
-  *Headers = NULL;
+  if (request->Token.Event != NULL) {
+    gBS->CloseEvent (request->Token.Event);
+  }
+
+  RestConfigFreeHttpMessage (&request->ResponseMsg, FALSE);
+  FreePool (request);
+}
+
+static redfishGetRequest* createGetRequest(redfishService* service, const char* uri, const char* etag)
+{
+  char*                 url;
+  redfishGetRequest*    request;
+  EFI_STATUS            Status;
+  UINTN                 HeaderNumber;
 
   url = makeUrlForService(service, uri);
   if(!url)
@@ -389,139 +590,267 @@ json_t* getUriFromServiceEx(redfishService* service, const char* uri, EFI_HTTP_H
       return NULL;
   }
 
-  DEBUG((DEBUG_INFO, "libredfish: getUriFromServiceEx(): %a\n", url));
+  DEBUG((DEBUG_INFO, "libredfish: createGetRequest(): %a\n", url));
+
+  request = AllocateZeroPool (sizeof (redfishGetRequest));
+  if (request == NULL) {
+    free (url);
+    return NULL;
+  }
 
   //
-  // Step 1: Create HTTP request message with 4 headers:
+  // Step 1: Create HTTP request message with 5 headers, plus authentication,
+  //         If-None-Match and Accept-Encoding headers when they are required:
   //
-  HttpIoHeader = HttpIoCreateHeader ((service->sessionToken || service->basicAuthStr) ? 6 : 5);
-  if (HttpIoHeader == NULL) {
-    ret = NULL;
-    goto ON_EXIT;
+  HeaderNumber = 5;
+  if (service->sessionToken || service->basicAuthStr) {
+    HeaderNumber++;
+  }
+  if (etag != NULL) {
+    HeaderNumber++;
+  }
+  if (RedfishContentAcceptEncoding () != NULL) {
+    HeaderNumber++;
+  }
+  request->HttpIoHeader = HttpIoCreateHeader (HeaderNumber);
+  if (request->HttpIoHeader == NULL) {
+    goto ON_ERROR;
   }
 
   if(service->sessionToken)
   {
-    Status = HttpIoSetHeader (HttpIoHeader, "X-Auth-Token", service->sessionToken);
+    Status = HttpIoSetHeader (request->HttpIoHeader, "X-Auth-Token", service->sessionToken);
     ASSERT_EFI_ERROR (Status);
   } else if (service->basicAuthStr) {
-    Status = HttpIoSetHeader (HttpIoHeader, "Authorization", service->basicAuthStr);
+    Status = HttpIoSetHeader (request->HttpIoHeader, "Authorization", service->basicAuthStr);
     ASSERT_EFI_ERROR (Status);
   }
 
-  Status = HttpIoSetHeader (HttpIoHeader, "Host", service->HostHeaderValue);
+  Status = HttpIoSetHeader (request->HttpIoHeader, "Host", service->HostHeaderValue);
   ASSERT_EFI_ERROR (Status);
-  Status = HttpIoSetHeader (HttpIoHeader, "OData-Version", "4.0");
+  Status = HttpIoSetHeader (request->HttpIoHeader, "OData-Version", "4.0");
   ASSERT_EFI_ERROR (Status);
-  Status = HttpIoSetHeader (HttpIoHeader, "Accept", "application/json");
+  Status = HttpIoSetHeader (request->HttpIoHeader, "Accept", "application/json");
   ASSERT_EFI_ERROR (Status);
-  Status = HttpIoSetHeader (HttpIoHeader, "User-Agent", "libredfish");
+  Status = HttpIoSetHeader (request->HttpIoHeader, "User-Agent", "libredfish");
   ASSERT_EFI_ERROR (Status);
-  Status = HttpIoSetHeader (HttpIoHeader, "Connection", "Keep-Alive");
+  Status = HttpIoSetHeader (request->HttpIoHeader, "Connection", "Keep-Alive");
   ASSERT_EFI_ERROR (Status);
+  if (etag != NULL) {
+    //
+    // Server replies 304 without message body if the resource is not changed.
+    //
+    Status = HttpIoSetHeader (request->HttpIoHeader, HTTP_HEADER_IF_NONE_MATCH, (CHAR8 *)etag);
+    ASSERT_EFI_ERROR (Status);
+  }
+  if (RedfishContentAcceptEncoding () != NULL) {
+    //
+    // Let server compress the response, parseGetResponse() decodes it.
+    //
+    Status = HttpIoSetHeader (request->HttpIoHeader, HTTP_HEADER_ACCEPT_ENCODING, (CHAR8 *)RedfishContentAcceptEncoding ());
+    ASSERT_EFI_ERROR (Status);
+  }
 
   //
   // Step 2: build the rest of HTTP request info.
   //
-  RequestData = AllocateZeroPool (sizeof (EFI_HTTP_REQUEST_DATA));
-  if (RequestData == NULL) {
-    ret = NULL;
-    goto ON_EXIT;
+  request->RequestData = AllocateZeroPool (sizeof (EFI_HTTP_REQUEST_DATA));
+  if (request->RequestData == NULL) {
+    goto ON_ERROR;
   }
 
-  RequestData->Method = HttpMethodGet;
-  RequestData->Url = C8ToC16 (url);
+  request->RequestData->Method = HttpMethodGet;
+  request->RequestData->Url = C8ToC16 (url);
 
   //
   // Step 3: fill in EFI_HTTP_MESSAGE
   //
-  RequestMsg = AllocateZeroPool (sizeof (EFI_HTTP_MESSAGE));
-  if (RequestMsg == NULL) {
-    ret = NULL;
-    goto ON_EXIT;
-  }
+  request->RequestMsg.Data.Request = request->RequestData;
+  request->RequestMsg.HeaderCount  = request->HttpIoHeader->HeaderCount;
+  request->RequestMsg.Headers      = request->HttpIoHeader->Headers;
 
-  RequestMsg->Data.Request = RequestData;
-  RequestMsg->HeaderCount  = HttpIoHeader->HeaderCount;
-  RequestMsg->Headers      = HttpIoHeader->Headers;
+  free (url);
+  return request;
 
-  ZeroMem (&ResponseMsg, sizeof (ResponseMsg));
+ON_ERROR:
+  free (url);
+  freeGetRequest (request);
+  return NULL;
+}
 
-  //
-  // Step 4: call RESTEx to get response from REST service.
-  //
-  Status = service->RestEx->SendReceive (service->RestEx, RequestMsg, &ResponseMsg);
-  if (EFI_ERROR (Status)) {
-    ret = NULL;
-    goto ON_EXIT;
-  }
+static json_t* parseGetResponse(redfishGetRequest* request, EFI_HTTP_HEADER **Headers, UINTN *HeaderCount, EFI_HTTP_STATUS_CODE **StatusCode)
+{
+  EFI_STATUS        Status;
+  EFI_HTTP_MESSAGE  *ResponseMsg;
+  EFI_HTTP_HEADER   *ContentEncodedHeader;
+
+  ResponseMsg = &request->ResponseMsg;
 
   //
-  // Step 5: Return the HTTP StatusCode and Body message.
+  // Return the HTTP StatusCode and Body message.
   //
-  if (ResponseMsg.Data.Response != NULL) {
+  if (ResponseMsg->Data.Response != NULL) {
     *StatusCode = AllocateZeroPool (sizeof (EFI_HTTP_STATUS_CODE));
     if (*StatusCode == NULL) {
-      ret = NULL;
-      goto ON_EXIT;
+      return NULL;
     }
 
     //
     // The caller shall take the responsibility to free the buffer.
     //
-    **StatusCode = ResponseMsg.Data.Response->StatusCode;
+    **StatusCode = ResponseMsg->Data.Response->StatusCode;
   }
 
-  if (ResponseMsg.Headers != NULL) {
-    *Headers = cloneHttpHeaders (&ResponseMsg, HeaderCount);
+  if (ResponseMsg->Headers != NULL) {
+    *Headers = cloneHttpHeaders (ResponseMsg, HeaderCount);
   }
 
-  if (ResponseMsg.BodyLength != 0 && ResponseMsg.Body != NULL) {
+  if (ResponseMsg->BodyLength == 0 || ResponseMsg->Body == NULL) {
     //
-    // Check if data is encoded.
+    // There is no message body returned from server.
     //
-    ContentEncodedHeader = HttpFindHeader (ResponseMsg.HeaderCount, ResponseMsg.Headers, HTTP_HEADER_CONTENT_ENCODING);
-    if (ContentEncodedHeader != NULL) {
-      //
-      // The content is encoded.
-      //
-      Status = DecodeResponseContent (ContentEncodedHeader->FieldValue, &ResponseMsg.Body, &ResponseMsg.BodyLength);
-      if (EFI_ERROR (Status)) {
-        DEBUG ((DEBUG_ERROR, "%a: Failed to decompress the response content %r\n.", __FUNCTION__, Status));
-        ret = NULL;
-        goto ON_EXIT;
-      }
-    }
-    ret = json_loadb (ResponseMsg.Body, ResponseMsg.BodyLength, 0, NULL);
-  } else {
+    return NULL;
+  }
+
+  //
+  // Check if data is encoded.
+  //
+  ContentEncodedHeader = HttpFindHeader (ResponseMsg->HeaderCount, ResponseMsg->Headers, HTTP_HEADER_CONTENT_ENCODING);
+  if (ContentEncodedHeader != NULL) {
     //
-    // There is no message body returned from server.
+    // The content is encoded.
     //
+    Status = DecodeResponseContent (ContentEncodedHeader->FieldValue, &ResponseMsg->Body, &ResponseMsg->BodyLength);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a: Failed to decompress the response content %r\n.", __FUNCTION__, Status));
+      return NULL;
+    }
+  }
+
+  return loadResponseBody (&request->RequestMsg, ResponseMsg);
+}
+
+json_t* getUriFromServiceIfNoneMatch(redfishService* service, const char* uri, const char* etag, EFI_HTTP_HEADER **Headers, UINTN *HeaderCount, EFI_HTTP_STATUS_CODE **StatusCode)
+{
+  json_t*             ret;
+  EFI_STATUS          Status;
+  redfishGetRequest*  request;
+
+  if(service == NULL || uri == NULL || Headers == NULL || HeaderCount == NULL ||StatusCode == NULL)
+  {
+      return NULL;
+  }
+
+  *StatusCode = NULL;
+  *HeaderCount = 0;
+  *Headers = NULL;
+
+  request = createGetRequest(service, uri, etag);
+  if (request == NULL) {
+    return NULL;
+  }
+
+  //
+  // Call RESTEx to get response from REST service.
+  //
+  Status = sendReceiveRequest (service, &request->RequestMsg, &request->ResponseMsg);
+  if (EFI_ERROR (Status)) {
     ret = NULL;
+  } else {
+    ret = parseGetResponse(request, Headers, HeaderCount, StatusCode);
   }
 
-ON_EXIT:
-  if (url != NULL) {
-    free (url);
+  freeGetRequest(request);
+  return ret;
+}
+
+EFI_STATUS getUriFromServiceAsync(redfishService* service, const char* uri, void** asyncRequest)
+{
+  EFI_STATUS          Status;
+  redfishGetRequest*  request;
+  UINTN               Timeout;
+
+  if(service == NULL || uri == NULL || asyncRequest == NULL)
+  {
+      return EFI_INVALID_PARAMETER;
   }
 
-  if (HttpIoHeader != NULL) {
-    HttpIoFreeHeader (HttpIoHeader);
+  *asyncRequest = NULL;
+
+  request = createGetRequest(service, uri, NULL);
+  if (request == NULL) {
+    return EFI_OUT_OF_RESOURCES;
   }
 
-  if (RequestData != NULL) {
-    RestConfigFreeHttpRequestData (RequestData);
+  //
+  // The event is only checked, there is no notification function.
+  //
+  Status = gBS->CreateEvent (0, TPL_CALLBACK, NULL, NULL, &request->Token.Event);
+  if (EFI_ERROR (Status)) {
+    freeGetRequest(request);
+    return Status;
   }
 
-  if (RequestMsg != NULL) {
-    FreePool (RequestMsg);
+  request->Token.ResponseMessage = &request->ResponseMsg;
+  Timeout = REDFISH_HTTP_RESPONSE_TIMEOUT;
+  request->PerfStartTick = RedfishPerfStart ();
+  Status = service->RestEx->AyncSendReceive (service->RestEx, &request->RequestMsg, &request->Token, &Timeout);
+  if (EFI_ERROR (Status)) {
+    freeGetRequest(request);
+    return Status;
   }
 
-  RestConfigFreeHttpMessage (&ResponseMsg, FALSE);
+  *asyncRequest = request;
+  return EFI_SUCCESS;
+}
+
+json_t* getUriFromServiceAsyncResult(redfishService* service, void* asyncRequest, EFI_STATUS* AsyncStatus, EFI_HTTP_HEADER **Headers, UINTN *HeaderCount, EFI_HTTP_STATUS_CODE **StatusCode)
+{
+  json_t*             ret;
+  redfishGetRequest*  request;
+
+  if(service == NULL || asyncRequest == NULL || AsyncStatus == NULL || Headers == NULL || HeaderCount == NULL || StatusCode == NULL)
+  {
+      return NULL;
+  }
+
+  request = (redfishGetRequest*)asyncRequest;
+  if (EFI_ERROR (gBS->CheckEvent (request->Token.Event))) {
+    //
+    // Give REST EX driver the chance to receive the response, in case its
+    // timer can't run at the TPL of caller.
+    //
+    if (service->RestExPipeline != NULL) {
+      service->RestExPipeline->Poll (service->RestExPipeline);
+    }
+
+    if (EFI_ERROR (gBS->CheckEvent (request->Token.Event))) {
+      *AsyncStatus = EFI_NOT_READY;
+      return NULL;
+    }
+  }
+
+  *StatusCode = NULL;
+  *HeaderCount = 0;
+  *Headers = NULL;
 
+  *AsyncStatus = request->Token.Status;
+  recordHttpRequest (request->PerfStartTick, request->Token.Status, &request->RequestMsg, &request->ResponseMsg);
+  if (EFI_ERROR (request->Token.Status)) {
+    ret = NULL;
+  } else {
+    ret = parseGetResponse(request, Headers, HeaderCount, StatusCode);
+  }
+
+  freeGetRequest(request);
   return ret;
 }
 
+json_t* getUriFromServiceEx(redfishService* service, const char* uri, EFI_HTTP_HEADER **Headers, UINTN *HeaderCount, EFI_HTTP_STATUS_CODE **StatusCode)
+{
+  return getUriFromServiceIfNoneMatch (service, uri, NULL, Headers, HeaderCount, StatusCode);
+}
+
 json_t* getUriFromService(redfishService* service, const char* uri, EFI_HTTP_STATUS_CODE** StatusCode)
 {
   char* url;
@@ -532,6 +861,7 @@ json_t* getUriFromService(redfishService* service, const char* uri, EFI_HTTP_STA
   EFI_HTTP_MESSAGE                  *RequestMsg = NULL;
   EFI_HTTP_MESSAGE                  ResponseMsg;
   EFI_HTTP_HEADER                   *ContentEncodedHeader;
+  UINTN                             HeaderNumber;
 
   if(service == NULL || uri == NULL || StatusCode == NULL)
   {
@@ -549,9 +879,17 @@ json_t* getUriFromService(redfishService* service, const char* uri, EFI_HTTP_STA
   DEBUG((DEBUG_INFO, "libredfish: getUriFromService(): %a\n", url));
 
   //
-  // Step 1: Create HTTP request message with 4 headers:
+  // Step 1: Create HTTP request message with 5 headers, plus authentication
+  //         and Accept-Encoding headers when they are required:
   //
-  HttpIoHeader = HttpIoCreateHeader ((service->sessionToken || service->basicAuthStr) ? 6 : 5);
+  HeaderNumber = 5;
+  if (service->sessionToken || service->basicAuthStr) {
+    HeaderNumber++;
+  }
+  if (RedfishContentAcceptEncoding () != NULL) {
+    HeaderNumber++;
+  }
+  HttpIoHeader = HttpIoCreateHeader (HeaderNumber);
   if (HttpIoHeader == NULL) {
     ret = NULL;
     goto ON_EXIT;
@@ -576,6 +914,10 @@ json_t* getUriFromService(redfishService* service, const char* uri, EFI_HTTP_STA
   ASSERT_EFI_ERROR (Status);
   Status = HttpIoSetHeader (HttpIoHeader, "Connection", "Keep-Alive");
   ASSERT_EFI_ERROR (Status);
+  if (RedfishContentAcceptEncoding () != NULL) {
+    Status = HttpIoSetHeader (HttpIoHeader, HTTP_HEADER_ACCEPT_ENCODING, (CHAR8 *)RedfishContentAcceptEncoding ());
+    ASSERT_EFI_ERROR (Status);
+  }
 
   //
   // Step 2: build the rest of HTTP request info.
@@ -607,7 +949,7 @@ json_t* getUriFromService(redfishService* service, const char* uri, EFI_HTTP_STA
   //
   // Step 4: call RESTEx to get response from REST service.
   //
-  Status = service->RestEx->SendReceive (service->RestEx, RequestMsg, &ResponseMsg);
+  Status = sendReceiveRequest (service, RequestMsg, &ResponseMsg);
   if (EFI_ERROR (Status)) {
     ret = NULL;
     goto ON_EXIT;
@@ -645,7 +987,7 @@ json_t* getUriFromService(redfishService* service, const char* uri, EFI_HTTP_STA
         goto ON_EXIT;
       }
     }
-    ret = json_loadb (ResponseMsg.Body, ResponseMsg.BodyLength, 0, NULL);
+    ret = loadResponseBody (RequestMsg, &ResponseMsg);
   } else {
     //
     // There is no message body returned from server.
@@ -684,7 +1026,6 @@ json_t* patchUriFromServiceEx(redfishService* service, const char* uri, const ch
   EFI_HTTP_REQUEST_DATA             *RequestData = NULL;
   EFI_HTTP_MESSAGE                  *RequestMsg = NULL;
   EFI_HTTP_MESSAGE                  ResponseMsg;
-  CHAR8                             ContentLengthStr[80];
   CHAR8                             *EncodedContent;
   UINTN                             EncodedContentLen;
 
@@ -693,6 +1034,8 @@ json_t* patchUriFromServiceEx(redfishService* service, const char* uri, const ch
       return NULL;
   }
 
+  EncodedContent = (CHAR8 *)content;
+
   *StatusCode = NULL;
 
   url = makeUrlForService(service, uri);
@@ -732,14 +1075,6 @@ json_t* patchUriFromServiceEx(redfishService* service, const char* uri, const ch
   Status = HttpIoSetHeader (HttpIoHeader, "Connection", "Keep-Alive");
   ASSERT_EFI_ERROR (Status);
 
-  AsciiSPrint(
-    ContentLengthStr,
-    sizeof (ContentLengthStr),
-    "%lu",
-    (UINT64) strlen(content)
-    );
-  Status = HttpIoSetHeader (HttpIoHeader, "Content-Length", ContentLengthStr);
-  ASSERT_EFI_ERROR (Status);
   Status = HttpIoSetHeader (HttpIoHeader, "OData-Version", "4.0");
   ASSERT_EFI_ERROR (Status);
 
@@ -764,23 +1099,10 @@ json_t* patchUriFromServiceEx(redfishService* service, const char* uri, const ch
     goto ON_EXIT;
   }
 
-  EncodedContent = (CHAR8 *)content;
-  EncodedContentLen = strlen(content);
-  //
-  // We currently only support gzip Content-Encoding.
-  //
-  Status = EncodeRequestContent ((CHAR8 *)HTTP_CONTENT_ENCODING_GZIP, (CHAR8 *)content, (VOID **)&EncodedContent, &EncodedContentLen);
-  if (Status == EFI_INVALID_PARAMETER) {
-    DEBUG((DEBUG_ERROR, "%a: Error to encode content.\n", __FUNCTION__));
+  Status = setPatchRequestBody (HttpIoHeader, content, &EncodedContent, &EncodedContentLen);
+  if (EFI_ERROR (Status)) {
     ret = NULL;
     goto ON_EXIT;
-  } else if (Status == EFI_UNSUPPORTED) {
-    DEBUG((DEBUG_INFO, "No content coding for %a! Use raw data instead.\n", HTTP_CONTENT_ENCODING_GZIP));
-    Status = HttpIoSetHeader (HttpIoHeader, "Content-Encoding", HTTP_CONTENT_ENCODING_IDENTITY);
-    ASSERT_EFI_ERROR (Status);
-  } else {
-    Status = HttpIoSetHeader (HttpIoHeader, "Content-Encoding", HTTP_CONTENT_ENCODING_GZIP);
-    ASSERT_EFI_ERROR (Status);
   }
 
   RequestMsg->Data.Request = RequestData;
@@ -794,7 +1116,7 @@ json_t* patchUriFromServiceEx(redfishService* service, const char* uri, const ch
   //
   // Step 4: call RESTEx to get response from REST service.
   //
-  Status = service->RestEx->SendReceive (service->RestEx, RequestMsg, &ResponseMsg);
+  Status = sendReceiveRequest (service, RequestMsg, &ResponseMsg);
   if (EFI_ERROR (Status)) {
     ret = NULL;
     goto ON_EXIT;
@@ -820,13 +1142,9 @@ json_t* patchUriFromServiceEx(redfishService* service, const char* uri, const ch
     *Headers = cloneHttpHeaders (&ResponseMsg, HeaderCount);
   }
 
-  if (EncodedContent != content) {
-    FreePool (EncodedContent);
-  }
-
 
   if (ResponseMsg.BodyLength != 0 && ResponseMsg.Body != NULL) {
-    ret = json_loadb (ResponseMsg.Body, ResponseMsg.BodyLength, 0, NULL);
+    ret = loadResponseBody (RequestMsg, &ResponseMsg);
   } else {
     //
     // There is no message body returned from server.
@@ -851,6 +1169,10 @@ ON_EXIT:
     FreePool (RequestMsg);
   }
 
+  if (EncodedContent != content) {
+    FreePool (EncodedContent);
+  }
+
   RestConfigFreeHttpMessage (&ResponseMsg, FALSE);
 
   return ret;
@@ -865,7 +1187,6 @@ json_t* patchUriFromService(redfishService* service, const char* uri, const char
   EFI_HTTP_REQUEST_DATA             *RequestData = NULL;
   EFI_HTTP_MESSAGE                  *RequestMsg = NULL;
   EFI_HTTP_MESSAGE                  ResponseMsg;
-  CHAR8                             ContentLengthStr[80];
   CHAR8                             *EncodedContent;
   UINTN                             EncodedContentLen;
 
@@ -874,6 +1195,8 @@ json_t* patchUriFromService(redfishService* service, const char* uri, const char
       return NULL;
   }
 
+  EncodedContent = (CHAR8 *)content;
+
   *StatusCode = NULL;
 
   url = makeUrlForService(service, uri);
@@ -913,14 +1236,6 @@ json_t* patchUriFromService(redfishService* service, const char* uri, const char
   Status = HttpIoSetHeader (HttpIoHeader, "Connection", "Keep-Alive");
   ASSERT_EFI_ERROR (Status);
 
-  AsciiSPrint(
-    ContentLengthStr,
-    sizeof (ContentLengthStr),
-    "%lu",
-    (UINT64) strlen(content)
-    );
-  Status = HttpIoSetHeader (HttpIoHeader, "Content-Length", ContentLengthStr);
-  ASSERT_EFI_ERROR (Status);
   Status = HttpIoSetHeader (HttpIoHeader, "OData-Version", "4.0");
   ASSERT_EFI_ERROR (Status);
 
@@ -945,23 +1260,10 @@ json_t* patchUriFromService(redfishService* service, const char* uri, const char
     goto ON_EXIT;
   }
 
-  EncodedContent = (CHAR8 *)content;
-  EncodedContentLen = strlen(content);
-  //
-  // We currently only support gzip Content-Encoding.
-  //
-  Status = EncodeRequestContent ((CHAR8 *)HTTP_CONTENT_ENCODING_GZIP, (CHAR8 *)content, (VOID **)&EncodedContent, &EncodedContentLen);
-  if (Status == EFI_INVALID_PARAMETER) {
-    DEBUG((DEBUG_ERROR, "%a: Error to encode content.\n", __FUNCTION__));
+  Status = setPatchRequestBody (HttpIoHeader, content, &EncodedContent, &EncodedContentLen);
+  if (EFI_ERROR (Status)) {
     ret = NULL;
     goto ON_EXIT;
-  } else if (Status == EFI_UNSUPPORTED) {
-    DEBUG((DEBUG_INFO, "No content coding for %a! Use raw data instead.\n", HTTP_CONTENT_ENCODING_GZIP));
-    Status = HttpIoSetHeader (HttpIoHeader, "Content-Encoding", HTTP_CONTENT_ENCODING_IDENTITY);
-    ASSERT_EFI_ERROR (Status);
-  } else {
-    Status = HttpIoSetHeader (HttpIoHeader, "Content-Encoding", HTTP_CONTENT_ENCODING_GZIP);
-    ASSERT_EFI_ERROR (Status);
   }
 
   RequestMsg->Data.Request = RequestData;
@@ -975,7 +1277,7 @@ json_t* patchUriFromService(redfishService* service, const char* uri, const char
   //
   // Step 4: call RESTEx to get response from REST service.
   //
-  Status = service->RestEx->SendReceive (service->RestEx, RequestMsg, &ResponseMsg);
+  Status = sendReceiveRequest (service, RequestMsg, &ResponseMsg);
   if (EFI_ERROR (Status)) {
     ret = NULL;
     goto ON_EXIT;
@@ -997,13 +1299,9 @@ json_t* patchUriFromService(redfishService* service, const char* uri, const char
     **StatusCode = ResponseMsg.Data.Response->StatusCode;
   }
 
-  if (EncodedContent != content) {
-    FreePool (EncodedContent);
-  }
-
 
   if (ResponseMsg.BodyLength != 0 && ResponseMsg.Body != NULL) {
-    ret = json_loadb (ResponseMsg.Body, ResponseMsg.BodyLength, 0, NULL);
+    ret = loadResponseBody (RequestMsg, &ResponseMsg);
   } else {
     //
     // There is no message body returned from server.
@@ -1028,6 +1326,10 @@ ON_EXIT:
     FreePool (RequestMsg);
   }
 
+  if (EncodedContent != content) {
+    FreePool (EncodedContent);
+  }
+
   RestConfigFreeHttpMessage (&ResponseMsg, FALSE);
 
   return ret;
@@ -1140,7 +1442,7 @@ json_t* postUriFromServiceEx(redfishService* service, const char* uri, const cha
   //
   // Step 4: call RESTEx to get response from REST service.
   //
-  Status = service->RestEx->SendReceive (service->RestEx, RequestMsg, &ResponseMsg);
+  Status = sendReceiveRequest (service, RequestMsg, &ResponseMsg);
   if (EFI_ERROR (Status)) {
     goto ON_EXIT;
   }
@@ -1165,7 +1467,7 @@ json_t* postUriFromServiceEx(redfishService* service, const char* uri, const cha
   }
 
   if (ResponseMsg.BodyLength != 0 && ResponseMsg.Body != NULL) {
-    ret = json_loadb (ResponseMsg.Body, ResponseMsg.BodyLength, 0, NULL);
+    ret = loadResponseBody (RequestMsg, &ResponseMsg);
   }
 
   //
@@ -1325,7 +1627,7 @@ json_t* postUriFromService(redfishService* service, const char* uri, const char*
   //
   // Step 4: call RESTEx to get response from REST service.
   //
-  Status = service->RestEx->SendReceive (service->RestEx, RequestMsg, &ResponseMsg);
+  Status = sendReceiveRequest (service, RequestMsg, &ResponseMsg);
   if (EFI_ERROR (Status)) {
     goto ON_EXIT;
   }
@@ -1346,7 +1648,7 @@ json_t* postUriFromService(redfishService* service, const char* uri, const char*
   }
 
   if (ResponseMsg.BodyLength != 0 && ResponseMsg.Body != NULL) {
-    ret = json_loadb (ResponseMsg.Body, ResponseMsg.BodyLength, 0, NULL);
+    ret = loadResponseBody (RequestMsg, &ResponseMsg);
   }
 
   //
@@ -1482,7 +1784,7 @@ json_t* deleteUriFromService(redfishService* service, const char* uri, EFI_HTTP_
   //
   // Step 4: call RESTEx to get response from REST service.
   //
-  Status = service->RestEx->SendReceive (service->RestEx, RequestMsg, &ResponseMsg);
+  Status = sendReceiveRequest (service, RequestMsg, &ResponseMsg);
   if (EFI_ERROR (Status)) {
     ret = NULL;
     goto ON_EXIT;
@@ -1505,7 +1807,7 @@ json_t* deleteUriFromService(redfishService* service, const char* uri, EFI_HTTP_
   }
 
   if (ResponseMsg.BodyLength != 0 && ResponseMsg.Body != NULL) {
-    ret = json_loadb (ResponseMsg.Body, ResponseMsg.BodyLength, 0, NULL);
+    ret = loadResponseBody (RequestMsg, &ResponseMsg);
   }
 
 ON_EXIT:
@@ -1788,6 +2090,36 @@ static redfishService* createServiceEnumeratorBasicAuth(const char* host, const
     return ret;
 }
 
+//
+// Create the service with the X-Auth-Token of a Redfish session which is
+// already logged in, e.g. by another driver. No session login is done here.
+//
+static redfishService* createServiceEnumeratorToken(const char* host, const char* rootUri, const char* token, unsigned int flags, void * restProtocol)
+{
+    redfishService* ret;
+
+    if(token == NULL)
+    {
+        return NULL;
+    }
+
+    ret = createServiceEnumeratorNoAuth(host, rootUri, false, flags, restProtocol);
+    if(ret == NULL)
+    {
+        return NULL;
+    }
+
+    ret->sessionToken = AllocateCopyPool (AsciiStrSize (token), token);
+    if(ret->sessionToken == NULL)
+    {
+        cleanupServiceEnumerator(ret);
+        return NULL;
+    }
+
+    ret->versions = getVersions(ret, rootUri);
+    return ret;
+}
+
 static redfishService* createServiceEnumeratorSessionAuth(const char* host, const char* rootUri, const char* username, const char* password, unsigned int flags, void * restProtocol)
 {
     redfishService* ret;
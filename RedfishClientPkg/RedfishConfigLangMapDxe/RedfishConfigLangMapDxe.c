@@ -12,433 +12,20 @@
 REDFISH_CONFIG_LANG_MAP_PRIVATE_DATA  *mRedfishConfigLangMapPrivate = NULL;
 
 /**
-  Release REDFISH_CONFIG_LANG_MAP_RECORD resource
+  Move the config lang map in the text variable of earlier driver version
+  to keyed store, and delete the text variable once the records are saved.
 
-  @param[in]    Record    Pointer to REDFISH_CONFIG_LANG_MAP_RECORD instance
-
-  @retval EFI_SUCCESS             REDFISH_CONFIG_LANG_MAP_RECORD is released successfully.
-  @retval EFI_INVALID_PARAMETER   Record is NULL
-
-**/
-EFI_STATUS
-ReleaseConfigLangMapRecord (
-  IN REDFISH_CONFIG_LANG_MAP_RECORD *Record
-  )
-{
-  if (Record == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  if (Record->Uri != NULL) {
-    FreePool (Record->Uri);
-  }
-
-  if (Record->ConfigLang != NULL) {
-    FreePool (Record->ConfigLang);
-  }
-
-  FreePool (Record);
-
-  return EFI_SUCCESS;
-}
-
-/**
-  Create new resource map resource.
-
-  @param[in]    Uri         The URI string matching to this ConfigLang.
-  @param[in]    ConfigLang  ConfigLang string.
-
-  @retval REDFISH_CONFIG_LANG_MAP_RECORD *  Pointer to newly created config language map.
-  @retval NULL                              No memory available.
-
-**/
-REDFISH_CONFIG_LANG_MAP_RECORD *
-NewConfigLangMapRecord (
-  IN  EFI_STRING  Uri,
-  IN  EFI_STRING  ConfigLang
-  )
-{
-  REDFISH_CONFIG_LANG_MAP_RECORD *NewRecord;
-  UINTN                          Size;
-
-  if (IS_EMPTY_STRING (Uri) || IS_EMPTY_STRING (ConfigLang)) {
-    return NULL;
-  }
-
-  NewRecord = AllocateZeroPool (sizeof (REDFISH_CONFIG_LANG_MAP_RECORD));
-  if (NewRecord == NULL) {
-    return NULL;
-  }
-
-  Size = StrSize (Uri);
-  NewRecord->Uri = AllocateCopyPool (Size, Uri);
-  if (NewRecord->Uri == NULL) {
-    goto ON_ERROR;
-  }
-
-  NewRecord->Size = Size;
-  Size = StrSize (ConfigLang);
-  NewRecord->ConfigLang = AllocateCopyPool (Size, ConfigLang);
-  if (NewRecord->ConfigLang == NULL) {
-    goto ON_ERROR;
-  }
-
-  NewRecord->Size += Size;
-  return NewRecord;
-
-ON_ERROR:
-
-  if (NewRecord != NULL) {
-    ReleaseConfigLangMapRecord (NewRecord);
-  }
-
-  return NULL;
-}
-
-/**
-  Add new config language map by given URI and ConfigLang string to specify List.
-
-  @param[in]    List        Target config language map list to add.
-  @param[in]    Uri         The URI string matching to this ConfigLang.
-  @param[in]    ConfigLang  ConfigLang string.
-
-  @retval EFI_SUCCESS   config language map recourd is added.
-  @retval Others        Fail to add config language map.
-
-**/
-EFI_STATUS
-AddConfigLangMapRecord (
-  IN  REDFISH_CONFIG_LANG_MAP_LIST *List,
-  IN  EFI_STRING                   Uri,
-  IN  EFI_STRING                   ConfigLang
-  )
-{
-  REDFISH_CONFIG_LANG_MAP_RECORD *NewRecord;
-
-  if (List == NULL || IS_EMPTY_STRING (Uri) || IS_EMPTY_STRING (ConfigLang)) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  NewRecord = NewConfigLangMapRecord (Uri, ConfigLang);
-  if (NewConfigLangMapRecord == NULL) {
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  InsertTailList (&List->Listheader, &NewRecord->List);
-  ++List->Count;
-  List->TotalSize += NewRecord->Size;
-
-  return EFI_SUCCESS;
-}
-
-/**
-  Delete an config language map by given config language map instance.
-
-  @param[in]    List    Target config language map list to be removed.
-  @param[in]    Record  Pointer to the instance to be deleted.
-
-  @retval EFI_SUCCESS   config language map recourd is removed.
-  @retval Others        Fail to add config language map.
-
-**/
-EFI_STATUS
-DeleteConfigLangMapRecord (
-  IN  REDFISH_CONFIG_LANG_MAP_LIST   *List,
-  IN  REDFISH_CONFIG_LANG_MAP_RECORD *Record
-  )
-{
-  if (List == NULL || Record == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  RemoveEntryList (&Record->List);
-  --List->Count;
-  List->TotalSize -= Record->Size;
-
-  return ReleaseConfigLangMapRecord (Record);
-}
-
-/**
-  Search on given ListHeader for given ConfigLang string.
-
-  @param[in]    ListHeader  Target list to search.
-  @param[in]    Query       Target string to search.
-  @param[in]    QueryIsUri  Query string is URI string or not
-
-  @retval REDFISH_CONFIG_LANG_MAP_RECORD  Target in map is found.
-  @retval NULL                            No target in map with given query is found.
-
-**/
-REDFISH_CONFIG_LANG_MAP_RECORD *
-FindConfigLangMapRecord (
-  IN  LIST_ENTRY  *ListHeader,
-  IN  EFI_STRING  Query,
-  IN  BOOLEAN     QueryIsUri
-  )
-{
-  LIST_ENTRY                      *List;
-  REDFISH_CONFIG_LANG_MAP_RECORD  *Record;
-
-  if (IsListEmpty (ListHeader)) {
-    return NULL;
-  }
-
-  if (IS_EMPTY_STRING (Query)) {
-    return NULL;
-  }
-
-  Record = NULL;
-  List = GetFirstNode (ListHeader);
-  while (!IsNull (ListHeader, List)) {
-    Record = REDFISH_CONFIG_LANG_MAP_RECORD_FROM_LIST (List);
-
-    if (QueryIsUri) {
-      if (StrCmp (Record->Uri, Query) == 0) {
-        return  Record;
-      }
-    } else {
-      if (StrCmp (Record->ConfigLang, Query) == 0) {
-        return  Record;
-      }
-    }
-
-    List = GetNextNode (ListHeader, List);
-  }
-
-  return NULL;
-}
-
-#if CONFIG_LANG_MAP_DEBUG_ENABLED
-/**
-  Debug output the config language map list.
-
-  @param[in]    ConfigLangMapList  Target list to dump
-  @param[in]    Msg       Debug message string.
-
-  @retval EFI_SUCCESS             Debug dump finished.
-  @retval EFI_INVALID_PARAMETER   ConfigLangMapList is NULL.
-
-**/
-EFI_STATUS
-DumpConfigLangMapList (
-  IN  REDFISH_CONFIG_LANG_MAP_LIST  *ConfigLangMapList,
-  IN  EFI_STRING                    Msg
-  )
-{
-  LIST_ENTRY          *List;
-  REDFISH_CONFIG_LANG_MAP_RECORD *Record;
-
-  if (ConfigLangMapList == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  if (!IS_EMPTY_STRING (Msg)) {
-    DEBUG ((DEBUG_ERROR, "%s\n", Msg));
-  }
-
-  if (IsListEmpty (&ConfigLangMapList->Listheader)) {
-    DEBUG ((DEBUG_INFO, "ConfigLangMap list is empty\n"));
-    return EFI_NOT_FOUND;
-  }
-
-  DEBUG ((DEBUG_INFO, "Count: %d Total Size: %d\n", ConfigLangMapList->Count, ConfigLangMapList->TotalSize));
-  Record = NULL;
-  List = GetFirstNode (&ConfigLangMapList->Listheader);
-  while (!IsNull (&ConfigLangMapList->Listheader, List)) {
-    Record = REDFISH_CONFIG_LANG_MAP_RECORD_FROM_LIST (List);
-
-    DEBUG ((DEBUG_INFO, "ConfigLang: %s Uri: %s Size: %d\n", Record->ConfigLang, Record->Uri, Record->Size));
-
-    List = GetNextNode (&ConfigLangMapList->Listheader, List);
-  }
-
-  return EFI_SUCCESS;
-}
-
-/**
-  Debug output raw data buffer.
-
-  @param[in]    Buffer      Debug output data buffer.
-  @param[in]    BufferSize  The size of Buffer in byte.
-
-  @retval EFI_SUCCESS             Debug dump finished.
-  @retval EFI_INVALID_PARAMETER   Buffer is NULL.
-
-**/
-EFI_STATUS
-DumpRawBuffer (
-  IN  UINT8    *Buffer,
-  IN  UINTN     BufferSize
-  )
-{
-  UINTN  Index;
-  CHAR16 *Seeker;
-
-  if (Buffer == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  Index = 0;
-  Seeker = (CHAR16 *)Buffer;
-  DEBUG ((DEBUG_ERROR, "Buffer size: %d\n", BufferSize));
-  while (Seeker[Index] != '\0') {
-    DEBUG ((DEBUG_ERROR, "(%d) %c ", (Index + 1), Seeker[Index]));
-
-    ++Index;
-  }
-  DEBUG ((DEBUG_ERROR, "\n"));
-
-  return EFI_SUCCESS;
-}
-#endif
-
-/**
-  Release all ConfigLangMap from list.
-
-  @param[in]    ConfigLangMapList    The list to be released.
-
-  @retval EFI_SUCCESS             All config lang is released.
-  @retval EFI_INVALID_PARAMETER   ConfigLangMapList is NULL.
-
-**/
-EFI_STATUS
-ReleaseConfigLangMapList (
-  IN  REDFISH_CONFIG_LANG_MAP_LIST   *ConfigLangMapList
-  )
-{
-  LIST_ENTRY          *List;
-  LIST_ENTRY          *Next;
-  REDFISH_CONFIG_LANG_MAP_RECORD *Record;
-
-  if (ConfigLangMapList == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  if (IsListEmpty (&ConfigLangMapList->Listheader)) {
-    return EFI_SUCCESS;
-  }
-
-  Record = NULL;
-  Next = NULL;
-  List = GetFirstNode (&ConfigLangMapList->Listheader);
-  while (!IsNull (&ConfigLangMapList->Listheader, List)) {
-    Record = REDFISH_CONFIG_LANG_MAP_RECORD_FROM_LIST (List);
-    Next = GetNextNode (&ConfigLangMapList->Listheader, List);
-
-    DeleteConfigLangMapRecord (ConfigLangMapList, Record);
-
-    List = Next;
-  }
-
-  return EFI_SUCCESS;
-}
-
-/**
-  Save config lang in list to UEFI variable.
-
-  @param[in]    ConfigLangMapList The list to be saved.
+  @param[in]    ConfigLangStore   The keyed store to add records.
   @param[in]    VariableName      The UEFI variable name.
 
-  @retval EFI_SUCCESS             All config lang is saved.
-  @retval EFI_INVALID_PARAMETER   VariableName or ConfigLangMapList is NULL.
-
-**/
-EFI_STATUS
-SaveConfigLangMapList (
-  IN  REDFISH_CONFIG_LANG_MAP_LIST  *ConfigLangMapList,
-  IN  EFI_STRING                    VariableName
-  )
-{
-  LIST_ENTRY                      *List;
-  REDFISH_CONFIG_LANG_MAP_RECORD  *Record;
-  UINT8                           *VarData;
-  VOID                            *Data;
-  EFI_STRING                      Seeker;
-  UINTN                           VarSize;
-  UINTN                           StringSize;
-  EFI_STATUS                      Status;
-
-  if (ConfigLangMapList == NULL || IS_EMPTY_STRING (VariableName)) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  if (IsListEmpty (&ConfigLangMapList->Listheader)) {
-    return EFI_SUCCESS;
-  }
-
-  //
-  // Caculate the total size we need to keep ConfigLangMap list.
-  //
-  VarSize = ConfigLangMapList->TotalSize + sizeof (CHAR16); // terminator character
-  VarData = AllocateZeroPool (VarSize);
-  if (VarData == NULL) {
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  Seeker = (EFI_STRING)VarData;
-  Record = NULL;
-  List = GetFirstNode (&ConfigLangMapList->Listheader);
-  while (!IsNull (&ConfigLangMapList->Listheader, List)) {
-    Record = REDFISH_CONFIG_LANG_MAP_RECORD_FROM_LIST (List);
-
-    StringSize = StrSize (Record->Uri);
-    CopyMem (Seeker, Record->Uri, StringSize);
-
-    Seeker += (StringSize / sizeof (CHAR16) - 1);
-    *Seeker = '|';
-    ++Seeker;
-
-    StringSize = StrSize (Record->ConfigLang);
-    CopyMem (Seeker, Record->ConfigLang, StringSize);
-
-    Seeker += (StringSize / sizeof (CHAR16) - 1);
-    *Seeker = '\n';
-
-    ++Seeker;
-
-    List = GetNextNode (&ConfigLangMapList->Listheader, List);;
-  }
-
-  *Seeker = '\0';
-
-#if CONFIG_LANG_MAP_DEBUG_ENABLED
-  DumpRawBuffer (VarData, VarSize);
-#endif
-
-  ASSERT (((UINTN)Seeker - (UINTN)VarData + sizeof (CHAR16)) == VarSize);
-
-  //
-  // Check if variable exists already. If yes, remove it first.
-  //
-  Status = GetVariable2 (
-             VariableName,
-             &gEfiRedfishClientVariableGuid,
-             (VOID *)&Data,
-             NULL
-             );
-  if (!EFI_ERROR (Status)) {
-    FreePool (Data);
-    gRT->SetVariable (VariableName, &gEfiRedfishClientVariableGuid, VARIABLE_ATTRIBUTE_NV_BS, 0, NULL);
-  }
-
-
-  return gRT->SetVariable (VariableName, &gEfiRedfishClientVariableGuid, VARIABLE_ATTRIBUTE_NV_BS, VarSize, (VOID *)VarData);
-}
-
-/**
-  Read config lang map from UEFI variable if it exists.
-
-  @param[in]    ConfigLangMapList The list to be loaded.
-  @param[in]    VariableName      The UEFI variable name.
-
-  @retval EFI_SUCCESS             All config lang is read successfully.
-  @retval EFI_INVALID_PARAMETER   VariableName or ConfigLangMapList is NULL.
+  @retval EFI_SUCCESS             All config lang is moved successfully.
+  @retval EFI_INVALID_PARAMETER   VariableName or ConfigLangStore is NULL.
   @retval EFI_NOT_FOUND           No config lang is found on UEFI variable.
 
 **/
 EFI_STATUS
-InitialConfigLangMapList (
-  IN  REDFISH_CONFIG_LANG_MAP_LIST  *ConfigLangMapList,
+MigrateConfigLangMapList (
+  IN  REDFISH_KEYED_STORE           *ConfigLangStore,
   IN  EFI_STRING                    VariableName
   )
 {
@@ -449,7 +36,7 @@ InitialConfigLangMapList (
   UINTN      VariableSize;
   EFI_STATUS Status;
 
-  if (ConfigLangMapList == NULL || IS_EMPTY_STRING (VariableName)) {
+  if (ConfigLangStore == NULL || IS_EMPTY_STRING (VariableName)) {
     return EFI_INVALID_PARAMETER;
   }
 
@@ -496,21 +83,26 @@ InitialConfigLangMapList (
 
     *Seeker = '\0';
 
-    AddConfigLangMapRecord (ConfigLangMapList, UriPointer, ConfigLangPointer);
+    if (!IS_EMPTY_STRING (UriPointer) && !IS_EMPTY_STRING (ConfigLangPointer)) {
+      RedfishKeyedStoreSet (ConfigLangStore, ConfigLangPointer, StrSize (ConfigLangPointer), UriPointer, StrSize (UriPointer));
+    }
 
     UriPointer = ++Seeker;
   }
 
-#if CONFIG_LANG_MAP_DEBUG_ENABLED
-  DumpConfigLangMapList (ConfigLangMapList, L"Initial ConfigLangMap List from Variable");
-#endif
-
-  Status = EFI_SUCCESS;
+  Status = RedfishKeyedStoreFlush (ConfigLangStore);
 
 ON_ERROR:
 
   FreePool (VarData);
 
+  //
+  // Corrupted data is dropped as well.
+  //
+  if (!EFI_ERROR (Status) || (Status == EFI_DEVICE_ERROR)) {
+    gRT->SetVariable (VariableName, &gEfiRedfishClientVariableGuid, VARIABLE_ATTRIBUTE_NV_BS, 0, NULL);
+  }
+
   return Status;
 }
 
@@ -534,9 +126,10 @@ RedfishConfigLangMapGet (
   OUT EFI_STRING                              *ResultString
   )
 {
-  REDFISH_CONFIG_LANG_MAP_RECORD       *Target;
   REDFISH_CONFIG_LANG_MAP_PRIVATE_DATA *Private;
-  EFI_STRING                           Result;
+  CONST VOID                           *Result;
+  UINTN                                ResultSize;
+  EFI_STATUS                           Status;
 
   if (This == NULL || IS_EMPTY_STRING (QueryString) || ResultString == NULL || QueryStringType >= RedfishGetTypeMax) {
     return EFI_INVALID_PARAMETER;
@@ -546,16 +139,17 @@ RedfishConfigLangMapGet (
 
   *ResultString = NULL;
 
-  Target = FindConfigLangMapRecord (&Private->ConfigLangList.Listheader, QueryString, (QueryStringType == RedfishGetTypeUri));
-  if (Target == NULL) {
-#if CONFIG_LANG_MAP_DEBUG_ENABLED
-    DumpConfigLangMapList (&Private->ConfigLangList, L"EFI_NOT_FOUND");
-#endif
-    return EFI_NOT_FOUND;
+  if (QueryStringType == RedfishGetTypeUri) {
+    Status = RedfishKeyedStoreGetByValue (Private->ConfigLangStore, QueryString, StrSize (QueryString), &Result, &ResultSize);
+  } else {
+    Status = RedfishKeyedStoreGet (Private->ConfigLangStore, QueryString, StrSize (QueryString), &Result, &ResultSize);
   }
 
-  Result = (QueryStringType == RedfishGetTypeUri ? Target->ConfigLang : Target->Uri);
-  *ResultString = AllocateCopyPool (StrSize (Result), Result);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  *ResultString = AllocateCopyPool (ResultSize, Result);
   if (*ResultString == NULL) {
     return EFI_OUT_OF_RESOURCES;
   }
@@ -583,9 +177,7 @@ RedfishConfigLangMapSet (
   IN  EFI_STRING                              Uri        OPTIONAL
   )
 {
-  REDFISH_CONFIG_LANG_MAP_RECORD       *Target;
   REDFISH_CONFIG_LANG_MAP_PRIVATE_DATA *Private;
-  EFI_STATUS                        Status;
 
   if (This == NULL || IS_EMPTY_STRING (ConfigLang)) {
     return EFI_INVALID_PARAMETER;
@@ -593,23 +185,21 @@ RedfishConfigLangMapSet (
 
   Private = REDFISH_CONFIG_LANG_MAP_PRIVATE_FROM_THIS (This);
 
-  Status = EFI_NOT_FOUND;
-  Target = FindConfigLangMapRecord (&Private->ConfigLangList.Listheader, ConfigLang, FALSE);
-  if (Target != NULL) {
-    //
-    // Remove old one and create new one.
-    //
-    Status = DeleteConfigLangMapRecord (&Private->ConfigLangList, Target);
-  }
-
   //
   // When Uri is NULL, it means that we want to remov this record.
   //
   if (Uri == NULL) {
-    return Status;
+    return RedfishKeyedStoreSet (Private->ConfigLangStore, ConfigLang, StrSize (ConfigLang), NULL, 0);
   }
 
-  return AddConfigLangMapRecord (&Private->ConfigLangList, Uri, ConfigLang);
+  if (IS_EMPTY_STRING (Uri)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // The record is written to variable on flush only if the URI is changed.
+  //
+  return RedfishKeyedStoreSet (Private->ConfigLangStore, ConfigLang, StrSize (ConfigLang), Uri, StrSize (Uri));
 }
 
 /**
@@ -635,9 +225,9 @@ RedfishConfigLangMapFlush (
 
   Private = REDFISH_CONFIG_LANG_MAP_PRIVATE_FROM_THIS (This);
 
-  Status = SaveConfigLangMapList (&Private->ConfigLangList, Private->VariableName);
+  Status = RedfishKeyedStoreFlush (Private->ConfigLangStore);
   if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a, save ConfigLangMap list to variable: %s failed: %r\n", __FUNCTION__, Private->VariableName, Status));
+    DEBUG ((DEBUG_ERROR, "%a, save ConfigLangMap list to variable: %s failed: %r\n", __FUNCTION__, CONFIG_LANG_MAP_STORE_VARIABLE_NAME, Status));
   }
 
   return Status;
@@ -692,10 +282,8 @@ RedfishConfigLangMapDriverUnload (
       ASSERT (FALSE);
     }
 
-    ReleaseConfigLangMapList (&mRedfishConfigLangMapPrivate->ConfigLangList);
-
-    if (mRedfishConfigLangMapPrivate->VariableName != NULL) {
-      FreePool (mRedfishConfigLangMapPrivate->VariableName);
+    if (mRedfishConfigLangMapPrivate->ConfigLangStore != NULL) {
+      RedfishKeyedStoreClose (mRedfishConfigLangMapPrivate->ConfigLangStore);
     }
 
     if (mRedfishConfigLangMapPrivate->ExitBootEvent != NULL) {
@@ -747,9 +335,12 @@ RedfishConfigLangMapDriverEntryPoint (
     return EFI_OUT_OF_RESOURCES;
   }
 
-  InitializeListHead (&mRedfishConfigLangMapPrivate->ConfigLangList.Listheader);
-  mRedfishConfigLangMapPrivate->VariableName = AllocateCopyPool (StrSize (CONFIG_LANG_MAP_VARIABLE_NAME), CONFIG_LANG_MAP_VARIABLE_NAME);
-  if (mRedfishConfigLangMapPrivate->VariableName == NULL) {
+  //
+  // Read existing record from variable.
+  //
+  Status = RedfishKeyedStoreOpen (CONFIG_LANG_MAP_STORE_VARIABLE_NAME, &mRedfishConfigLangMapPrivate->ConfigLangStore);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, can not open ConfigLangMap store: %r\n", __FUNCTION__, Status));
     goto ON_ERROR;
   }
 
@@ -785,11 +376,11 @@ RedfishConfigLangMapDriverEntryPoint (
   }
 
   //
-  // Read existing record from variable.
+  // Move the records kept by earlier version of this driver.
   //
-  Status = InitialConfigLangMapList (&mRedfishConfigLangMapPrivate->ConfigLangList, mRedfishConfigLangMapPrivate->VariableName);
+  Status = MigrateConfigLangMapList (mRedfishConfigLangMapPrivate->ConfigLangStore, CONFIG_LANG_MAP_VARIABLE_NAME);
   if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_INFO, "%a, Initial ConfigLangMap List: %r\n", __FUNCTION__, Status));
+    DEBUG ((DEBUG_INFO, "%a, Migrate ConfigLangMap List: %r\n", __FUNCTION__, Status));
   }
 
   //
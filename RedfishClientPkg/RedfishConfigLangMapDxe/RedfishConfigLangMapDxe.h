@@ -21,6 +21,7 @@
 #include <Library/DebugLib.h>
 
 #include <Library/MemoryAllocationLib.h>
+#include <Library/RedfishKeyedStoreLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiDriverEntryPoint.h>
 #include <Library/UefiLib.h>
@@ -30,38 +31,21 @@
 
 #include <Guid/VariableFormat.h>
 
-#define CONFIG_LANG_MAP_VARIABLE_NAME    L"RedfishConfigLangMap"
-#define CONFIG_LANG_MAP_DEBUG_ENABLED    0x00
-
 //
-// Definition of REDFISH_CONFIG_LANG_MAP_RECORD
+// CONFIG_LANG_MAP_VARIABLE_NAME is the single text variable used by the
+// earlier versions of this driver. Records in it are moved to the keyed store.
 //
-typedef struct {
-  LIST_ENTRY  List;
-  EFI_STRING  Uri;
-  EFI_STRING  ConfigLang;
-  UINTN       Size;
-} REDFISH_CONFIG_LANG_MAP_RECORD;
-
-#define REDFISH_CONFIG_LANG_MAP_RECORD_FROM_LIST(a)  BASE_CR (a, REDFISH_CONFIG_LANG_MAP_RECORD, List)
-
-//
-// Definition of REDFISH_CONFIG_LANG_MAP_LIST
-//
-typedef struct {
-  LIST_ENTRY    Listheader;
-  UINTN         TotalSize;
-  UINTN         Count;
-} REDFISH_CONFIG_LANG_MAP_LIST;
+#define CONFIG_LANG_MAP_VARIABLE_NAME        L"RedfishConfigLangMap"
+#define CONFIG_LANG_MAP_STORE_VARIABLE_NAME  L"RedfishConfigLangMapStore"
 
 //
-// Definition of REDFISH_CONFIG_LANG_MAP_PRIVATE_DATA
+// Definition of REDFISH_CONFIG_LANG_MAP_PRIVATE_DATA. The keyed store
+// keeps the map with ConfigLang as key and URI as value.
 //
 typedef struct {
   EFI_HANDLE                             ImageHandle;
-  REDFISH_CONFIG_LANG_MAP_LIST           ConfigLangList;
+  REDFISH_KEYED_STORE                    *ConfigLangStore;
   EDKII_REDFISH_CONFIG_LANG_MAP_PROTOCOL Protocol;
-  EFI_STRING                             VariableName;
   EFI_EVENT                              ExitBootEvent;
   EFI_EVENT                              ProvisionEvent;
 } REDFISH_CONFIG_LANG_MAP_PRIVATE_DATA;
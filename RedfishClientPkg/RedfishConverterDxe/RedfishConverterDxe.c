@@ -0,0 +1,45 @@
+/** @file
+  Redfish JSON to C structure convertor driver which links multiple convertors
+  into one image.
+
+  The convertors are linked into this driver as NULL library instances, for
+  example:
+
+    RedfishClientPkg/RedfishConverterDxe/RedfishConverterDxe.inf {
+      <LibraryClasses>
+        NULL|RedfishClientPkg/Converter/Memory/v1_7_1/RedfishMemory_V1_7_1_Lib.inf
+    }
+
+  Each convertor registers itself in its library constructor, so the convertors
+  share one copy of JSON library and convertor common library, and they are
+  loaded and dispatched as one DXE image.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/DebugLib.h>
+
+/**
+  This is the declaration of an EFI image entry point. The convertors are
+  registered by library constructors before this function is called.
+
+  @param  ImageHandle           The firmware allocated handle for the UEFI image.
+  @param  SystemTable           A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS           The operation completed successfully.
+**/
+EFI_STATUS
+EFIAPI
+RedfishConverterDxeEntryPoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  DEBUG ((DEBUG_INFO, "%a: Redfish convertors are registered\n", __FUNCTION__));
+
+  return EFI_SUCCESS;
+}
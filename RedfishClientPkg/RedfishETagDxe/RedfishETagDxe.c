@@ -12,420 +12,20 @@
 REDFISH_ETAG_PRIVATE_DATA  *mRedfishETagPrivate = NULL;
 
 /**
-  Release REDFISH_ETAG_RECORD resource
+  Move the records in the text variable of earlier driver version to
+  keyed store, and delete the text variable once the records are saved.
 
-  @param[in]    Record    Pointer to REDFISH_ETAG_RECORD instance
-
-  @retval EFI_SUCCESS             REDFISH_ETAG_RECORD is released successfully.
-  @retval EFI_INVALID_PARAMETER   Record is NULL
-
-**/
-EFI_STATUS
-ReleaseETagRecord (
-  IN REDFISH_ETAG_RECORD *Record
-  )
-{
-  if (Record == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  if (Record->Uri != NULL) {
-    FreePool (Record->Uri);
-  }
-
-  if (Record->ETag != NULL) {
-    FreePool (Record->ETag);
-  }
-
-  FreePool (Record);
-
-  return EFI_SUCCESS;
-}
-
-/**
-  Create new Etag resource.
-
-  @param[in]    Uri   The URI string matching to this ETAG.
-  @param[in]    ETag  ETAG string.
-
-  @retval REDFISH_ETAG_RECORD *   Pointer to newly created ETAG.
-  @retval NULL                    No memory available.
-
-**/
-REDFISH_ETAG_RECORD *
-NewETagRecord (
-  IN  CHAR8   *Uri,
-  IN  CHAR8   *ETag
-  )
-{
-  REDFISH_ETAG_RECORD *NewRecord;
-  UINTN               Size;
-
-  if (IS_EMPTY_STRING (Uri) || IS_EMPTY_STRING (ETag)) {
-    return NULL;
-  }
-
-  NewRecord = AllocateZeroPool (sizeof (REDFISH_ETAG_RECORD));
-  if (NewRecord == NULL) {
-    return NULL;
-  }
-
-  Size = AsciiStrSize (Uri);
-  NewRecord->Uri = AllocateCopyPool (Size, Uri);
-  if (NewRecord->Uri == NULL) {
-    goto ON_ERROR;
-  }
-
-  NewRecord->Size = Size;
-  Size = AsciiStrSize (ETag);
-  NewRecord->ETag = AllocateCopyPool (Size, ETag);
-  if (NewRecord->ETag == NULL) {
-    goto ON_ERROR;
-  }
-
-  NewRecord->Size += Size;
-  return NewRecord;
-
-ON_ERROR:
-
-  if (NewRecord != NULL) {
-    ReleaseETagRecord (NewRecord);
-  }
-
-  return NULL;
-}
-
-/**
-  Add new ETAG by given URI and ETAG string to specify List.
-
-  @param[in]    List  Target ETAG list to add.
-  @param[in]    Uri   The URI string matching to this ETAG.
-  @param[in]    ETag  ETAG string.
-
-  @retval EFI_SUCCESS   ETAG recourd is added.
-  @retval Others        Fail to add ETAG.
-
-**/
-EFI_STATUS
-AddETagRecord (
-  IN  REDFISH_ETAG_LIST *List,
-  IN  CHAR8             *Uri,
-  IN  CHAR8             *ETag
-  )
-{
-  REDFISH_ETAG_RECORD *NewRecord;
-
-  if (List == NULL || IS_EMPTY_STRING (Uri) || IS_EMPTY_STRING (ETag)) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  NewRecord = NewETagRecord (Uri, ETag);
-  if (NewETagRecord == NULL) {
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  InsertTailList (&List->Listheader, &NewRecord->List);
-  ++List->Count;
-  List->TotalSize += NewRecord->Size;
-
-  return EFI_SUCCESS;
-}
-
-/**
-  Delete an ETAG by given ETAG instance.
-
-  @param[in]    List    Target ETAG list to be removed.
-  @param[in]    Record  Pointer to the instance to be deleted.
-
-  @retval EFI_SUCCESS   ETAG recourd is removed.
-  @retval Others        Fail to add ETAG.
-
-**/
-EFI_STATUS
-DeleteETagRecord (
-  IN  REDFISH_ETAG_LIST   *List,
-  IN  REDFISH_ETAG_RECORD *Record
-  )
-{
-  if (List == NULL || Record == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  RemoveEntryList (&Record->List);
-  --List->Count;
-  List->TotalSize -= Record->Size;
-
-  return ReleaseETagRecord (Record);
-}
-
-/**
-  Search on given ListHeader for given URI string.
-
-  @param[in]    ListHeader  Target list to search.
-  @param[in]    Uri         Target URI to search.
-
-  @retval REDFISH_ETAG_RECORD   Target ETAG is found.
-  @retval NULL                  No ETAG with given URI is found.
-
-**/
-REDFISH_ETAG_RECORD *
-FindETagRecord (
-  IN  LIST_ENTRY  *ListHeader,
-  IN  CHAR8       *Uri
-  )
-{
-  LIST_ENTRY          *List;
-  REDFISH_ETAG_RECORD *Record;
-
-  if (IsListEmpty (ListHeader)) {
-    return NULL;
-  }
-
-  Record = NULL;
-  List = GetFirstNode (ListHeader);
-  while (!IsNull (ListHeader, List)) {
-    Record = REDFISH_ETAG_RECORD_FROM_LIST (List);
-
-    if (AsciiStrCmp (Record->Uri, Uri) == 0) {
-      return  Record;
-    }
-
-    List = GetNextNode (ListHeader, List);
-  }
-
-  return NULL;
-}
-
-#if ETAG_DEBUG_ENABLED
-/**
-  Debug output the ETAG list.
-
-  @param[in]    ETagList  Target list to dump
-  @param[in]    Msg       Debug message string.
-
-  @retval EFI_SUCCESS             Debug dump finished.
-  @retval EFI_INVALID_PARAMETER   ETagList is NULL.
-
-**/
-EFI_STATUS
-DumpETagList (
-  IN  REDFISH_ETAG_LIST   *ETagList,
-  IN  EFI_STRING          Msg
-  )
-{
-  LIST_ENTRY          *List;
-  REDFISH_ETAG_RECORD *Record;
-
-  if (ETagList == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  if (!IS_EMPTY_STRING (Msg)) {
-    DEBUG ((DEBUG_ERROR, "%s\n", Msg));
-  }
-
-  if (IsListEmpty (&ETagList->Listheader)) {
-    DEBUG ((DEBUG_INFO, "ETag list is empty\n"));
-    return EFI_NOT_FOUND;
-  }
-
-  DEBUG ((DEBUG_INFO, "Count: %d Total Size: %d\n", ETagList->Count, ETagList->TotalSize));
-  Record = NULL;
-  List = GetFirstNode (&ETagList->Listheader);
-  while (!IsNull (&ETagList->Listheader, List)) {
-    Record = REDFISH_ETAG_RECORD_FROM_LIST (List);
-
-    DEBUG ((DEBUG_INFO, "ETag: %a Uri: %a Size: %d\n", Record->ETag, Record->Uri, Record->Size));
-
-    List = GetNextNode (&ETagList->Listheader, List);
-  }
-
-  return EFI_SUCCESS;
-}
-
-/**
-  Debug output raw data buffer.
-
-  @param[in]    Buffer      Debug output data buffer.
-  @param[in]    BufferSize  The size of Buffer in byte.
-
-  @retval EFI_SUCCESS             Debug dump finished.
-  @retval EFI_INVALID_PARAMETER   Buffer is NULL.
-
-**/
-EFI_STATUS
-DumpRawBuffer (
-  IN  CHAR8    *Buffer,
-  IN  UINTN     BufferSize
-  )
-{
-  UINTN  Index;
-
-  if (Buffer == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  Index = 0;
-
-  DEBUG ((DEBUG_ERROR, "Buffer size: %d\n", BufferSize));
-  while (Buffer[Index] != '\0') {
-    DEBUG ((DEBUG_ERROR, "(%d) %c ", (Index + 1), Buffer[Index]));
-
-    ++Index;
-  }
-  DEBUG ((DEBUG_ERROR, "\n"));
-
-  return EFI_SUCCESS;
-}
-#endif
-
-/**
-  Release all ETag from list.
-
-  @param[in]    ETagList    The list to be released.
-
-  @retval EFI_SUCCESS             All etag is released.
-  @retval EFI_INVALID_PARAMETER   ETagList is NULL.
-
-**/
-EFI_STATUS
-ReleaseETagList (
-  IN  REDFISH_ETAG_LIST   *ETagList
-  )
-{
-  LIST_ENTRY          *List;
-  LIST_ENTRY          *Next;
-  REDFISH_ETAG_RECORD *Record;
-
-  if (ETagList == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  if (IsListEmpty (&ETagList->Listheader)) {
-    return EFI_SUCCESS;
-  }
-
-  Record = NULL;
-  Next = NULL;
-  List = GetFirstNode (&ETagList->Listheader);
-  while (!IsNull (&ETagList->Listheader, List)) {
-    Record = REDFISH_ETAG_RECORD_FROM_LIST (List);
-    Next = GetNextNode (&ETagList->Listheader, List);
-
-    DeleteETagRecord (ETagList, Record);
-
-    List = Next;
-  }
-
-  return EFI_SUCCESS;
-}
-
-/**
-  Save etag in list to UEFI variable.
-
-  @param[in]    ETagList      The list to be saved.
-  @param[in]    VariableName  The UEFI variable name.
-
-  @retval EFI_SUCCESS             All etag is saved.
-  @retval EFI_INVALID_PARAMETER   VariableName or ETagList is NULL.
-
-**/
-EFI_STATUS
-SaveETagList (
-  IN  REDFISH_ETAG_LIST   *ETagList,
-  IN  EFI_STRING          VariableName
-  )
-{
-  LIST_ENTRY          *List;
-  REDFISH_ETAG_RECORD *Record;
-  CHAR8               *VarData;
-  VOID                *Data;
-  CHAR8               *Seeker;
-  UINTN               VarSize;
-  UINTN               StrSize;
-  EFI_STATUS          Status;
-
-  if (ETagList == NULL || IS_EMPTY_STRING (VariableName)) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  if (IsListEmpty (&ETagList->Listheader)) {
-    return EFI_SUCCESS;
-  }
-
-  //
-  // Caculate the total size we need to keep ETag list.
-  //
-  VarSize = ETagList->TotalSize + 1; // terminator character
-  VarData = AllocateZeroPool (VarSize);
-  if (VarData == NULL) {
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  Seeker = VarData;
-  Record = NULL;
-  List = GetFirstNode (&ETagList->Listheader);
-  while (!IsNull (&ETagList->Listheader, List)) {
-    Record = REDFISH_ETAG_RECORD_FROM_LIST (List);
-
-    StrSize = AsciiStrSize (Record->Uri);
-    CopyMem (Seeker, Record->Uri, StrSize);
-
-    Seeker += (StrSize - 1);
-    *Seeker = '|';
-    ++Seeker;
-
-    StrSize = AsciiStrSize (Record->ETag);
-    CopyMem (Seeker, Record->ETag, StrSize);
-
-    Seeker += (StrSize - 1);
-    *Seeker = '\n';
-
-    ++Seeker;
-
-    List = GetNextNode (&ETagList->Listheader, List);;
-  }
-
-  *Seeker = '\0';
-
-#if ETAG_DEBUG_ENABLED
-  DumpRawBuffer (VarData, VarSize);
-#endif
-
-  ASSERT (((UINTN)Seeker - (UINTN)VarData + 1) == VarSize);
-
-  //
-  // Check if variable exists already. If yes, remove it first.
-  //
-  Status = GetVariable2 (
-             VariableName,
-             &gEfiRedfishClientVariableGuid,
-             (VOID *)&Data,
-             NULL
-             );
-  if (!EFI_ERROR (Status)) {
-    FreePool (Data);
-    gRT->SetVariable (VariableName, &gEfiRedfishClientVariableGuid, VARIABLE_ATTRIBUTE_NV_BS, 0, NULL);
-  }
-
-
-  return gRT->SetVariable (VariableName, &gEfiRedfishClientVariableGuid, VARIABLE_ATTRIBUTE_NV_BS, VarSize, (VOID *)VarData);
-}
-
-/**
-  Read etag from UEFI variable if it exists.
-
-  @param[in]    ETagList      The list to be loaded.
+  @param[in]    ETagStore     The keyed store to add records.
   @param[in]    VariableName  The UEFI variable name.
 
-  @retval EFI_SUCCESS             All etag is read successfully.
-  @retval EFI_INVALID_PARAMETER   VariableName or ETagList is NULL.
+  @retval EFI_SUCCESS             All etag is moved successfully.
+  @retval EFI_INVALID_PARAMETER   VariableName or ETagStore is NULL.
   @retval EFI_NOT_FOUND           No etag is found on UEFI variable.
 
 **/
 EFI_STATUS
-InitialETagList (
-  IN  REDFISH_ETAG_LIST   *ETagList,
+MigrateETagList (
+  IN  REDFISH_KEYED_STORE *ETagStore,
   IN  EFI_STRING          VariableName
   )
 {
@@ -436,7 +36,7 @@ InitialETagList (
   UINTN      VariableSize;
   EFI_STATUS Status;
 
-  if (ETagList == NULL || IS_EMPTY_STRING (VariableName)) {
+  if (ETagStore == NULL || IS_EMPTY_STRING (VariableName)) {
     return EFI_INVALID_PARAMETER;
   }
 
@@ -483,21 +83,26 @@ InitialETagList (
 
     *Seeker = '\0';
 
-    AddETagRecord (ETagList, UriPointer, ETagPointer);
+    if (!IS_EMPTY_STRING (UriPointer) && !IS_EMPTY_STRING (ETagPointer)) {
+      RedfishKeyedStoreSet (ETagStore, UriPointer, AsciiStrSize (UriPointer), ETagPointer, AsciiStrSize (ETagPointer));
+    }
 
     UriPointer = ++Seeker;
   }
 
-#if ETAG_DEBUG_ENABLED
-  DumpETagList (ETagList, L"Initial ETag List from Variable");
-#endif
-
-  Status = EFI_SUCCESS;
+  Status = RedfishKeyedStoreFlush (ETagStore);
 
 ON_ERROR:
 
   FreePool (VarData);
 
+  //
+  // Corrupted data is dropped as well.
+  //
+  if (!EFI_ERROR (Status) || (Status == EFI_DEVICE_ERROR)) {
+    gRT->SetVariable (VariableName, &gEfiRedfishClientVariableGuid, VARIABLE_ATTRIBUTE_NV_BS, 0, NULL);
+  }
+
   return Status;
 }
 
@@ -519,8 +124,10 @@ RedfishETagGet (
   OUT CHAR8                     **ETag
   )
 {
-  REDFISH_ETAG_RECORD       *Target;
   REDFISH_ETAG_PRIVATE_DATA *Private;
+  CONST VOID                *Target;
+  UINTN                     TargetSize;
+  EFI_STATUS                Status;
 
   if (This == NULL || IS_EMPTY_STRING (Uri) || ETag == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -530,12 +137,15 @@ RedfishETagGet (
 
   *ETag = NULL;
 
-  Target = FindETagRecord (&Private->ETagList.Listheader, Uri);
-  if (Target == NULL) {
-    return EFI_NOT_FOUND;
+  Status = RedfishKeyedStoreGet (Private->ETagStore, Uri, AsciiStrSize (Uri), &Target, &TargetSize);
+  if (EFI_ERROR (Status)) {
+    return Status;
   }
 
-  *ETag = AllocateCopyPool (AsciiStrSize (Target->ETag), Target->ETag);
+  *ETag = AllocateCopyPool (TargetSize, Target);
+  if (*ETag == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
 
   return EFI_SUCCESS;
 }
@@ -559,9 +169,7 @@ RedfishETagSet (
   IN  CHAR8                        *ETag  OPTIONAL
   )
 {
-  REDFISH_ETAG_RECORD       *Target;
   REDFISH_ETAG_PRIVATE_DATA *Private;
-  EFI_STATUS                Status;
 
   if (This == NULL || IS_EMPTY_STRING (Uri)) {
     return EFI_INVALID_PARAMETER;
@@ -569,23 +177,21 @@ RedfishETagSet (
 
   Private = REDFISH_ETAG_PRIVATE_FROM_THIS (This);
 
-  Status = EFI_NOT_FOUND;
-  Target = FindETagRecord (&Private->ETagList.Listheader, Uri);
-  if (Target != NULL) {
-    //
-    // Remove old one and create new one.
-    //
-    Status = DeleteETagRecord (&Private->ETagList, Target);
-  }
-
   //
   // When ETag is NULL, it means that we want to remov this record.
   //
   if (ETag == NULL) {
-    return Status;
+    return RedfishKeyedStoreSet (Private->ETagStore, Uri, AsciiStrSize (Uri), NULL, 0);
   }
 
-  return AddETagRecord (&Private->ETagList, Uri, ETag);
+  if (IS_EMPTY_STRING (ETag)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // The record is written to variable on flush only if the ETag is changed.
+  //
+  return RedfishKeyedStoreSet (Private->ETagStore, Uri, AsciiStrSize (Uri), ETag, AsciiStrSize (ETag));
 }
 
 /**
@@ -611,9 +217,9 @@ RedfishETagFlush (
 
   Private = REDFISH_ETAG_PRIVATE_FROM_THIS (This);
 
-  Status = SaveETagList (&Private->ETagList, Private->VariableName);
+  Status = RedfishKeyedStoreFlush (Private->ETagStore);
   if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a, save ETag list to variable: %s failed: %r\n", __FUNCTION__, Private->VariableName, Status));
+    DEBUG ((DEBUG_ERROR, "%a, save ETag list to variable: %s failed: %r\n", __FUNCTION__, ETAG_STORE_VARIABLE_NAME, Status));
   }
 
   return Status;
@@ -668,10 +274,8 @@ RedfishETagDriverUnload (
       ASSERT (FALSE);
     }
 
-    ReleaseETagList (&mRedfishETagPrivate->ETagList);
-
-    if (mRedfishETagPrivate->VariableName != NULL) {
-      FreePool (mRedfishETagPrivate->VariableName);
+    if (mRedfishETagPrivate->ETagStore != NULL) {
+      RedfishKeyedStoreClose (mRedfishETagPrivate->ETagStore);
     }
 
     if (mRedfishETagPrivate->Event != NULL) {
@@ -720,9 +324,12 @@ RedfishETagDriverEntryPoint (
     return EFI_OUT_OF_RESOURCES;
   }
 
-  InitializeListHead (&mRedfishETagPrivate->ETagList.Listheader);
-  mRedfishETagPrivate->VariableName = AllocateCopyPool (StrSize (ETAG_VARIABLE_NAME), ETAG_VARIABLE_NAME);
-  if (mRedfishETagPrivate->VariableName == NULL) {
+  //
+  // Read existing record from variable.
+  //
+  Status = RedfishKeyedStoreOpen (ETAG_STORE_VARIABLE_NAME, &mRedfishETagPrivate->ETagStore);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, can not open ETag store: %r\n", __FUNCTION__, Status));
     goto ON_ERROR;
   }
 
@@ -758,11 +365,11 @@ RedfishETagDriverEntryPoint (
   }
 
   //
-  // Read existing record from variable.
+  // Move the records kept by earlier version of this driver.
   //
-  Status = InitialETagList (&mRedfishETagPrivate->ETagList, mRedfishETagPrivate->VariableName);
+  Status = MigrateETagList (mRedfishETagPrivate->ETagStore, ETAG_VARIABLE_NAME);
   if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_INFO, "%a, Initial ETag List: %r\n", __FUNCTION__, Status));
+    DEBUG ((DEBUG_INFO, "%a, Migrate ETag List: %r\n", __FUNCTION__, Status));
   }
 
   return EFI_SUCCESS;
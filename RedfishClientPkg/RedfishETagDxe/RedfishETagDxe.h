@@ -21,6 +21,7 @@
 #include <Library/DebugLib.h>
 
 #include <Library/MemoryAllocationLib.h>
+#include <Library/RedfishKeyedStoreLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiDriverEntryPoint.h>
 #include <Library/UefiLib.h>
@@ -30,38 +31,20 @@
 
 #include <Guid/VariableFormat.h>
 
-#define ETAG_VARIABLE_NAME    L"RedfishETag"
-#define ETAG_DEBUG_ENABLED    0x00
-
 //
-// Definition of REDFISH_ETAG_RECORD
+// ETAG_VARIABLE_NAME is the single text variable used by the earlier
+// versions of this driver. Records in it are moved to the keyed store.
 //
-typedef struct {
-  LIST_ENTRY  List;
-  CHAR8       *Uri;
-  CHAR8       *ETag;
-  UINTN       Size;
-} REDFISH_ETAG_RECORD;
-
-#define REDFISH_ETAG_RECORD_FROM_LIST(a)  BASE_CR (a, REDFISH_ETAG_RECORD, List)
-
-//
-// Definition of REDFISH_ETAG_LIST
-//
-typedef struct {
-  LIST_ENTRY    Listheader;
-  UINTN         TotalSize;
-  UINTN         Count;
-} REDFISH_ETAG_LIST;
+#define ETAG_VARIABLE_NAME          L"RedfishETag"
+#define ETAG_STORE_VARIABLE_NAME    L"RedfishETagStore"
 
 //
 // Definition of REDFISH_ETAG_PRIVATE_DATA
 //
 typedef struct {
   EFI_HANDLE                  ImageHandle;
-  REDFISH_ETAG_LIST           ETagList;
+  REDFISH_KEYED_STORE         *ETagStore;
   EDKII_REDFISH_ETAG_PROTOCOL Protocol;
-  EFI_STRING                  VariableName;
   EFI_EVENT                   Event;
 } REDFISH_ETAG_PRIVATE_DATA;
 
@@ -104,6 +104,63 @@ DestroryExchangeInformation (
   return EFI_SUCCESS;
 }
 
+/**
+  Ask the feature drivers in given list and their sibling feature drivers to
+  prefetch their Redfish resources. The feature driver only starts reading the
+  resource without waiting for it, so the network waits overlap before the
+  feature drivers are started up one by one. The exchange information given to
+  the feature driver is the same as it gets in StartUpFeatureDriver(). The
+  feature driver which doesn't support CallbackActionPrefetch returns
+  EFI_UNSUPPORTED.
+
+  @param[in]  ThisFeatureDriverList    This feature driver list.
+  @param[in]  CurrentConfigLanguageUri The current parent configure language URI.
+  @param[in]  StartupContext           Start up information
+
+**/
+VOID
+PrefetchFeatureDriver (
+  IN REDFISH_FEATURE_INTERNAL_DATA *ThisFeatureDriverList,
+  IN EFI_STRING                    CurrentConfigLanguageUri,
+  IN REDFISH_FEATURE_STARTUP_CONTEXT *StartupContext
+  )
+{
+  EFI_STATUS Status;
+  REDFISH_FEATURE_INTERNAL_DATA *ThisList;
+  RESOURCE_INFORMATION_EXCHANGE PrefetchInformation;
+
+  if (StartupContext->Action != CallbackActionStartOperation) {
+    return;
+  }
+
+  for (ThisList = ThisFeatureDriverList; ThisList != NULL; ThisList = ThisList->SiblingList) {
+    if (ThisList->Callback == NULL) {
+      continue;
+    }
+    ZeroMem (&PrefetchInformation, sizeof (RESOURCE_INFORMATION_EXCHANGE));
+    ThisList->InformationExchange = &PrefetchInformation;
+    Status = SetupExchangeInformationInfo (ThisList, CurrentConfigLanguageUri);
+    if (!EFI_ERROR (Status)) {
+      ThisList->Callback(
+                  StartupContext->This,
+                  CallbackActionPrefetch,
+                  ThisList->Context,
+                  &PrefetchInformation
+                  );
+    }
+    if (PrefetchInformation.SendInformation.ParentUri != NULL) {
+      FreePool (PrefetchInformation.SendInformation.ParentUri);
+    }
+    if (PrefetchInformation.SendInformation.PropertyName != NULL) {
+      FreePool (PrefetchInformation.SendInformation.PropertyName);
+    }
+    if (PrefetchInformation.SendInformation.FullUri != NULL) {
+      FreePool (PrefetchInformation.SendInformation.FullUri);
+    }
+    ThisList->InformationExchange = mInformationExchange;
+  }
+}
+
 /**
   Startup child feature drivers and it's sibing feature drivers.
 
@@ -124,6 +181,7 @@ StartUpFeatureDriver (
   REDFISH_FEATURE_INTERNAL_DATA *ThisList;
   REDFISH_FEATURE_ARRAY_TYPE_CONFIG_LANG_LIST ConfigLangList;
   EFI_STRING NextParentUri;
+  UINT64 StartTick;
 
   NextParentUri = (EFI_STRING)AllocateZeroPool (MaxParentUriLength * sizeof (CHAR16));
   if (NextParentUri == NULL) {
@@ -134,18 +192,26 @@ StartUpFeatureDriver (
     StrCpyS(NextParentUri, MaxParentUriLength, CurrentConfigLanguageUri);
   }
 
+  //
+  // Let this level read its resources before the callbacks below wait for
+  // them. The requests already started by the parent level are not sent again.
+  //
+  PrefetchFeatureDriver (ThisFeatureDriverList, NextParentUri, StartupContext);
+
   ThisList = ThisFeatureDriverList;
   while (TRUE) {
     if (ThisList->Callback != NULL) {
       ThisList->InformationExchange = mInformationExchange;
       Status = SetupExchangeInformationInfo (ThisList, NextParentUri);
       if (!EFI_ERROR (Status)) {
+        StartTick = RedfishPerfStart ();
         Status = ThisList->Callback(
                                StartupContext->This,
                                StartupContext->Action,
                                ThisList->Context,
                                ThisList->InformationExchange
                                );
+        RedfishPerfEndUnicode (RedfishPerfFeatureDriver, ThisList->InformationExchange->SendInformation.FullUri, StartTick, 1, 0, EFI_ERROR (Status));
       }
       if (EFI_ERROR (Status)) {
         DEBUG((DEBUG_ERROR, "%a: Callback to EDK2 Redfish feature driver fail: %s.\n", __FUNCTION__, ThisList->InformationExchange->SendInformation.FullUri));
@@ -167,6 +233,22 @@ StartUpFeatureDriver (
           CopyConfiglanguageList (&ThisList->InformationExchange->ReturnedInformation.ConfigureLanguageList, &ConfigLangList);
           DestroryExchangeInformation(ThisList);
           //
+          // Prefetch the resources of all collection members first, so members
+          // don't wait for their resources one after another. The parent URI of
+          // each member is composed the same way as the loop below does.
+          //
+          for (Index = 0; Index < ConfigLangList.Count; Index ++) {
+            StrCatS (NextParentUri, MaxParentUriLength, ThisList->NodeName);
+            StrCatS (NextParentUri, MaxParentUriLength, NodeIsCollectionSymbol);
+            SetResourceConfigLangMemberInstance (&NextParentUri, MaxParentUriLength, (REDFISH_FEATURE_ARRAY_TYPE_CONFIG_LANG *)&ConfigLangList.List[Index]);
+            PrefetchFeatureDriver (ThisList->ChildList, NextParentUri, StartupContext);
+          }
+          if (CurrentConfigLanguageUri != NULL) {
+            StrCpyS(NextParentUri, MaxParentUriLength, CurrentConfigLanguageUri);
+          } else{
+            NextParentUri [0] = 0;
+          }
+          //
           // Modify the collection instance according to the returned InformationTypeCollectionMemberConfigLanguage.
           //
           for (Index = 0; Index < ConfigLangList.Count; Index ++) {
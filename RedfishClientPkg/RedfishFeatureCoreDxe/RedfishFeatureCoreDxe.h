@@ -19,6 +19,7 @@
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/RedfishEventLib.h>
 #include <Library/RedfishFeatureUtilityLib.h>
+#include <Library/RedfishPerfLib.h>
 
 #define MaxNodeNameLength 64
 #define MaxParentUriLength 512
@@ -0,0 +1,397 @@
+/** @file
+  Redfish service pool driver. Feature drivers get the Redfish session from
+  this driver so they share one session login instead of logging in their own.
+  The session token is handed to feature drivers as plain text and each of
+  them creates its own Redfish service with it.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishServicePoolDxe.h"
+
+REDFISH_SERVICE_POOL_PRIVATE_DATA  *mRedfishServicePoolPrivate = NULL;
+
+/**
+  Free the pool entry and the Redfish service in it.
+
+  @param[in]    Entry     The pool entry to free.
+
+**/
+VOID
+RedfishServicePoolFreeEntry (
+  IN  REDFISH_SERVICE_POOL_ENTRY  *Entry
+  )
+{
+  if (Entry == NULL) {
+    return;
+  }
+
+  if (Entry->Service != NULL) {
+    RedfishCleanupService (Entry->Service);
+  }
+
+  if (Entry->Location != NULL) {
+    FreePool (Entry->Location);
+  }
+
+  FreePool (Entry);
+}
+
+/**
+  Find the pool entry created with given Redfish service information.
+
+  @param[in]    Private                   Pointer to private data.
+  @param[in]    RedfishConfigServiceInfo  Redfish service information.
+
+  @retval REDFISH_SERVICE_POOL_ENTRY *    The entry is found.
+  @retval NULL                            There is no such entry.
+
+**/
+REDFISH_SERVICE_POOL_ENTRY *
+RedfishServicePoolFindByInfo (
+  IN  REDFISH_SERVICE_POOL_PRIVATE_DATA   *Private,
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION  *RedfishConfigServiceInfo
+  )
+{
+  LIST_ENTRY                  *Node;
+  REDFISH_SERVICE_POOL_ENTRY  *Entry;
+
+  Node = GetFirstNode (&Private->ServiceList);
+  while (!IsNull (&Private->ServiceList, Node)) {
+    Entry = REDFISH_SERVICE_POOL_ENTRY_FROM_LIST (Node);
+    if ((Entry->RestExHandle == RedfishConfigServiceInfo->RedfishServiceRestExHandle) &&
+        (Entry->Version == RedfishConfigServiceInfo->RedfishServiceVersion) &&
+        (Entry->UseHttps == RedfishConfigServiceInfo->RedfishServiceUseHttps) &&
+        (StrCmp (Entry->Location, RedfishConfigServiceInfo->RedfishServiceLocation) == 0)) {
+      return Entry;
+    }
+
+    Node = GetNextNode (&Private->ServiceList, Node);
+  }
+
+  return NULL;
+}
+
+/**
+  Create the pool entry of given Redfish service information. The Redfish
+  service is created and the session is logged in.
+
+  @param[in]    RedfishConfigServiceInfo  Redfish service information.
+  @param[out]   NewEntry                  The pool entry created.
+
+  @retval EFI_SUCCESS              The entry is created.
+  @retval EFI_DEVICE_ERROR         Failed to create the service.
+  @retval EFI_OUT_OF_RESOURCES     Not enough memory.
+
+**/
+EFI_STATUS
+RedfishServicePoolCreateEntry (
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION  *RedfishConfigServiceInfo,
+  OUT REDFISH_SERVICE_POOL_ENTRY          **NewEntry
+  )
+{
+  REDFISH_SERVICE_POOL_ENTRY  *Entry;
+
+  Entry = AllocateZeroPool (sizeof (REDFISH_SERVICE_POOL_ENTRY));
+  if (Entry == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Entry->Location = AllocateCopyPool (StrSize (RedfishConfigServiceInfo->RedfishServiceLocation), RedfishConfigServiceInfo->RedfishServiceLocation);
+  if (Entry->Location == NULL) {
+    RedfishServicePoolFreeEntry (Entry);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Entry->Service = RedfishCreateService (RedfishConfigServiceInfo);
+  if (Entry->Service == NULL) {
+    DEBUG ((DEBUG_ERROR, "%a, can not create Redfish service for %s\n", __FUNCTION__, Entry->Location));
+    RedfishServicePoolFreeEntry (Entry);
+    return EFI_DEVICE_ERROR;
+  }
+
+  Entry->RestExHandle = RedfishConfigServiceInfo->RedfishServiceRestExHandle;
+  Entry->Version      = RedfishConfigServiceInfo->RedfishServiceVersion;
+  Entry->UseHttps     = RedfishConfigServiceInfo->RedfishServiceUseHttps;
+
+  *NewEntry = Entry;
+  return EFI_SUCCESS;
+}
+
+/**
+  Take one reference of the pool entry and return a copy of its session token.
+
+  @param[in]    Entry           The pool entry.
+  @param[out]   SessionToken    The copy of session token, or NULL if the
+                                service does not use Redfish session.
+
+  @retval EFI_SUCCESS              The reference is taken.
+  @retval EFI_OUT_OF_RESOURCES     Not enough memory.
+
+**/
+EFI_STATUS
+RedfishServicePoolReferenceEntry (
+  IN  REDFISH_SERVICE_POOL_ENTRY  *Entry,
+  OUT CHAR8                       **SessionToken
+  )
+{
+  CONST CHAR8  *Token;
+
+  *SessionToken = NULL;
+
+  Token = RedfishGetSessionToken (Entry->Service);
+  if (Token != NULL) {
+    *SessionToken = AllocateCopyPool (AsciiStrSize (Token), Token);
+    if (*SessionToken == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  Entry->RefCount++;
+  return EFI_SUCCESS;
+}
+
+/**
+  Get the session of given Redfish service information. The session is logged
+  in when this is the first request of the service, otherwise the existing
+  session is returned and its reference count is increased.
+
+  Each successful call must be paired with one call of
+  EDKII_REDFISH_SERVICE_POOL_PROTOCOL.Release() with the same service information.
+
+  @param[in]   This                      Pointer to EDKII_REDFISH_SERVICE_POOL_PROTOCOL instance.
+  @param[in]   RedfishConfigServiceInfo  Redfish service information.
+  @param[out]  SessionToken              On return, a copy of the X-Auth-Token of the
+                                         session. Caller frees it by FreePool(). It is
+                                         NULL when the platform does not use Redfish
+                                         session, and caller creates its own service
+                                         by RedfishCreateService() in this case.
+
+  @retval EFI_SUCCESS              The session token is returned.
+  @retval EFI_INVALID_PARAMETER    RedfishConfigServiceInfo or SessionToken is NULL.
+  @retval EFI_DEVICE_ERROR         Failed to create the service.
+  @retval EFI_OUT_OF_RESOURCES     Not enough memory.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishServicePoolAcquire (
+  IN  EDKII_REDFISH_SERVICE_POOL_PROTOCOL  *This,
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION   *RedfishConfigServiceInfo,
+  OUT CHAR8                                **SessionToken
+  )
+{
+  EFI_STATUS                         Status;
+  EFI_TPL                            OldTpl;
+  REDFISH_SERVICE_POOL_PRIVATE_DATA  *Private;
+  REDFISH_SERVICE_POOL_ENTRY         *Entry;
+  REDFISH_SERVICE_POOL_ENTRY         *NewEntry;
+
+  if (This == NULL || RedfishConfigServiceInfo == NULL || SessionToken == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (RedfishConfigServiceInfo->RedfishServiceLocation == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Private = REDFISH_SERVICE_POOL_PRIVATE_FROM_THIS (This);
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  Entry  = RedfishServicePoolFindByInfo (Private, RedfishConfigServiceInfo);
+  if (Entry != NULL) {
+    Status = RedfishServicePoolReferenceEntry (Entry, SessionToken);
+    gBS->RestoreTPL (OldTpl);
+    return Status;
+  }
+
+  gBS->RestoreTPL (OldTpl);
+
+  //
+  // Session login talks to the Redfish service, so it is done at caller's TPL.
+  //
+  Status = RedfishServicePoolCreateEntry (RedfishConfigServiceInfo, &NewEntry);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Someone may add the same service while this one is logging in. Keep the
+  // one in the list and free the new one.
+  //
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  Entry  = RedfishServicePoolFindByInfo (Private, RedfishConfigServiceInfo);
+  if (Entry == NULL) {
+    InsertTailList (&Private->ServiceList, &NewEntry->List);
+    Entry    = NewEntry;
+    NewEntry = NULL;
+  }
+
+  Status = RedfishServicePoolReferenceEntry (Entry, SessionToken);
+  gBS->RestoreTPL (OldTpl);
+
+  if (NewEntry != NULL) {
+    RedfishServicePoolFreeEntry (NewEntry);
+  } else {
+    DEBUG ((REDFISH_DEBUG_TRACE, "%a, Redfish service for %s is created\n", __FUNCTION__, Entry->Location));
+  }
+
+  return Status;
+}
+
+/**
+  Release the session returned by EDKII_REDFISH_SERVICE_POOL_PROTOCOL.Acquire().
+  The service in the pool is freed when it is not used by anyone.
+
+  @param[in]   This                      Pointer to EDKII_REDFISH_SERVICE_POOL_PROTOCOL instance.
+  @param[in]   RedfishConfigServiceInfo  Redfish service information given to Acquire().
+
+  @retval EFI_SUCCESS              The session is released.
+  @retval EFI_INVALID_PARAMETER    RedfishConfigServiceInfo is NULL.
+  @retval EFI_NOT_FOUND            There is no session of RedfishConfigServiceInfo in the pool.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishServicePoolRelease (
+  IN  EDKII_REDFISH_SERVICE_POOL_PROTOCOL  *This,
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION   *RedfishConfigServiceInfo
+  )
+{
+  EFI_TPL                            OldTpl;
+  REDFISH_SERVICE_POOL_PRIVATE_DATA  *Private;
+  REDFISH_SERVICE_POOL_ENTRY         *Entry;
+
+  if (This == NULL || RedfishConfigServiceInfo == NULL || RedfishConfigServiceInfo->RedfishServiceLocation == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Private = REDFISH_SERVICE_POOL_PRIVATE_FROM_THIS (This);
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  Entry  = RedfishServicePoolFindByInfo (Private, RedfishConfigServiceInfo);
+  if (Entry == NULL) {
+    gBS->RestoreTPL (OldTpl);
+    return EFI_NOT_FOUND;
+  }
+
+  ASSERT (Entry->RefCount > 0);
+  Entry->RefCount--;
+  if (Entry->RefCount > 0) {
+    gBS->RestoreTPL (OldTpl);
+    return EFI_SUCCESS;
+  }
+
+  RemoveEntryList (&Entry->List);
+  gBS->RestoreTPL (OldTpl);
+
+  DEBUG ((REDFISH_DEBUG_TRACE, "%a, Redfish service for %s is freed\n", __FUNCTION__, Entry->Location));
+  RedfishServicePoolFreeEntry (Entry);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Unloads an image.
+
+  @param[in]  ImageHandle           Handle that identifies the image to be unloaded.
+
+  @retval EFI_SUCCESS           The image has been unloaded.
+  @retval EFI_INVALID_PARAMETER ImageHandle is not a valid image handle.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishServicePoolDriverUnload (
+  IN EFI_HANDLE  ImageHandle
+  )
+{
+  EFI_STATUS                  Status;
+  EFI_TPL                     OldTpl;
+  LIST_ENTRY                  *Node;
+  REDFISH_SERVICE_POOL_ENTRY  *Entry;
+
+  if (mRedfishServicePoolPrivate != NULL) {
+
+    Status = gBS->UninstallProtocolInterface (
+                    mRedfishServicePoolPrivate->ImageHandle,
+                    &gEdkIIRedfishServicePoolProtocolGuid,
+                    (VOID*)&mRedfishServicePoolPrivate->Protocol
+                    );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a, can not uninstall gEdkIIRedfishServicePoolProtocolGuid: %r\n", __FUNCTION__, Status));
+      ASSERT (FALSE);
+    }
+
+    OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+    while (!IsListEmpty (&mRedfishServicePoolPrivate->ServiceList)) {
+      Node  = GetFirstNode (&mRedfishServicePoolPrivate->ServiceList);
+      Entry = REDFISH_SERVICE_POOL_ENTRY_FROM_LIST (Node);
+      RemoveEntryList (Node);
+      RedfishServicePoolFreeEntry (Entry);
+    }
+
+    gBS->RestoreTPL (OldTpl);
+
+    FreePool (mRedfishServicePoolPrivate);
+    mRedfishServicePoolPrivate = NULL;
+  }
+
+  return EFI_SUCCESS;
+}
+
+//
+// EDKII_REDFISH_SERVICE_POOL_PROTOCOL.
+//
+EDKII_REDFISH_SERVICE_POOL_PROTOCOL mRedfishServicePoolProtocol = {
+  RedfishServicePoolAcquire,
+  RedfishServicePoolRelease
+};
+
+/**
+  This is the declaration of an EFI image entry point. This entry point is
+  the same for UEFI Applications, UEFI OS Loaders, and UEFI Drivers including
+  both device drivers and bus drivers.
+
+  @param[in]  ImageHandle       The firmware allocated handle for the UEFI image.
+  @param[in]  SystemTable       A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS           The operation completed successfully.
+  @retval Others                An unexpected error occurred.
+**/
+EFI_STATUS
+EFIAPI
+RedfishServicePoolDriverEntryPoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS    Status;
+
+  mRedfishServicePoolPrivate = AllocateZeroPool (sizeof (REDFISH_SERVICE_POOL_PRIVATE_DATA));
+  if (mRedfishServicePoolPrivate == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  InitializeListHead (&mRedfishServicePoolPrivate->ServiceList);
+  mRedfishServicePoolPrivate->ImageHandle = ImageHandle;
+  CopyMem (&mRedfishServicePoolPrivate->Protocol, &mRedfishServicePoolProtocol, sizeof (EDKII_REDFISH_SERVICE_POOL_PROTOCOL));
+
+  Status = gBS->InstallProtocolInterface (
+                  &ImageHandle,
+                  &gEdkIIRedfishServicePoolProtocolGuid,
+                  EFI_NATIVE_INTERFACE,
+                  (VOID*)&mRedfishServicePoolPrivate->Protocol
+                  );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, can not install gEdkIIRedfishServicePoolProtocolGuid: %r\n", __FUNCTION__, Status));
+    ASSERT (FALSE);
+    FreePool (mRedfishServicePoolPrivate);
+    mRedfishServicePoolPrivate = NULL;
+  }
+
+  return Status;
+}
@@ -0,0 +1,58 @@
+/** @file
+  Common header file for RedfishServicePoolDxe driver.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef REDFISH_SERVICE_POOL_DXE_H_
+#define REDFISH_SERVICE_POOL_DXE_H_
+
+#include <Uefi.h>
+#include <RedfishBase.h>
+
+//
+// Libraries
+//
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/RedfishLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiDriverEntryPoint.h>
+#include <Library/UefiLib.h>
+
+#include <Protocol/EdkIIRedfishServicePoolProtocol.h>
+
+//
+// Definition of REDFISH_SERVICE_POOL_ENTRY. The service information it is
+// created with is copied, as the caller may free its own copy. Service is
+// used in this image only, its session token is what is shared.
+//
+typedef struct {
+  LIST_ENTRY        List;
+  EFI_HANDLE        RestExHandle;
+  UINTN             Version;
+  CHAR16            *Location;
+  BOOLEAN           UseHttps;
+  REDFISH_SERVICE   Service;
+  UINTN             RefCount;
+} REDFISH_SERVICE_POOL_ENTRY;
+
+#define REDFISH_SERVICE_POOL_ENTRY_FROM_LIST(a)  BASE_CR (a, REDFISH_SERVICE_POOL_ENTRY, List)
+
+//
+// Definition of REDFISH_SERVICE_POOL_PRIVATE_DATA
+//
+typedef struct {
+  EFI_HANDLE                            ImageHandle;
+  LIST_ENTRY                            ServiceList;
+  EDKII_REDFISH_SERVICE_POOL_PROTOCOL   Protocol;
+} REDFISH_SERVICE_POOL_PRIVATE_DATA;
+
+#define REDFISH_SERVICE_POOL_PRIVATE_FROM_THIS(a)  BASE_CR (a, REDFISH_SERVICE_POOL_PRIVATE_DATA, Protocol)
+
+#endif
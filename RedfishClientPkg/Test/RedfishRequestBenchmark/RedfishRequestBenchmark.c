@@ -0,0 +1,1060 @@
+/** @file
+  Host based benchmark of the Redfish client request path.
+
+  An in-memory EFI_REST_EX_PROTOCOL replays the responses of a Redfish
+  mockup, such as SimpleOcpServerV1 of Redfish-Profile-Simulator. The Bios
+  feature driver runs on it as built for the platform: BiosDxe and its Common
+  code, RedfishLib, the Bios converter of ConverterLib, RedfishETagDxe and
+  RedfishConfigLangMapDxe. The UEFI services, HII configuration and variables
+  under them are mocks of RedfishRequestBenchmarkMock.c.
+
+  One flow is what the feature core does on each boot: signal ready to
+  provisioning, prefetch and start the operation on the BIOS resource of each
+  system, and signal after provisioning. The HII configuration is seeded from
+  the mockup, with the pending settings applied, so the driver consumes the
+  settings and provisions the BIOS attributes which differ.
+
+  The benchmark reports round trips, bytes, HII and variable accesses and
+  time of each flow. The latency of the Redfish service is not slept, it is
+  added per round trip to the measured time.
+
+  Usage: RedfishRequestBenchmark [MockupDirectory [LatencyMs [gzip]]]
+
+  The mockup directory defaults to SimpleOcpServerV1 under $WORKSPACE. The
+  tests are skipped when it is not found.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishRequestBenchmark.h"
+
+#include <RedfishResourceCommon.h>
+#include <IndustryStandard/Http11.h>
+#include <Library/JsonLib.h>
+#include <Library/RedfishContentCodingLib.h>
+#include <Library/RedfishCrtLib.h>
+#include <Library/RedfishEventLib.h>
+#include <Library/UnitTestLib.h>
+
+#define UNIT_TEST_APP_NAME     "Redfish Request Benchmark"
+#define UNIT_TEST_APP_VERSION  "2.0"
+
+#define DEFAULT_MOCKUP_DIRECTORY  "/RedfishClientPkg/Tools/Redfish-Profile-Simulator/MockupData/SimpleOcpServerV1"
+#define DEFAULT_LATENCY_MS        5
+#define MOCKUP_INDEX_FILE         "/index.json"
+#define MOCKUP_READ_SIZE          0x1000
+#define MOCKUP_URI_LENGTH         256
+#define MOCKUP_SYSTEM_MAX         16
+#define MOCKUP_ETAG               "W/\"benchmark\""
+#define MOCKUP_SCHEMA_TYPE        "#Bios.v1_0_9."
+#define MOCKUP_SETTINGS_TYPE      "#Bios.v1_0_2."
+#define SERVICE_LOCATION          L"localhost"
+#define SERVICE_ROOT_URI          "/redfish/v1"
+#define SYSTEMS_URI               "/redfish/v1/Systems"
+#define BIOS_ATTRIBUTES           "Attributes"
+#define BIOS_CONFIG_LANG_FORMAT   L"/Bios/Attributes/%a"
+#define SYSTEM_CONFIG_LANG        L"/Systems/{%d}"
+#define SYSTEM_BIOS_URI           L"Systems/{%d}/Bios"
+#define SYSTEM_URI                L"Systems/{%d}"
+#define BIOS_PROPERTY             L"Bios"
+#define BENCHMARK_SECONDS         2
+
+///
+/// Response of one mockup resource, loaded on its first request.
+///
+typedef struct {
+  LIST_ENTRY    Link;
+  CHAR8         *Uri;
+  VOID          *Body;
+  UINTN         BodyLength;
+  VOID          *EncodedBody;
+  UINTN         EncodedBodyLength;
+} MOCKUP_RESOURCE;
+
+///
+/// Entry points and constructors of the modules under benchmark. A host
+/// application runs none of them, the benchmark calls them in the order of
+/// the platform.
+///
+EFI_STATUS
+EFIAPI
+RedfishETagDriverEntryPoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  );
+
+EFI_STATUS
+EFIAPI
+RedfishConfigLangMapDriverEntryPoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  );
+
+EFI_STATUS
+EFIAPI
+RedfishPlatformConfigLibConstructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  );
+
+EFI_STATUS
+EFIAPI
+RedfishFeatureUtilityLibConstructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  );
+
+EFI_STATUS
+EFIAPI
+RedfishResourceConfigConstructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  );
+
+EFI_STATUS
+EFIAPI
+RedfishVersionLibConstructor (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  );
+
+EFI_STATUS
+EFIAPI
+RedfishBios_V1_0_9EntryPoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  );
+
+EFI_STATUS
+EFIAPI
+RedfishResourceEntryPoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  );
+
+EFI_STATUS
+EFIAPI
+RedfishResourceUnload (
+  IN EFI_HANDLE  ImageHandle
+  );
+
+extern REDFISH_RESOURCE_COMMON_PRIVATE  *mRedfishResourcePrivate;
+
+BENCHMARK_STATISTICS  mStatistics;
+
+STATIC CHAR8       mMockupDirectory[MOCKUP_URI_LENGTH];
+STATIC UINTN       mLatencyMs       = DEFAULT_LATENCY_MS;
+STATIC BOOLEAN     mEncodeResponses = FALSE;
+STATIC LIST_ENTRY  mMockupResources = INITIALIZE_LIST_HEAD_VARIABLE (mMockupResources);
+STATIC EFI_HANDLE  mImageHandle;
+STATIC EFI_HANDLE  mRestExHandle;
+STATIC BOOLEAN     mBenchmarkReady;
+STATIC UINTN       mSystemCount;
+STATIC UINTN       mSystemIds[MOCKUP_SYSTEM_MAX];
+
+STATIC EFI_HTTP_HEADER  mJsonResponseHeaders[] = {
+  { HTTP_HEADER_CONTENT_TYPE,     HTTP_CONTENT_TYPE_APP_JSON     },
+  { HTTP_HEADER_CONTENT_ENCODING, HTTP_CONTENT_ENCODING_IDENTITY },
+  { HTTP_HEADER_ETAG,             MOCKUP_ETAG                    }
+};
+
+STATIC EFI_HTTP_HEADER  mEncodedResponseHeaders[] = {
+  { HTTP_HEADER_CONTENT_TYPE,     HTTP_CONTENT_TYPE_APP_JSON },
+  { HTTP_HEADER_CONTENT_ENCODING, HTTP_CONTENT_ENCODING_GZIP },
+  { HTTP_HEADER_ETAG,             MOCKUP_ETAG                }
+};
+
+STATIC EFI_HTTP_HEADER  mPatchResponseHeaders[] = {
+  { HTTP_HEADER_CONTENT_TYPE, HTTP_CONTENT_TYPE_APP_JSON },
+  { HTTP_HEADER_ETAG,         MOCKUP_ETAG                }
+};
+
+/**
+  Read the whole file into a buffer allocated from pool.
+
+  @param[in]   FileName  Name of the file.
+  @param[out]  Length    Length of the file.
+
+  @retval Buffer of the file, NULL when it can't be read.
+**/
+STATIC
+VOID *
+ReadMockupFile (
+  IN  CHAR8  *FileName,
+  OUT UINTN  *Length
+  )
+{
+  FILE   *File;
+  UINT8  *Buffer;
+  UINTN  Size;
+  UINTN  Read;
+
+  File = fopen (FileName, "rb");
+  if (File == NULL) {
+    return NULL;
+  }
+
+  Buffer  = NULL;
+  Size    = 0;
+  *Length = 0;
+  do {
+    if (*Length == Size) {
+      Buffer = ReallocatePool (Size, Size + MOCKUP_READ_SIZE, Buffer);
+      if (Buffer == NULL) {
+        break;
+      }
+
+      Size += MOCKUP_READ_SIZE;
+    }
+
+    Read     = fread (Buffer + *Length, 1, Size - *Length, File);
+    *Length += Read;
+  } while (Read != 0);
+
+  fclose (File);
+  return Buffer;
+}
+
+/**
+  The BIOS settings objects of the mockup are of an older schema version
+  than the BIOS resources. Rewrite their "@odata.type" so the Bios v1_0_9
+  converter takes them, as it would on a service of one schema version.
+
+  @param[in, out]  Body        The body of the resource.
+  @param[in]       BodyLength  Length of Body.
+**/
+STATIC
+VOID
+RewriteSchemaVersion (
+  IN OUT CHAR8  *Body,
+  IN     UINTN  BodyLength
+  )
+{
+  UINTN  Index;
+  UINTN  Length;
+
+  Length = AsciiStrLen (MOCKUP_SETTINGS_TYPE);
+  for (Index = 0; Index + Length <= BodyLength; Index++) {
+    if (CompareMem (Body + Index, MOCKUP_SETTINGS_TYPE, Length) == 0) {
+      CopyMem (Body + Index, MOCKUP_SCHEMA_TYPE, Length);
+    }
+  }
+}
+
+/**
+  Find the mockup resource of Uri, and load it when it is requested the
+  first time.
+
+  @param[in]  Uri  The URI, with or without the trailing slash.
+
+  @retval The mockup resource, NULL when the mockup has no such resource.
+**/
+STATIC
+MOCKUP_RESOURCE *
+FindMockupResource (
+  IN  CONST CHAR8  *Uri
+  )
+{
+  EFI_STATUS       Status;
+  LIST_ENTRY       *Entry;
+  MOCKUP_RESOURCE  *Resource;
+  CHAR8            FileName[MOCKUP_URI_LENGTH * 2];
+  UINTN            Length;
+
+  Length = AsciiStrLen (Uri);
+  while ((Length > 1) && (Uri[Length - 1] == '/')) {
+    Length--;
+  }
+
+  for (Entry = GetFirstNode (&mMockupResources); !IsNull (&mMockupResources, Entry); Entry = GetNextNode (&mMockupResources, Entry)) {
+    Resource = BASE_CR (Entry, MOCKUP_RESOURCE, Link);
+    if ((AsciiStrnCmp (Resource->Uri, Uri, Length) == 0) && (Resource->Uri[Length] == '\0')) {
+      return Resource;
+    }
+  }
+
+  Resource = AllocateZeroPool (sizeof (MOCKUP_RESOURCE));
+  if (Resource == NULL) {
+    return NULL;
+  }
+
+  Resource->Uri = AllocateCopyPool (Length + 1, Uri);
+  if (Resource->Uri == NULL) {
+    FreePool (Resource);
+    return NULL;
+  }
+
+  Resource->Uri[Length] = '\0';
+  AsciiSPrint (FileName, sizeof (FileName), "%a%a%a", mMockupDirectory, Resource->Uri, MOCKUP_INDEX_FILE);
+  Resource->Body = ReadMockupFile (FileName, &Resource->BodyLength);
+  if (Resource->Body == NULL) {
+    FreePool (Resource->Uri);
+    FreePool (Resource);
+    return NULL;
+  }
+
+  RewriteSchemaVersion (Resource->Body, Resource->BodyLength);
+
+  //
+  // The service encodes the response once, as a BMC would keep it.
+  //
+  Status = RedfishContentEncode (
+             HTTP_CONTENT_ENCODING_GZIP,
+             Resource->Body,
+             Resource->BodyLength,
+             &Resource->EncodedBody,
+             &Resource->EncodedBodyLength
+             );
+  if (EFI_ERROR (Status)) {
+    Resource->EncodedBody = NULL;
+  }
+
+  InsertTailList (&mMockupResources, &Resource->Link);
+  return Resource;
+}
+
+/**
+  Free all mockup resources loaded.
+**/
+STATIC
+VOID
+FreeMockupResources (
+  VOID
+  )
+{
+  MOCKUP_RESOURCE  *Resource;
+
+  while (!IsListEmpty (&mMockupResources)) {
+    Resource = BASE_CR (GetFirstNode (&mMockupResources), MOCKUP_RESOURCE, Link);
+    RemoveEntryList (&Resource->Link);
+    FreePool (Resource->Uri);
+    FreePool (Resource->Body);
+    if (Resource->EncodedBody != NULL) {
+      FreePool (Resource->EncodedBody);
+    }
+
+    FreePool (Resource);
+  }
+}
+
+/**
+  Load the JSON payload of a mockup resource.
+
+  @param[in]  Uri  The URI of the resource.
+
+  @retval The JSON payload, freed by caller. NULL when the mockup has no such
+          resource.
+**/
+STATIC
+EDKII_JSON_VALUE
+LoadMockupPayload (
+  IN  CONST CHAR8  *Uri
+  )
+{
+  MOCKUP_RESOURCE  *Resource;
+
+  if (Uri == NULL) {
+    return NULL;
+  }
+
+  Resource = FindMockupResource (Uri);
+  if (Resource == NULL) {
+    return NULL;
+  }
+
+  return JsonLoadBuffer (Resource->Body, Resource->BodyLength, 0, NULL);
+}
+
+/**
+  Find the value of the header in an HTTP message.
+
+  @param[in]  Message    The HTTP message.
+  @param[in]  FieldName  Name of the header.
+
+  @retval Value of the header, NULL when it is not present.
+**/
+STATIC
+CHAR8 *
+FindHeader (
+  IN  EFI_HTTP_MESSAGE  *Message,
+  IN  CHAR8             *FieldName
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < Message->HeaderCount; Index++) {
+    if (AsciiStriCmp (Message->Headers[Index].FieldName, FieldName) == 0) {
+      return Message->Headers[Index].FieldValue;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Replay the response of the mockup to a request. Only GET and PATCH are
+  supported, PATCH is acknowledged without changing the mockup. The response
+  data, body and header array are allocated from pool and freed by the
+  caller, the header strings are constant.
+
+  @param[in]   This         The in-memory REST EX protocol.
+  @param[in]   RequestMsg   The HTTP request.
+  @param[out]  ResponseMsg  The HTTP response.
+
+  @retval EFI_SUCCESS            A response is returned.
+  @retval EFI_INVALID_PARAMETER  The request is not valid.
+  @retval EFI_OUT_OF_RESOURCES   There is not enough memory.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockupSendReceive (
+  IN  EFI_REST_EX_PROTOCOL  *This,
+  IN  EFI_HTTP_MESSAGE      *RequestMsg,
+  OUT EFI_HTTP_MESSAGE      *ResponseMsg
+  )
+{
+  MOCKUP_RESOURCE       *Resource;
+  EFI_HTTP_STATUS_CODE  StatusCode;
+  EFI_HTTP_HEADER       *Headers;
+  UINTN                 HeadersSize;
+  CHAR8                 Url[MOCKUP_URI_LENGTH];
+  CHAR8                 *Uri;
+  CHAR8                 *Query;
+  CHAR8                 *AcceptEncoding;
+  BOOLEAN               Encoded;
+
+  if ((RequestMsg == NULL) || (RequestMsg->Data.Request == NULL) || (ResponseMsg == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (EFI_ERROR (UnicodeStrToAsciiStrS (RequestMsg->Data.Request->Url, Url, sizeof (Url)))) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Drop "http://host" and the query, such as $expand.
+  //
+  Uri = AsciiStrStr (Url, "://");
+  if (Uri != NULL) {
+    Uri = AsciiStrStr (Uri + 3, "/");
+  }
+
+  if (Uri == NULL) {
+    Uri = Url;
+  }
+
+  Query = AsciiStrStr (Uri, "?");
+  if (Query != NULL) {
+    *Query = '\0';
+  }
+
+  mStatistics.RoundTrips++;
+  mStatistics.BytesOut += RequestMsg->BodyLength;
+  ZeroMem (ResponseMsg, sizeof (EFI_HTTP_MESSAGE));
+  ResponseMsg->Data.Response = AllocateZeroPool (sizeof (EFI_HTTP_RESPONSE_DATA));
+  if (ResponseMsg->Data.Response == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Headers     = NULL;
+  HeadersSize = 0;
+  Resource    = FindMockupResource (Uri);
+  if (Resource == NULL) {
+    StatusCode = HTTP_STATUS_404_NOT_FOUND;
+    mStatistics.Errors++;
+  } else if (RequestMsg->Data.Request->Method == HttpMethodPatch) {
+    //
+    // The client reads the ETag of the provisioned resource from the reply.
+    //
+    StatusCode  = HTTP_STATUS_200_OK;
+    Headers     = mPatchResponseHeaders;
+    HeadersSize = sizeof (mPatchResponseHeaders);
+    mStatistics.Patches++;
+  } else if (RequestMsg->Data.Request->Method == HttpMethodGet) {
+    StatusCode     = HTTP_STATUS_200_OK;
+    AcceptEncoding = FindHeader (RequestMsg, HTTP_HEADER_ACCEPT_ENCODING);
+    Encoded        = (BOOLEAN)(mEncodeResponses && (Resource->EncodedBody != NULL) &&
+                               (AcceptEncoding != NULL) && (AsciiStrStr (AcceptEncoding, HTTP_CONTENT_ENCODING_GZIP) != NULL));
+    if (Encoded) {
+      ResponseMsg->Body       = AllocateCopyPool (Resource->EncodedBodyLength, Resource->EncodedBody);
+      ResponseMsg->BodyLength = Resource->EncodedBodyLength;
+      Headers                 = mEncodedResponseHeaders;
+      HeadersSize             = sizeof (mEncodedResponseHeaders);
+    } else {
+      ResponseMsg->Body       = AllocateCopyPool (Resource->BodyLength, Resource->Body);
+      ResponseMsg->BodyLength = Resource->BodyLength;
+      Headers                 = mJsonResponseHeaders;
+      HeadersSize             = sizeof (mJsonResponseHeaders);
+    }
+
+    if (ResponseMsg->Body == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    mStatistics.BytesIn += ResponseMsg->BodyLength;
+    mStatistics.Gets++;
+  } else {
+    StatusCode = HTTP_STATUS_405_METHOD_NOT_ALLOWED;
+    mStatistics.Errors++;
+  }
+
+  if (Headers != NULL) {
+    ResponseMsg->Headers = AllocateCopyPool (HeadersSize, Headers);
+    if (ResponseMsg->Headers == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    ResponseMsg->HeaderCount = HeadersSize / sizeof (EFI_HTTP_HEADER);
+  }
+
+  ResponseMsg->Data.Response->StatusCode = StatusCode;
+  return EFI_SUCCESS;
+}
+
+/**
+  Replay the response of the mockup to a request without blocking. The
+  response is ready when this function returns, and the event of the token
+  is signaled.
+
+  @param[in]  This                   The in-memory REST EX protocol.
+  @param[in]  RequestMessage         The HTTP request.
+  @param[in]  RestExToken            The token to receive the response.
+  @param[in]  TimeOutInMilliSeconds  Not used.
+
+  @retval EFI_SUCCESS            The request is sent.
+  @retval EFI_INVALID_PARAMETER  The request is not valid.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockupAsyncSendReceive (
+  IN  EFI_REST_EX_PROTOCOL  *This,
+  IN  EFI_HTTP_MESSAGE      *RequestMessage OPTIONAL,
+  IN  EFI_REST_EX_TOKEN     *RestExToken,
+  IN  UINTN                 *TimeOutInMilliSeconds OPTIONAL
+  )
+{
+  if ((RestExToken == NULL) || (RestExToken->Event == NULL) || (RestExToken->ResponseMessage == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  RestExToken->Status = MockupSendReceive (This, RequestMessage, RestExToken->ResponseMessage);
+  gBS->SignalEvent (RestExToken->Event);
+  return EFI_SUCCESS;
+}
+
+STATIC EFI_REST_EX_PROTOCOL  mMockupRestEx = {
+  MockupSendReceive,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  MockupAsyncSendReceive,
+  NULL
+};
+
+/**
+  Seed the HII configuration from the BIOS attributes of the first system
+  with a BIOS resource. The values pending in its settings object are the
+  values on the platform, as if they were applied on the last boot. The
+  attributes with no value are left out.
+
+  @param[in]  SystemUri  URI of the system.
+
+  @retval EFI_SUCCESS    The HII configuration is seeded.
+  @retval EFI_NOT_FOUND  The mockup has no BIOS attributes of the system.
+  @retval Others         Failed to seed the HII configuration.
+**/
+STATIC
+EFI_STATUS
+SeedPlatformConfig (
+  IN  CONST CHAR8  *SystemUri
+  )
+{
+  EFI_STATUS           Status;
+  EDKII_JSON_VALUE     Bios;
+  EDKII_JSON_VALUE     Settings;
+  EDKII_JSON_VALUE     Attributes;
+  EDKII_JSON_VALUE     PendingAttributes;
+  EDKII_JSON_VALUE     Attribute;
+  EDKII_JSON_VALUE     PendingAttribute;
+  CHAR8                **Keys;
+  UINTN                KeyCount;
+  UINTN                Index;
+  CHAR8                Uri[MOCKUP_URI_LENGTH];
+  CHAR16               ConfigureLang[MOCKUP_URI_LENGTH];
+  EDKII_REDFISH_VALUE  Value;
+
+  AsciiSPrint (Uri, sizeof (Uri), "%a/%s", SystemUri, BIOS_PROPERTY);
+  Bios       = LoadMockupPayload (Uri);
+  Attributes = JsonObjectGetValue (JsonValueGetObject (Bios), BIOS_ATTRIBUTES);
+  Keys       = JsonObjectGetKeys (JsonValueGetObject (Attributes), &KeyCount);
+  if (Keys == NULL) {
+    JsonValueFree (Bios);
+    return EFI_NOT_FOUND;
+  }
+
+  Settings = LoadMockupPayload (
+               JsonValueGetAsciiString (
+                 JsonObjectGetValue (
+                   JsonValueGetObject (JsonObjectGetValue (JsonValueGetObject (JsonObjectGetValue (JsonValueGetObject (Bios), "@Redfish.Settings")), "SettingsObject")),
+                   "@odata.id"
+                   )
+                 )
+               );
+  PendingAttributes = JsonObjectGetValue (JsonValueGetObject (Settings), BIOS_ATTRIBUTES);
+
+  Status = EFI_SUCCESS;
+  for (Index = 0; Index < KeyCount && !EFI_ERROR (Status); Index++) {
+    Attribute        = JsonObjectGetValue (JsonValueGetObject (Attributes), Keys[Index]);
+    PendingAttribute = JsonObjectGetValue (JsonValueGetObject (PendingAttributes), Keys[Index]);
+    if ((PendingAttribute != NULL) && !JsonValueIsNull (PendingAttribute) &&
+        !(JsonValueIsString (PendingAttribute) && (JsonValueGetAsciiString (PendingAttribute)[0] == '\0')))
+    {
+      Attribute = PendingAttribute;
+    }
+
+    ZeroMem (&Value, sizeof (Value));
+    if (JsonValueIsInteger (Attribute)) {
+      Value.Type          = REDFISH_VALUE_TYPE_INTEGER;
+      Value.Value.Integer = JsonValueGetInteger (Attribute);
+    } else if (JsonValueIsBoolean (Attribute)) {
+      Value.Type          = REDFISH_VALUE_TYPE_BOOLEAN;
+      Value.Value.Boolean = JsonValueGetBoolean (Attribute);
+    } else if (JsonValueIsString (Attribute) && (JsonValueGetAsciiString (Attribute)[0] != '\0')) {
+      Value.Type         = REDFISH_VALUE_TYPE_STRING;
+      Value.Value.Buffer = (CHAR8 *)JsonValueGetAsciiString (Attribute);
+    } else {
+      continue;
+    }
+
+    UnicodeSPrint (ConfigureLang, sizeof (ConfigureLang), BIOS_CONFIG_LANG_FORMAT, Keys[Index]);
+    Status = MockAddPlatformConfigValue (ConfigureLang, &Value);
+  }
+
+  FreePool (Keys);
+  JsonValueFree (Settings);
+  JsonValueFree (Bios);
+  return Status;
+}
+
+/**
+  Find the systems of the mockup with a BIOS resource. Their configure
+  languages "/Systems/{N}" are mapped to their URIs, as the ComputerSystem
+  collection driver does, and the HII configuration is seeded from the first
+  of them.
+
+  @retval EFI_SUCCESS    The systems are found.
+  @retval EFI_NOT_FOUND  The mockup has no system with a BIOS resource.
+  @retval Others         Failed to map the systems.
+**/
+STATIC
+EFI_STATUS
+SetupSystems (
+  VOID
+  )
+{
+  EFI_STATUS        Status;
+  EDKII_JSON_VALUE  Systems;
+  EDKII_JSON_VALUE  Members;
+  CONST CHAR8       *SystemUri;
+  CHAR8             Uri[MOCKUP_URI_LENGTH];
+  CHAR16            ConfigureLang[MOCKUP_URI_LENGTH];
+  CHAR16            SystemUriString[MOCKUP_URI_LENGTH];
+  UINTN             Index;
+
+  Status       = EFI_NOT_FOUND;
+  mSystemCount = 0;
+  Systems      = LoadMockupPayload (SYSTEMS_URI);
+  Members      = JsonObjectGetValue (JsonValueGetObject (Systems), "Members");
+  for (Index = 0; Index < JsonArrayCount (Members) && mSystemCount < MOCKUP_SYSTEM_MAX; Index++) {
+    SystemUri = JsonValueGetAsciiString (JsonObjectGetValue (JsonValueGetObject (JsonArrayGetValue (Members, Index)), "@odata.id"));
+    if (SystemUri == NULL) {
+      continue;
+    }
+
+    //
+    // The feature core only dispatches the resources the service has.
+    //
+    AsciiSPrint (Uri, sizeof (Uri), "%a/%s", SystemUri, BIOS_PROPERTY);
+    if (FindMockupResource (Uri) == NULL) {
+      continue;
+    }
+
+    if (mSystemCount == 0) {
+      Status = SeedPlatformConfig (SystemUri);
+      if (EFI_ERROR (Status)) {
+        break;
+      }
+    }
+
+    mSystemIds[mSystemCount++] = Index + 1;
+    UnicodeSPrint (ConfigureLang, sizeof (ConfigureLang), SYSTEM_CONFIG_LANG, Index + 1);
+    AsciiStrToUnicodeStrS (SystemUri, SystemUriString, ARRAY_SIZE (SystemUriString));
+    Status = RedfisSetRedfishUri (ConfigureLang, SystemUriString);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+  }
+
+  JsonValueFree (Systems);
+  return Status;
+}
+
+/**
+  Install the mockup REST EX protocol, run the entry points and
+  constructors of the modules under benchmark, and start the Bios feature
+  driver on the mockup service.
+
+  @retval EFI_SUCCESS  The feature driver is ready.
+  @retval Others       The mockup is not found or the setup failed.
+**/
+STATIC
+EFI_STATUS
+SetupFeatureDriver (
+  VOID
+  )
+{
+  EFI_STATUS                          Status;
+  REDFISH_CONFIG_SERVICE_INFORMATION  ServiceInfo;
+
+  if (FindMockupResource (SERVICE_ROOT_URI) == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  //
+  // The handle of this image is where the drivers publish their protocols.
+  //
+  mImageHandle = NULL;
+  Status       = gBS->InstallProtocolInterface (&mImageHandle, &gEfiCallerIdGuid, EFI_NATIVE_INTERFACE, NULL);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  mRestExHandle = NULL;
+  Status        = gBS->InstallProtocolInterface (&mRestExHandle, &gEfiRestExProtocolGuid, EFI_NATIVE_INTERFACE, &mMockupRestEx);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = MockInstallProtocols ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  RedfishETagDriverEntryPoint (mImageHandle, NULL);
+  RedfishConfigLangMapDriverEntryPoint (mImageHandle, NULL);
+  RedfishPlatformConfigLibConstructor (mImageHandle, NULL);
+  RedfishFeatureUtilityLibConstructor (mImageHandle, NULL);
+  RedfishResourceConfigConstructor (mImageHandle, NULL);
+  RedfishVersionLibConstructor (mImageHandle, NULL);
+  RedfishBios_V1_0_9EntryPoint (mImageHandle, NULL);
+  Status = RedfishResourceEntryPoint (mImageHandle, NULL);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = SetupSystems ();
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  ZeroMem (&ServiceInfo, sizeof (ServiceInfo));
+  ServiceInfo.RedfishServiceRestExHandle = mRestExHandle;
+  ServiceInfo.RedfishServiceLocation     = SERVICE_LOCATION;
+  return mRedfishResourcePrivate->ConfigHandler.Init (&mRedfishResourcePrivate->ConfigHandler, &ServiceInfo);
+}
+
+/**
+  Run the Bios feature driver as the feature core does on one boot: each
+  BIOS resource is prefetched, then consumed or provisioned.
+**/
+STATIC
+VOID
+RunFeatureFlow (
+  VOID
+  )
+{
+  EFI_STATUS                     Status;
+  RESOURCE_INFORMATION_EXCHANGE  InformationExchange;
+  CHAR16                         FullUri[MOCKUP_URI_LENGTH];
+  CHAR16                         ParentUri[MOCKUP_URI_LENGTH];
+  UINTN                          Index;
+
+  SignalReadyToProvisioningEvent ();
+
+  for (Index = 0; Index < mSystemCount; Index++) {
+    UnicodeSPrint (FullUri, sizeof (FullUri), SYSTEM_BIOS_URI, mSystemIds[Index]);
+    UnicodeSPrint (ParentUri, sizeof (ParentUri), SYSTEM_URI, mSystemIds[Index]);
+    ZeroMem (&InformationExchange, sizeof (InformationExchange));
+    InformationExchange.SendInformation.FullUri      = FullUri;
+    InformationExchange.SendInformation.ParentUri    = ParentUri;
+    InformationExchange.SendInformation.PropertyName = BIOS_PROPERTY;
+
+    Status = MockRunFeatureCallback (CallbackActionPrefetch, &InformationExchange);
+    if (EFI_ERROR (Status)) {
+      mStatistics.Errors++;
+    }
+
+    //
+    // EFI_NOT_FOUND is nothing to provision, the resource is up to date.
+    //
+    Status = MockRunFeatureCallback (CallbackActionStartOperation, &InformationExchange);
+    if (EFI_ERROR (Status) && (Status != EFI_NOT_FOUND)) {
+      mStatistics.Errors++;
+    }
+
+    DestroyConfiglanguageList (&InformationExchange.ReturnedInformation.ConfigureLanguageList);
+  }
+
+  SignalAfterProvisioningEvent ();
+  RedfishFlushHttpCache (NULL);
+}
+
+/**
+  Set up the feature driver on the mockup once for all tests.
+**/
+STATIC
+VOID
+EFIAPI
+BenchmarkSetup (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+
+  Status = SetupFeatureDriver ();
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, no Redfish mockup in %a: %r\n", __FUNCTION__, mMockupDirectory, Status));
+    return;
+  }
+
+  mBenchmarkReady = TRUE;
+}
+
+/**
+  Stop the feature driver and free the mocks.
+**/
+STATIC
+VOID
+EFIAPI
+BenchmarkTeardown (
+  VOID
+  )
+{
+  if (mRedfishResourcePrivate != NULL) {
+    RedfishResourceUnload (mImageHandle);
+  }
+
+  MockCleanup ();
+  FreeMockupResources ();
+  mBenchmarkReady = FALSE;
+}
+
+/**
+  Skip the tests when the mockup is not found.
+
+  @param[in]  Context  Not used.
+
+  @retval UNIT_TEST_PASSED   The mockup is found.
+  @retval UNIT_TEST_SKIPPED  The mockup is not found.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+MockupShouldBeFound (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  if (!mBenchmarkReady) {
+    UT_LOG_WARNING ("No Redfish mockup in %a\n", mMockupDirectory);
+    return UNIT_TEST_SKIPPED;
+  }
+
+  ZeroMem (&mStatistics, sizeof (mStatistics));
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  One flow of the Bios feature driver runs without errors, reads the HII
+  configuration and provisions the attributes which differ.
+
+  @param[in]  Context  Not used.
+
+  @retval UNIT_TEST_PASSED  The test passed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+FeatureFlowShouldSucceed (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  RunFeatureFlow ();
+
+  UT_ASSERT_EQUAL (mStatistics.Errors, 0);
+  UT_ASSERT_NOT_EQUAL (mStatistics.HiiGets, 0);
+  UT_ASSERT_NOT_EQUAL (mStatistics.Patches, 0);
+  UT_ASSERT_EQUAL (mStatistics.RoundTrips, mStatistics.Gets + mStatistics.Patches);
+  UT_LOG_INFO (
+    "One flow: %ld round trips, %ld GET, %ld PATCH, %ld bytes in, %ld bytes out, %ld HII gets, %ld HII sets, %ld variable writes\n",
+    (UINT64)mStatistics.RoundTrips,
+    (UINT64)mStatistics.Gets,
+    (UINT64)mStatistics.Patches,
+    mStatistics.BytesIn,
+    mStatistics.BytesOut,
+    (UINT64)mStatistics.HiiGets,
+    (UINT64)mStatistics.HiiSets,
+    (UINT64)mStatistics.VariableWrites
+    );
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Run the flow for BENCHMARK_SECONDS and report the average flow. The
+  numbers are logged, only the errors are checked.
+
+  time() is the only clock the C runtime mapping of RedfishPkg provides and
+  it counts seconds, so the flows start on a tick.
+
+  @param[in]  Context  Not used.
+
+  @retval UNIT_TEST_PASSED  The test passed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+BenchmarkFeatureFlow (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  time_t  Start;
+  time_t  End;
+  UINT64  Flows;
+  UINT64  FlowMicroseconds;
+  UINT64  LatencyMicroseconds;
+
+  Start = time (NULL);
+  while (time (NULL) == Start) {
+  }
+
+  ZeroMem (&mStatistics, sizeof (mStatistics));
+  End   = time (NULL) + BENCHMARK_SECONDS;
+  Flows = 0;
+  while (time (NULL) < End) {
+    RunFeatureFlow ();
+    Flows++;
+  }
+
+  UT_ASSERT_EQUAL (mStatistics.Errors, 0);
+  UT_ASSERT_NOT_EQUAL (Flows, 0);
+
+  FlowMicroseconds    = (UINT64)BENCHMARK_SECONDS * 1000000 / Flows;
+  LatencyMicroseconds = (UINT64)mStatistics.RoundTrips * mLatencyMs * 1000 / Flows;
+  UT_LOG_INFO (
+    "%ld flows in %d s, responses %a. Per flow: %ld round trips, %ld bytes in, %ld bytes out, %ld HII gets, %ld variable writes, %ld us client time, %ld ms with %ld ms latency\n",
+    Flows,
+    BENCHMARK_SECONDS,
+    mEncodeResponses ? HTTP_CONTENT_ENCODING_GZIP : HTTP_CONTENT_ENCODING_IDENTITY,
+    (UINT64)mStatistics.RoundTrips / Flows,
+    mStatistics.BytesIn / Flows,
+    mStatistics.BytesOut / Flows,
+    (UINT64)mStatistics.HiiGets / Flows,
+    (UINT64)mStatistics.VariableWrites / Flows,
+    FlowMicroseconds,
+    (FlowMicroseconds + LatencyMicroseconds) / 1000,
+    (UINT64)mLatencyMs
+    );
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  Redfish request path and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      RequestTests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  Status = CreateUnitTestSuite (&RequestTests, Framework, "Redfish Request Benchmark", "RedfishRequest", BenchmarkSetup, BenchmarkTeardown);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for Redfish Request Benchmark\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite-----------Description------------------------Name--------Function-------------------Pre--------------------Post---Context
+  //
+  AddTestCase (RequestTests, "Run Bios feature driver",         "Flow",      FeatureFlowShouldSucceed, MockupShouldBeFound, NULL, NULL);
+  AddTestCase (RequestTests, "Benchmark Bios feature driver",   "Benchmark", BenchmarkFeatureFlow,     MockupShouldBeFound, NULL, NULL);
+
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework != NULL) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+
+  @param[in]  Argc  Number of arguments.
+  @param[in]  Argv  Mockup directory, latency in ms and "gzip" to encode
+                    the content.
+
+  @retval  0      All test cases were dispatched.
+  @retval  Other  Failed to initialize the unit tests.
+**/
+INT32
+main (
+  IN INT32  Argc,
+  IN CHAR8  *Argv[]
+  )
+{
+  CHAR8  *Workspace;
+
+  if (Argc > 1) {
+    AsciiStrCpyS (mMockupDirectory, sizeof (mMockupDirectory), Argv[1]);
+  } else {
+    Workspace = getenv ("WORKSPACE");
+    AsciiSPrint (mMockupDirectory, sizeof (mMockupDirectory), "%a%a", (Workspace != NULL) ? Workspace : ".", DEFAULT_MOCKUP_DIRECTORY);
+  }
+
+  if (Argc > 2) {
+    mLatencyMs = AsciiStrDecimalToUintn (Argv[2]);
+  }
+
+  if (Argc > 3) {
+    mEncodeResponses = (BOOLEAN)(AsciiStriCmp (Argv[3], HTTP_CONTENT_ENCODING_GZIP) == 0);
+  }
+
+  return (INT32)UnitTestingEntry ();
+}
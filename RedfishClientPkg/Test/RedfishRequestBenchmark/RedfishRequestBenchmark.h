@@ -0,0 +1,96 @@
+/** @file
+  Definitions shared by the Redfish request benchmark and its mock UEFI
+  services.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef REDFISH_REQUEST_BENCHMARK_H_
+#define REDFISH_REQUEST_BENCHMARK_H_
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
+
+#include <Protocol/EdkIIRedfishFeature.h>
+#include <Protocol/EdkIIRedfishPlatformConfig.h>
+
+///
+/// What the feature driver did, on the wire and on the platform.
+///
+typedef struct {
+  UINTN     RoundTrips;
+  UINTN     Gets;
+  UINTN     Patches;
+  UINTN     Errors;
+  UINT64    BytesIn;
+  UINT64    BytesOut;
+  UINTN     HiiGets;
+  UINTN     HiiSets;
+  UINTN     VariableWrites;
+} BENCHMARK_STATISTICS;
+
+extern BENCHMARK_STATISTICS  mStatistics;
+
+/**
+  Install the fake protocols the feature driver and its libraries consume:
+  REST JSON structure, Redfish platform config, Redfish feature and Redfish
+  service pool.
+
+  @retval EFI_SUCCESS  The protocols are installed.
+  @retval Others       Failed to install the protocols.
+**/
+EFI_STATUS
+MockInstallProtocols (
+  VOID
+  );
+
+/**
+  Add one value to the fake HII configuration of Redfish platform config
+  protocol. The value is copied.
+
+  @param[in]  ConfigureLang  Configure language of the value.
+  @param[in]  Value          The value.
+
+  @retval EFI_SUCCESS           The value is added.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory.
+**/
+EFI_STATUS
+MockAddPlatformConfigValue (
+  IN  EFI_STRING           ConfigureLang,
+  IN  EDKII_REDFISH_VALUE  *Value
+  );
+
+/**
+  Run the callback the feature driver registered to the fake Redfish feature
+  protocol, as the feature core does for each resource.
+
+  @param[in]      Action               The action to take.
+  @param[in, out] InformationExchange  The information of the resource.
+
+  @retval EFI_NOT_READY  No feature driver is registered.
+  @retval Others         Status returned by the feature driver.
+**/
+EFI_STATUS
+MockRunFeatureCallback (
+  IN     FEATURE_CALLBACK_ACTION        Action,
+  IN OUT RESOURCE_INFORMATION_EXCHANGE  *InformationExchange
+  );
+
+/**
+  Free what the mock UEFI services keep: handles, events, variables and the
+  fake HII configuration.
+**/
+VOID
+MockCleanup (
+  VOID
+  );
+
+#endif
@@ -0,0 +1,1641 @@
+/** @file
+  Mock UEFI services of the Redfish request benchmark.
+
+  The boot services keep protocols and events in memory, which is what the
+  feature driver, the Redfish drivers and their libraries need to find each
+  other. The runtime services keep variables in memory. The fake protocols
+  stand for the drivers that are not part of the benchmark: REST JSON
+  structure, Redfish platform config on top of HII, Redfish feature core and
+  Redfish service pool.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishRequestBenchmark.h"
+
+#include <Protocol/RestJsonStructure.h>
+#include <Protocol/EdkIIRedfishServicePoolProtocol.h>
+
+#define MOCK_VARIABLE_MAX        0x40
+#define MOCK_VARIABLE_NAME_SIZE  64
+#define MOCK_CONFIG_VALUE_MAX    0x200
+#define MOCK_SESSION_TOKEN       "benchmark"
+#define MOCK_SUPPORTED_SCHEMA    "x-uefi-redfish-Bios.v1_0_9"
+#define MOCK_PATTERN_ANY         L".*"
+
+///
+/// Protocol interface installed on a handle.
+///
+typedef struct {
+  LIST_ENTRY    Link;
+  EFI_HANDLE    Handle;
+  EFI_GUID      Protocol;
+  VOID          *Interface;
+} MOCK_PROTOCOL_INTERFACE;
+
+///
+/// Event created by the mock boot services.
+///
+typedef struct {
+  LIST_ENTRY          Link;
+  UINT32              Type;
+  EFI_EVENT_NOTIFY    NotifyFunction;
+  VOID                *NotifyContext;
+  BOOLEAN             InGroup;
+  EFI_GUID            EventGroup;
+  BOOLEAN             Signaled;
+} MOCK_EVENT;
+
+///
+/// Variable kept by the mock UEFI variable services.
+///
+typedef struct {
+  BOOLEAN    InUse;
+  CHAR16     Name[MOCK_VARIABLE_NAME_SIZE];
+  EFI_GUID   Guid;
+  UINT32     Attributes;
+  UINTN      DataSize;
+  VOID       *Data;
+} MOCK_VARIABLE;
+
+///
+/// Value of the fake HII configuration.
+///
+typedef struct {
+  EFI_STRING             ConfigureLang;
+  EDKII_REDFISH_VALUE    Value;
+} MOCK_CONFIG_VALUE;
+
+STATIC LIST_ENTRY                        mMockInterfaces = INITIALIZE_LIST_HEAD_VARIABLE (mMockInterfaces);
+STATIC LIST_ENTRY                        mMockEvents     = INITIALIZE_LIST_HEAD_VARIABLE (mMockEvents);
+STATIC UINTN                             mMockHandleCount;
+STATIC EFI_TPL                           mMockTpl = TPL_APPLICATION;
+STATIC MOCK_VARIABLE                     mMockVariables[MOCK_VARIABLE_MAX];
+STATIC MOCK_CONFIG_VALUE                 mMockConfigValues[MOCK_CONFIG_VALUE_MAX];
+STATIC UINTN                             mMockConfigValueCount;
+STATIC EFI_REST_JSON_STRUCTURE_TO_STRUCTURE       mMockToStructure;
+STATIC EFI_REST_JSON_STRUCTURE_TO_JSON            mMockToJson;
+STATIC EFI_REST_JSON_STRUCTURE_DESTORY_STRUCTURE  mMockDestroyStructure;
+STATIC REDFISH_FEATURE_CALLBACK          mMockFeatureCallback;
+STATIC VOID                              *mMockFeatureContext;
+
+/**
+  Mock of EFI_BOOT_SERVICES.RaiseTPL().
+
+  @param[in]  NewTpl  The new task priority level.
+
+  @retval The previous task priority level.
+**/
+STATIC
+EFI_TPL
+EFIAPI
+MockRaiseTpl (
+  IN EFI_TPL  NewTpl
+  )
+{
+  EFI_TPL  OldTpl;
+
+  OldTpl   = mMockTpl;
+  mMockTpl = NewTpl;
+  return OldTpl;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.RestoreTPL().
+
+  @param[in]  OldTpl  The previous task priority level.
+**/
+STATIC
+VOID
+EFIAPI
+MockRestoreTpl (
+  IN EFI_TPL  OldTpl
+  )
+{
+  mMockTpl = OldTpl;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.AllocatePool().
+
+  @param[in]   PoolType  Not used.
+  @param[in]   Size      Size to allocate.
+  @param[out]  Buffer    The allocated buffer.
+
+  @retval EFI_SUCCESS           The buffer is allocated.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockAllocatePool (
+  IN  EFI_MEMORY_TYPE  PoolType,
+  IN  UINTN            Size,
+  OUT VOID             **Buffer
+  )
+{
+  *Buffer = AllocatePool (Size);
+  return (*Buffer == NULL) ? EFI_OUT_OF_RESOURCES : EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.FreePool().
+
+  @param[in]  Buffer  The buffer to free.
+
+  @retval EFI_SUCCESS  The buffer is freed.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockFreePool (
+  IN VOID  *Buffer
+  )
+{
+  FreePool (Buffer);
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.CreateEventEx(). Timers never expire, the mock
+  REST EX protocol completes each request before it returns.
+
+  @param[in]   Type            Type of event.
+  @param[in]   NotifyTpl       Not used.
+  @param[in]   NotifyFunction  Notification function of event.
+  @param[in]   NotifyContext   Context of notification function.
+  @param[in]   EventGroup      Group of event, NULL when it is in no group.
+  @param[out]  Event           The created event.
+
+  @retval EFI_SUCCESS           The event is created.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockCreateEventEx (
+  IN       UINT32            Type,
+  IN       EFI_TPL           NotifyTpl,
+  IN       EFI_EVENT_NOTIFY  NotifyFunction OPTIONAL,
+  IN CONST VOID              *NotifyContext OPTIONAL,
+  IN CONST EFI_GUID          *EventGroup OPTIONAL,
+  OUT      EFI_EVENT         *Event
+  )
+{
+  MOCK_EVENT  *MockEvent;
+
+  if (Event == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  MockEvent = AllocateZeroPool (sizeof (MOCK_EVENT));
+  if (MockEvent == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  MockEvent->Type           = Type;
+  MockEvent->NotifyFunction = NotifyFunction;
+  MockEvent->NotifyContext  = (VOID *)NotifyContext;
+  if (EventGroup != NULL) {
+    MockEvent->InGroup = TRUE;
+    CopyGuid (&MockEvent->EventGroup, EventGroup);
+  }
+
+  InsertTailList (&mMockEvents, &MockEvent->Link);
+  *Event = MockEvent;
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.CreateEvent().
+
+  @param[in]   Type            Type of event.
+  @param[in]   NotifyTpl       Not used.
+  @param[in]   NotifyFunction  Notification function of event.
+  @param[in]   NotifyContext   Context of notification function.
+  @param[out]  Event           The created event.
+
+  @retval EFI_SUCCESS           The event is created.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockCreateEvent (
+  IN  UINT32            Type,
+  IN  EFI_TPL           NotifyTpl,
+  IN  EFI_EVENT_NOTIFY  NotifyFunction OPTIONAL,
+  IN  VOID              *NotifyContext OPTIONAL,
+  OUT EFI_EVENT         *Event
+  )
+{
+  return MockCreateEventEx (Type, NotifyTpl, NotifyFunction, NotifyContext, NULL, Event);
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.SetTimer().
+
+  @param[in]  Event        Not used.
+  @param[in]  Type         Not used.
+  @param[in]  TriggerTime  Not used.
+
+  @retval EFI_SUCCESS  Always.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockSetTimer (
+  IN EFI_EVENT        Event,
+  IN EFI_TIMER_DELAY  Type,
+  IN UINT64           TriggerTime
+  )
+{
+  return EFI_SUCCESS;
+}
+
+/**
+  Signal the event and run its notification function. The notification
+  function may close the event.
+
+  @param[in]  MockEvent  The event.
+**/
+STATIC
+VOID
+MockNotifyEvent (
+  IN MOCK_EVENT  *MockEvent
+  )
+{
+  MockEvent->Signaled = TRUE;
+  if (((MockEvent->Type & EVT_NOTIFY_SIGNAL) != 0) && (MockEvent->NotifyFunction != NULL)) {
+    MockEvent->NotifyFunction (MockEvent, MockEvent->NotifyContext);
+  }
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.SignalEvent(). The notification functions run
+  right away, and all events of the group are signaled.
+
+  @param[in]  Event  The event to signal.
+
+  @retval EFI_SUCCESS  The event is signaled.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockSignalEvent (
+  IN EFI_EVENT  Event
+  )
+{
+  MOCK_EVENT  *MockEvent;
+  MOCK_EVENT  *GroupEvent;
+  LIST_ENTRY  *Entry;
+  LIST_ENTRY  *NextEntry;
+  EFI_GUID    EventGroup;
+
+  MockEvent = (MOCK_EVENT *)Event;
+  if (!MockEvent->InGroup) {
+    MockNotifyEvent (MockEvent);
+    return EFI_SUCCESS;
+  }
+
+  CopyGuid (&EventGroup, &MockEvent->EventGroup);
+  for (Entry = GetFirstNode (&mMockEvents); !IsNull (&mMockEvents, Entry); Entry = NextEntry) {
+    NextEntry  = GetNextNode (&mMockEvents, Entry);
+    GroupEvent = BASE_CR (Entry, MOCK_EVENT, Link);
+    if (GroupEvent->InGroup && CompareGuid (&GroupEvent->EventGroup, &EventGroup)) {
+      MockNotifyEvent (GroupEvent);
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.CloseEvent().
+
+  @param[in]  Event  The event to close.
+
+  @retval EFI_SUCCESS  The event is closed.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockCloseEvent (
+  IN EFI_EVENT  Event
+  )
+{
+  MOCK_EVENT  *MockEvent;
+
+  MockEvent = (MOCK_EVENT *)Event;
+  RemoveEntryList (&MockEvent->Link);
+  FreePool (MockEvent);
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.CheckEvent().
+
+  @param[in]  Event  The event to check.
+
+  @retval EFI_SUCCESS    The event was signaled, it is not signaled any more.
+  @retval EFI_NOT_READY  The event is not signaled.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockCheckEvent (
+  IN EFI_EVENT  Event
+  )
+{
+  MOCK_EVENT  *MockEvent;
+
+  MockEvent = (MOCK_EVENT *)Event;
+  if (!MockEvent->Signaled) {
+    return EFI_NOT_READY;
+  }
+
+  MockEvent->Signaled = FALSE;
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.WaitForEvent(). Nothing is signaled while it
+  waits, so it only returns an event which is signaled already.
+
+  @param[in]   NumberOfEvents  Number of events.
+  @param[in]   Event           The events.
+  @param[out]  Index           Index of the signaled event.
+
+  @retval EFI_SUCCESS    An event is signaled.
+  @retval EFI_NOT_READY  No event is signaled.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockWaitForEvent (
+  IN  UINTN      NumberOfEvents,
+  IN  EFI_EVENT  *Event,
+  OUT UINTN      *Index
+  )
+{
+  UINTN  EventIndex;
+
+  for (EventIndex = 0; EventIndex < NumberOfEvents; EventIndex++) {
+    if (!EFI_ERROR (MockCheckEvent (Event[EventIndex]))) {
+      *Index = EventIndex;
+      return EFI_SUCCESS;
+    }
+  }
+
+  return EFI_NOT_READY;
+}
+
+/**
+  Find the protocol interface on the handle.
+
+  @param[in]  Handle    The handle, NULL for any handle.
+  @param[in]  Protocol  The protocol.
+
+  @retval MOCK_PROTOCOL_INTERFACE  The protocol interface is found.
+  @retval NULL                     There is no such protocol interface.
+**/
+STATIC
+MOCK_PROTOCOL_INTERFACE *
+MockFindInterface (
+  IN EFI_HANDLE      Handle OPTIONAL,
+  IN CONST EFI_GUID  *Protocol
+  )
+{
+  LIST_ENTRY               *Entry;
+  MOCK_PROTOCOL_INTERFACE  *MockInterface;
+
+  for (Entry = GetFirstNode (&mMockInterfaces); !IsNull (&mMockInterfaces, Entry); Entry = GetNextNode (&mMockInterfaces, Entry)) {
+    MockInterface = BASE_CR (Entry, MOCK_PROTOCOL_INTERFACE, Link);
+    if (((Handle == NULL) || (MockInterface->Handle == Handle)) && CompareGuid (&MockInterface->Protocol, Protocol)) {
+      return MockInterface;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.InstallProtocolInterface().
+
+  @param[in, out]  Handle         The handle, a new one is created when it is NULL.
+  @param[in]       Protocol       The protocol.
+  @param[in]       InterfaceType  Not used.
+  @param[in]       Interface      The protocol interface.
+
+  @retval EFI_SUCCESS            The protocol interface is installed.
+  @retval EFI_INVALID_PARAMETER  The protocol is installed on the handle already.
+  @retval EFI_OUT_OF_RESOURCES   There is not enough memory.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockInstallProtocolInterface (
+  IN OUT EFI_HANDLE          *Handle,
+  IN     EFI_GUID            *Protocol,
+  IN     EFI_INTERFACE_TYPE  InterfaceType,
+  IN     VOID                *Interface
+  )
+{
+  MOCK_PROTOCOL_INTERFACE  *MockInterface;
+
+  if ((Handle == NULL) || (Protocol == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if ((*Handle != NULL) && (MockFindInterface (*Handle, Protocol) != NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  MockInterface = AllocateZeroPool (sizeof (MOCK_PROTOCOL_INTERFACE));
+  if (MockInterface == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //
+  // Handles are only compared, never dereferenced.
+  //
+  if (*Handle == NULL) {
+    *Handle = (EFI_HANDLE)++mMockHandleCount;
+  }
+
+  MockInterface->Handle    = *Handle;
+  MockInterface->Interface = Interface;
+  CopyGuid (&MockInterface->Protocol, Protocol);
+  InsertTailList (&mMockInterfaces, &MockInterface->Link);
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.UninstallProtocolInterface().
+
+  @param[in]  Handle     The handle.
+  @param[in]  Protocol   The protocol.
+  @param[in]  Interface  Not used.
+
+  @retval EFI_SUCCESS    The protocol interface is uninstalled.
+  @retval EFI_NOT_FOUND  The protocol is not installed on the handle.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockUninstallProtocolInterface (
+  IN EFI_HANDLE  Handle,
+  IN EFI_GUID    *Protocol,
+  IN VOID        *Interface
+  )
+{
+  MOCK_PROTOCOL_INTERFACE  *MockInterface;
+
+  MockInterface = MockFindInterface (Handle, Protocol);
+  if ((Handle == NULL) || (MockInterface == NULL)) {
+    return EFI_NOT_FOUND;
+  }
+
+  RemoveEntryList (&MockInterface->Link);
+  FreePool (MockInterface);
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.HandleProtocol().
+
+  @param[in]   Handle     The handle.
+  @param[in]   Protocol   The protocol.
+  @param[out]  Interface  The protocol interface.
+
+  @retval EFI_SUCCESS      The protocol interface is returned.
+  @retval EFI_UNSUPPORTED  The protocol is not installed on the handle.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockHandleProtocol (
+  IN  EFI_HANDLE  Handle,
+  IN  EFI_GUID    *Protocol,
+  OUT VOID        **Interface
+  )
+{
+  MOCK_PROTOCOL_INTERFACE  *MockInterface;
+
+  MockInterface = MockFindInterface (Handle, Protocol);
+  if ((Handle == NULL) || (MockInterface == NULL)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  *Interface = MockInterface->Interface;
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.RegisterProtocolNotify(). The notification of
+  protocol installation is not delivered, the caller signals its event once
+  when it registers, as EfiCreateProtocolNotifyEvent() does.
+
+  @param[in]   Protocol      Not used.
+  @param[in]   Event         The event.
+  @param[out]  Registration  The registration key.
+
+  @retval EFI_SUCCESS  Always.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockRegisterProtocolNotify (
+  IN  EFI_GUID   *Protocol,
+  IN  EFI_EVENT  Event,
+  OUT VOID       **Registration
+  )
+{
+  *Registration = Event;
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.LocateHandleBuffer(). Only ByProtocol is
+  supported.
+
+  @param[in]   SearchType  Type of search.
+  @param[in]   Protocol    The protocol.
+  @param[in]   SearchKey   Not used.
+  @param[out]  NoHandles   Number of handles.
+  @param[out]  Buffer      The handles, freed by caller.
+
+  @retval EFI_SUCCESS           The handles are returned.
+  @retval EFI_NOT_FOUND         No handle has the protocol.
+  @retval EFI_UNSUPPORTED       The type of search is not supported.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockLocateHandleBuffer (
+  IN     EFI_LOCATE_SEARCH_TYPE  SearchType,
+  IN     EFI_GUID                *Protocol OPTIONAL,
+  IN     VOID                    *SearchKey OPTIONAL,
+  OUT    UINTN                   *NoHandles,
+  OUT    EFI_HANDLE              **Buffer
+  )
+{
+  LIST_ENTRY               *Entry;
+  MOCK_PROTOCOL_INTERFACE  *MockInterface;
+  UINTN                    Count;
+
+  if ((SearchType != ByProtocol) || (Protocol == NULL)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  *NoHandles = 0;
+  *Buffer    = AllocatePool (mMockHandleCount * sizeof (EFI_HANDLE));
+  if (*Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Count = 0;
+  for (Entry = GetFirstNode (&mMockInterfaces); !IsNull (&mMockInterfaces, Entry); Entry = GetNextNode (&mMockInterfaces, Entry)) {
+    MockInterface = BASE_CR (Entry, MOCK_PROTOCOL_INTERFACE, Link);
+    if (CompareGuid (&MockInterface->Protocol, Protocol)) {
+      (*Buffer)[Count++] = MockInterface->Handle;
+    }
+  }
+
+  if (Count == 0) {
+    FreePool (*Buffer);
+    *Buffer = NULL;
+    return EFI_NOT_FOUND;
+  }
+
+  *NoHandles = Count;
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.LocateProtocol().
+
+  @param[in]   Protocol      The protocol.
+  @param[in]   Registration  Not used.
+  @param[out]  Interface     The first interface of the protocol.
+
+  @retval EFI_SUCCESS    The protocol interface is returned.
+  @retval EFI_NOT_FOUND  The protocol is not installed.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockLocateProtocol (
+  IN  EFI_GUID  *Protocol,
+  IN  VOID      *Registration OPTIONAL,
+  OUT VOID      **Interface
+  )
+{
+  MOCK_PROTOCOL_INTERFACE  *MockInterface;
+
+  MockInterface = MockFindInterface (NULL, Protocol);
+  if (MockInterface == NULL) {
+    *Interface = NULL;
+    return EFI_NOT_FOUND;
+  }
+
+  *Interface = MockInterface->Interface;
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.OpenProtocol(). Opening is not tracked.
+
+  @param[in]   Handle            The handle.
+  @param[in]   Protocol          The protocol.
+  @param[out]  Interface         The protocol interface.
+  @param[in]   AgentHandle       Not used.
+  @param[in]   ControllerHandle  Not used.
+  @param[in]   Attributes        Not used.
+
+  @retval EFI_SUCCESS      The protocol interface is returned.
+  @retval EFI_UNSUPPORTED  The protocol is not installed on the handle.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockOpenProtocol (
+  IN  EFI_HANDLE  Handle,
+  IN  EFI_GUID    *Protocol,
+  OUT VOID        **Interface OPTIONAL,
+  IN  EFI_HANDLE  AgentHandle,
+  IN  EFI_HANDLE  ControllerHandle,
+  IN  UINT32      Attributes
+  )
+{
+  VOID  *ProtocolInterface;
+
+  if (EFI_ERROR (MockHandleProtocol (Handle, Protocol, &ProtocolInterface))) {
+    return EFI_UNSUPPORTED;
+  }
+
+  if (Interface != NULL) {
+    *Interface = ProtocolInterface;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.InstallMultipleProtocolInterfaces().
+
+  @param[in, out]  Handle  The handle, a new one is created when it is NULL.
+  @param[in]       ...     Pairs of protocol and interface, ended by NULL.
+
+  @retval EFI_SUCCESS  All protocol interfaces are installed.
+  @retval Others       Failed to install a protocol interface.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockInstallMultipleProtocolInterfaces (
+  IN OUT EFI_HANDLE  *Handle,
+  ...
+  )
+{
+  EFI_STATUS  Status;
+  VA_LIST     Args;
+  EFI_GUID    *Protocol;
+  VOID        *Interface;
+
+  Status = EFI_SUCCESS;
+  VA_START (Args, Handle);
+  for (Protocol = VA_ARG (Args, EFI_GUID *); Protocol != NULL; Protocol = VA_ARG (Args, EFI_GUID *)) {
+    Interface = VA_ARG (Args, VOID *);
+    Status    = MockInstallProtocolInterface (Handle, Protocol, EFI_NATIVE_INTERFACE, Interface);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+  }
+
+  VA_END (Args);
+  return Status;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.UninstallMultipleProtocolInterfaces().
+
+  @param[in]  Handle  The handle.
+  @param[in]  ...     Pairs of protocol and interface, ended by NULL.
+
+  @retval EFI_SUCCESS  All protocol interfaces are uninstalled.
+  @retval Others       Failed to uninstall a protocol interface.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockUninstallMultipleProtocolInterfaces (
+  IN EFI_HANDLE  Handle,
+  ...
+  )
+{
+  EFI_STATUS  Status;
+  VA_LIST     Args;
+  EFI_GUID    *Protocol;
+  VOID        *Interface;
+
+  Status = EFI_SUCCESS;
+  VA_START (Args, Handle);
+  for (Protocol = VA_ARG (Args, EFI_GUID *); Protocol != NULL; Protocol = VA_ARG (Args, EFI_GUID *)) {
+    Interface = VA_ARG (Args, VOID *);
+    Status    = MockUninstallProtocolInterface (Handle, Protocol, Interface);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+  }
+
+  VA_END (Args);
+  return Status;
+}
+
+/**
+  Mock of EFI_BOOT_SERVICES.Stall(). The mock REST EX protocol never keeps
+  the caller waiting.
+
+  @param[in]  Microseconds  Not used.
+
+  @retval EFI_SUCCESS  Always.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockStall (
+  IN UINTN  Microseconds
+  )
+{
+  return EFI_SUCCESS;
+}
+
+///
+/// Mock version of the UEFI Boot Services Table
+///
+EFI_BOOT_SERVICES  MockBoot = {
+  {
+    EFI_BOOT_SERVICES_SIGNATURE,        // Signature
+    EFI_BOOT_SERVICES_REVISION,         // Revision
+    sizeof (EFI_BOOT_SERVICES),         // HeaderSize
+    0,                                  // CRC32
+    0                                   // Reserved
+  },
+  MockRaiseTpl,                             // RaiseTPL
+  MockRestoreTpl,                           // RestoreTPL
+  NULL,                                     // AllocatePages
+  NULL,                                     // FreePages
+  NULL,                                     // GetMemoryMap
+  MockAllocatePool,                         // AllocatePool
+  MockFreePool,                             // FreePool
+  MockCreateEvent,                          // CreateEvent
+  MockSetTimer,                             // SetTimer
+  MockWaitForEvent,                         // WaitForEvent
+  MockSignalEvent,                          // SignalEvent
+  MockCloseEvent,                           // CloseEvent
+  MockCheckEvent,                           // CheckEvent
+  MockInstallProtocolInterface,             // InstallProtocolInterface
+  NULL,                                     // ReinstallProtocolInterface
+  MockUninstallProtocolInterface,           // UninstallProtocolInterface
+  MockHandleProtocol,                       // HandleProtocol
+  NULL,                                     // Reserved
+  MockRegisterProtocolNotify,               // RegisterProtocolNotify
+  NULL,                                     // LocateHandle
+  NULL,                                     // LocateDevicePath
+  NULL,                                     // InstallConfigurationTable
+  NULL,                                     // LoadImage
+  NULL,                                     // StartImage
+  NULL,                                     // Exit
+  NULL,                                     // UnloadImage
+  NULL,                                     // ExitBootServices
+  NULL,                                     // GetNextMonotonicCount
+  MockStall,                                // Stall
+  NULL,                                     // SetWatchdogTimer
+  NULL,                                     // ConnectController
+  NULL,                                     // DisconnectController
+  MockOpenProtocol,                         // OpenProtocol
+  NULL,                                     // CloseProtocol
+  NULL,                                     // OpenProtocolInformation
+  NULL,                                     // ProtocolsPerHandle
+  MockLocateHandleBuffer,                   // LocateHandleBuffer
+  MockLocateProtocol,                       // LocateProtocol
+  MockInstallMultipleProtocolInterfaces,    // InstallMultipleProtocolInterfaces
+  MockUninstallMultipleProtocolInterfaces,  // UninstallMultipleProtocolInterfaces
+  NULL,                                     // CalculateCrc32
+  NULL,                                     // CopyMem
+  NULL,                                     // SetMem
+  MockCreateEventEx                         // CreateEventEx
+};
+
+/**
+  Find the variable in the mock variable store.
+
+  @param[in]  VariableName  Name of variable.
+  @param[in]  VendorGuid    Guid of variable.
+
+  @retval MOCK_VARIABLE     The variable is found.
+  @retval NULL              There is no such variable.
+**/
+STATIC
+MOCK_VARIABLE *
+MockFindVariable (
+  IN CONST CHAR16    *VariableName,
+  IN CONST EFI_GUID  *VendorGuid
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < MOCK_VARIABLE_MAX; Index++) {
+    if (mMockVariables[Index].InUse &&
+        (StrCmp (mMockVariables[Index].Name, VariableName) == 0) &&
+        CompareGuid (&mMockVariables[Index].Guid, VendorGuid))
+    {
+      return &mMockVariables[Index];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Mock of EFI_RUNTIME_SERVICES.GetVariable().
+
+  @param[in]       VariableName  Name of variable.
+  @param[in]       VendorGuid    Guid of variable.
+  @param[out]      Attributes    Attributes of variable.
+  @param[in, out]  DataSize      Size of Data.
+  @param[out]      Data          Buffer to receive the data of variable.
+
+  @retval EFI_SUCCESS           The variable is returned.
+  @retval EFI_NOT_FOUND         The variable doesn't exist.
+  @retval EFI_BUFFER_TOO_SMALL  DataSize is too small.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockGetVariable (
+  IN     CHAR16    *VariableName,
+  IN     EFI_GUID  *VendorGuid,
+  OUT    UINT32    *Attributes OPTIONAL,
+  IN OUT UINTN     *DataSize,
+  OUT    VOID      *Data OPTIONAL
+  )
+{
+  MOCK_VARIABLE  *Variable;
+
+  Variable = MockFindVariable (VariableName, VendorGuid);
+  if (Variable == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  if (*DataSize < Variable->DataSize) {
+    *DataSize = Variable->DataSize;
+    return EFI_BUFFER_TOO_SMALL;
+  }
+
+  if (Attributes != NULL) {
+    *Attributes = Variable->Attributes;
+  }
+
+  *DataSize = Variable->DataSize;
+  CopyMem (Data, Variable->Data, Variable->DataSize);
+  return EFI_SUCCESS;
+}
+
+/**
+  Mock of EFI_RUNTIME_SERVICES.SetVariable(). Each call is one write to the
+  flash of a real platform.
+
+  @param[in]  VariableName  Name of variable.
+  @param[in]  VendorGuid    Guid of variable.
+  @param[in]  Attributes    Attributes of variable.
+  @param[in]  DataSize      Size of Data. Zero deletes the variable.
+  @param[in]  Data          Data of variable.
+
+  @retval EFI_SUCCESS           The variable is set or deleted.
+  @retval EFI_NOT_FOUND         The variable to delete doesn't exist.
+  @retval EFI_OUT_OF_RESOURCES  Mock variable store is full.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockSetVariable (
+  IN CHAR16    *VariableName,
+  IN EFI_GUID  *VendorGuid,
+  IN UINT32    Attributes,
+  IN UINTN     DataSize,
+  IN VOID      *Data
+  )
+{
+  MOCK_VARIABLE  *Variable;
+  UINTN          Index;
+
+  mStatistics.VariableWrites++;
+
+  Variable = MockFindVariable (VariableName, VendorGuid);
+  if (DataSize == 0) {
+    if (Variable == NULL) {
+      return EFI_NOT_FOUND;
+    }
+
+    FreePool (Variable->Data);
+    ZeroMem (Variable, sizeof (MOCK_VARIABLE));
+    return EFI_SUCCESS;
+  }
+
+  if (Variable == NULL) {
+    for (Index = 0; Index < MOCK_VARIABLE_MAX; Index++) {
+      if (!mMockVariables[Index].InUse) {
+        Variable = &mMockVariables[Index];
+        break;
+      }
+    }
+
+    if ((Variable == NULL) || (StrSize (VariableName) > sizeof (Variable->Name))) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Variable->InUse = TRUE;
+    StrCpyS (Variable->Name, MOCK_VARIABLE_NAME_SIZE, VariableName);
+    CopyGuid (&Variable->Guid, VendorGuid);
+  } else {
+    FreePool (Variable->Data);
+  }
+
+  Variable->Attributes = Attributes;
+  Variable->DataSize   = DataSize;
+  Variable->Data       = AllocateCopyPool (DataSize, Data);
+  return (Variable->Data == NULL) ? EFI_OUT_OF_RESOURCES : EFI_SUCCESS;
+}
+
+///
+/// Mock version of the UEFI Runtime Services Table
+///
+EFI_RUNTIME_SERVICES  MockRuntime = {
+  {
+    EFI_RUNTIME_SERVICES_SIGNATURE,     // Signature
+    EFI_RUNTIME_SERVICES_REVISION,      // Revision
+    sizeof (EFI_RUNTIME_SERVICES),      // HeaderSize
+    0,                                  // CRC32
+    0                                   // Reserved
+  },
+  NULL,               // GetTime
+  NULL,               // SetTime
+  NULL,               // GetWakeupTime
+  NULL,               // SetWakeupTime
+  NULL,               // SetVirtualAddressMap
+  NULL,               // ConvertPointer
+  MockGetVariable,    // GetVariable
+  NULL,               // GetNextVariableName
+  MockSetVariable,    // SetVariable
+  NULL,               // GetNextHighMonotonicCount
+  NULL,               // ResetSystem
+  NULL,               // UpdateCapsule
+  NULL,               // QueryCapsuleCapabilities
+  NULL                // QueryVariableInfo
+};
+
+/**
+  Register the converter. Only one converter is kept, the benchmark converts
+  one schema.
+
+  @param[in]  This              Not used.
+  @param[in]  JsonStructureSupported  Not used.
+  @param[in]  ToStructure       The JSON to structure function.
+  @param[in]  ToJson            The structure to JSON function.
+  @param[in]  DestroyStructure  The function to destroy the structure.
+
+  @retval EFI_SUCCESS  The converter is registered.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockJsonStructureRegister (
+  IN EFI_REST_JSON_STRUCTURE_PROTOCOL           *This,
+  IN EFI_REST_JSON_STRUCTURE_SUPPORTED          *JsonStructureSupported,
+  IN EFI_REST_JSON_STRUCTURE_TO_STRUCTURE       ToStructure,
+  IN EFI_REST_JSON_STRUCTURE_TO_JSON            ToJson,
+  IN EFI_REST_JSON_STRUCTURE_DESTORY_STRUCTURE  DestroyStructure
+  )
+{
+  mMockToStructure      = ToStructure;
+  mMockToJson           = ToJson;
+  mMockDestroyStructure = DestroyStructure;
+  return EFI_SUCCESS;
+}
+
+/**
+  Convert JSON text to structure with the registered converter.
+
+  @param[in]   This                The protocol.
+  @param[in]   JsonRsrcIdentifier  The resource type identifier.
+  @param[in]   ResourceJsonText    The JSON text.
+  @param[out]  JsonStructure       The structure.
+
+  @retval EFI_UNSUPPORTED  No converter is registered.
+  @retval Others           Status returned by the converter.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockJsonStructureToStructure (
+  IN  EFI_REST_JSON_STRUCTURE_PROTOCOL        *This,
+  IN  EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER  *JsonRsrcIdentifier OPTIONAL,
+  IN  CHAR8                                   *ResourceJsonText,
+  OUT EFI_REST_JSON_STRUCTURE_HEADER          **JsonStructure
+  )
+{
+  if (mMockToStructure == NULL) {
+    return EFI_UNSUPPORTED;
+  }
+
+  return mMockToStructure (This, JsonRsrcIdentifier, ResourceJsonText, JsonStructure);
+}
+
+/**
+  Convert structure to JSON text with the registered converter.
+
+  @param[in]   This                 The protocol.
+  @param[in]   JsonStructureHeader  The structure.
+  @param[out]  ResourceJsonText     The JSON text.
+
+  @retval EFI_UNSUPPORTED  No converter is registered.
+  @retval Others           Status returned by the converter.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockJsonStructureToJson (
+  IN  EFI_REST_JSON_STRUCTURE_PROTOCOL  *This,
+  IN  EFI_REST_JSON_STRUCTURE_HEADER    *JsonStructureHeader,
+  OUT CHAR8                             **ResourceJsonText
+  )
+{
+  if (mMockToJson == NULL) {
+    return EFI_UNSUPPORTED;
+  }
+
+  return mMockToJson (This, JsonStructureHeader, ResourceJsonText);
+}
+
+/**
+  Destroy the structure with the registered converter.
+
+  @param[in]  This                 The protocol.
+  @param[in]  JsonStructureHeader  The structure.
+
+  @retval EFI_UNSUPPORTED  No converter is registered.
+  @retval Others           Status returned by the converter.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockJsonStructureDestroyStructure (
+  IN EFI_REST_JSON_STRUCTURE_PROTOCOL  *This,
+  IN EFI_REST_JSON_STRUCTURE_HEADER    *JsonStructureHeader
+  )
+{
+  if (mMockDestroyStructure == NULL) {
+    return EFI_UNSUPPORTED;
+  }
+
+  return mMockDestroyStructure (This, JsonStructureHeader);
+}
+
+STATIC EFI_REST_JSON_STRUCTURE_PROTOCOL  mMockJsonStructure = {
+  MockJsonStructureRegister,
+  MockJsonStructureToStructure,
+  MockJsonStructureToJson,
+  MockJsonStructureDestroyStructure
+};
+
+/**
+  Find the value of the configure language in the fake HII configuration.
+
+  @param[in]  ConfigureLang  Configure language of the value.
+
+  @retval MOCK_CONFIG_VALUE  The value is found.
+  @retval NULL               There is no such value.
+**/
+STATIC
+MOCK_CONFIG_VALUE *
+MockFindConfigValue (
+  IN EFI_STRING  ConfigureLang
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < mMockConfigValueCount; Index++) {
+    if (StrCmp (mMockConfigValues[Index].ConfigureLang, ConfigureLang) == 0) {
+      return &mMockConfigValues[Index];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Get the value of configure language from the fake HII configuration. The
+  string value is allocated and freed by caller, as the platform config
+  driver does.
+
+  @param[in]   This           Not used.
+  @param[in]   Schema         Not used.
+  @param[in]   Version        Not used.
+  @param[in]   ConfigureLang  Configure language of the value.
+  @param[out]  Value          The value.
+
+  @retval EFI_SUCCESS           The value is returned.
+  @retval EFI_NOT_FOUND         There is no such value.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockPlatformConfigGetValue (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL  *This,
+  IN     CHAR8                                   *Schema,
+  IN     CHAR8                                   *Version,
+  IN     EFI_STRING                              ConfigureLang,
+  OUT    EDKII_REDFISH_VALUE                     *Value
+  )
+{
+  MOCK_CONFIG_VALUE  *ConfigValue;
+
+  mStatistics.HiiGets++;
+  ConfigValue = MockFindConfigValue (ConfigureLang);
+  if (ConfigValue == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  CopyMem (Value, &ConfigValue->Value, sizeof (EDKII_REDFISH_VALUE));
+  if (Value->Type == REDFISH_VALUE_TYPE_STRING) {
+    Value->Value.Buffer = AllocateCopyPool (AsciiStrSize (ConfigValue->Value.Value.Buffer), ConfigValue->Value.Value.Buffer);
+    if (Value->Value.Buffer == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Set the value of configure language in the fake HII configuration.
+
+  @param[in]  This           Not used.
+  @param[in]  Schema         Not used.
+  @param[in]  Version        Not used.
+  @param[in]  ConfigureLang  Configure language of the value.
+  @param[in]  Value          The value, it is copied.
+
+  @retval EFI_SUCCESS            The value is set.
+  @retval EFI_NOT_FOUND          There is no such value.
+  @retval EFI_INVALID_PARAMETER  The type of value doesn't match.
+  @retval EFI_OUT_OF_RESOURCES   There is not enough memory.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockPlatformConfigSetValue (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL  *This,
+  IN     CHAR8                                   *Schema,
+  IN     CHAR8                                   *Version,
+  IN     EFI_STRING                              ConfigureLang,
+  IN     EDKII_REDFISH_VALUE                     Value
+  )
+{
+  MOCK_CONFIG_VALUE  *ConfigValue;
+  CHAR8              *Buffer;
+
+  ConfigValue = MockFindConfigValue (ConfigureLang);
+  if (ConfigValue == NULL) {
+    return EFI_NOT_FOUND;
+  }
+
+  if (ConfigValue->Value.Type != Value.Type) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (Value.Type == REDFISH_VALUE_TYPE_STRING) {
+    Buffer = AllocateCopyPool (AsciiStrSize (Value.Value.Buffer), Value.Value.Buffer);
+    if (Buffer == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    FreePool (ConfigValue->Value.Value.Buffer);
+    ConfigValue->Value.Value.Buffer = Buffer;
+  } else {
+    CopyMem (&ConfigValue->Value, &Value, sizeof (EDKII_REDFISH_VALUE));
+  }
+
+  mStatistics.HiiSets++;
+  return EFI_SUCCESS;
+}
+
+/**
+  Get the configure languages matching the pattern. Only the literal
+  configure language and the pattern ending with ".*" are supported, which
+  is what the feature drivers use.
+
+  The strings in the list belong to the fake HII configuration, caller only
+  frees the list.
+
+  @param[in]   This               Not used.
+  @param[in]   Schema             Not used.
+  @param[in]   Version            Not used.
+  @param[in]   RegexPattern       The pattern.
+  @param[out]  ConfigureLangList  The configure languages.
+  @param[out]  Count              Number of configure languages.
+
+  @retval EFI_SUCCESS           The configure languages are returned.
+  @retval EFI_NOT_FOUND         No configure language matches the pattern.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockPlatformConfigGetConfigureLang (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL  *This,
+  IN     CHAR8                                   *Schema,
+  IN     CHAR8                                   *Version,
+  IN     EFI_STRING                              RegexPattern,
+  OUT    EFI_STRING                              **ConfigureLangList,
+  OUT    UINTN                                   *Count
+  )
+{
+  UINTN  Index;
+  UINTN  PrefixLength;
+
+  PrefixLength = StrLen (RegexPattern);
+  if ((PrefixLength >= StrLen (MOCK_PATTERN_ANY)) &&
+      (StrCmp (RegexPattern + PrefixLength - StrLen (MOCK_PATTERN_ANY), MOCK_PATTERN_ANY) == 0))
+  {
+    PrefixLength -= StrLen (MOCK_PATTERN_ANY);
+  } else {
+    PrefixLength++;
+  }
+
+  *Count             = 0;
+  *ConfigureLangList = AllocatePool (MAX (mMockConfigValueCount, 1) * sizeof (EFI_STRING));
+  if (*ConfigureLangList == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (Index = 0; Index < mMockConfigValueCount; Index++) {
+    if (StrnCmp (mMockConfigValues[Index].ConfigureLang, RegexPattern, PrefixLength) == 0) {
+      (*ConfigureLangList)[(*Count)++] = mMockConfigValues[Index].ConfigureLang;
+    }
+  }
+
+  if (*Count == 0) {
+    FreePool (*ConfigureLangList);
+    *ConfigureLangList = NULL;
+    return EFI_NOT_FOUND;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Get the schema of the fake HII configuration.
+
+  @param[in]   This             Not used.
+  @param[in]   HiiHandle        Not used.
+  @param[out]  SupportedSchema  The schema, freed by caller.
+
+  @retval EFI_SUCCESS           The schema is returned.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockPlatformConfigGetSupportedSchema (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL  *This,
+  IN     EFI_HII_HANDLE                          HiiHandle OPTIONAL,
+  OUT    CHAR8                                   **SupportedSchema
+  )
+{
+  *SupportedSchema = AllocateCopyPool (sizeof (MOCK_SUPPORTED_SCHEMA), MOCK_SUPPORTED_SCHEMA);
+  return (*SupportedSchema == NULL) ? EFI_OUT_OF_RESOURCES : EFI_SUCCESS;
+}
+
+/**
+  Get the values of the list from the fake HII configuration.
+
+  @param[in]      This       The protocol.
+  @param[in]      Count      Number of entries.
+  @param[in, out] ValueList  The entries.
+
+  @retval EFI_SUCCESS  The result of each entry is in its Status.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockPlatformConfigGetValues (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL     *This,
+  IN     UINTN                                      Count,
+  IN OUT EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *ValueList
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < Count; Index++) {
+    ValueList[Index].Status = MockPlatformConfigGetValue (
+                                This,
+                                ValueList[Index].Schema,
+                                ValueList[Index].Version,
+                                ValueList[Index].ConfigureLang,
+                                &ValueList[Index].Value
+                                );
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Set the values of the list in the fake HII configuration.
+
+  @param[in]      This       The protocol.
+  @param[in]      Count      Number of entries.
+  @param[in, out] ValueList  The entries.
+
+  @retval EFI_SUCCESS  The result of each entry is in its Status.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockPlatformConfigSetValues (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL     *This,
+  IN     UINTN                                      Count,
+  IN OUT EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *ValueList
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < Count; Index++) {
+    ValueList[Index].Status = MockPlatformConfigSetValue (
+                                This,
+                                ValueList[Index].Schema,
+                                ValueList[Index].Version,
+                                ValueList[Index].ConfigureLang,
+                                ValueList[Index].Value
+                                );
+  }
+
+  return EFI_SUCCESS;
+}
+
+STATIC EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL  mMockPlatformConfig = {
+  MockPlatformConfigGetValue,
+  MockPlatformConfigSetValue,
+  MockPlatformConfigGetConfigureLang,
+  MockPlatformConfigGetSupportedSchema,
+  MockPlatformConfigGetValues,
+  MockPlatformConfigSetValues
+};
+
+/**
+  Keep the callback of the feature driver. Only one feature driver is kept.
+
+  @param[in]  This               Not used.
+  @param[in]  FeatureManagedUri  Not used.
+  @param[in]  Callback           The callback.
+  @param[in]  Context            Context of the callback.
+
+  @retval EFI_SUCCESS  The callback is kept.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockFeatureRegister (
+  IN     EDKII_REDFISH_FEATURE_PROTOCOL  *This,
+  IN     EFI_STRING                      FeatureManagedUri,
+  IN     REDFISH_FEATURE_CALLBACK        Callback,
+  IN     VOID                            *Context
+  )
+{
+  mMockFeatureCallback = Callback;
+  mMockFeatureContext  = Context;
+  return EFI_SUCCESS;
+}
+
+/**
+  Drop the callback of the feature driver.
+
+  @param[in]  This               Not used.
+  @param[in]  FeatureManagedUri  Not used.
+  @param[in]  Context            Not used.
+
+  @retval EFI_SUCCESS  The callback is dropped.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockFeatureUnregister (
+  IN     EDKII_REDFISH_FEATURE_PROTOCOL  *This,
+  IN     EFI_STRING                      FeatureManagedUri,
+  IN     VOID                            *Context
+  )
+{
+  mMockFeatureCallback = NULL;
+  mMockFeatureContext  = NULL;
+  return EFI_SUCCESS;
+}
+
+STATIC EDKII_REDFISH_FEATURE_PROTOCOL  mMockFeature = {
+  MockFeatureRegister,
+  MockFeatureUnregister
+};
+
+/**
+  Return the session token of the service. The mockup has no session
+  service, so no session is logged in, but the feature driver takes the path
+  of shared session.
+
+  @param[in]   This                      Not used.
+  @param[in]   RedfishConfigServiceInfo  Not used.
+  @param[out]  SessionToken              The session token, freed by caller.
+
+  @retval EFI_SUCCESS           The session token is returned.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockServicePoolAcquire (
+  IN  EDKII_REDFISH_SERVICE_POOL_PROTOCOL  *This,
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION   *RedfishConfigServiceInfo,
+  OUT CHAR8                                **SessionToken
+  )
+{
+  *SessionToken = AllocateCopyPool (sizeof (MOCK_SESSION_TOKEN), MOCK_SESSION_TOKEN);
+  return (*SessionToken == NULL) ? EFI_OUT_OF_RESOURCES : EFI_SUCCESS;
+}
+
+/**
+  Release the session returned by MockServicePoolAcquire().
+
+  @param[in]  This                      Not used.
+  @param[in]  RedfishConfigServiceInfo  Not used.
+
+  @retval EFI_SUCCESS  Always.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+MockServicePoolRelease (
+  IN  EDKII_REDFISH_SERVICE_POOL_PROTOCOL  *This,
+  IN  REDFISH_CONFIG_SERVICE_INFORMATION   *RedfishConfigServiceInfo
+  )
+{
+  return EFI_SUCCESS;
+}
+
+STATIC EDKII_REDFISH_SERVICE_POOL_PROTOCOL  mMockServicePool = {
+  MockServicePoolAcquire,
+  MockServicePoolRelease
+};
+
+/**
+  Install the fake protocols the feature driver and its libraries consume:
+  REST JSON structure, Redfish platform config, Redfish feature and Redfish
+  service pool.
+
+  @retval EFI_SUCCESS  The protocols are installed.
+  @retval Others       Failed to install the protocols.
+**/
+EFI_STATUS
+MockInstallProtocols (
+  VOID
+  )
+{
+  EFI_HANDLE  Handle;
+
+  Handle = NULL;
+  return gBS->InstallMultipleProtocolInterfaces (
+                &Handle,
+                &gEfiRestJsonStructureProtocolGuid,
+                &mMockJsonStructure,
+                &gEdkIIRedfishPlatformConfigProtocolGuid,
+                &mMockPlatformConfig,
+                &gEdkIIRedfishFeatureProtocolGuid,
+                &mMockFeature,
+                &gEdkIIRedfishServicePoolProtocolGuid,
+                &mMockServicePool,
+                NULL
+                );
+}
+
+/**
+  Add one value to the fake HII configuration of Redfish platform config
+  protocol. The value is copied.
+
+  @param[in]  ConfigureLang  Configure language of the value.
+  @param[in]  Value          The value.
+
+  @retval EFI_SUCCESS           The value is added.
+  @retval EFI_OUT_OF_RESOURCES  There is not enough memory.
+**/
+EFI_STATUS
+MockAddPlatformConfigValue (
+  IN  EFI_STRING           ConfigureLang,
+  IN  EDKII_REDFISH_VALUE  *Value
+  )
+{
+  MOCK_CONFIG_VALUE  *ConfigValue;
+
+  if (mMockConfigValueCount == MOCK_CONFIG_VALUE_MAX) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  ConfigValue                = &mMockConfigValues[mMockConfigValueCount];
+  ConfigValue->ConfigureLang = AllocateCopyPool (StrSize (ConfigureLang), ConfigureLang);
+  if (ConfigValue->ConfigureLang == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  CopyMem (&ConfigValue->Value, Value, sizeof (EDKII_REDFISH_VALUE));
+  if (Value->Type == REDFISH_VALUE_TYPE_STRING) {
+    ConfigValue->Value.Value.Buffer = AllocateCopyPool (AsciiStrSize (Value->Value.Buffer), Value->Value.Buffer);
+    if (ConfigValue->Value.Value.Buffer == NULL) {
+      FreePool (ConfigValue->ConfigureLang);
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  mMockConfigValueCount++;
+  return EFI_SUCCESS;
+}
+
+/**
+  Run the callback the feature driver registered to the fake Redfish feature
+  protocol, as the feature core does for each resource.
+
+  @param[in]      Action               The action to take.
+  @param[in, out] InformationExchange  The information of the resource.
+
+  @retval EFI_NOT_READY  No feature driver is registered.
+  @retval Others         Status returned by the feature driver.
+**/
+EFI_STATUS
+MockRunFeatureCallback (
+  IN     FEATURE_CALLBACK_ACTION        Action,
+  IN OUT RESOURCE_INFORMATION_EXCHANGE  *InformationExchange
+  )
+{
+  if (mMockFeatureCallback == NULL) {
+    return EFI_NOT_READY;
+  }
+
+  return mMockFeatureCallback (&mMockFeature, Action, mMockFeatureContext, InformationExchange);
+}
+
+/**
+  Free what the mock UEFI services keep: handles, events, variables and the
+  fake HII configuration.
+**/
+VOID
+MockCleanup (
+  VOID
+  )
+{
+  MOCK_PROTOCOL_INTERFACE  *MockInterface;
+  MOCK_EVENT               *MockEvent;
+  UINTN                    Index;
+
+  while (!IsListEmpty (&mMockInterfaces)) {
+    MockInterface = BASE_CR (GetFirstNode (&mMockInterfaces), MOCK_PROTOCOL_INTERFACE, Link);
+    RemoveEntryList (&MockInterface->Link);
+    FreePool (MockInterface);
+  }
+
+  while (!IsListEmpty (&mMockEvents)) {
+    MockEvent = BASE_CR (GetFirstNode (&mMockEvents), MOCK_EVENT, Link);
+    RemoveEntryList (&MockEvent->Link);
+    FreePool (MockEvent);
+  }
+
+  for (Index = 0; Index < MOCK_VARIABLE_MAX; Index++) {
+    if (mMockVariables[Index].InUse) {
+      FreePool (mMockVariables[Index].Data);
+    }
+  }
+
+  ZeroMem (mMockVariables, sizeof (mMockVariables));
+
+  for (Index = 0; Index < mMockConfigValueCount; Index++) {
+    FreePool (mMockConfigValues[Index].ConfigureLang);
+    if (mMockConfigValues[Index].Value.Type == REDFISH_VALUE_TYPE_STRING) {
+      FreePool (mMockConfigValues[Index].Value.Value.Buffer);
+    }
+  }
+
+  mMockConfigValueCount = 0;
+  mMockFeatureCallback  = NULL;
+  mMockFeatureContext   = NULL;
+}
@@ -22,8 +22,8 @@ rfVersion = "0.9.6"
 rfProgram1 = "redfishProfileSimulator"
 rfProgram2 = "                "
 rfUsage1 = "[-Vh]  [--Version][--help]"
-rfUsage2 = "[-H<hostIP>] [-P<port>] [-C<cert>] [-K<key>] [-p<profile_path>]"
-rfUsage3 = "[--Host=<hostIP>] [--Port=<port>] [--Cert=<cert>] [--Key=<key>] [--profile_path=<profile_path>]"
+rfUsage2 = "[-H<hostIP>] [-P<port>] [-C<cert>] [-K<key>] [-p<profile_path>] [-L<latency>] [-S]"
+rfUsage3 = "[--Host=<hostIP>] [--Port=<port>] [--Cert=<cert>] [--Key=<key>] [--profile_path=<profile_path>] [--Latency=<latency>] [--Statistics]"
 
 
 def rf_usage():
@@ -60,6 +60,9 @@ def rf_help():
         print("       -K<key>,     --Key=<key>                      --- Server key.")
         print("       -p<profile_path>, --profile=<profile_path>    --- the path to the Redfish profile to use. "
               "dflt=\"./MockupData/SimpleOcpServerV1\" ")
+        print("       -L<latency>, --Latency=<latency>              --- delay every response by <latency> milliseconds. dflt=0")
+        print("       -S,          --Statistics                     --- list the requests per URI in the statistics"
+              " printed on exit")
 
 # Conditional Requests with ETags
 # http://flask.pocoo.org/snippets/95/
@@ -115,10 +118,12 @@ def main(argv):
     rf_port = 5000
     rf_cert =""
     rf_key=""
+    rf_latency = 0
+    rf_per_uri = False
 
     try:
-        opts, args = getopt.getopt(argv[1:], "VhH:P:C:K:p:",
-                                   ["Version", "help", "Host=", "Port=", "Cert=", "Key=", "profile="])
+        opts, args = getopt.getopt(argv[1:], "VhH:P:C:K:p:L:S",
+                                   ["Version", "help", "Host=", "Port=", "Cert=", "Key=", "profile=", "Latency=", "Statistics"])
     except getopt.GetoptError:
         print(rfProgram1, ":  Error parsing options")
         rf_usage()
@@ -140,6 +145,10 @@ def main(argv):
             rf_cert=arg
         elif opt in "--Key=":
             rf_key=arg
+        elif opt in ("-L", "--Latency"):
+            rf_latency = int(arg)
+        elif opt in ("-S", "--Statistics"):
+            rf_per_uri = True
         else:
             print("  ", rfProgram1, ":  Error: unsupported option")
             rf_usage()
@@ -157,6 +166,8 @@ def main(argv):
     print("{} Version: {}".format(rfProgram1,rfVersion))
     print("   Starting redfishProfileSimulator at:  hostIP={},  port={}".format(rf_host, rf_port))
     print("   Using Profile at {}".format(rf_profile_path))
+    if rf_latency > 0:
+        print("   Delaying every response by {} ms".format(rf_latency))
 
     if os.path.isdir(rf_profile_path):
         # import the classes and code we run from main.
@@ -165,6 +176,7 @@ def main(argv):
         # rfApi_SimpleServer is a function in ./RedfishProfileSim/redfishURIs.py.
         # It loads the flask APIs (URIs), and starts the flask service
         from v1sim.redfishURIs import rfApi_SimpleServer
+        from v1sim.statistics import RfStatistics
 
         # create the root service resource
         root_path = os.path.normpath("redfish/v1")
@@ -173,8 +185,15 @@ def main(argv):
         versions = RfServiceVersions(rf_profile_path, "redfish")
         root = RfServiceRoot(rf_profile_path, root_path)
 
+        # count the requests, they are printed when the service is stopped
+        statistics = RfStatistics(latency_ms=rf_latency, per_uri=rf_per_uri)
+
         # start the flask REST API service
-        rfApi_SimpleServer(root, versions, host=rf_host, port=rf_port, cert=rf_cert, key=rf_key)
+        try:
+            rfApi_SimpleServer(root, versions, host=rf_host, port=rf_port, cert=rf_cert, key=rf_key,
+                               statistics=statistics)
+        finally:
+            statistics.report()
     else:
         print("invalid profile path")
 
@@ -21,9 +21,13 @@ from v1sim.resource import RfCollection, RfResource, RfResourceRaw
 
 from werkzeug.serving import WSGIRequestHandler
 
-def rfApi_SimpleServer(root, versions, host="127.0.0.1", port=5000, cert="", key=""):
+def rfApi_SimpleServer(root, versions, host="127.0.0.1", port=5000, cert="", key="", statistics=None):
     app = Flask(__name__)
 
+    # delay the responses and count the requests
+    if statistics is not None:
+        statistics.attach(app)
+
     # create auth class that does basic or redifish session auth
     auth = RfHTTPBasicOrTokenAuth()
 
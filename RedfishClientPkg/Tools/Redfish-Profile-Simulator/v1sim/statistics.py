@@ -0,0 +1,70 @@
+#
+# Copyright Notice:
+# (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+# SPDX-License-Identifier: BSD-2-Clause-Patent
+#
+# Request statistics and response latency of the simulator. They are used to
+# measure how many round trips and bytes a Redfish client takes to provision
+# the platform, and how it behaves on a slow BMC.
+#
+
+import sys
+import threading
+import time
+from collections import OrderedDict
+
+from flask import request
+
+
+class RfStatistics():
+    def __init__(self, latency_ms=0, per_uri=False):
+        self.latency = latency_ms / 1000.0
+        self.per_uri = per_uri
+        self.lock = threading.Lock()
+        self.first = None
+        self.last = None
+        self.methods = OrderedDict()
+        self.uris = OrderedDict()
+
+    def attach(self, app):
+        @app.before_request
+        def rf_before_request():
+            if self.latency > 0:
+                time.sleep(self.latency)
+
+        @app.after_request
+        def rf_after_request(response):
+            self.record(request.method, request.path, request.content_length or 0,
+                        response.calculate_content_length() or 0, response.status_code)
+            return response
+
+    def record(self, method, uri, bytes_in, bytes_out, status):
+        now = time.time()
+        with self.lock:
+            if self.first is None:
+                self.first = now
+            self.last = now
+            for table, key in ((self.methods, method), (self.uris, method + " " + uri)):
+                entry = table.setdefault(key, [0, 0, 0, 0])
+                entry[0] += 1
+                entry[1] += 1 if status >= 400 else 0
+                entry[2] += bytes_in
+                entry[3] += bytes_out
+
+    def report(self, out=sys.stdout):
+        with self.lock:
+            if self.first is None:
+                print("No request is received.", file=out)
+                return
+            total = [sum(entry[i] for entry in self.methods.values()) for i in range(4)]
+            print("", file=out)
+            print("Requests: {}  Errors: {}  Bytes in: {}  Bytes out: {}  Wall time: {:.3f}s".format(
+                total[0], total[1], total[2], total[3], self.last - self.first), file=out)
+            tables = [("Method", self.methods)]
+            if self.per_uri:
+                tables.append(("Request", self.uris))
+            for title, table in tables:
+                print("", file=out)
+                print("{:<64} {:>8} {:>6} {:>10} {:>10}".format(title, "Count", "Error", "BytesIn", "BytesOut"), file=out)
+                for key, entry in sorted(table.items(), key=lambda item: item[1][0], reverse=True):
+                    print("{:<64} {:>8} {:>6} {:>10} {:>10}".format(key, entry[0], entry[1], entry[2], entry[3]), file=out)
@@ -0,0 +1,230 @@
+/** @file
+  A shell application that dumps the performance measurements of Redfish
+  modules collected by EDKII_REDFISH_PERF_PROTOCOL. The measurements are
+  sorted by the total time, so the slowest resources are listed first.
+
+  Usage: RedfishPerfDump [-r] [-h]
+    -r  Reset the measurements after they are dumped.
+    -h  Show help.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiLib.h>
+#include <Protocol/EdkIIRedfishPerf.h>
+#include <Protocol/ShellParameters.h>
+
+CONST CHAR8  *mCategoryName[RedfishPerfCategoryMax] = REDFISH_PERF_CATEGORY_NAMES;
+
+/**
+  Display the usage of this application.
+
+**/
+VOID
+ShowHelp (
+  VOID
+  )
+{
+  Print (L"Dump the performance measurements of Redfish modules.\n\n");
+  Print (L"RedfishPerfDump [-r] [-h]\n\n");
+  Print (L"  -r  Reset the measurements after they are dumped.\n");
+  Print (L"  -h  Show this help.\n");
+}
+
+/**
+  Sort the entries by the total time in descending order.
+
+  @param[in, out]  Entries       Array of entries.
+  @param[in]       EntryCount    Number of entries.
+
+**/
+VOID
+SortEntries (
+  IN OUT REDFISH_PERF_ENTRY  *Entries,
+  IN     UINTN               EntryCount
+  )
+{
+  REDFISH_PERF_ENTRY  Entry;
+  UINTN               Index;
+  UINTN               Position;
+
+  for (Index = 1; Index < EntryCount; Index++) {
+    CopyMem (&Entry, &Entries[Index], sizeof (REDFISH_PERF_ENTRY));
+    for (Position = Index; Position > 0 && Entries[Position - 1].TotalTime < Entry.TotalTime; Position--) {
+      CopyMem (&Entries[Position], &Entries[Position - 1], sizeof (REDFISH_PERF_ENTRY));
+    }
+
+    CopyMem (&Entries[Position], &Entry, sizeof (REDFISH_PERF_ENTRY));
+  }
+}
+
+/**
+  Convert nanoseconds to microseconds.
+
+  @param[in]  Time       Time in nanoseconds.
+
+  @return     Time in microseconds.
+
+**/
+UINT64
+NanoToMicro (
+  IN UINT64  Time
+  )
+{
+  return DivU64x32 (Time, 1000);
+}
+
+/**
+  Dump the measurements.
+
+  @param[in]  Entries       Array of entries.
+  @param[in]  EntryCount    Number of entries.
+
+**/
+VOID
+DumpEntries (
+  IN REDFISH_PERF_ENTRY  *Entries,
+  IN UINTN               EntryCount
+  )
+{
+  REDFISH_PERF_ENTRY  Summary[RedfishPerfCategoryMax];
+  REDFISH_PERF_ENTRY  *Entry;
+  UINTN               Index;
+
+  ZeroMem (Summary, sizeof (Summary));
+
+  Print (L"%-11a %8a %6a %12a %10a %10a %10a  %-36a %a\n", "Category", "Count", "Error", "Total(us)", "Avg(us)", "Max(us)", "Bytes", "Module", "Key");
+  for (Index = 0; Index < EntryCount; Index++) {
+    Entry = &Entries[Index];
+    if (Entry->Category >= RedfishPerfCategoryMax) {
+      continue;
+    }
+
+    Print (
+      L"%-11a %8ld %6ld %12ld %10ld %10ld %10ld  %g %a\n",
+      mCategoryName[Entry->Category],
+      (UINT64)Entry->Count,
+      (UINT64)Entry->ErrorCount,
+      NanoToMicro (Entry->TotalTime),
+      NanoToMicro (Entry->Count == 0 ? 0 : DivU64x64Remainder (Entry->TotalTime, Entry->Count, NULL)),
+      NanoToMicro (Entry->MaxTime),
+      Entry->Bytes,
+      &Entry->Module,
+      Entry->Key
+      );
+
+    Summary[Entry->Category].Count      += Entry->Count;
+    Summary[Entry->Category].ErrorCount += Entry->ErrorCount;
+    Summary[Entry->Category].TotalTime  += Entry->TotalTime;
+    Summary[Entry->Category].Bytes      += Entry->Bytes;
+    if (Entry->MaxTime > Summary[Entry->Category].MaxTime) {
+      Summary[Entry->Category].MaxTime = Entry->MaxTime;
+    }
+  }
+
+  Print (L"\nSummary:\n");
+  Print (L"%-11a %8a %6a %12a %10a %10a %10a\n", "Category", "Count", "Error", "Total(us)", "Avg(us)", "Max(us)", "Bytes");
+  for (Index = 0; Index < RedfishPerfCategoryMax; Index++) {
+    Entry = &Summary[Index];
+    if (Entry->Count == 0) {
+      continue;
+    }
+
+    Print (
+      L"%-11a %8ld %6ld %12ld %10ld %10ld %10ld\n",
+      mCategoryName[Index],
+      (UINT64)Entry->Count,
+      (UINT64)Entry->ErrorCount,
+      NanoToMicro (Entry->TotalTime),
+      NanoToMicro (DivU64x64Remainder (Entry->TotalTime, Entry->Count, NULL)),
+      NanoToMicro (Entry->MaxTime),
+      Entry->Bytes
+      );
+  }
+}
+
+/**
+  The user Entry Point for Application. The user code starts with this function
+  as the real entry point for the application.
+
+  @param[in] ImageHandle    The firmware allocated handle for the EFI image.
+  @param[in] SystemTable    A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS       The entry point is executed successfully.
+  @retval other             Some error occurs when executing this entry point.
+
+**/
+EFI_STATUS
+EFIAPI
+UefiMain (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS                     Status;
+  EFI_SHELL_PARAMETERS_PROTOCOL  *ShellParameters;
+  EDKII_REDFISH_PERF_PROTOCOL    *RedfishPerf;
+  REDFISH_PERF_ENTRY             *Entries;
+  UINTN                          EntryCount;
+  BOOLEAN                        Reset;
+  UINTN                          Index;
+
+  Reset  = FALSE;
+  Status = gBS->HandleProtocol (
+                  ImageHandle,
+                  &gEfiShellParametersProtocolGuid,
+                  (VOID **)&ShellParameters
+                  );
+  if (!EFI_ERROR (Status)) {
+    for (Index = 1; Index < ShellParameters->Argc; Index++) {
+      if ((StrCmp (ShellParameters->Argv[Index], L"-r") == 0) || (StrCmp (ShellParameters->Argv[Index], L"-R") == 0)) {
+        Reset = TRUE;
+      } else if ((StrCmp (ShellParameters->Argv[Index], L"-h") == 0) || (StrCmp (ShellParameters->Argv[Index], L"-?") == 0)) {
+        ShowHelp ();
+        return EFI_SUCCESS;
+      } else {
+        Print (L"RedfishPerfDump: The argument '%s' is invalid.\n", ShellParameters->Argv[Index]);
+        ShowHelp ();
+        return EFI_INVALID_PARAMETER;
+      }
+    }
+  }
+
+  Status = gBS->LocateProtocol (&gEdkIIRedfishPerfProtocolGuid, NULL, (VOID **)&RedfishPerf);
+  if (EFI_ERROR (Status)) {
+    Print (L"RedfishPerfDump: Redfish performance measurement is not enabled.\n");
+    return Status;
+  }
+
+  Status = RedfishPerf->GetEntries (RedfishPerf, &EntryCount, &Entries);
+  if (Status == EFI_NOT_FOUND) {
+    Print (L"RedfishPerfDump: Nothing is recorded.\n");
+    return EFI_SUCCESS;
+  } else if (EFI_ERROR (Status)) {
+    Print (L"RedfishPerfDump: Failed to get the measurements: %r\n", Status);
+    return Status;
+  }
+
+  SortEntries (Entries, EntryCount);
+  DumpEntries (Entries, EntryCount);
+
+  //
+  // The key strings are no longer valid after reset.
+  //
+  FreePool (Entries);
+
+  if (Reset) {
+    RedfishPerf->Reset (RedfishPerf);
+    Print (L"\nThe measurements are reset.\n");
+  }
+
+  return EFI_SUCCESS;
+}
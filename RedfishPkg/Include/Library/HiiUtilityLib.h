@@ -93,6 +93,12 @@ typedef struct {
   CHAR16           *ConfigRequest;  // <ConfigRequest> = <ConfigHdr> + <RequestElement>
   UINTN            ElementCount;    // Number of <RequestElement> in the <ConfigRequest>
   UINTN            SpareStrLen;     // Spare length of ConfigRequest string buffer
+
+  //
+  // For storage loaded on demand.
+  //
+  BOOLEAN          Loaded;          // Whole storage is loaded from Configuration Driver
+  UINT8            *LoadedMap;      // Bitmap of the bytes in Buffer loaded from Configuration Driver
 } HII_FORMSET_STORAGE;
 
 
@@ -978,6 +984,7 @@ typedef struct {
 
   UINTN                           IfrBinaryLength;         // Ifr binary data length of this formset.
   UINT8                           *IfrBinaryData;          // Point to the Ifr binary data.
+  UINT32                          StringPackageChecksum;   // Checksum of string packages in the package list.
 
   EFI_GUID                        Guid;                    // Formset Guid.
   EFI_STRING_ID                   FormSetTitle;            // String Id of Formset title.
@@ -1031,6 +1038,35 @@ CreateFormSetFromHiiHandle (
      OUT HII_FORMSET       *FormSet
   );
 
+/**
+  Check whether the FormSet in HII database is changed since it was created by
+  CreateFormSetFromHiiHandle(), and find the forms which need to be parsed again.
+
+  IFR opcodes of each form are compared separately. When the opcodes outside of
+  forms are changed, e.g. storage or default store, all forms are reported.
+
+  @param  FormSet                FormSet data structure.
+  @param  StringUpdated          Returned TRUE if string packages are changed.
+  @param  FormIdList             Returned FormId of the forms which are added,
+                                 removed or changed. It is allocated by this
+                                 function and must be freed by caller. NULL if
+                                 there is no changed form.
+  @param  FormIdCount            Returned number of FormId in FormIdList.
+
+  @retval EFI_SUCCESS            Update of FormSet is returned.
+  @retval EFI_INVALID_PARAMETER  One or more parameters are invalid.
+  @retval EFI_NOT_FOUND          The FormSet is no longer in HII database.
+  @retval EFI_OUT_OF_RESOURCES   There is not enough system memory.
+
+**/
+EFI_STATUS
+GetFormSetUpdate (
+  IN     HII_FORMSET    *FormSet,
+     OUT BOOLEAN        *StringUpdated,
+     OUT UINT16         **FormIdList,
+     OUT UINTN          *FormIdCount
+  );
+
 /**
   Initialize a Formset and get current setting for Questions.
 
@@ -1127,6 +1163,28 @@ SubmitForm (
   IN     HII_FORM       *Form
   );
 
+/**
+  Submit data of the given questions in a FormSet. Questions which refer to
+  the same storage are routed to the configuration driver together.
+
+  @param  FormSet                FormSet which contains the questions.
+  @param  FormList               Form of each question in QuestionList.
+  @param  QuestionList           Questions to submit.
+  @param  Count                  Number of questions in QuestionList.
+
+  @retval EFI_SUCCESS            The function completed successfully.
+  @retval EFI_INVALID_PARAMETER  One or more parameters are invalid.
+  @retval Others                 Other errors occur.
+
+**/
+EFI_STATUS
+SubmitQuestions (
+  IN HII_FORMSET    *FormSet,
+  IN HII_FORM       **FormList,
+  IN HII_STATEMENT  **QuestionList,
+  IN UINTN          Count
+  );
+
 /**
   Evaluate the result of a HII expression.
 
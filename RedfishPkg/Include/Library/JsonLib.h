@@ -87,6 +87,65 @@ typedef enum {
     EdkiiJsonTypeNull
 } EDKII_JSON_TYPE;
 
+///
+/// The incremental JSON parser created by JsonParserCreate().
+///
+typedef    VOID*    EDKII_JSON_PARSER;
+
+///
+/// The events reported to EDKII_JSON_PARSER_CALLBACK.
+///
+typedef enum {
+    EdkiiJsonParserEventValue,        ///< A string, number, true, false or null value,
+                                      ///< or an object or array which is loaded.
+    EdkiiJsonParserEventObjectStart,
+    EdkiiJsonParserEventObjectEnd,
+    EdkiiJsonParserEventArrayStart,
+    EdkiiJsonParserEventArrayEnd
+} EDKII_JSON_PARSER_EVENT;
+
+///
+/// The action EDKII_JSON_PARSER_CALLBACK returns. Continue, Load and Skip are
+/// different only for EdkiiJsonParserEventObjectStart and EdkiiJsonParserEventArrayStart.
+///
+typedef enum {
+    EdkiiJsonParserActionContinue,    ///< Report the members of the object or array one by one.
+    EdkiiJsonParserActionLoad,        ///< Load the whole object or array and report it with
+                                      ///< one EdkiiJsonParserEventValue, no end event.
+    EdkiiJsonParserActionSkip,        ///< Drop the object or array without building it,
+                                      ///< no more events until it ends, no end event.
+    EdkiiJsonParserActionAbort        ///< Stop parsing.
+} EDKII_JSON_PARSER_ACTION;
+
+/**
+  The callback function of the incremental JSON parser. It is called for each
+  value the parser completes, and for the start and end of each object and array
+  whose members are reported one by one.
+
+  @param[in]   Context        The context given to JsonParserCreate().
+  @param[in]   Event          The parser event.
+  @param[in]   Depth          The nesting level of the value. The root value is 0.
+  @param[in]   Key            The member name when the value is in an object,
+                              otherwise NULL.
+  @param[in]   Index          The index when the value is in an array, otherwise 0.
+  @param[in]   Value          The value of EdkiiJsonParserEventValue, otherwise NULL.
+                              The value is freed when the callback returns, caller
+                              calls JsonIncreaseReference() to keep it.
+
+  @retval      EDKII_JSON_PARSER_ACTION  The action to take.
+
+**/
+typedef
+EDKII_JSON_PARSER_ACTION
+(EFIAPI *EDKII_JSON_PARSER_CALLBACK)(
+  IN  VOID                     *Context,
+  IN  EDKII_JSON_PARSER_EVENT  Event,
+  IN  UINTN                    Depth,
+  IN  CONST CHAR8              *Key    OPTIONAL,
+  IN  UINTN                    Index,
+  IN  EDKII_JSON_VALUE         Value   OPTIONAL
+  );
+
 /**
   The function is used to initialize a JSON value which contains a new JSON array,
   or NULL on error. Initially, the array is empty.
@@ -799,6 +858,101 @@ JsonLoadBuffer (
   IN OUT EDKII_JSON_ERROR  *Error
   );
 
+/**
+  Create an incremental JSON parser. The JSON payload is given to the parser
+  piece by piece with JsonParserFeed() as it is received, so the payload never
+  needs to be kept in one buffer.
+
+  Without Callback, the parser loads the whole JSON value and JsonParserFinish()
+  returns it. With Callback, the parser reports the values with events and
+  builds only the objects and arrays the callback asks to load, so members the
+  caller doesn't need never take memory.
+
+  @param[in]   Flags         Flag of loading JSON payload, the value could be
+                             the combination of below flags. Other flags are
+                             ignored.
+                               - EDKII_JSON_REJECT_DUPLICATES
+                               - EDKII_JSON_DISABLE_EOF_CHECK
+                               - EDKII_JSON_DECODE_ANY
+  @param[in]   Callback      The function to report parser events. Optional.
+  @param[in]   Context       The context passed to Callback. Optional.
+
+  @retval      EDKII_JSON_PARSER  The parser. Caller frees it by JsonParserFree().
+  @retval      NULL               Not enough memory.
+
+**/
+EDKII_JSON_PARSER
+EFIAPI
+JsonParserCreate (
+  IN    UINTN                        Flags,
+  IN    EDKII_JSON_PARSER_CALLBACK   Callback  OPTIONAL,
+  IN    VOID                         *Context  OPTIONAL
+  );
+
+/**
+  Give the next piece of JSON payload to the parser. The piece may end anywhere,
+  even in the middle of a string or number.
+
+  @param[in]   Parser        The parser created by JsonParserCreate().
+  @param[in]   Buffer        The piece of JSON payload.
+  @param[in]   BufferLen     The length of Buffer in bytes.
+  @param[out]  Error         Returned error of the JSON payload. Optional.
+
+  @retval      EFI_SUCCESS             The piece is parsed.
+  @retval      EFI_INVALID_PARAMETER   Parser is NULL, or Buffer is NULL and BufferLen is not 0.
+  @retval      EFI_VOLUME_CORRUPTED    The payload is not valid JSON, see Error for the details.
+  @retval      EFI_ABORTED             The callback stops parsing.
+  @retval      EFI_ALREADY_STARTED     JsonParserFinish() is called already.
+  @retval      EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+EFI_STATUS
+EFIAPI
+JsonParserFeed (
+  IN    EDKII_JSON_PARSER  Parser,
+  IN    CONST CHAR8        *Buffer,
+  IN    UINTN              BufferLen,
+  OUT   EDKII_JSON_ERROR   *Error    OPTIONAL
+  );
+
+/**
+  Tell the parser the JSON payload ends and get the loaded JSON value.
+
+  @param[in]   Parser        The parser created by JsonParserCreate().
+  @param[out]  JsonValue     The JSON value loaded when the parser is created
+                             without callback, otherwise NULL. Caller needs to
+                             cleanup the value by calling JsonValueFree(). Optional.
+  @param[out]  Error         Returned error of the JSON payload. Optional.
+
+  @retval      EFI_SUCCESS             The payload is a complete JSON value.
+  @retval      EFI_INVALID_PARAMETER   Parser is NULL.
+  @retval      EFI_VOLUME_CORRUPTED    The payload is not valid JSON or it is not complete,
+                                       see Error for the details.
+  @retval      EFI_ABORTED             The callback stops parsing.
+  @retval      EFI_ALREADY_STARTED     JsonParserFinish() is called already.
+  @retval      EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+EFI_STATUS
+EFIAPI
+JsonParserFinish (
+  IN    EDKII_JSON_PARSER  Parser,
+  OUT   EDKII_JSON_VALUE   *JsonValue  OPTIONAL,
+  OUT   EDKII_JSON_ERROR   *Error      OPTIONAL
+  );
+
+/**
+  Free the parser and the JSON values it holds.
+
+  @param[in]   Parser        The parser created by JsonParserCreate().
+
+**/
+VOID
+EFIAPI
+JsonParserFree (
+  IN    EDKII_JSON_PARSER  Parser
+  );
+
 /**
   The reference count is used to track whether a value is still in use or not.
   When a value is created, it's reference count is set to 1.
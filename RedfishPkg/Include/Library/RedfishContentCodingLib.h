@@ -75,4 +75,18 @@ RedfishContentDecode (
   OUT VOID  **DecodedContentPointer,
   OUT UINTN *DecodedLength
   );
+
+/**
+  Return the content codings which RedfishContentDecode() supports, in the
+  format of HTTP Accept-Encoding header value. Redfish library sends it in
+  requests so REST service could compress the response.
+
+  @retval CHAR8 *   Accept-Encoding header value.
+  @retval NULL      No content coding is supported.
+
+**/
+CONST CHAR8 *
+RedfishContentAcceptEncoding (
+  VOID
+  );
 #endif
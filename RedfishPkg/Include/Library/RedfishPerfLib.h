@@ -0,0 +1,77 @@
+/** @file
+  Definitions of RedfishPerfLib. The library measures Redfish operations and
+  reports them to EDKII_REDFISH_PERF_PROTOCOL and to the performance
+  measurement log of PerformanceLib.
+
+  All functions return immediately when PcdRedfishPerfEnable is FALSE.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef REDFISH_PERF_LIB_H_
+#define REDFISH_PERF_LIB_H_
+
+#include <Uefi.h>
+#include <Protocol/EdkIIRedfishPerf.h>
+
+/**
+  Start to measure an operation.
+
+  @return   The time stamp to pass to RedfishPerfEnd(), or 0 if the measurement
+            is disabled.
+
+**/
+UINT64
+EFIAPI
+RedfishPerfStart (
+  VOID
+  );
+
+/**
+  End the measurement of operations started by RedfishPerfStart(), and record it.
+
+  @param[in]  Category        Category of the measured operations.
+  @param[in]  Key             URI, schema or feature the operations are for.
+  @param[in]  StartTick       The time stamp returned by RedfishPerfStart().
+  @param[in]  Count           Number of operations measured at once.
+  @param[in]  Bytes           Bytes sent and received.
+  @param[in]  Failed          TRUE if the operations failed.
+
+**/
+VOID
+EFIAPI
+RedfishPerfEnd (
+  IN REDFISH_PERF_CATEGORY  Category,
+  IN CONST CHAR8            *Key,
+  IN UINT64                 StartTick,
+  IN UINTN                  Count,
+  IN UINT64                 Bytes,
+  IN BOOLEAN                Failed
+  );
+
+/**
+  Same as RedfishPerfEnd(), but the key is a Unicode string.
+
+  @param[in]  Category        Category of the measured operations.
+  @param[in]  Key             URI, schema or feature the operations are for.
+  @param[in]  StartTick       The time stamp returned by RedfishPerfStart().
+  @param[in]  Count           Number of operations measured at once.
+  @param[in]  Bytes           Bytes sent and received.
+  @param[in]  Failed          TRUE if the operations failed.
+
+**/
+VOID
+EFIAPI
+RedfishPerfEndUnicode (
+  IN REDFISH_PERF_CATEGORY  Category,
+  IN CONST CHAR16           *Key,
+  IN UINT64                 StartTick,
+  IN UINTN                  Count,
+  IN UINT64                 Bytes,
+  IN BOOLEAN                Failed
+  );
+
+#endif
@@ -53,6 +53,43 @@ RedfishPlatformConfigSetValue (
   IN     EDKII_REDFISH_VALUE  Value
   );
 
+/**
+  Get Redfish values with the given list of Schema and Configure Language.
+  The result of each entry is returned in its Status field.
+
+  @param[in]      Count            The number of entries in ValueList.
+  @param[in,out]  ValueList        The list of Schema, Version and Configure Language to query.
+
+  @retval EFI_SUCCESS              All values are returned successfully.
+  @retval EFI_NOT_READY            Redfish Platform Config protocol is not ready.
+  @retval Others                   Some error happened. Check Status of each entry.
+
+**/
+EFI_STATUS
+RedfishPlatformConfigGetValues (
+  IN     UINTN                                      Count,
+  IN OUT EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *ValueList
+  );
+
+/**
+  Set Redfish values with the given list of Schema and Configure Language.
+  The values on the same HII storage are submitted together. The result of
+  each entry is returned in its Status field.
+
+  @param[in]      Count            The number of entries in ValueList.
+  @param[in,out]  ValueList        The list of Schema, Version, Configure Language and value to set.
+
+  @retval EFI_SUCCESS              All values are set successfully.
+  @retval EFI_NOT_READY            Redfish Platform Config protocol is not ready.
+  @retval Others                   Some error happened. Check Status of each entry.
+
+**/
+EFI_STATUS
+RedfishPlatformConfigSetValues (
+  IN     UINTN                                      Count,
+  IN OUT EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *ValueList
+  );
+
 /**
   Get the list of Configure Language from platform configuration by the given Schema and Pattern.
 
@@ -0,0 +1,133 @@
+/** @file
+  This file defines the EDKII_REDFISH_PERF_PROTOCOL interface.
+
+  Redfish modules report the time they spend on each operation, such as HTTP
+  request, JSON parse or HII question access, to this protocol through
+  RedfishPerfLib. The measurements are aggregated per category, module and
+  key (URI, schema or feature), so the resources which take most of the
+  Redfish provisioning time can be found out.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef EDKII_REDFISH_PERF_PROTOCOL_H_
+#define EDKII_REDFISH_PERF_PROTOCOL_H_
+
+typedef struct _EDKII_REDFISH_PERF_PROTOCOL EDKII_REDFISH_PERF_PROTOCOL;
+
+#define EDKII_REDFISH_PERF_PROTOCOL_GUID \
+    {  \
+      0x39fb93b6, 0x27e7, 0x41a6, { 0xb6, 0xcf, 0xe5, 0x25, 0x82, 0xf7, 0xad, 0x42 }  \
+    }
+
+///
+/// Category of the measured operation.
+///
+typedef enum {
+  RedfishPerfHttpRequest,     ///< HTTP request sent by RedfishLib. Key is the URI.
+  RedfishPerfRestEx,          ///< HTTP message sent and received by REST EX. Key is the URL.
+  RedfishPerfJsonParse,       ///< JSON text parsed by RedfishLib. Key is the URI.
+  RedfishPerfJsonConvert,     ///< JSON converted to or from structure. Key is the resource type.
+  RedfishPerfHiiGet,          ///< HII question value retrieved. Key is the schema.
+  RedfishPerfHiiSet,          ///< HII question value set. Key is the schema.
+  RedfishPerfFeatureDriver,   ///< Redfish feature driver callback. Key is the feature URI.
+  RedfishPerfCategoryMax
+} REDFISH_PERF_CATEGORY;
+
+#define REDFISH_PERF_CATEGORY_NAMES \
+  { "Http", "RestEx", "JsonParse", "JsonConvert", "HiiGet", "HiiSet", "Feature" }
+
+///
+/// Aggregated measurements of one category, module and key.
+///
+typedef struct {
+  REDFISH_PERF_CATEGORY    Category;
+  EFI_GUID                 Module;        ///< FILE_GUID of the module performs the operations.
+  CONST CHAR8              *Key;
+  UINTN                    Count;         ///< Number of operations.
+  UINTN                    ErrorCount;    ///< Number of failed operations, or HTTP status is 4XX or 5XX.
+  UINT64                   TotalTime;     ///< Total time in nanoseconds.
+  UINT64                   MaxTime;       ///< Longest time of a single measurement in nanoseconds.
+  UINT64                   Bytes;         ///< Bytes sent and received.
+} REDFISH_PERF_ENTRY;
+
+/**
+  Record a measurement.
+
+  @param[in]  This            Pointer to EDKII_REDFISH_PERF_PROTOCOL instance.
+  @param[in]  Category        Category of the measured operations.
+  @param[in]  Module          FILE_GUID of the module performs the operations.
+  @param[in]  Key             URI, schema or feature the operations are for.
+  @param[in]  Count           Number of operations measured at once.
+  @param[in]  Time            Time of the operations in nanoseconds.
+  @param[in]  Bytes           Bytes sent and received.
+  @param[in]  Failed          TRUE if the operations failed.
+
+  @retval EFI_SUCCESS             The measurement is recorded.
+  @retval EFI_INVALID_PARAMETER   This, Module or Key is NULL, or Category is invalid.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to record.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REDFISH_PERF_RECORD) (
+  IN EDKII_REDFISH_PERF_PROTOCOL  *This,
+  IN REDFISH_PERF_CATEGORY        Category,
+  IN CONST EFI_GUID               *Module,
+  IN CONST CHAR8                  *Key,
+  IN UINTN                        Count,
+  IN UINT64                       Time,
+  IN UINT64                       Bytes,
+  IN BOOLEAN                      Failed
+  );
+
+/**
+  Get the aggregated measurements.
+
+  @param[in]  This            Pointer to EDKII_REDFISH_PERF_PROTOCOL instance.
+  @param[out] EntryCount      Number of entries returned in EntryList.
+  @param[out] EntryList       Newly allocated array of entries, caller frees it.
+                              The Key strings are owned by this protocol and
+                              valid until Reset() is called.
+
+  @retval EFI_SUCCESS             The entries are returned.
+  @retval EFI_INVALID_PARAMETER   This, EntryCount or EntryList is NULL.
+  @retval EFI_NOT_FOUND           Nothing is recorded.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REDFISH_PERF_GET_ENTRIES) (
+  IN  EDKII_REDFISH_PERF_PROTOCOL  *This,
+  OUT UINTN                        *EntryCount,
+  OUT REDFISH_PERF_ENTRY           **EntryList
+  );
+
+/**
+  Drop all the recorded measurements.
+
+  @param[in]  This            Pointer to EDKII_REDFISH_PERF_PROTOCOL instance.
+
+  @retval EFI_SUCCESS             The measurements are dropped.
+  @retval EFI_INVALID_PARAMETER   This is NULL.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REDFISH_PERF_RESET) (
+  IN EDKII_REDFISH_PERF_PROTOCOL  *This
+  );
+
+struct _EDKII_REDFISH_PERF_PROTOCOL {
+  EDKII_REDFISH_PERF_RECORD       Record;
+  EDKII_REDFISH_PERF_GET_ENTRIES  GetEntries;
+  EDKII_REDFISH_PERF_RESET        Reset;
+};
+
+extern EFI_GUID  gEdkIIRedfishPerfProtocolGuid;
+
+#endif
@@ -47,6 +47,18 @@ typedef struct {
   UINTN                     ArrayCount;
 } EDKII_REDFISH_VALUE;
 
+/**
+  Definition of EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY. It describes one
+  value in the batch functions GetValues() and SetValues().
+ **/
+typedef struct {
+  CHAR8                     *Schema;          // The Redfish schema to query.
+  CHAR8                     *Version;         // The Redfish version to query.
+  EFI_STRING                ConfigureLang;    // The target value which match this configure Language.
+  EDKII_REDFISH_VALUE       Value;            // The value to set, or the returned value.
+  EFI_STATUS                Status;           // The result of this entry.
+} EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY;
+
 /**
   Get Redfish value with the given Schema and Configure Language.
 
@@ -142,11 +154,58 @@ EFI_STATUS
   OUT    CHAR8                                     **SupportedSchema
   );
 
+/**
+  Get Redfish values with the given list of Schema and Configure Language. All
+  entries are resolved in one pass. The result of each entry is returned in its
+  Status field.
+
+  @param[in]      This             Pointer to EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL instance.
+  @param[in]      Count            The number of entries in ValueList.
+  @param[in,out]  ValueList        The list of Schema, Version and Configure Language to query.
+                                   Value and Status of each entry are returned.
+
+  @retval EFI_SUCCESS              All values are returned successfully.
+  @retval Others                   Some error happened. Check Status of each entry.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REDFISH_PLATFORM_CONFIG_GET_VALUES) (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL     *This,
+  IN     UINTN                                      Count,
+  IN OUT EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *ValueList
+  );
+
+/**
+  Set Redfish values with the given list of Schema and Configure Language. All
+  entries are resolved in one pass, and the changes on the same HII storage are
+  submitted to the configuration driver together. The result of each entry is
+  returned in its Status field.
+
+  @param[in]      This             Pointer to EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL instance.
+  @param[in]      Count            The number of entries in ValueList.
+  @param[in,out]  ValueList        The list of Schema, Version, Configure Language and value to set.
+                                   Status of each entry is returned.
+
+  @retval EFI_SUCCESS              All values are set successfully.
+  @retval Others                   Some error happened. Check Status of each entry.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REDFISH_PLATFORM_CONFIG_SET_VALUES) (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL     *This,
+  IN     UINTN                                      Count,
+  IN OUT EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *ValueList
+  );
+
 struct _EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL {
   EDKII_REDFISH_PLATFORM_CONFIG_GET_VALUE             GetValue;
   EDKII_REDFISH_PLATFORM_CONFIG_SET_VALUE             SetValue;
   EDKII_REDFISH_PLATFORM_CONFIG_GET_CONFIG_LANG       GetConfigureLang;
   EDKII_REDFISH_PLATFORM_CONFIG_GET_SUPPORTED_SCHEMA  GetSupportedSchema;
+  EDKII_REDFISH_PLATFORM_CONFIG_GET_VALUES            GetValues;
+  EDKII_REDFISH_PLATFORM_CONFIG_SET_VALUES            SetValues;
 };
 
 extern EFI_GUID gEdkIIRedfishPlatformConfigProtocolGuid;
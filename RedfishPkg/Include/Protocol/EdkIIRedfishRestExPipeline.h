@@ -0,0 +1,102 @@
+/** @file
+  This file defines the EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL interface.
+
+  This protocol is installed by Redfish REST EX driver on the same child
+  handle of EFI_REST_EX_PROTOCOL. It sends a list of HTTP GET requests on
+  the persistent connection without waiting for the response of each
+  request, then receives the responses in the order of the requests. It
+  also lets the caller drive the asynchronous requests submitted through
+  EFI_REST_EX_PROTOCOL.AsyncSendReceive() on the same child.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef EDKII_REDFISH_REST_EX_PIPELINE_H_
+#define EDKII_REDFISH_REST_EX_PIPELINE_H_
+
+#include <Protocol/Http.h>
+
+typedef struct _EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL;
+
+#define EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL_GUID \
+    {  \
+      0xe9061b36, 0xc3f1, 0x4632, { 0xba, 0x74, 0x12, 0x99, 0x03, 0xb0, 0x9b, 0x87 }  \
+    }
+
+/**
+  Send a list of HTTP GET requests to REST service and receive the responses.
+
+  The requests are written to the connection back to back. Up to
+  PcdRedfishRestExPipelineDepth requests are outstanding on the connection,
+  the responses are received in the same order of RequestMessage. When the
+  connection is closed by REST service in the middle, the unanswered requests
+  are sent again on a new connection.
+
+  The status of each request is returned in ResponseStatus. EFI_SUCCESS means
+  a complete HTTP response is received in corresponding ResponseMessage,
+  caller checks the HTTP status code in ResponseMessage and frees the
+  response data, headers and body. ResponseMessage is zeroed out before the
+  requests are sent, the response messages it holds are not released.
+
+  @param[in]  This                Pointer to EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL instance.
+  @param[in]  RequestCount        Number of messages in RequestMessage, ResponseMessage
+                                  and ResponseStatus.
+  @param[in]  RequestMessage      Array of HTTP GET request messages.
+  @param[out] ResponseMessage     Array to receive the HTTP response messages.
+  @param[out] ResponseStatus      Array to receive the status of each request.
+
+  @retval EFI_SUCCESS             All requests are processed. Check ResponseStatus for
+                                  the result of each request.
+  @retval EFI_INVALID_PARAMETER   This, RequestMessage, ResponseMessage or ResponseStatus
+                                  is NULL, or RequestCount is zero.
+  @retval EFI_UNSUPPORTED         Any of the requests is not HTTP GET.
+  @retval EFI_NO_MEDIA            There is no media on the network interface.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to process.
+  @retval EFI_ACCESS_DENIED       The connection is in use by the caller of this function.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REDFISH_REST_EX_PIPELINE_SEND_RECEIVE)(
+  IN  EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL  *This,
+  IN  UINTN                                    RequestCount,
+  IN  EFI_HTTP_MESSAGE                         *RequestMessage,
+  OUT EFI_HTTP_MESSAGE                         *ResponseMessage,
+  OUT EFI_STATUS                               *ResponseStatus
+  );
+
+/**
+  Make progress on the asynchronous requests submitted by
+  EFI_REST_EX_PROTOCOL.AsyncSendReceive() on the same REST EX child.
+
+  REST EX driver processes the asynchronous requests in a periodic timer at
+  TPL_CALLBACK. A caller which waits for the requests at TPL_CALLBACK, e.g.
+  in an event notification function, blocks that timer. It calls this
+  function in its waiting loop instead, the queued requests are sent, the
+  responses are received and the event of completed REST EX token is
+  signaled.
+
+  @param[in]  This                Pointer to EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL instance.
+
+  @retval EFI_SUCCESS             There is no asynchronous request in progress.
+  @retval EFI_NOT_READY           Some asynchronous requests are still in progress.
+  @retval EFI_INVALID_PARAMETER   This is NULL.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *EDKII_REDFISH_REST_EX_PIPELINE_POLL)(
+  IN  EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL  *This
+  );
+
+struct _EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL {
+  EDKII_REDFISH_REST_EX_PIPELINE_SEND_RECEIVE  SendReceive;   ///< Send GET requests and receive responses in order.
+  EDKII_REDFISH_REST_EX_PIPELINE_POLL          Poll;          ///< Make progress on asynchronous requests.
+};
+
+extern EFI_GUID gEdkIIRedfishRestExPipelineProtocolGuid;
+
+#endif
@@ -14,6 +14,17 @@
 #include <Library/DebugLib.h>
 #include <Library/MemoryAllocationLib.h>
 
+//
+// ASCII characters are converted one 64-bit block at a time. The masks tell
+// whether all the characters in a block are ASCII.
+//
+#define ASCII_BLOCK_SIZE        sizeof (UINT64)
+#define UCS2_BLOCK_CHARS        (sizeof (UINT64) / sizeof (CHAR16))
+#define UTF8_NON_ASCII_MASK     0x8080808080808080ULL
+#define UCS2_NON_ASCII_MASK     0xFF80FF80FF80FF80ULL
+#define BYTE_REPEAT(Byte)       ((UINT64) (Byte) * 0x0101010101010101ULL)
+#define HAS_ZERO_BYTE(Block)    ((((Block) - BYTE_REPEAT (0x01)) & ~(Block) & UTF8_NON_ASCII_MASK) != 0)
+
 /**
   Since each UCS2 character can be represented by 1-3 UTF8 encoded characters,
   this function is used to retrieve the UTF8 encoding size for a UCS2 character.
@@ -280,38 +291,69 @@ UCS2StrToUTF8 (
   CHAR8    *Utf8Str;
   UINTN    Utf8StrLength;
   UINTN    Utf8StrIndex;
-  CHAR8    Utf8Buffer[UTF8_BUFFER_FOR_UCS2_MAX_SIZE];
-  UINT8    Utf8BufferSize;
+  UINTN    Index;
 
   if (Ucs2Str == NULL || Utf8StrAddr == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
+  //
+  // Each UCS2 character takes one byte in UTF8, one more byte when it is
+  // above 0x7F and another one when it is above 0x7FF.
+  //
   Ucs2StrLength = StrLen (Ucs2Str);
-  Utf8StrLength = 0;
+  Utf8StrLength = Ucs2StrLength;
+
+  Ucs2StrIndex = 0;
+  while (Ucs2StrIndex < Ucs2StrLength) {
 
-  for (Ucs2StrIndex = 0; Ucs2StrIndex < Ucs2StrLength; Ucs2StrIndex ++) {
+    if (Ucs2StrLength - Ucs2StrIndex >= UCS2_BLOCK_CHARS &&
+      (ReadUnaligned64 ((UINT64 *) (Ucs2Str + Ucs2StrIndex)) & UCS2_NON_ASCII_MASK) == 0) {
+
+      Ucs2StrIndex += UCS2_BLOCK_CHARS;
+      continue;
+    }
+
+    if (Ucs2Str[Ucs2StrIndex] > 0x7F) {
+      Utf8StrLength ++;
+      if (Ucs2Str[Ucs2StrIndex] > 0x7FF) {
+        Utf8StrLength ++;
+      }
+    }
 
-    ZeroMem (Utf8Buffer, sizeof (Utf8Buffer));
-    Utf8BufferSize = UCS2CharToUTF8 (Ucs2Str[Ucs2StrIndex], Utf8Buffer);
-    Utf8StrLength += Utf8BufferSize;
+    Ucs2StrIndex ++;
   }
 
-  Utf8Str = AllocateZeroPool (Utf8StrLength + 1);
+  Utf8Str = AllocatePool (Utf8StrLength + 1);
   if (Utf8Str == NULL) {
     return EFI_OUT_OF_RESOURCES;
   }
 
   Utf8StrIndex = 0;
-  for (Ucs2StrIndex = 0; Ucs2StrIndex < Ucs2StrLength; Ucs2StrIndex ++) {
+  Ucs2StrIndex = 0;
+  while (Ucs2StrIndex < Ucs2StrLength) {
 
-    ZeroMem (Utf8Buffer, sizeof (Utf8Buffer));
-    Utf8BufferSize = UCS2CharToUTF8 (Ucs2Str[Ucs2StrIndex], Utf8Buffer);
+    //
+    // Narrow a block of ASCII characters at once.
+    //
+    if (Ucs2StrLength - Ucs2StrIndex >= UCS2_BLOCK_CHARS &&
+      (ReadUnaligned64 ((UINT64 *) (Ucs2Str + Ucs2StrIndex)) & UCS2_NON_ASCII_MASK) == 0) {
 
-    CopyMem (Utf8Str + Utf8StrIndex, Utf8Buffer, Utf8BufferSize);
-    Utf8StrIndex += Utf8BufferSize;
+      for (Index = 0; Index < UCS2_BLOCK_CHARS; Index ++) {
+        Utf8Str[Utf8StrIndex + Index] = (CHAR8) Ucs2Str[Ucs2StrIndex + Index];
+      }
+
+      Utf8StrIndex += UCS2_BLOCK_CHARS;
+      Ucs2StrIndex += UCS2_BLOCK_CHARS;
+      continue;
+    }
+
+    Utf8StrIndex += UCS2CharToUTF8 (Ucs2Str[Ucs2StrIndex], Utf8Str + Utf8StrIndex);
+    Ucs2StrIndex ++;
   }
 
+  ASSERT (Utf8StrIndex == Utf8StrLength);
+
   Utf8Str[Utf8StrIndex] = '\0';
   *Utf8StrAddr = Utf8Str;
 
@@ -344,6 +386,8 @@ UTF8StrToUCS2 (
   UINTN         Ucs2StrIndex;
   UINT8         Utf8BufferSize;
   CHAR16        *Ucs2StrTemp;
+  UINT64        Block;
+  UINTN         Index;
 
   if (Utf8Str == NULL || Ucs2StrAddr == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -352,22 +396,38 @@ UTF8StrToUCS2 (
   //
   // It is not an Ascii string, calculate string length.
   //
-  Utf8StrLength = 0;
-  while (*(Utf8Str + Utf8StrLength) != '\0') {
-    Utf8StrLength ++;
-  }
+  Utf8StrLength = AsciiStrLen (Utf8Str);
 
   //
   // UCS2 string shall not be longer than the UTF8 string.
   //
-  Ucs2StrTemp = AllocateZeroPool ((Utf8StrLength + 1) * sizeof (CHAR16));
+  Ucs2StrTemp = AllocatePool ((Utf8StrLength + 1) * sizeof (CHAR16));
   if (Ucs2StrTemp == NULL) {
     return EFI_OUT_OF_RESOURCES;
   }
 
   Utf8StrIndex = 0;
   Ucs2StrIndex = 0;
-  while (Utf8Str[Utf8StrIndex] != '\0') {
+  while (Utf8StrIndex < Utf8StrLength) {
+
+    //
+    // Widen a block of ASCII characters at once, unless there is a "\\u"
+    // format in it.
+    //
+    if (Utf8StrLength - Utf8StrIndex >= ASCII_BLOCK_SIZE) {
+
+      Block = ReadUnaligned64 ((UINT64 *) (Utf8Str + Utf8StrIndex));
+      if ((Block & UTF8_NON_ASCII_MASK) == 0 && !HAS_ZERO_BYTE (Block ^ BYTE_REPEAT ('\\'))) {
+
+        for (Index = 0; Index < ASCII_BLOCK_SIZE; Index ++) {
+          Ucs2StrTemp[Ucs2StrIndex + Index] = (CHAR16) Utf8Str[Utf8StrIndex + Index];
+        }
+
+        Utf8StrIndex += ASCII_BLOCK_SIZE;
+        Ucs2StrIndex += ASCII_BLOCK_SIZE;
+        continue;
+      }
+    }
 
     if (CompareMem (Utf8Str + Utf8StrIndex, "\\u", 2) == 0 &&
       Utf8StrLength - Utf8StrIndex >= UNICODE_FORMAT_LEN) {
@@ -405,16 +465,22 @@ UTF8StrToUCS2 (
     }
   }
 
-  *Ucs2StrAddr = AllocateZeroPool ((Ucs2StrIndex + 1) * sizeof (CHAR16));
-  if (*Ucs2StrAddr == NULL) {
+  Ucs2StrTemp[Ucs2StrIndex] = L'\0';
 
-    FreePool (Ucs2StrTemp);
-    return EFI_OUT_OF_RESOURCES;
+  //
+  // The temporary string is returned as is when no character is shortened.
+  //
+  if (Ucs2StrIndex == Utf8StrLength) {
+
+    *Ucs2StrAddr = Ucs2StrTemp;
+    return EFI_SUCCESS;
   }
 
-  StrCpyS (*Ucs2StrAddr, Ucs2StrIndex + 1, Ucs2StrTemp);
-  *(*Ucs2StrAddr + Ucs2StrIndex) = L'\0';
+  *Ucs2StrAddr = AllocateCopyPool ((Ucs2StrIndex + 1) * sizeof (CHAR16), Ucs2StrTemp);
   FreePool (Ucs2StrTemp);
+  if (*Ucs2StrAddr == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
 
   return EFI_SUCCESS;
 }
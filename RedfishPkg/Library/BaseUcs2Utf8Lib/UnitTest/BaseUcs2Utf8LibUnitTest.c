@@ -0,0 +1,713 @@
+/** @file
+  Unit tests and benchmark of BaseUcs2Utf8Lib.
+
+  The string conversion is checked against the per character conversion the
+  library used before the ASCII block fast path, and the round trips both do
+  in the same time are counted on strings seen in Redfish payloads.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <time.h>
+#include <cmocka.h>
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UnitTestLib.h>
+#include <Library/BaseUcs2Utf8Lib.h>
+
+#define UNIT_TEST_APP_NAME     "BaseUcs2Utf8Lib Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+#define RANDOM_STRING_COUNT    20000
+#define RANDOM_STRING_PIECES   40
+#define BENCHMARK_SECONDS      1
+#define BENCHMARK_BATCH        256
+
+//
+// Pieces random strings are built from. ASCII pieces are picked more often,
+// like in Redfish payloads.
+//
+STATIC CONST CHAR8  *mPieces[] = {
+  "a",
+  "Z",
+  "/",
+  "\\",
+  "\\u00e9",
+  "\\u12",
+  "\\uzzzz",
+  "\xc3\xa9",
+  "\xe2\x82\xac",
+  "\xf0\x9f",
+  "\x80",
+  "{\"Id\":"
+};
+
+#define ASCII_PIECE_COUNT  3
+
+typedef
+EFI_STATUS
+(*ROUND_TRIP)(
+  IN  CHAR8  *Utf8Str
+  );
+
+STATIC CONST CHAR8  *mBenchmarkStrings[] = {
+  "/redfish/v1/Systems/1/Bios/Attributes/ProcessorHyperThreadingDisable",
+  "/redfish/v1/Systems/1/Memory/DIMM_A1",
+  "#ComputerSystem.v1_5_0.ComputerSystem",
+  "Caf\xc3\xa9 \xe2\x82\xac 100"
+};
+
+STATIC UINT32  mSeed;
+
+/**
+  Return the next pseudo random number, so every run sees the same strings.
+
+  @retval The random number.
+**/
+STATIC
+UINT32
+NextRandom (
+  VOID
+  )
+{
+  mSeed = mSeed * 1103515245 + 12345;
+  return (mSeed >> 16) & 0x7FFF;
+}
+
+/**
+  Reference: the UTF8 size of the character at Utf8Buffer, 0 if it is not
+  for UCS2.
+**/
+STATIC
+UINT8
+ReferenceGetUtf8Size (
+  IN  CHAR8  *Utf8Buffer
+  )
+{
+  CHAR8  TempChar;
+  UINT8  Utf8Size;
+
+  TempChar = *Utf8Buffer;
+  if ((TempChar & 0xF0) == 0xF0) {
+    return 0;
+  }
+
+  Utf8Size = 1;
+  if ((TempChar & 0x80) == 0x80) {
+    if ((TempChar & 0xC0) == 0xC0) {
+      Utf8Size++;
+      if ((TempChar & 0xE0) == 0xE0) {
+        Utf8Size++;
+      }
+    }
+  }
+
+  return Utf8Size;
+}
+
+/**
+  Reference: the UCS2 character of "\uXXXX" at Utf8Buffer.
+**/
+STATIC
+EFI_STATUS
+ReferenceGetUcs2CharByFormat (
+  IN  CHAR8   *Utf8Buffer,
+  OUT CHAR16  *Ucs2Char
+  )
+{
+  UINT8  Num1;
+  UINT8  Num2;
+  UINT8  Index;
+  CHAR8  Ucs2CharFormat[UNICODE_FORMAT_CHAR_SIZE];
+
+  for (Index = 0; Index < 4; Index++) {
+    if ((*(Utf8Buffer + 2 + Index) & 0x80) != 0x00) {
+      return EFI_INVALID_PARAMETER;
+    }
+  }
+
+  ZeroMem (Ucs2CharFormat, UNICODE_FORMAT_CHAR_SIZE);
+  CopyMem (Ucs2CharFormat, Utf8Buffer + 2, UNICODE_FORMAT_CHAR_LEN);
+  Num1 = (UINT8)AsciiStrHexToUintn (Ucs2CharFormat);
+  CopyMem (Ucs2CharFormat, Utf8Buffer + 4, UNICODE_FORMAT_CHAR_LEN);
+  Num2 = (UINT8)AsciiStrHexToUintn (Ucs2CharFormat);
+
+  *((CHAR8 *)Ucs2Char)       = Num2;
+  *(((CHAR8 *)Ucs2Char) + 1) = Num1;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Reference: encode one UCS2 character to UTF8.
+**/
+STATIC
+UINT8
+ReferenceUcs2CharToUtf8 (
+  IN  CHAR16  Ucs2Char,
+  OUT CHAR8   *Utf8Buffer
+  )
+{
+  if (Ucs2Char <= 0x007F) {
+    *Utf8Buffer = Ucs2Char & 0x7F;
+    return 1;
+  } else if (Ucs2Char <= 0x07FF) {
+    *(Utf8Buffer + 1) = (Ucs2Char & 0x3F) | 0x80;
+    *Utf8Buffer       = ((Ucs2Char >> 6) & 0x1F) | 0xC0;
+    return 2;
+  }
+
+  *(Utf8Buffer + 2) = (Ucs2Char & 0x3F) | 0x80;
+  *(Utf8Buffer + 1) = ((Ucs2Char >> 6) & 0x3F) | 0x80;
+  *Utf8Buffer       = ((Ucs2Char >> 12) & 0x0F) | 0xE0;
+  return 3;
+}
+
+/**
+  Reference: decode one UTF8 character to UCS2.
+**/
+STATIC
+EFI_STATUS
+ReferenceUtf8ToUcs2Char (
+  IN  CHAR8   *Utf8Buffer,
+  OUT CHAR16  *Ucs2Char
+  )
+{
+  CHAR8  *Ucs2Buffer;
+  CHAR8  TempChar1;
+  CHAR8  TempChar2;
+  CHAR8  TempChar3;
+
+  ZeroMem (Ucs2Char, sizeof (CHAR16));
+  Ucs2Buffer = (CHAR8 *)Ucs2Char;
+
+  switch (ReferenceGetUtf8Size (Utf8Buffer)) {
+    case 1:
+      TempChar1 = *Utf8Buffer;
+      if ((TempChar1 & 0x80) != 0x00) {
+        return EFI_INVALID_PARAMETER;
+      }
+
+      *Ucs2Buffer       = TempChar1;
+      *(Ucs2Buffer + 1) = 0;
+      break;
+
+    case 2:
+      TempChar1 = *Utf8Buffer;
+      TempChar2 = *(Utf8Buffer + 1);
+      if (((TempChar1 & 0xE0) != 0xC0) || ((TempChar2 & 0xC0) != 0x80)) {
+        return EFI_INVALID_PARAMETER;
+      }
+
+      *Ucs2Buffer       = (TempChar1 << 6) + (TempChar2 & 0x3F);
+      *(Ucs2Buffer + 1) = (TempChar1 >> 2) & 0x07;
+      break;
+
+    case 3:
+      TempChar1 = *Utf8Buffer;
+      TempChar2 = *(Utf8Buffer + 1);
+      TempChar3 = *(Utf8Buffer + 2);
+      if (((TempChar1 & 0xF0) != 0xE0) || ((TempChar2 & 0xC0) != 0x80) || ((TempChar3 & 0xC0) != 0x80)) {
+        return EFI_INVALID_PARAMETER;
+      }
+
+      *Ucs2Buffer       = (TempChar2 << 6) + (TempChar3 & 0x3F);
+      *(Ucs2Buffer + 1) = (TempChar1 << 4) + ((TempChar2 >> 2) & 0x0F);
+      break;
+
+    default:
+      return EFI_INVALID_PARAMETER;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Reference: UCS2StrToUTF8() one character at a time, encoding the string
+  twice to get its size first.
+**/
+STATIC
+EFI_STATUS
+ReferenceUcs2StrToUtf8 (
+  IN  CHAR16  *Ucs2Str,
+  OUT CHAR8   **Utf8StrAddr
+  )
+{
+  UINTN  Ucs2StrIndex;
+  UINTN  Ucs2StrLength;
+  CHAR8  *Utf8Str;
+  UINTN  Utf8StrLength;
+  UINTN  Utf8StrIndex;
+  CHAR8  Utf8Buffer[UTF8_BUFFER_FOR_UCS2_MAX_SIZE];
+  UINT8  Utf8BufferSize;
+
+  Ucs2StrLength = StrLen (Ucs2Str);
+  Utf8StrLength = 0;
+  for (Ucs2StrIndex = 0; Ucs2StrIndex < Ucs2StrLength; Ucs2StrIndex++) {
+    ZeroMem (Utf8Buffer, sizeof (Utf8Buffer));
+    Utf8StrLength += ReferenceUcs2CharToUtf8 (Ucs2Str[Ucs2StrIndex], Utf8Buffer);
+  }
+
+  Utf8Str = AllocateZeroPool (Utf8StrLength + 1);
+  if (Utf8Str == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Utf8StrIndex = 0;
+  for (Ucs2StrIndex = 0; Ucs2StrIndex < Ucs2StrLength; Ucs2StrIndex++) {
+    ZeroMem (Utf8Buffer, sizeof (Utf8Buffer));
+    Utf8BufferSize = ReferenceUcs2CharToUtf8 (Ucs2Str[Ucs2StrIndex], Utf8Buffer);
+    CopyMem (Utf8Str + Utf8StrIndex, Utf8Buffer, Utf8BufferSize);
+    Utf8StrIndex += Utf8BufferSize;
+  }
+
+  Utf8Str[Utf8StrIndex] = '\0';
+  *Utf8StrAddr          = Utf8Str;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Reference: UTF8StrToUCS2() one character at a time into a working buffer,
+  which is then copied to a pool of the exact size.
+**/
+STATIC
+EFI_STATUS
+ReferenceUtf8StrToUcs2 (
+  IN  CHAR8   *Utf8Str,
+  OUT CHAR16  **Ucs2StrAddr
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       Utf8StrIndex;
+  UINTN       Utf8StrLength;
+  UINTN       Ucs2StrIndex;
+  UINT8       Utf8BufferSize;
+  CHAR16      *Ucs2StrTemp;
+
+  Utf8StrLength = AsciiStrLen (Utf8Str);
+  Ucs2StrTemp   = AllocateZeroPool ((Utf8StrLength + 1) * sizeof (CHAR16));
+  if (Ucs2StrTemp == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Utf8StrIndex = 0;
+  Ucs2StrIndex = 0;
+  while (Utf8Str[Utf8StrIndex] != '\0') {
+    if ((CompareMem (Utf8Str + Utf8StrIndex, "\\u", 2) == 0) &&
+        (Utf8StrLength - Utf8StrIndex >= UNICODE_FORMAT_LEN))
+    {
+      Status = ReferenceGetUcs2CharByFormat (Utf8Str + Utf8StrIndex, Ucs2StrTemp + Ucs2StrIndex);
+      if (!EFI_ERROR (Status)) {
+        Utf8StrIndex += UNICODE_FORMAT_LEN;
+        Ucs2StrIndex++;
+      } else {
+        Ucs2StrTemp[Ucs2StrIndex]     = L'\\';
+        Ucs2StrTemp[Ucs2StrIndex + 1] = L'u';
+        Ucs2StrIndex                 += 2;
+        Utf8StrIndex                 += 2;
+      }
+    } else {
+      Utf8BufferSize = ReferenceGetUtf8Size (Utf8Str + Utf8StrIndex);
+      if ((Utf8BufferSize == 0) || (Utf8StrLength - Utf8StrIndex < Utf8BufferSize)) {
+        FreePool (Ucs2StrTemp);
+        return EFI_INVALID_PARAMETER;
+      }
+
+      Status = ReferenceUtf8ToUcs2Char (Utf8Str + Utf8StrIndex, Ucs2StrTemp + Ucs2StrIndex);
+      if (EFI_ERROR (Status)) {
+        FreePool (Ucs2StrTemp);
+        return EFI_INVALID_PARAMETER;
+      }
+
+      Ucs2StrIndex++;
+      Utf8StrIndex += Utf8BufferSize;
+    }
+  }
+
+  *Ucs2StrAddr = AllocateCopyPool ((Ucs2StrIndex + 1) * sizeof (CHAR16), Ucs2StrTemp);
+  FreePool (Ucs2StrTemp);
+  if (*Ucs2StrAddr == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  (*Ucs2StrAddr)[Ucs2StrIndex] = L'\0';
+  return EFI_SUCCESS;
+}
+
+/**
+  Convert Utf8Str by the library and by the reference, and check both give
+  the same status and the same string, in both directions.
+
+  @retval TRUE   Library and reference agree.
+  @retval FALSE  They don't.
+**/
+STATIC
+BOOLEAN
+MatchReference (
+  IN  CHAR8  *Utf8Str
+  )
+{
+  EFI_STATUS  Status;
+  EFI_STATUS  ReferenceStatus;
+  CHAR16      *Ucs2Str;
+  CHAR16      *ReferenceUcs2Str;
+  CHAR8       *Utf8Back;
+  CHAR8       *ReferenceUtf8Back;
+  BOOLEAN     Match;
+
+  Ucs2Str          = NULL;
+  ReferenceUcs2Str = NULL;
+  Status           = UTF8StrToUCS2 (Utf8Str, &Ucs2Str);
+  ReferenceStatus  = ReferenceUtf8StrToUcs2 (Utf8Str, &ReferenceUcs2Str);
+  if (Status != ReferenceStatus) {
+    UT_LOG_ERROR ("UTF8StrToUCS2 of \"%a\": %r, reference: %r\n", Utf8Str, Status, ReferenceStatus);
+    Match = FALSE;
+    goto ON_EXIT;
+  }
+
+  if (EFI_ERROR (Status)) {
+    Match = TRUE;
+    goto ON_EXIT;
+  }
+
+  Match = (BOOLEAN)(StrCmp (Ucs2Str, ReferenceUcs2Str) == 0);
+  if (!Match) {
+    UT_LOG_ERROR ("UTF8StrToUCS2 of \"%a\" differs from reference\n", Utf8Str);
+    goto ON_EXIT;
+  }
+
+  Utf8Back          = NULL;
+  ReferenceUtf8Back = NULL;
+  Status            = UCS2StrToUTF8 (Ucs2Str, &Utf8Back);
+  ReferenceStatus   = ReferenceUcs2StrToUtf8 (ReferenceUcs2Str, &ReferenceUtf8Back);
+  Match             = (BOOLEAN)(Status == ReferenceStatus && !EFI_ERROR (Status) && AsciiStrCmp (Utf8Back, ReferenceUtf8Back) == 0);
+  if (!Match) {
+    UT_LOG_ERROR ("UCS2StrToUTF8 of \"%a\" differs from reference\n", Utf8Str);
+  }
+
+  if (Utf8Back != NULL) {
+    FreePool (Utf8Back);
+  }
+
+  if (ReferenceUtf8Back != NULL) {
+    FreePool (ReferenceUtf8Back);
+  }
+
+ON_EXIT:
+  if (Ucs2Str != NULL) {
+    FreePool (Ucs2Str);
+  }
+
+  if (ReferenceUcs2Str != NULL) {
+    FreePool (ReferenceUcs2Str);
+  }
+
+  return Match;
+}
+
+/**
+  Known strings are converted to the expected result.
+
+  @param[in]  Context  Not used.
+
+  @retval UNIT_TEST_PASSED  The test passed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+ConvertKnownStringsShouldSucceed (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CHAR16  *Ucs2Str;
+  CHAR8   *Utf8Str;
+
+  UT_ASSERT_NOT_EFI_ERROR (UTF8StrToUCS2 ("/redfish/v1/Systems/1", &Ucs2Str));
+  UT_ASSERT_EQUAL (StrCmp (Ucs2Str, L"/redfish/v1/Systems/1"), 0);
+  FreePool (Ucs2Str);
+
+  UT_ASSERT_NOT_EFI_ERROR (UTF8StrToUCS2 ("Caf\xc3\xa9 \xe2\x82\xac\\u00e9\\u12", &Ucs2Str));
+  UT_ASSERT_EQUAL (StrCmp (Ucs2Str, L"Caf\x00e9 \x20ac\x00e9\\u12"), 0);
+  FreePool (Ucs2Str);
+
+  UT_ASSERT_NOT_EFI_ERROR (UCS2StrToUTF8 (L"Caf\x00e9 \x20ac 1234567890", &Utf8Str));
+  UT_ASSERT_EQUAL (AsciiStrCmp (Utf8Str, "Caf\xc3\xa9 \xe2\x82\xac 1234567890"), 0);
+  FreePool (Utf8Str);
+
+  UT_ASSERT_NOT_EFI_ERROR (UCS2StrToUTF8 (L"", &Utf8Str));
+  UT_ASSERT_EQUAL (Utf8Str[0], '\0');
+  FreePool (Utf8Str);
+
+  UT_ASSERT_STATUS_EQUAL (UTF8StrToUCS2 ("12345678\xf0\x9f\x98\x80", &Ucs2Str), EFI_INVALID_PARAMETER);
+  UT_ASSERT_STATUS_EQUAL (UTF8StrToUCS2 ("1234567\xc3", &Ucs2Str), EFI_INVALID_PARAMETER);
+  UT_ASSERT_STATUS_EQUAL (UTF8StrToUCS2 (NULL, &Ucs2Str), EFI_INVALID_PARAMETER);
+  UT_ASSERT_STATUS_EQUAL (UCS2StrToUTF8 (NULL, &Utf8Str), EFI_INVALID_PARAMETER);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Random strings, valid or not, are converted the same as the reference, at
+  every alignment and length around the block size.
+
+  @param[in]  Context  Not used.
+
+  @retval UNIT_TEST_PASSED  The test passed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+ConvertRandomStringsShouldMatchReference (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CHAR8        Buffer[RANDOM_STRING_PIECES * 8 + 1];
+  UINTN        Length;
+  UINTN        Index;
+  UINTN        Count;
+  UINTN        Piece;
+  CONST CHAR8  *PieceStr;
+
+  mSeed = 1;
+  for (Index = 0; Index < RANDOM_STRING_COUNT; Index++) {
+    Length = 0;
+    Count  = NextRandom () % RANDOM_STRING_PIECES;
+    for (Piece = 0; Piece < Count; Piece++) {
+      if ((NextRandom () % 3) != 0) {
+        PieceStr = mPieces[NextRandom () % ASCII_PIECE_COUNT];
+      } else {
+        PieceStr = mPieces[NextRandom () % ARRAY_SIZE (mPieces)];
+      }
+
+      CopyMem (Buffer + Length, PieceStr, AsciiStrLen (PieceStr));
+      Length += AsciiStrLen (PieceStr);
+    }
+
+    Buffer[Length] = '\0';
+    UT_ASSERT_TRUE (MatchReference (Buffer));
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Convert Utf8Str to UCS2 and back with the library.
+
+  @retval EFI_SUCCESS  Both conversions succeeded.
+  @retval Others       A conversion failed.
+**/
+STATIC
+EFI_STATUS
+LibraryRoundTrip (
+  IN  CHAR8  *Utf8Str
+  )
+{
+  EFI_STATUS  Status;
+  CHAR16      *Ucs2Str;
+  CHAR8       *Utf8Back;
+
+  Status = UTF8StrToUCS2 (Utf8Str, &Ucs2Str);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = UCS2StrToUTF8 (Ucs2Str, &Utf8Back);
+  FreePool (Ucs2Str);
+  if (!EFI_ERROR (Status)) {
+    FreePool (Utf8Back);
+  }
+
+  return Status;
+}
+
+/**
+  Convert Utf8Str to UCS2 and back with the reference.
+
+  @retval EFI_SUCCESS  Both conversions succeeded.
+  @retval Others       A conversion failed.
+**/
+STATIC
+EFI_STATUS
+ReferenceRoundTrip (
+  IN  CHAR8  *Utf8Str
+  )
+{
+  EFI_STATUS  Status;
+  CHAR16      *Ucs2Str;
+  CHAR8       *Utf8Back;
+
+  Status = ReferenceUtf8StrToUcs2 (Utf8Str, &Ucs2Str);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = ReferenceUcs2StrToUtf8 (Ucs2Str, &Utf8Back);
+  FreePool (Ucs2Str);
+  if (!EFI_ERROR (Status)) {
+    FreePool (Utf8Back);
+  }
+
+  return Status;
+}
+
+/**
+  Count the round trips of Utf8Str done in BENCHMARK_SECONDS.
+
+  time() is the only clock the C runtime mapping of RedfishPkg provides and
+  it counts seconds, so the count starts on a tick and the clock is read
+  once every BENCHMARK_BATCH round trips.
+
+  @param[in]  RoundTrip  The round trip to count.
+  @param[in]  Utf8Str    The string to convert.
+
+  @retval The number of round trips, 0 if one failed.
+**/
+STATIC
+UINTN
+CountRoundTrips (
+  IN  ROUND_TRIP  RoundTrip,
+  IN  CHAR8       *Utf8Str
+  )
+{
+  time_t  Start;
+  time_t  End;
+  UINTN   Count;
+  UINTN   Batch;
+
+  Start = time (NULL);
+  while (time (NULL) == Start) {
+  }
+
+  End   = time (NULL) + BENCHMARK_SECONDS;
+  Count = 0;
+  while (time (NULL) < End) {
+    for (Batch = 0; Batch < BENCHMARK_BATCH; Batch++) {
+      if (EFI_ERROR (RoundTrip (Utf8Str))) {
+        return 0;
+      }
+    }
+
+    Count += BENCHMARK_BATCH;
+  }
+
+  return Count;
+}
+
+/**
+  Count round trips of Redfish strings by the library and by the reference
+  in the same time. The counts are logged, only the results are checked.
+
+  @param[in]  Context  Not used.
+
+  @retval UNIT_TEST_PASSED  The test passed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+BenchmarkRoundTrip (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  Index;
+  UINTN  LibraryCount;
+  UINTN  ReferenceCount;
+
+  for (Index = 0; Index < ARRAY_SIZE (mBenchmarkStrings); Index++) {
+    UT_ASSERT_TRUE (MatchReference ((CHAR8 *)mBenchmarkStrings[Index]));
+
+    ReferenceCount = CountRoundTrips (ReferenceRoundTrip, (CHAR8 *)mBenchmarkStrings[Index]);
+    LibraryCount   = CountRoundTrips (LibraryRoundTrip, (CHAR8 *)mBenchmarkStrings[Index]);
+    UT_ASSERT_NOT_EQUAL (ReferenceCount, 0);
+    UT_ASSERT_NOT_EQUAL (LibraryCount, 0);
+
+    UT_LOG_INFO (
+      "\"%a\": round trips in %d s, reference %ld, library %ld, %ld.%02ld times\n",
+      mBenchmarkStrings[Index],
+      BENCHMARK_SECONDS,
+      (UINT64)ReferenceCount,
+      (UINT64)LibraryCount,
+      (UINT64)(LibraryCount / ReferenceCount),
+      (UINT64)(LibraryCount * 100 / ReferenceCount % 100)
+      );
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  BaseUcs2Utf8Lib and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      Ucs2Utf8Tests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  Status = CreateUnitTestSuite (&Ucs2Utf8Tests, Framework, "UCS2 UTF8 Conversion Tests", "BaseUcs2Utf8Lib.Convert", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for UCS2 UTF8 Conversion Tests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  AddTestCase (Ucs2Utf8Tests, "Convert known strings",                "Known",     ConvertKnownStringsShouldSucceed,         NULL, NULL, NULL);
+  AddTestCase (Ucs2Utf8Tests, "Convert random strings as reference",  "Reference", ConvertRandomStringsShouldMatchReference, NULL, NULL, NULL);
+  AddTestCase (Ucs2Utf8Tests, "Benchmark round trip with reference",  "Benchmark", BenchmarkRoundTrip,                       NULL, NULL, NULL);
+
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework != NULL) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+
+  @param[in]  Argc  Number of arguments.
+  @param[in]  Argv  Array of arguments.
+
+  @retval  0      All test cases were dispatched.
+  @retval  Other  Failed to initialize the unit tests.
+**/
+INT32
+main (
+  IN INT32  Argc,
+  IN CHAR8  *Argv[]
+  )
+{
+  return (INT32)UnitTestingEntry ();
+}
@@ -34,6 +34,7 @@
 #include <Library/HiiLib.h>
 #include <Library/DevicePathLib.h>
 #include <Library/UefiLib.h>
+#include <Library/PcdLib.h>
 
 #include "HiiExpression.h"
 #include <Library/HiiUtilityLib.h>
@@ -73,6 +74,19 @@ NewStringCpy (
   IN     CHAR16    *Src
   );
 
+/**
+  Allocate new memory and concatinate Source on the end of Destination.
+
+  @param  Dest                   String to added to the end of.
+  @param  Src                    String to concatinate.
+
+**/
+VOID
+NewStringCat (
+  IN OUT CHAR16    **Dest,
+  IN     CHAR16    *Src
+  );
+
 /**
   Set Value of given Name in a NameValue Storage.
 
@@ -286,6 +300,8 @@ ConfigRespToStorage (
                                  On output, GUID of the formset found(if not NULL).
   @param  BinaryLength           The length of the FormSet IFR binary.
   @param  BinaryData             The buffer designed to receive the FormSet.
+  @param  StringChecksum         The checksum of string packages in the package
+                                 list. Optional.
 
   @retval EFI_SUCCESS            Buffer filled with the requested FormSet.
                                  BufferLength was updated.
@@ -299,7 +315,40 @@ GetIfrBinaryData (
   IN     EFI_HII_HANDLE    Handle,
   IN OUT EFI_GUID          *FormSetGuid,
      OUT UINTN             *BinaryLength,
-     OUT UINT8             **BinaryData
+     OUT UINT8             **BinaryData,
+     OUT UINT32            *StringChecksum  OPTIONAL
+  );
+
+//
+// Checksum of the IFR opcodes of one form.
+//
+typedef struct {
+  UINT16    FormId;
+  UINT32    Checksum;
+} HII_FORM_CHECKSUM;
+
+/**
+  Calculate the checksum of each form in FormSet IFR binary, and the checksum
+  of the opcodes which are not in any form.
+
+  @param  BinaryData             FormSet IFR binary.
+  @param  BinaryLength           The length of BinaryData.
+  @param  FormSetChecksum        Returned checksum of the opcodes outside of forms.
+  @param  FormChecksumList       Returned checksum of each form. It is allocated
+                                 by this function and must be freed by caller.
+  @param  FormCount              Returned number of forms in FormChecksumList.
+
+  @retval EFI_SUCCESS            Checksums are returned.
+  @retval EFI_OUT_OF_RESOURCES   There is not enough system memory.
+
+**/
+EFI_STATUS
+GetIfrFormChecksum (
+  IN     UINT8                *BinaryData,
+  IN     UINTN                BinaryLength,
+     OUT UINT32               *FormSetChecksum,
+     OUT HII_FORM_CHECKSUM    **FormChecksumList,
+     OUT UINTN                *FormCount
   );
 
 /**
@@ -315,6 +364,53 @@ LoadStorage (
   IN HII_FORMSET_STORAGE    *Storage
   );
 
+/**
+  Make sure the storage data referred by the question is loaded from
+  Configuration Driver. Only the <RequestElement> of the question is
+  requested for buffer storage.
+
+  @param  FormSet                FormSet data structure.
+  @param  Question               The question.
+
+**/
+VOID
+LoadQuestionStorage (
+  IN HII_FORMSET            *FormSet,
+  IN HII_STATEMENT          *Question
+  );
+
+/**
+  Make sure the storage data referred by the questions of a form is loaded
+  from Configuration Driver. The <RequestElement> of all questions not loaded
+  yet are requested at once, and the data already in storage is kept.
+
+  @param  FormSet                FormSet data structure.
+  @param  Form                   Form data structure.
+  @param  Storage                The storage.
+
+**/
+VOID
+LoadFormStorage (
+  IN HII_FORMSET            *FormSet,
+  IN HII_FORM               *Form,
+  IN HII_FORMSET_STORAGE    *Storage
+  );
+
+/**
+  Mark the given range of buffer storage as loaded from Configuration Driver.
+
+  @param  Storage                Buffer Storage.
+  @param  Offset                 Offset of the range.
+  @param  Width                  Width of the range.
+
+**/
+VOID
+MarkStorageRangeLoaded (
+  IN HII_FORMSET_STORAGE    *Storage,
+  IN UINTN                  Offset,
+  IN UINTN                  Width
+  );
+
 /**
   Free resources of a Form.
 
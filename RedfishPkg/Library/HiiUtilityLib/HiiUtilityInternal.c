@@ -748,6 +748,137 @@ ConfigRespToStorage (
   return Status;
 }
 
+/**
+  Accumulate FNV-1a checksum of data.
+
+  @param  Checksum               Checksum of previous data.
+  @param  Data                   Data to be accumulated.
+  @param  Length                 The length of Data.
+
+  @return Checksum of previous data and Data.
+
+**/
+UINT32
+IfrChecksum (
+  IN UINT32    Checksum,
+  IN UINT8     *Data,
+  IN UINTN     Length
+  )
+{
+  while (Length > 0) {
+    Checksum ^= *Data;
+    Checksum *= 16777619U;
+    Data++;
+    Length--;
+  }
+
+  return Checksum;
+}
+
+/**
+  Calculate the checksum of each form in FormSet IFR binary, and the checksum
+  of the opcodes which are not in any form.
+
+  @param  BinaryData             FormSet IFR binary.
+  @param  BinaryLength           The length of BinaryData.
+  @param  FormSetChecksum        Returned checksum of the opcodes outside of forms.
+  @param  FormChecksumList       Returned checksum of each form. It is allocated
+                                 by this function and must be freed by caller.
+  @param  FormCount              Returned number of forms in FormChecksumList.
+
+  @retval EFI_SUCCESS            Checksums are returned.
+  @retval EFI_OUT_OF_RESOURCES   There is not enough system memory.
+
+**/
+EFI_STATUS
+GetIfrFormChecksum (
+  IN     UINT8                *BinaryData,
+  IN     UINTN                BinaryLength,
+     OUT UINT32               *FormSetChecksum,
+     OUT HII_FORM_CHECKSUM    **FormChecksumList,
+     OUT UINTN                *FormCount
+  )
+{
+  EFI_IFR_OP_HEADER  *OpCode;
+  UINTN              Offset;
+  UINTN              FormStart;
+  UINTN              Depth;
+  UINTN              MaxCount;
+  BOOLEAN            InForm;
+
+  *FormSetChecksum  = 2166136261U;
+  *FormChecksumList = NULL;
+  *FormCount        = 0;
+
+  //
+  // Count the forms first.
+  //
+  MaxCount = 0;
+  for (Offset = 0; Offset + sizeof (EFI_IFR_OP_HEADER) <= BinaryLength; Offset += OpCode->Length) {
+    OpCode = (EFI_IFR_OP_HEADER *) (BinaryData + Offset);
+    if (OpCode->Length == 0) {
+      break;
+    }
+
+    if (OpCode->OpCode == EFI_IFR_FORM_OP || OpCode->OpCode == EFI_IFR_FORM_MAP_OP) {
+      MaxCount++;
+    }
+  }
+
+  if (MaxCount != 0) {
+    *FormChecksumList = AllocatePool (MaxCount * sizeof (HII_FORM_CHECKSUM));
+    if (*FormChecksumList == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+  }
+
+  //
+  // A form starts with form opcode in formset scope and ends with the end
+  // opcode which closes its scope.
+  //
+  Depth     = 0;
+  FormStart = 0;
+  InForm    = FALSE;
+  for (Offset = 0; Offset + sizeof (EFI_IFR_OP_HEADER) <= BinaryLength; Offset += OpCode->Length) {
+    OpCode = (EFI_IFR_OP_HEADER *) (BinaryData + Offset);
+    if (OpCode->Length == 0) {
+      break;
+    }
+
+    if (!InForm && Depth == 1 && *FormCount < MaxCount &&
+        (OpCode->OpCode == EFI_IFR_FORM_OP || OpCode->OpCode == EFI_IFR_FORM_MAP_OP)) {
+      InForm    = TRUE;
+      FormStart = Offset;
+      CopyMem (&(*FormChecksumList)[*FormCount].FormId, &((EFI_IFR_FORM *) OpCode)->FormId, sizeof (UINT16));
+    }
+
+    if (!InForm) {
+      *FormSetChecksum = IfrChecksum (*FormSetChecksum, (UINT8 *) OpCode, OpCode->Length);
+    }
+
+    if (OpCode->Scope != 0) {
+      Depth++;
+    } else if (OpCode->OpCode == EFI_IFR_END_OP && Depth > 0) {
+      Depth--;
+    }
+
+    if (InForm && Depth == 1) {
+      InForm = FALSE;
+      (*FormChecksumList)[*FormCount].Checksum = IfrChecksum (2166136261U, BinaryData + FormStart, Offset + OpCode->Length - FormStart);
+      (*FormCount)++;
+    }
+
+    if (Depth == 0) {
+      //
+      // End of formset.
+      //
+      break;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
 /**
   Fetch the Ifr binary data of a FormSet.
 
@@ -772,7 +903,8 @@ GetIfrBinaryData (
   IN     EFI_HII_HANDLE    Handle,
   IN OUT EFI_GUID          *FormSetGuid,
      OUT UINTN             *BinaryLength,
-     OUT UINT8             **BinaryData
+     OUT UINT8             **BinaryData,
+     OUT UINT32            *StringChecksum  OPTIONAL
   )
 {
   EFI_STATUS                   Status;
@@ -927,6 +1059,25 @@ GetIfrBinaryData (
 
   *BinaryLength = PackageHeader.Length - Offset2;
   *BinaryData = AllocateCopyPool (*BinaryLength, OpCodeData);
+
+  if (StringChecksum != NULL) {
+    //
+    // Strings referred by formset may be updated without changing the IFR.
+    //
+    *StringChecksum = 2166136261U;
+    for (Offset = sizeof (EFI_HII_PACKAGE_LIST_HEADER); Offset < PackageListLength; Offset += PackageHeader.Length) {
+      Package = ((UINT8 *) HiiPackageList) + Offset;
+      CopyMem (&PackageHeader, Package, sizeof (EFI_HII_PACKAGE_HEADER));
+      if (PackageHeader.Length == 0) {
+        break;
+      }
+
+      if (PackageHeader.Type == EFI_HII_PACKAGE_STRINGS) {
+        *StringChecksum = IfrChecksum (*StringChecksum, Package, PackageHeader.Length);
+      }
+    }
+  }
+
   FreePool (HiiPackageList);
   if (*BinaryData == NULL) {
     return EFI_OUT_OF_RESOURCES;
@@ -1256,6 +1407,8 @@ LoadStorage (
     FreePool (Result);
   }
 
+  Storage->Loaded = TRUE;
+
   Storage->ConfigRequest = AllocateCopyPool (StrSize (ConfigRequest), ConfigRequest);
   if (Storage->ConfigRequest == NULL) {
 
@@ -1272,6 +1425,267 @@ LoadStorage (
   }
 }
 
+/**
+  Check whether the given range of buffer storage is loaded from Configuration Driver.
+
+  @param  Storage                Buffer Storage.
+  @param  Offset                 Offset of the range.
+  @param  Width                  Width of the range.
+
+  @retval TRUE                   The range is loaded.
+  @retval FALSE                  Some bytes in the range are not loaded yet.
+
+**/
+BOOLEAN
+IsStorageRangeLoaded (
+  IN HII_FORMSET_STORAGE    *Storage,
+  IN UINTN                  Offset,
+  IN UINTN                  Width
+  )
+{
+  UINTN  Index;
+
+  if (Storage->Loaded) {
+    return TRUE;
+  }
+
+  if (Storage->LoadedMap == NULL) {
+    return FALSE;
+  }
+
+  for (Index = Offset; Index < Offset + Width && Index < Storage->Size; Index++) {
+    if ((Storage->LoadedMap[Index / 8] & (1 << (Index % 8))) == 0) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+  Mark the given range of buffer storage as loaded from Configuration Driver.
+
+  @param  Storage                Buffer Storage.
+  @param  Offset                 Offset of the range.
+  @param  Width                  Width of the range.
+
+**/
+VOID
+MarkStorageRangeLoaded (
+  IN HII_FORMSET_STORAGE    *Storage,
+  IN UINTN                  Offset,
+  IN UINTN                  Width
+  )
+{
+  UINTN  Index;
+
+  if (Storage->Loaded) {
+    return;
+  }
+
+  if (Storage->LoadedMap == NULL) {
+    Storage->LoadedMap = AllocateZeroPool ((Storage->Size + 7) / 8);
+    if (Storage->LoadedMap == NULL) {
+      return;
+    }
+  }
+
+  for (Index = Offset; Index < Offset + Width && Index < Storage->Size; Index++) {
+    Storage->LoadedMap[Index / 8] |= (UINT8) (1 << (Index % 8));
+  }
+}
+
+/**
+  Fill buffer storage with the settings of given <RequestElement> requested
+  from Configuration Driver. The other data in storage is not changed.
+
+  @param  Storage                Buffer Storage.
+  @param  RequestElement         <RequestElement> to request.
+
+  @retval EFI_SUCCESS            The settings are filled in storage.
+  @retval Others                 Fail to get the settings from Configuration Driver.
+
+**/
+EFI_STATUS
+LoadStorageElement (
+  IN HII_FORMSET_STORAGE    *Storage,
+  IN CHAR16                 *RequestElement
+  )
+{
+  EFI_STATUS                      Status;
+  EFI_STRING                      Progress;
+  EFI_STRING                      Result;
+  CHAR16                          *StrPtr;
+  EFI_STRING                      ConfigRequest;
+  EFI_HII_CONFIG_ROUTING_PROTOCOL *HiiConfigRouting;
+
+  Status = gBS->LocateProtocol (
+                  &gEfiHiiConfigRoutingProtocolGuid,
+                  NULL,
+                  (VOID **) &HiiConfigRouting
+                  );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // <ConfigRequest> ::= <ConfigHdr> + <RequestElement>
+  //
+  ConfigRequest = NULL;
+  NewStringCat (&ConfigRequest, Storage->ConfigHdr);
+  NewStringCat (&ConfigRequest, RequestElement);
+  if (ConfigRequest == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = HiiConfigRouting->ExtractConfig (
+                               HiiConfigRouting,
+                               ConfigRequest,
+                               &Progress,
+                               &Result
+                               );
+  FreePool (ConfigRequest);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Convert Result from <ConfigAltResp> to <ConfigResp>
+  //
+  StrPtr = StrStr (Result, L"&GUID=");
+  if (StrPtr != NULL) {
+    *StrPtr = L'\0';
+  }
+
+  Status = ConfigRespToStorage (Storage, Result);
+  FreePool (Result);
+
+  return Status;
+}
+
+/**
+  Make sure the storage data referred by the question is loaded from
+  Configuration Driver. Only the <RequestElement> of the question is
+  requested for buffer storage.
+
+  @param  FormSet                FormSet data structure.
+  @param  Question               The question.
+
+**/
+VOID
+LoadQuestionStorage (
+  IN HII_FORMSET            *FormSet,
+  IN HII_STATEMENT          *Question
+  )
+{
+  EFI_STATUS           Status;
+  HII_FORMSET_STORAGE  *Storage;
+
+  Storage = Question->Storage;
+  if (Storage == NULL || Storage->Loaded) {
+    return;
+  }
+
+  switch (Storage->Type) {
+    case EFI_HII_VARSTORE_BUFFER:
+    case EFI_HII_VARSTORE_EFI_VARIABLE_BUFFER:
+      if (Question->BlockName == NULL ||
+          IsStorageRangeLoaded (Storage, Question->VarStoreInfo.VarOffset, Question->StorageWidth)) {
+        return;
+      }
+
+      Status = LoadStorageElement (Storage, Question->BlockName);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_WARN, "%a: failed to load %s of %s: %r\n", __FUNCTION__, Question->BlockName, Storage->Name, Status));
+      }
+
+      //
+      // Do not request again on failure, the storage keeps the default zero
+      // as it does when the whole storage is loaded.
+      //
+      MarkStorageRangeLoaded (Storage, Question->VarStoreInfo.VarOffset, Question->StorageWidth);
+      break;
+
+    case EFI_HII_VARSTORE_NAME_VALUE:
+      LoadStorage (FormSet, Storage);
+      break;
+
+    default:
+      break;
+  }
+}
+
+/**
+  Make sure the storage data referred by the questions of a form is loaded
+  from Configuration Driver. The <RequestElement> of all questions not loaded
+  yet are requested at once, and the data already in storage is kept.
+
+  @param  FormSet                FormSet data structure.
+  @param  Form                   Form data structure.
+  @param  Storage                The storage.
+
+**/
+VOID
+LoadFormStorage (
+  IN HII_FORMSET            *FormSet,
+  IN HII_FORM               *Form,
+  IN HII_FORMSET_STORAGE    *Storage
+  )
+{
+  EFI_STATUS     Status;
+  LIST_ENTRY     *Link;
+  HII_STATEMENT  *Question;
+  CHAR16         *RequestElement;
+
+  if (Storage->Loaded) {
+    return;
+  }
+
+  if (Storage->Type == EFI_HII_VARSTORE_NAME_VALUE) {
+    LoadStorage (FormSet, Storage);
+    return;
+  }
+
+  if (Storage->Type != EFI_HII_VARSTORE_BUFFER && Storage->Type != EFI_HII_VARSTORE_EFI_VARIABLE_BUFFER) {
+    return;
+  }
+
+  RequestElement = NULL;
+  Link = GetFirstNode (&Form->StatementListHead);
+  while (!IsNull (&Form->StatementListHead, Link)) {
+    Question = HII_STATEMENT_FROM_LINK (Link);
+    Link = GetNextNode (&Form->StatementListHead, Link);
+
+    if (Question->Storage != Storage || Question->BlockName == NULL ||
+        IsStorageRangeLoaded (Storage, Question->VarStoreInfo.VarOffset, Question->StorageWidth)) {
+      continue;
+    }
+
+    NewStringCat (&RequestElement, Question->BlockName);
+  }
+
+  if (RequestElement == NULL) {
+    return;
+  }
+
+  Status = LoadStorageElement (Storage, RequestElement);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_WARN, "%a: failed to load %s: %r\n", __FUNCTION__, Storage->Name, Status));
+  }
+
+  FreePool (RequestElement);
+
+  Link = GetFirstNode (&Form->StatementListHead);
+  while (!IsNull (&Form->StatementListHead, Link)) {
+    Question = HII_STATEMENT_FROM_LINK (Link);
+    Link = GetNextNode (&Form->StatementListHead, Link);
+
+    if (Question->Storage == Storage && Question->BlockName != NULL) {
+      MarkStorageRangeLoaded (Storage, Question->VarStoreInfo.VarOffset, Question->StorageWidth);
+    }
+  }
+}
+
 /**
   Zero extend integer/boolean/date/time to UINT64 for comparing.
 
@@ -1636,6 +2050,11 @@ GetQuestionValue (
     IsBufferStorage = FALSE;
   }
   if (GetValueFrom == GetSetValueWithBuffer ) {
+    //
+    // Storage may be loaded on demand, get the data of this question first.
+    //
+    LoadQuestionStorage (FormSet, Question);
+
     if (IsBufferStorage) {
       //
       // Copy from storage Edit buffer
@@ -1743,6 +2162,9 @@ GetQuestionValue (
     //
     if (IsBufferStorage) {
       CopyMem (Storage->Buffer + Question->VarStoreInfo.VarOffset, Dst, StorageWidth);
+      if (!Question->QuestionReferToBitField) {
+        MarkStorageRangeLoaded (Storage, Question->VarStoreInfo.VarOffset, StorageWidth);
+      }
     } else {
       SetValueByName (Storage, Question->VariableName, Value, NULL);
     }
@@ -52,7 +52,7 @@ CreateFormSetFromHiiHandle (
     return Status;
   }
 
-  Status = GetIfrBinaryData (Handle, FormSetGuid, &FormSet->IfrBinaryLength, &FormSet->IfrBinaryData);
+  Status = GetIfrBinaryData (Handle, FormSetGuid, &FormSet->IfrBinaryLength, &FormSet->IfrBinaryData, &FormSet->StringPackageChecksum);
   if (EFI_ERROR (Status)) {
     return Status;
   }
@@ -104,6 +104,179 @@ CreateFormSetFromHiiHandle (
   return Status;
 }
 
+/**
+  Add FormId to FormIdList if it is not in the list yet.
+
+  @param  FormIdList             FormId list.
+  @param  FormIdCount            Number of FormId in FormIdList.
+  @param  FormId                 FormId to add.
+
+**/
+VOID
+AddUpdatedFormId (
+  IN OUT UINT16    *FormIdList,
+  IN OUT UINTN     *FormIdCount,
+  IN     UINT16    FormId
+  )
+{
+  UINTN  Index;
+
+  for (Index = 0; Index < *FormIdCount; Index++) {
+    if (FormIdList[Index] == FormId) {
+      return;
+    }
+  }
+
+  FormIdList[*FormIdCount] = FormId;
+  (*FormIdCount)++;
+}
+
+/**
+  Check whether the FormSet in HII database is changed since it was created by
+  CreateFormSetFromHiiHandle(), and find the forms which need to be parsed again.
+
+  IFR opcodes of each form are compared separately. When the opcodes outside of
+  forms are changed, e.g. storage or default store, all forms are reported.
+
+  @param  FormSet                FormSet data structure.
+  @param  StringUpdated          Returned TRUE if string packages are changed.
+  @param  FormIdList             Returned FormId of the forms which are added,
+                                 removed or changed. It is allocated by this
+                                 function and must be freed by caller. NULL if
+                                 there is no changed form.
+  @param  FormIdCount            Returned number of FormId in FormIdList.
+
+  @retval EFI_SUCCESS            Update of FormSet is returned.
+  @retval EFI_INVALID_PARAMETER  One or more parameters are invalid.
+  @retval EFI_NOT_FOUND          The FormSet is no longer in HII database.
+  @retval EFI_OUT_OF_RESOURCES   There is not enough system memory.
+
+**/
+EFI_STATUS
+GetFormSetUpdate (
+  IN     HII_FORMSET    *FormSet,
+     OUT BOOLEAN        *StringUpdated,
+     OUT UINT16         **FormIdList,
+     OUT UINTN          *FormIdCount
+  )
+{
+  EFI_STATUS         Status;
+  EFI_GUID           FormSetGuid;
+  UINTN              BinaryLength;
+  UINT8              *BinaryData;
+  UINT32             StringChecksum;
+  UINT32             OldFormSetChecksum;
+  UINT32             NewFormSetChecksum;
+  HII_FORM_CHECKSUM  *OldFormList;
+  HII_FORM_CHECKSUM  *NewFormList;
+  UINTN              OldFormCount;
+  UINTN              NewFormCount;
+  UINTN              OldIndex;
+  UINTN              NewIndex;
+
+  if (FormSet == NULL || FormSet->IfrBinaryData == NULL || StringUpdated == NULL || FormIdList == NULL || FormIdCount == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  *StringUpdated = FALSE;
+  *FormIdList    = NULL;
+  *FormIdCount   = 0;
+  OldFormList    = NULL;
+  NewFormList    = NULL;
+
+  CopyGuid (&FormSetGuid, &FormSet->Guid);
+  Status = GetIfrBinaryData (FormSet->HiiHandle, &FormSetGuid, &BinaryLength, &BinaryData, &StringChecksum);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  if (BinaryData == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  *StringUpdated = (BOOLEAN) (StringChecksum != FormSet->StringPackageChecksum);
+
+  if (BinaryLength == FormSet->IfrBinaryLength && CompareMem (BinaryData, FormSet->IfrBinaryData, BinaryLength) == 0) {
+    FreePool (BinaryData);
+    return EFI_SUCCESS;
+  }
+
+  Status = GetIfrFormChecksum (FormSet->IfrBinaryData, FormSet->IfrBinaryLength, &OldFormSetChecksum, &OldFormList, &OldFormCount);
+  if (EFI_ERROR (Status)) {
+    goto Done;
+  }
+
+  Status = GetIfrFormChecksum (BinaryData, BinaryLength, &NewFormSetChecksum, &NewFormList, &NewFormCount);
+  if (EFI_ERROR (Status)) {
+    goto Done;
+  }
+
+  if (OldFormCount + NewFormCount == 0) {
+    goto Done;
+  }
+
+  *FormIdList = AllocatePool ((OldFormCount + NewFormCount) * sizeof (UINT16));
+  if (*FormIdList == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto Done;
+  }
+
+  //
+  // Form is changed when its checksum is different or it exists on one side only.
+  // All forms are changed when the opcodes outside of forms are changed.
+  //
+  for (OldIndex = 0; OldIndex < OldFormCount; OldIndex++) {
+    for (NewIndex = 0; NewIndex < NewFormCount; NewIndex++) {
+      if (NewFormList[NewIndex].FormId == OldFormList[OldIndex].FormId) {
+        break;
+      }
+    }
+
+    if (OldFormSetChecksum != NewFormSetChecksum || NewIndex == NewFormCount ||
+        NewFormList[NewIndex].Checksum != OldFormList[OldIndex].Checksum) {
+      AddUpdatedFormId (*FormIdList, FormIdCount, OldFormList[OldIndex].FormId);
+    }
+  }
+
+  for (NewIndex = 0; NewIndex < NewFormCount; NewIndex++) {
+    for (OldIndex = 0; OldIndex < OldFormCount; OldIndex++) {
+      if (OldFormList[OldIndex].FormId == NewFormList[NewIndex].FormId) {
+        break;
+      }
+    }
+
+    if (OldFormSetChecksum != NewFormSetChecksum || OldIndex == OldFormCount) {
+      AddUpdatedFormId (*FormIdList, FormIdCount, NewFormList[NewIndex].FormId);
+    }
+  }
+
+  if (*FormIdCount == 0) {
+    //
+    // Only the data after formset is changed.
+    //
+    FreePool (*FormIdList);
+    *FormIdList = NULL;
+  }
+
+Done:
+  if (EFI_ERROR (Status) && *FormIdList != NULL) {
+    FreePool (*FormIdList);
+    *FormIdList  = NULL;
+    *FormIdCount = 0;
+  }
+
+  if (OldFormList != NULL) {
+    FreePool (OldFormList);
+  }
+
+  if (NewFormList != NULL) {
+    FreePool (NewFormList);
+  }
+
+  FreePool (BinaryData);
+  return Status;
+}
+
 /**
   Initialize a Formset and get current setting for Questions.
 
@@ -126,14 +299,17 @@ InitializeFormSet (
   }
 
   //
-  // Load Storage for all questions with storage
+  // Load Storage for all questions with storage. When storage is loaded on
+  // demand, the data of a question is requested the first time it is needed.
   //
-  Link = GetFirstNode (&FormSet->StorageListHead);
-  while (!IsNull (&FormSet->StorageListHead, Link)) {
+  if (!PcdGetBool (PcdHiiUtilityLibLazyStorageLoad)) {
+    Link = GetFirstNode (&FormSet->StorageListHead);
+    while (!IsNull (&FormSet->StorageListHead, Link)) {
 
-    Storage = HII_STORAGE_FROM_LINK (Link);
-    LoadStorage (FormSet, Storage);
-    Link = GetNextNode (&FormSet->StorageListHead, Link);
+      Storage = HII_STORAGE_FROM_LINK (Link);
+      LoadStorage (FormSet, Storage);
+      Link = GetNextNode (&FormSet->StorageListHead, Link);
+    }
   }
 
   //
@@ -196,6 +372,9 @@ DestroyFormSet (
       RemoveEntryList (&Storage->Link);
 
       if (Storage != NULL) {
+        if (Storage->LoadedMap != NULL) {
+          FreePool (Storage->LoadedMap);
+        }
         FreePool (Storage);
       }
     }
@@ -283,6 +462,11 @@ SubmitForm (
       continue;
     }
 
+    //
+    // Questions not loaded yet must not be submitted with zero.
+    //
+    LoadFormStorage (FormSet, Form, Storage);
+
     Status = StorageToConfigResp (ConfigInfo->Storage, &ConfigResp, ConfigInfo->ConfigRequest);
     if (EFI_ERROR (Status)) {
       return Status;
@@ -315,6 +499,142 @@ SubmitForm (
   return Status;
 }
 
+/**
+  Submit data of the given questions in a FormSet. Questions which refer to
+  the same storage are collected into one <ConfigRequest>, so each storage is
+  routed to the configuration driver only once.
+
+  @param  FormSet                FormSet which contains the questions.
+  @param  FormList               Form of each question in QuestionList.
+  @param  QuestionList           Questions to submit.
+  @param  Count                  Number of questions in QuestionList.
+
+  @retval EFI_SUCCESS            The function completed successfully.
+  @retval EFI_INVALID_PARAMETER  One or more parameters are invalid.
+  @retval Others                 Other errors occur.
+
+**/
+EFI_STATUS
+SubmitQuestions (
+  IN HII_FORMSET    *FormSet,
+  IN HII_FORM       **FormList,
+  IN HII_STATEMENT  **QuestionList,
+  IN UINTN          Count
+  )
+{
+  EFI_STATUS                         Status;
+  EFI_STATUS                         ReturnStatus;
+  EFI_HII_CONFIG_ROUTING_PROTOCOL    *HiiConfigRouting;
+  EFI_STRING                         ConfigRequest;
+  EFI_STRING                         ConfigResp;
+  EFI_STRING                         Progress;
+  HII_FORMSET_STORAGE                *Storage;
+  HII_FORM                           *Form;
+  BOOLEAN                            *Submitted;
+  UINTN                              Index;
+  UINTN                              Index2;
+
+  if (FormSet == NULL || FormList == NULL || QuestionList == NULL || Count == 0) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //
+  // Do NoSubmit check once on each form which has question changed.
+  //
+  for (Index = 0; Index < Count; Index++) {
+    for (Index2 = 0; Index2 < Index; Index2++) {
+      if (FormList[Index2] == FormList[Index]) {
+        break;
+      }
+    }
+
+    if (Index2 < Index) {
+      continue;
+    }
+
+    Form = FormList[Index];
+    Status = NoSubmitCheck (FormSet, &Form, NULL);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  Status = gBS->LocateProtocol (
+                  &gEfiHiiConfigRoutingProtocolGuid,
+                  NULL,
+                  (VOID **) &HiiConfigRouting
+                  );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Submitted = AllocateZeroPool (sizeof (BOOLEAN) * Count);
+  if (Submitted == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  ReturnStatus = EFI_SUCCESS;
+  for (Index = 0; Index < Count; Index++) {
+    if (Submitted[Index]) {
+      continue;
+    }
+
+    Submitted[Index] = TRUE;
+    Storage = QuestionList[Index]->Storage;
+    if (Storage == NULL || Storage->Type == EFI_HII_VARSTORE_EFI_VARIABLE) {
+      continue;
+    }
+
+    //
+    // <ConfigRequest> ::= <ConfigHdr> + <RequestElement> of all questions in this storage.
+    //
+    ConfigRequest = NULL;
+    NewStringCat (&ConfigRequest, Storage->ConfigHdr);
+    for (Index2 = Index; Index2 < Count; Index2++) {
+      if (Index2 != Index && (Submitted[Index2] || QuestionList[Index2]->Storage != Storage)) {
+        continue;
+      }
+
+      Submitted[Index2] = TRUE;
+      LoadQuestionStorage (FormSet, QuestionList[Index2]);
+      if (Storage->Type == EFI_HII_VARSTORE_BUFFER || Storage->Type == EFI_HII_VARSTORE_EFI_VARIABLE_BUFFER) {
+        if (QuestionList[Index2]->BlockName != NULL) {
+          NewStringCat (&ConfigRequest, QuestionList[Index2]->BlockName);
+        }
+      } else {
+        NewStringCat (&ConfigRequest, L"&");
+        NewStringCat (&ConfigRequest, QuestionList[Index2]->VariableName);
+      }
+    }
+
+    if (ConfigRequest == NULL) {
+      ReturnStatus = EFI_OUT_OF_RESOURCES;
+      break;
+    }
+
+    Status = StorageToConfigResp (Storage, &ConfigResp, ConfigRequest);
+    FreePool (ConfigRequest);
+    if (EFI_ERROR (Status)) {
+      ReturnStatus = Status;
+      continue;
+    }
+
+    Status = HiiConfigRouting->RouteConfig (
+                                 HiiConfigRouting,
+                                 ConfigResp,
+                                 &Progress
+                                 );
+    FreePool (ConfigResp);
+    if (EFI_ERROR (Status)) {
+      ReturnStatus = Status;
+    }
+  }
+
+  FreePool (Submitted);
+
+  return ReturnStatus;
+}
+
 /**
   Save Question Value to the memory, but not to storage.
 
@@ -423,12 +743,22 @@ SetQuestionValue (
       // If the Question refer to bit filed, copy the value in related bit filed to storage edit buffer.
       //
       if (Question->QuestionReferToBitField) {
+        //
+        // Other bit fields share the bytes, so they must be loaded first.
+        //
+        LoadQuestionStorage (FormSet, Question);
         SetBitsQuestionValue (Question, Storage->Buffer + Question->VarStoreInfo.VarOffset, (UINT32)(*Src));
       } else {
         CopyMem (Storage->Buffer + Question->VarStoreInfo.VarOffset, Src, StorageWidth);
+        MarkStorageRangeLoaded (Storage, Question->VarStoreInfo.VarOffset, StorageWidth);
       }
     } else {
 
+      //
+      // Load the name/value storage first, so the new value is not overridden later.
+      //
+      LoadQuestionStorage (FormSet, Question);
+
       if (Question->Value.Type == EFI_IFR_TYPE_STRING) {
 
         //
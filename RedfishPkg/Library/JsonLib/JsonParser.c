@@ -0,0 +1,1307 @@
+/** @file
+  Incremental JSON parser. The JSON payload is fed piece by piece, values are
+  built with jansson only when caller needs them.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+    SPDX-License-Identifier: BSD-2-Clause-Patent
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/JsonLib.h>
+#include <Library/MemoryAllocationLib.h>
+
+#include "jansson.h"
+
+//
+// The same nesting limit as jansson.
+//
+#define JSON_PARSER_MAX_DEPTH        2048
+#define JSON_PARSER_INITIAL_DEPTH    16
+#define JSON_PARSER_INITIAL_TOKEN    64
+
+//
+// The lexical state inside a token.
+//
+typedef enum {
+  JsonLexNone,
+  JsonLexString,
+  JsonLexStringEscape,
+  JsonLexStringUnicode,
+  JsonLexNumber,
+  JsonLexLiteral
+} JSON_PARSER_LEX;
+
+//
+// The token parser expects next.
+//
+typedef enum {
+  JsonExpectValue,
+  JsonExpectArrayValueOrEnd,
+  JsonExpectObjectKeyOrEnd,
+  JsonExpectObjectKey,
+  JsonExpectColon,
+  JsonExpectCommaOrEnd,
+  JsonExpectNothing
+} JSON_PARSER_EXPECT;
+
+//
+// How the values of an object or array are handled.
+//
+typedef enum {
+  JsonModeEvent,            ///< Report to callback.
+  JsonModeLoad,             ///< Build JSON value.
+  JsonModeSkip              ///< Drop.
+} JSON_PARSER_MODE;
+
+typedef struct {
+  BOOLEAN             IsObject;
+  JSON_PARSER_MODE    Mode;
+  json_t              *Container;   ///< The object or array being built in JsonModeLoad.
+  CHAR8               *MemberKey;   ///< The name of current member of object.
+  UINTN               Count;        ///< The number of completed members.
+} JSON_PARSER_FRAME;
+
+typedef struct {
+  UINTN                         Flags;
+  EDKII_JSON_PARSER_CALLBACK    Callback;
+  VOID                          *Context;
+
+  JSON_PARSER_FRAME             *Stack;
+  UINTN                         Depth;
+  UINTN                         StackSize;
+  json_t                        *Root;
+
+  JSON_PARSER_LEX               Lex;
+  JSON_PARSER_EXPECT            Expect;
+  CHAR8                         *Token;
+  UINTN                         TokenLength;
+  UINTN                         TokenSize;
+  UINT32                        Unicode;        ///< The code unit of \u escape being read.
+  UINTN                         UnicodeDigits;
+  UINT32                        HighSurrogate;  ///< The high surrogate waiting for the low one.
+
+  INTN                          Line;
+  INTN                          Column;
+  INTN                          Position;
+  EFI_STATUS                    Status;         ///< The error stops the parser.
+  EDKII_JSON_ERROR              Error;
+  BOOLEAN                       Finished;
+} JSON_PARSER;
+
+/**
+  Stop the parser with error.
+
+  @param[in,out]  Parser   The parser.
+  @param[in]      Status   The error status.
+  @param[in]      Text     The error description.
+
+  @retval Status
+
+**/
+STATIC
+EFI_STATUS
+JsonParserSetError (
+  IN OUT JSON_PARSER  *Parser,
+  IN     EFI_STATUS   Status,
+  IN     CONST CHAR8  *Text
+  )
+{
+  Parser->Status         = Status;
+  Parser->Error.Line     = Parser->Line;
+  Parser->Error.Column   = Parser->Column;
+  Parser->Error.Position = Parser->Position;
+  AsciiStrCpyS (Parser->Error.Source, EDKII_JSON_ERROR_SOURCE_LENGTH, "<stream>");
+  AsciiStrnCpyS (Parser->Error.Text, EDKII_JSON_ERROR_TEXT_LENGTH, Text, EDKII_JSON_ERROR_TEXT_LENGTH - 1);
+  return Status;
+}
+
+/**
+  Append one byte to current token.
+
+  @param[in,out]  Parser   The parser.
+  @param[in]      Char     The byte to append.
+
+  @retval EFI_SUCCESS            The byte is appended.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+
+**/
+STATIC
+EFI_STATUS
+JsonParserTokenAppend (
+  IN OUT JSON_PARSER  *Parser,
+  IN     CHAR8        Char
+  )
+{
+  CHAR8  *Token;
+
+  //
+  // Keep one byte for the null terminator.
+  //
+  if (Parser->TokenLength + 1 >= Parser->TokenSize) {
+    Token = ReallocatePool (Parser->TokenSize, Parser->TokenSize * 2, Parser->Token);
+    if (Token == NULL) {
+      return JsonParserSetError (Parser, EFI_OUT_OF_RESOURCES, "out of memory");
+    }
+
+    Parser->Token      = Token;
+    Parser->TokenSize *= 2;
+  }
+
+  Parser->Token[Parser->TokenLength++] = Char;
+  return EFI_SUCCESS;
+}
+
+/**
+  Append a Unicode code point to current token in UTF-8.
+
+  @param[in,out]  Parser      The parser.
+  @param[in]      CodePoint   The code point, not a surrogate.
+
+  @retval EFI_SUCCESS            The code point is appended.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+
+**/
+STATIC
+EFI_STATUS
+JsonParserTokenAppendUtf8 (
+  IN OUT JSON_PARSER  *Parser,
+  IN     UINT32       CodePoint
+  )
+{
+  CHAR8       Bytes[4];
+  UINTN       Count;
+  UINTN       Index;
+  EFI_STATUS  Status;
+
+  if (CodePoint < 0x80) {
+    Bytes[0] = (CHAR8)CodePoint;
+    Count    = 1;
+  } else if (CodePoint < 0x800) {
+    Bytes[0] = (CHAR8)(0xC0 | (CodePoint >> 6));
+    Bytes[1] = (CHAR8)(0x80 | (CodePoint & 0x3F));
+    Count    = 2;
+  } else if (CodePoint < 0x10000) {
+    Bytes[0] = (CHAR8)(0xE0 | (CodePoint >> 12));
+    Bytes[1] = (CHAR8)(0x80 | ((CodePoint >> 6) & 0x3F));
+    Bytes[2] = (CHAR8)(0x80 | (CodePoint & 0x3F));
+    Count    = 3;
+  } else {
+    Bytes[0] = (CHAR8)(0xF0 | (CodePoint >> 18));
+    Bytes[1] = (CHAR8)(0x80 | ((CodePoint >> 12) & 0x3F));
+    Bytes[2] = (CHAR8)(0x80 | ((CodePoint >> 6) & 0x3F));
+    Bytes[3] = (CHAR8)(0x80 | (CodePoint & 0x3F));
+    Count    = 4;
+  }
+
+  for (Index = 0; Index < Count; Index++) {
+    Status = JsonParserTokenAppend (Parser, Bytes[Index]);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Check if the string is valid UTF-8. Overlong forms, surrogates and code
+  points above U+10FFFF are rejected.
+
+  @param[in]  String   The string.
+  @param[in]  Length   The length of String in bytes.
+
+  @retval TRUE    String is valid UTF-8.
+  @retval FALSE   String is not valid UTF-8.
+
+**/
+STATIC
+BOOLEAN
+JsonParserIsUtf8 (
+  IN CONST UINT8  *String,
+  IN UINTN        Length
+  )
+{
+  UINTN   Index;
+  UINTN   Count;
+  UINTN   Next;
+  UINT32  CodePoint;
+
+  Index = 0;
+  while (Index < Length) {
+    if (String[Index] < 0x80) {
+      Index++;
+      continue;
+    } else if ((String[Index] >= 0xC2) && (String[Index] <= 0xDF)) {
+      Count     = 1;
+      CodePoint = String[Index] & 0x1F;
+    } else if ((String[Index] & 0xF0) == 0xE0) {
+      Count     = 2;
+      CodePoint = String[Index] & 0x0F;
+    } else if ((String[Index] >= 0xF0) && (String[Index] <= 0xF4)) {
+      Count     = 3;
+      CodePoint = String[Index] & 0x07;
+    } else {
+      return FALSE;
+    }
+
+    if (Length - Index <= Count) {
+      return FALSE;
+    }
+
+    for (Next = Index + 1; Next <= Index + Count; Next++) {
+      if ((String[Next] & 0xC0) != 0x80) {
+        return FALSE;
+      }
+
+      CodePoint = (CodePoint << 6) | (String[Next] & 0x3F);
+    }
+
+    if (((Count == 2) && (CodePoint < 0x800)) ||
+        ((Count == 3) && (CodePoint < 0x10000)) ||
+        ((CodePoint >= 0xD800) && (CodePoint <= 0xDFFF)) ||
+        (CodePoint > 0x10FFFF))
+    {
+      return FALSE;
+    }
+
+    Index += Count + 1;
+  }
+
+  return TRUE;
+}
+
+/**
+  Return how the next value at current position is handled.
+
+  @param[in]  Parser   The parser.
+
+  @retval JSON_PARSER_MODE   The mode of current object or array, or of the
+                             root value.
+
+**/
+STATIC
+JSON_PARSER_MODE
+JsonParserCurrentMode (
+  IN JSON_PARSER  *Parser
+  )
+{
+  if (Parser->Depth > 0) {
+    return Parser->Stack[Parser->Depth - 1].Mode;
+  }
+
+  return (Parser->Callback != NULL) ? JsonModeEvent : JsonModeLoad;
+}
+
+/**
+  Report an event of the value at current position to callback.
+
+  @param[in,out]  Parser   The parser.
+  @param[in]      Event    The parser event.
+  @param[in]      Value    The value of EdkiiJsonParserEventValue.
+
+  @retval EDKII_JSON_PARSER_ACTION   The action callback returns.
+
+**/
+STATIC
+EDKII_JSON_PARSER_ACTION
+JsonParserReport (
+  IN OUT JSON_PARSER              *Parser,
+  IN     EDKII_JSON_PARSER_EVENT  Event,
+  IN     json_t                   *Value
+  )
+{
+  JSON_PARSER_FRAME  *Frame;
+  CONST CHAR8        *Key;
+  UINTN              Index;
+
+  Key   = NULL;
+  Index = 0;
+  if (Parser->Depth > 0) {
+    Frame = &Parser->Stack[Parser->Depth - 1];
+    if (Frame->IsObject) {
+      Key = Frame->MemberKey;
+    } else {
+      Index = Frame->Count;
+    }
+  }
+
+  return Parser->Callback (Parser->Context, Event, Parser->Depth, Key, Index, (EDKII_JSON_VALUE)Value);
+}
+
+/**
+  The value at current position is complete, move to the next one.
+
+  @param[in,out]  Parser   The parser.
+
+**/
+STATIC
+VOID
+JsonParserNextMember (
+  IN OUT JSON_PARSER  *Parser
+  )
+{
+  JSON_PARSER_FRAME  *Frame;
+
+  if (Parser->Depth == 0) {
+    Parser->Expect = JsonExpectNothing;
+    return;
+  }
+
+  Frame = &Parser->Stack[Parser->Depth - 1];
+  if (Frame->MemberKey != NULL) {
+    FreePool (Frame->MemberKey);
+    Frame->MemberKey = NULL;
+  }
+
+  Frame->Count++;
+  Parser->Expect = JsonExpectCommaOrEnd;
+}
+
+/**
+  Hand the completed value at current position to its owner: the object or
+  array being built, the root, or callback.
+
+  @param[in,out]  Parser   The parser.
+  @param[in]      Value    The value, NULL in JsonModeSkip. The reference is
+                           always taken.
+
+  @retval EFI_SUCCESS            The value is handled.
+  @retval EFI_VOLUME_CORRUPTED   Duplicate member name.
+  @retval EFI_ABORTED            Callback stops parsing.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+
+**/
+STATIC
+EFI_STATUS
+JsonParserAddValue (
+  IN OUT JSON_PARSER  *Parser,
+  IN     json_t       *Value
+  )
+{
+  JSON_PARSER_FRAME         *Frame;
+  EDKII_JSON_PARSER_ACTION  Action;
+
+  Frame = (Parser->Depth > 0) ? &Parser->Stack[Parser->Depth - 1] : NULL;
+
+  switch (JsonParserCurrentMode (Parser)) {
+    case JsonModeLoad:
+      if (Frame == NULL) {
+        Parser->Root = Value;
+      } else if (Frame->IsObject) {
+        if (((Parser->Flags & EDKII_JSON_REJECT_DUPLICATES) != 0) &&
+            (json_object_get (Frame->Container, Frame->MemberKey) != NULL))
+        {
+          json_decref (Value);
+          return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "duplicate object key");
+        }
+
+        if (json_object_set_new_nocheck (Frame->Container, Frame->MemberKey, Value) != 0) {
+          return JsonParserSetError (Parser, EFI_OUT_OF_RESOURCES, "out of memory");
+        }
+      } else {
+        if (json_array_append_new (Frame->Container, Value) != 0) {
+          return JsonParserSetError (Parser, EFI_OUT_OF_RESOURCES, "out of memory");
+        }
+      }
+
+      break;
+
+    case JsonModeEvent:
+      Action = JsonParserReport (Parser, EdkiiJsonParserEventValue, Value);
+      json_decref (Value);
+      if (Action == EdkiiJsonParserActionAbort) {
+        return JsonParserSetError (Parser, EFI_ABORTED, "aborted by callback");
+      }
+
+      break;
+
+    default:
+      ASSERT (Value == NULL);
+      break;
+  }
+
+  JsonParserNextMember (Parser);
+  return EFI_SUCCESS;
+}
+
+/**
+  Begin an object or array at current position.
+
+  @param[in,out]  Parser     The parser.
+  @param[in]      IsObject   TRUE for object, FALSE for array.
+
+  @retval EFI_SUCCESS            The object or array begins.
+  @retval EFI_VOLUME_CORRUPTED   Too deep nesting.
+  @retval EFI_ABORTED            Callback stops parsing.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+
+**/
+STATIC
+EFI_STATUS
+JsonParserBeginContainer (
+  IN OUT JSON_PARSER  *Parser,
+  IN     BOOLEAN      IsObject
+  )
+{
+  JSON_PARSER_MODE          Mode;
+  JSON_PARSER_FRAME         *Frame;
+  JSON_PARSER_FRAME         *Stack;
+  EDKII_JSON_PARSER_ACTION  Action;
+
+  if (Parser->Depth >= JSON_PARSER_MAX_DEPTH) {
+    return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "maximum parsing depth reached");
+  }
+
+  Mode = JsonParserCurrentMode (Parser);
+  if (Mode == JsonModeEvent) {
+    Action = JsonParserReport (
+               Parser,
+               IsObject ? EdkiiJsonParserEventObjectStart : EdkiiJsonParserEventArrayStart,
+               NULL
+               );
+    switch (Action) {
+      case EdkiiJsonParserActionContinue:
+        break;
+
+      case EdkiiJsonParserActionLoad:
+        Mode = JsonModeLoad;
+        break;
+
+      case EdkiiJsonParserActionSkip:
+        Mode = JsonModeSkip;
+        break;
+
+      default:
+        return JsonParserSetError (Parser, EFI_ABORTED, "aborted by callback");
+    }
+  }
+
+  if (Parser->Depth == Parser->StackSize) {
+    Stack = ReallocatePool (
+              Parser->StackSize * sizeof (JSON_PARSER_FRAME),
+              Parser->StackSize * 2 * sizeof (JSON_PARSER_FRAME),
+              Parser->Stack
+              );
+    if (Stack == NULL) {
+      return JsonParserSetError (Parser, EFI_OUT_OF_RESOURCES, "out of memory");
+    }
+
+    Parser->Stack      = Stack;
+    Parser->StackSize *= 2;
+  }
+
+  Frame = &Parser->Stack[Parser->Depth];
+  ZeroMem (Frame, sizeof (JSON_PARSER_FRAME));
+  Frame->IsObject = IsObject;
+  Frame->Mode     = Mode;
+  if (Mode == JsonModeLoad) {
+    Frame->Container = IsObject ? json_object () : json_array ();
+    if (Frame->Container == NULL) {
+      return JsonParserSetError (Parser, EFI_OUT_OF_RESOURCES, "out of memory");
+    }
+  }
+
+  Parser->Depth++;
+  Parser->Expect = IsObject ? JsonExpectObjectKeyOrEnd : JsonExpectArrayValueOrEnd;
+  return EFI_SUCCESS;
+}
+
+/**
+  End the object or array at the top of stack.
+
+  @param[in,out]  Parser   The parser.
+
+  @retval EFI_SUCCESS            The object or array ends.
+  @retval Others                 Error from JsonParserAddValue().
+
+**/
+STATIC
+EFI_STATUS
+JsonParserEndContainer (
+  IN OUT JSON_PARSER  *Parser
+  )
+{
+  JSON_PARSER_FRAME         Frame;
+  EDKII_JSON_PARSER_ACTION  Action;
+
+  ASSERT (Parser->Depth > 0);
+  Parser->Depth--;
+  CopyMem (&Frame, &Parser->Stack[Parser->Depth], sizeof (JSON_PARSER_FRAME));
+  ASSERT (Frame.MemberKey == NULL);
+
+  if (Frame.Mode == JsonModeSkip) {
+    JsonParserNextMember (Parser);
+    return EFI_SUCCESS;
+  }
+
+  if (Frame.Mode == JsonModeEvent) {
+    Action = JsonParserReport (
+               Parser,
+               Frame.IsObject ? EdkiiJsonParserEventObjectEnd : EdkiiJsonParserEventArrayEnd,
+               NULL
+               );
+    if (Action == EdkiiJsonParserActionAbort) {
+      return JsonParserSetError (Parser, EFI_ABORTED, "aborted by callback");
+    }
+
+    JsonParserNextMember (Parser);
+    return EFI_SUCCESS;
+  }
+
+  //
+  // The value is handed to the parent. The loaded one goes to the object or
+  // array being built, or reported to callback.
+  //
+  return JsonParserAddValue (Parser, Frame.Container);
+}
+
+/**
+  Build the value of the string token at current position. When an object
+  member name is expected, the string is kept as the name instead.
+
+  @param[in,out]  Parser   The parser.
+
+  @retval EFI_SUCCESS            The string is handled.
+  @retval EFI_VOLUME_CORRUPTED   The string is not valid.
+  @retval Others                 Error from JsonParserAddValue().
+
+**/
+STATIC
+EFI_STATUS
+JsonParserStringDone (
+  IN OUT JSON_PARSER  *Parser
+  )
+{
+  JSON_PARSER_FRAME  *Frame;
+  JSON_PARSER_MODE   Mode;
+  json_t             *Value;
+
+  if (Parser->HighSurrogate != 0) {
+    return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid Unicode surrogate pair");
+  }
+
+  if (!JsonParserIsUtf8 ((UINT8 *)Parser->Token, Parser->TokenLength)) {
+    return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid UTF-8 in string");
+  }
+
+  Parser->Token[Parser->TokenLength] = '\0';
+  Parser->Lex                        = JsonLexNone;
+  Mode                               = JsonParserCurrentMode (Parser);
+
+  if ((Parser->Expect == JsonExpectObjectKeyOrEnd) || (Parser->Expect == JsonExpectObjectKey)) {
+    Frame = &Parser->Stack[Parser->Depth - 1];
+    if (Mode != JsonModeSkip) {
+      Frame->MemberKey = AllocateCopyPool (Parser->TokenLength + 1, Parser->Token);
+      if (Frame->MemberKey == NULL) {
+        return JsonParserSetError (Parser, EFI_OUT_OF_RESOURCES, "out of memory");
+      }
+    }
+
+    Parser->Expect = JsonExpectColon;
+    return EFI_SUCCESS;
+  }
+
+  Value = NULL;
+  if (Mode != JsonModeSkip) {
+    Value = json_string_nocheck (Parser->Token);
+    if (Value == NULL) {
+      return JsonParserSetError (Parser, EFI_OUT_OF_RESOURCES, "out of memory");
+    }
+  }
+
+  return JsonParserAddValue (Parser, Value);
+}
+
+/**
+  Build the value of the number token at current position.
+
+  @param[in,out]  Parser   The parser.
+
+  @retval EFI_SUCCESS            The number is handled.
+  @retval EFI_VOLUME_CORRUPTED   The number is not valid.
+  @retval Others                 Error from JsonParserAddValue().
+
+**/
+STATIC
+EFI_STATUS
+JsonParserNumberDone (
+  IN OUT JSON_PARSER  *Parser
+  )
+{
+  CHAR8    *Token;
+  CHAR8    *End;
+  UINTN    Index;
+  BOOLEAN  Negative;
+  BOOLEAN  IsReal;
+  UINT64   Integer;
+  UINT64   Limit;
+  UINT64   Digit;
+  double   Real;
+  json_t   *Value;
+
+  Token                        = Parser->Token;
+  Token[Parser->TokenLength]   = '\0';
+  Parser->Lex                  = JsonLexNone;
+
+  //
+  // -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+  //
+  Index    = 0;
+  Negative = (BOOLEAN)(Token[Index] == '-');
+  if (Negative) {
+    Index++;
+  }
+
+  if (Token[Index] == '0') {
+    Index++;
+  } else if ((Token[Index] >= '1') && (Token[Index] <= '9')) {
+    while ((Token[Index] >= '0') && (Token[Index] <= '9')) {
+      Index++;
+    }
+  } else {
+    return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid number");
+  }
+
+  IsReal = FALSE;
+  if (Token[Index] == '.') {
+    IsReal = TRUE;
+    Index++;
+    if ((Token[Index] < '0') || (Token[Index] > '9')) {
+      return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid number");
+    }
+
+    while ((Token[Index] >= '0') && (Token[Index] <= '9')) {
+      Index++;
+    }
+  }
+
+  if ((Token[Index] == 'e') || (Token[Index] == 'E')) {
+    IsReal = TRUE;
+    Index++;
+    if ((Token[Index] == '+') || (Token[Index] == '-')) {
+      Index++;
+    }
+
+    if ((Token[Index] < '0') || (Token[Index] > '9')) {
+      return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid number");
+    }
+
+    while ((Token[Index] >= '0') && (Token[Index] <= '9')) {
+      Index++;
+    }
+  }
+
+  if (Index != Parser->TokenLength) {
+    return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid number");
+  }
+
+  if (JsonParserCurrentMode (Parser) == JsonModeSkip) {
+    return JsonParserAddValue (Parser, NULL);
+  }
+
+  if (IsReal) {
+    Real = strtod (Token, &End);
+    if (End != Token + Parser->TokenLength) {
+      return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid number");
+    }
+
+    //
+    // Only infinity gives NaN here.
+    //
+    if (Real - Real != 0) {
+      return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "real number overflow");
+    }
+
+    Value = json_real (Real);
+  } else {
+    //
+    // The magnitude of INT64 is one more on negative side.
+    //
+    Limit   = Negative ? (UINT64)MAX_INT64 + 1 : (UINT64)MAX_INT64;
+    Integer = 0;
+    for (Index = Negative ? 1 : 0; Index < Parser->TokenLength; Index++) {
+      Digit = (UINT64)(Token[Index] - '0');
+      if (Integer > (Limit - Digit) / 10) {
+        return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "too big integer");
+      }
+
+      Integer = Integer * 10 + Digit;
+    }
+
+    if (Negative && (Integer != 0)) {
+      Value = json_integer (-(json_int_t)(Integer - 1) - 1);
+    } else {
+      Value = json_integer ((json_int_t)Integer);
+    }
+  }
+
+  if (Value == NULL) {
+    return JsonParserSetError (Parser, EFI_OUT_OF_RESOURCES, "out of memory");
+  }
+
+  return JsonParserAddValue (Parser, Value);
+}
+
+/**
+  Build the value of the literal token at current position.
+
+  @param[in,out]  Parser   The parser.
+
+  @retval EFI_SUCCESS            The literal is handled.
+  @retval EFI_VOLUME_CORRUPTED   The literal is not true, false or null.
+  @retval Others                 Error from JsonParserAddValue().
+
+**/
+STATIC
+EFI_STATUS
+JsonParserLiteralDone (
+  IN OUT JSON_PARSER  *Parser
+  )
+{
+  json_t  *Value;
+
+  Parser->Token[Parser->TokenLength] = '\0';
+  Parser->Lex                        = JsonLexNone;
+
+  if (AsciiStrCmp (Parser->Token, "true") == 0) {
+    Value = json_true ();
+  } else if (AsciiStrCmp (Parser->Token, "false") == 0) {
+    Value = json_false ();
+  } else if (AsciiStrCmp (Parser->Token, "null") == 0) {
+    Value = json_null ();
+  } else {
+    return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid token");
+  }
+
+  if (JsonParserCurrentMode (Parser) == JsonModeSkip) {
+    json_decref (Value);
+    Value = NULL;
+  }
+
+  return JsonParserAddValue (Parser, Value);
+}
+
+/**
+  Process one byte inside a string token.
+
+  @param[in,out]  Parser   The parser.
+  @param[in]      Char     The byte.
+
+  @retval EFI_SUCCESS            The byte is processed.
+  @retval EFI_VOLUME_CORRUPTED   The string is not valid.
+  @retval Others                 Error from JsonParserStringDone().
+
+**/
+STATIC
+EFI_STATUS
+JsonParserStringChar (
+  IN OUT JSON_PARSER  *Parser,
+  IN     UINT8        Char
+  )
+{
+  UINT32  CodePoint;
+
+  switch (Parser->Lex) {
+    case JsonLexString:
+      if (Char == '"') {
+        return JsonParserStringDone (Parser);
+      } else if (Char == '\\') {
+        Parser->Lex = JsonLexStringEscape;
+        return EFI_SUCCESS;
+      } else if (Char < 0x20) {
+        return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "control character in string");
+      }
+
+      if (Parser->HighSurrogate != 0) {
+        return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid Unicode surrogate pair");
+      }
+
+      return JsonParserTokenAppend (Parser, (CHAR8)Char);
+
+    case JsonLexStringEscape:
+      if (Char == 'u') {
+        Parser->Lex           = JsonLexStringUnicode;
+        Parser->Unicode       = 0;
+        Parser->UnicodeDigits = 0;
+        return EFI_SUCCESS;
+      }
+
+      if (Parser->HighSurrogate != 0) {
+        return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid Unicode surrogate pair");
+      }
+
+      Parser->Lex = JsonLexString;
+      switch (Char) {
+        case '"':
+        case '\\':
+        case '/':
+          return JsonParserTokenAppend (Parser, (CHAR8)Char);
+        case 'b':
+          return JsonParserTokenAppend (Parser, '\b');
+        case 'f':
+          return JsonParserTokenAppend (Parser, '\f');
+        case 'n':
+          return JsonParserTokenAppend (Parser, '\n');
+        case 'r':
+          return JsonParserTokenAppend (Parser, '\r');
+        case 't':
+          return JsonParserTokenAppend (Parser, '\t');
+        default:
+          return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid escape");
+      }
+
+    default:
+      ASSERT (Parser->Lex == JsonLexStringUnicode);
+      if ((Char >= '0') && (Char <= '9')) {
+        Parser->Unicode = (Parser->Unicode << 4) | (Char - '0');
+      } else if ((Char >= 'a') && (Char <= 'f')) {
+        Parser->Unicode = (Parser->Unicode << 4) | (Char - 'a' + 10);
+      } else if ((Char >= 'A') && (Char <= 'F')) {
+        Parser->Unicode = (Parser->Unicode << 4) | (Char - 'A' + 10);
+      } else {
+        return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid escape");
+      }
+
+      if (++Parser->UnicodeDigits < 4) {
+        return EFI_SUCCESS;
+      }
+
+      Parser->Lex = JsonLexString;
+      CodePoint   = Parser->Unicode;
+      if ((CodePoint >= 0xD800) && (CodePoint <= 0xDBFF)) {
+        if (Parser->HighSurrogate != 0) {
+          return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid Unicode surrogate pair");
+        }
+
+        Parser->HighSurrogate = CodePoint;
+        return EFI_SUCCESS;
+      }
+
+      if ((CodePoint >= 0xDC00) && (CodePoint <= 0xDFFF)) {
+        if (Parser->HighSurrogate == 0) {
+          return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid Unicode surrogate pair");
+        }
+
+        CodePoint             = 0x10000 + ((Parser->HighSurrogate - 0xD800) << 10) + (CodePoint - 0xDC00);
+        Parser->HighSurrogate = 0;
+      } else if (Parser->HighSurrogate != 0) {
+        return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid Unicode surrogate pair");
+      }
+
+      if (CodePoint == 0) {
+        return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "\\u0000 is not allowed");
+      }
+
+      return JsonParserTokenAppendUtf8 (Parser, CodePoint);
+  }
+}
+
+/**
+  Process one byte between tokens, the byte starts a token or it is a
+  structural character.
+
+  @param[in,out]  Parser   The parser.
+  @param[in]      Char     The byte.
+
+  @retval EFI_SUCCESS            The byte is processed.
+  @retval EFI_VOLUME_CORRUPTED   The byte is not expected here.
+  @retval Others                 Error from the value handling.
+
+**/
+STATIC
+EFI_STATUS
+JsonParserStructureChar (
+  IN OUT JSON_PARSER  *Parser,
+  IN     UINT8        Char
+  )
+{
+  BOOLEAN  ExpectValue;
+  BOOLEAN  InObject;
+
+  ExpectValue = (BOOLEAN)((Parser->Expect == JsonExpectValue) || (Parser->Expect == JsonExpectArrayValueOrEnd));
+  InObject    = (BOOLEAN)((Parser->Depth > 0) && Parser->Stack[Parser->Depth - 1].IsObject);
+
+  switch (Char) {
+    case ' ':
+    case '\t':
+    case '\n':
+    case '\r':
+      return EFI_SUCCESS;
+
+    case '{':
+    case '[':
+      if (!ExpectValue) {
+        break;
+      }
+
+      return JsonParserBeginContainer (Parser, (BOOLEAN)(Char == '{'));
+
+    case '}':
+      if ((Parser->Expect == JsonExpectObjectKeyOrEnd) ||
+          ((Parser->Expect == JsonExpectCommaOrEnd) && InObject))
+      {
+        return JsonParserEndContainer (Parser);
+      }
+
+      break;
+
+    case ']':
+      if ((Parser->Expect == JsonExpectArrayValueOrEnd) ||
+          ((Parser->Expect == JsonExpectCommaOrEnd) && !InObject))
+      {
+        return JsonParserEndContainer (Parser);
+      }
+
+      break;
+
+    case ',':
+      if (Parser->Expect == JsonExpectCommaOrEnd) {
+        Parser->Expect = InObject ? JsonExpectObjectKey : JsonExpectValue;
+        return EFI_SUCCESS;
+      }
+
+      break;
+
+    case ':':
+      if (Parser->Expect == JsonExpectColon) {
+        Parser->Expect = JsonExpectValue;
+        return EFI_SUCCESS;
+      }
+
+      break;
+
+    default:
+      if (Char == '"') {
+        if (!ExpectValue && (Parser->Expect != JsonExpectObjectKeyOrEnd) && (Parser->Expect != JsonExpectObjectKey)) {
+          break;
+        }
+
+        Parser->Lex = JsonLexString;
+      } else if ((Char == '-') || ((Char >= '0') && (Char <= '9'))) {
+        if (!ExpectValue) {
+          break;
+        }
+
+        Parser->Lex = JsonLexNumber;
+      } else if ((Char >= 'a') && (Char <= 'z')) {
+        if (!ExpectValue) {
+          break;
+        }
+
+        Parser->Lex = JsonLexLiteral;
+      } else {
+        return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "invalid token");
+      }
+
+      if ((Parser->Depth == 0) && ((Parser->Flags & EDKII_JSON_DECODE_ANY) == 0)) {
+        return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "'[' or '{' expected");
+      }
+
+      Parser->TokenLength   = 0;
+      Parser->HighSurrogate = 0;
+      if (Parser->Lex != JsonLexString) {
+        return JsonParserTokenAppend (Parser, (CHAR8)Char);
+      }
+
+      return EFI_SUCCESS;
+  }
+
+  if (Parser->Expect == JsonExpectNothing) {
+    return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "end of file expected");
+  }
+
+  if ((Parser->Depth == 0) && ((Parser->Flags & EDKII_JSON_DECODE_ANY) == 0)) {
+    return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "'[' or '{' expected");
+  }
+
+  return JsonParserSetError (Parser, EFI_VOLUME_CORRUPTED, "unexpected token");
+}
+
+/**
+  Copy the error of parser to caller.
+
+  @param[in]   Parser   The parser.
+  @param[out]  Error    Returned error. Optional.
+
+  @retval The status of parser.
+
+**/
+STATIC
+EFI_STATUS
+JsonParserReturnError (
+  IN  JSON_PARSER       *Parser,
+  OUT EDKII_JSON_ERROR  *Error  OPTIONAL
+  )
+{
+  if ((Error != NULL) && EFI_ERROR (Parser->Status)) {
+    CopyMem (Error, &Parser->Error, sizeof (EDKII_JSON_ERROR));
+  }
+
+  return Parser->Status;
+}
+
+/**
+  Create an incremental JSON parser. The JSON payload is given to the parser
+  piece by piece with JsonParserFeed() as it is received, so the payload never
+  needs to be kept in one buffer.
+
+  Without Callback, the parser loads the whole JSON value and JsonParserFinish()
+  returns it. With Callback, the parser reports the values with events and
+  builds only the objects and arrays the callback asks to load, so members the
+  caller doesn't need never take memory.
+
+  @param[in]   Flags         Flag of loading JSON payload, the value could be
+                             the combination of below flags. Other flags are
+                             ignored.
+                               - EDKII_JSON_REJECT_DUPLICATES
+                               - EDKII_JSON_DISABLE_EOF_CHECK
+                               - EDKII_JSON_DECODE_ANY
+  @param[in]   Callback      The function to report parser events. Optional.
+  @param[in]   Context       The context passed to Callback. Optional.
+
+  @retval      EDKII_JSON_PARSER  The parser. Caller frees it by JsonParserFree().
+  @retval      NULL               Not enough memory.
+
+**/
+EDKII_JSON_PARSER
+EFIAPI
+JsonParserCreate (
+  IN    UINTN                        Flags,
+  IN    EDKII_JSON_PARSER_CALLBACK   Callback  OPTIONAL,
+  IN    VOID                         *Context  OPTIONAL
+  )
+{
+  JSON_PARSER  *Parser;
+
+  Parser = AllocateZeroPool (sizeof (JSON_PARSER));
+  if (Parser == NULL) {
+    return NULL;
+  }
+
+  Parser->Stack = AllocatePool (JSON_PARSER_INITIAL_DEPTH * sizeof (JSON_PARSER_FRAME));
+  Parser->Token = AllocatePool (JSON_PARSER_INITIAL_TOKEN);
+  if ((Parser->Stack == NULL) || (Parser->Token == NULL)) {
+    JsonParserFree (Parser);
+    return NULL;
+  }
+
+  Parser->StackSize = JSON_PARSER_INITIAL_DEPTH;
+  Parser->TokenSize = JSON_PARSER_INITIAL_TOKEN;
+  Parser->Flags     = Flags;
+  Parser->Callback  = Callback;
+  Parser->Context   = Context;
+  Parser->Lex       = JsonLexNone;
+  Parser->Expect    = JsonExpectValue;
+  Parser->Line      = 1;
+  Parser->Status    = EFI_SUCCESS;
+
+  return (EDKII_JSON_PARSER)Parser;
+}
+
+/**
+  Give the next piece of JSON payload to the parser. The piece may end anywhere,
+  even in the middle of a string or number.
+
+  @param[in]   Parser        The parser created by JsonParserCreate().
+  @param[in]   Buffer        The piece of JSON payload.
+  @param[in]   BufferLen     The length of Buffer in bytes.
+  @param[out]  Error         Returned error of the JSON payload. Optional.
+
+  @retval      EFI_SUCCESS             The piece is parsed.
+  @retval      EFI_INVALID_PARAMETER   Parser is NULL, or Buffer is NULL and BufferLen is not 0.
+  @retval      EFI_VOLUME_CORRUPTED    The payload is not valid JSON, see Error for the details.
+  @retval      EFI_ABORTED             The callback stops parsing.
+  @retval      EFI_ALREADY_STARTED     JsonParserFinish() is called already.
+  @retval      EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+EFI_STATUS
+EFIAPI
+JsonParserFeed (
+  IN    EDKII_JSON_PARSER  Parser,
+  IN    CONST CHAR8        *Buffer,
+  IN    UINTN              BufferLen,
+  OUT   EDKII_JSON_ERROR   *Error    OPTIONAL
+  )
+{
+  JSON_PARSER  *Private;
+  UINTN        Index;
+  UINT8        Char;
+  EFI_STATUS   Status;
+
+  if ((Parser == NULL) || ((Buffer == NULL) && (BufferLen != 0))) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Private = (JSON_PARSER *)Parser;
+  if (Private->Finished) {
+    return EFI_ALREADY_STARTED;
+  }
+
+  Status = EFI_SUCCESS;
+  Index  = 0;
+  while (Index < BufferLen && !EFI_ERROR (Private->Status)) {
+    if ((Private->Expect == JsonExpectNothing) && ((Private->Flags & EDKII_JSON_DISABLE_EOF_CHECK) != 0)) {
+      //
+      // The rest after the value is not parsed.
+      //
+      break;
+    }
+
+    Char = (UINT8)Buffer[Index];
+
+    //
+    // Numbers and literals end at the first byte not belonging to them, which
+    // is processed again as the next token.
+    //
+    if (Private->Lex == JsonLexNumber) {
+      if (((Char >= '0') && (Char <= '9')) || (Char == '-') || (Char == '+') ||
+          (Char == '.') || (Char == 'e') || (Char == 'E'))
+      {
+        Status = JsonParserTokenAppend (Private, (CHAR8)Char);
+      } else {
+        JsonParserNumberDone (Private);
+        continue;
+      }
+    } else if (Private->Lex == JsonLexLiteral) {
+      if ((Char >= 'a') && (Char <= 'z')) {
+        Status = JsonParserTokenAppend (Private, (CHAR8)Char);
+      } else {
+        JsonParserLiteralDone (Private);
+        continue;
+      }
+    } else if (Private->Lex != JsonLexNone) {
+      Status = JsonParserStringChar (Private, Char);
+    } else {
+      Status = JsonParserStructureChar (Private, Char);
+    }
+
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    Index++;
+    Private->Position++;
+    if (Char == '\n') {
+      Private->Line++;
+      Private->Column = 0;
+    } else {
+      Private->Column++;
+    }
+  }
+
+  return JsonParserReturnError (Private, Error);
+}
+
+/**
+  Tell the parser the JSON payload ends and get the loaded JSON value.
+
+  @param[in]   Parser        The parser created by JsonParserCreate().
+  @param[out]  JsonValue     The JSON value loaded when the parser is created
+                             without callback, otherwise NULL. Caller needs to
+                             cleanup the value by calling JsonValueFree(). Optional.
+  @param[out]  Error         Returned error of the JSON payload. Optional.
+
+  @retval      EFI_SUCCESS             The payload is a complete JSON value.
+  @retval      EFI_INVALID_PARAMETER   Parser is NULL.
+  @retval      EFI_VOLUME_CORRUPTED    The payload is not valid JSON or it is not complete,
+                                       see Error for the details.
+  @retval      EFI_ABORTED             The callback stops parsing.
+  @retval      EFI_ALREADY_STARTED     JsonParserFinish() is called already.
+  @retval      EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+EFI_STATUS
+EFIAPI
+JsonParserFinish (
+  IN    EDKII_JSON_PARSER  Parser,
+  OUT   EDKII_JSON_VALUE   *JsonValue  OPTIONAL,
+  OUT   EDKII_JSON_ERROR   *Error      OPTIONAL
+  )
+{
+  JSON_PARSER  *Private;
+
+  if (Parser == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (JsonValue != NULL) {
+    *JsonValue = NULL;
+  }
+
+  Private = (JSON_PARSER *)Parser;
+  if (Private->Finished) {
+    return EFI_ALREADY_STARTED;
+  }
+
+  Private->Finished = TRUE;
+  if (EFI_ERROR (Private->Status)) {
+    return JsonParserReturnError (Private, Error);
+  }
+
+  if (Private->Lex == JsonLexNumber) {
+    JsonParserNumberDone (Private);
+  } else if (Private->Lex == JsonLexLiteral) {
+    JsonParserLiteralDone (Private);
+  }
+
+  if (!EFI_ERROR (Private->Status) && (Private->Expect != JsonExpectNothing)) {
+    JsonParserSetError (Private, EFI_VOLUME_CORRUPTED, "premature end of input");
+  }
+
+  if (!EFI_ERROR (Private->Status) && (JsonValue != NULL)) {
+    *JsonValue    = (EDKII_JSON_VALUE)Private->Root;
+    Private->Root = NULL;
+  }
+
+  return JsonParserReturnError (Private, Error);
+}
+
+/**
+  Free the parser and the JSON values it holds.
+
+  @param[in]   Parser        The parser created by JsonParserCreate().
+
+**/
+VOID
+EFIAPI
+JsonParserFree (
+  IN    EDKII_JSON_PARSER  Parser
+  )
+{
+  JSON_PARSER  *Private;
+
+  if (Parser == NULL) {
+    return;
+  }
+
+  Private = (JSON_PARSER *)Parser;
+  if (Private->Stack != NULL) {
+    while (Private->Depth > 0) {
+      Private->Depth--;
+      if (Private->Stack[Private->Depth].Container != NULL) {
+        json_decref (Private->Stack[Private->Depth].Container);
+      }
+
+      if (Private->Stack[Private->Depth].MemberKey != NULL) {
+        FreePool (Private->Stack[Private->Depth].MemberKey);
+      }
+    }
+
+    FreePool (Private->Stack);
+  }
+
+  if (Private->Token != NULL) {
+    FreePool (Private->Token);
+  }
+
+  if (Private->Root != NULL) {
+    json_decref (Private->Root);
+  }
+
+  FreePool (Private);
+}
@@ -0,0 +1,505 @@
+/** @file
+  Unit tests of the incremental JSON parser in JsonLib.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/JsonLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UnitTestLib.h>
+
+#define UNIT_TEST_APP_NAME     "JsonLib Parser Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+//
+// mPayload is loaded to the value which is dumped as mCompactPayload.
+//
+STATIC CONST CHAR8  mPayload[] =
+  "{\r\n"
+  "  \"@odata.id\": \"/redfish/v1/Systems/1\",\r\n"
+  "  \"Name\" : \"System \\\"1\\\" caf\\u00e9\",\r\n"
+  "  \"MemoryGiB\": 9223372036854775807,\r\n"
+  "  \"Offset\": -42,\r\n"
+  "  \"Status\": { \"State\": \"Enabled\", \"Health\": null },\r\n"
+  "  \"Oem\": { \"Vendor\": { \"Flags\": [true, false, [], {}] } },\r\n"
+  "  \"Members\": [ { \"@odata.id\": \"/redfish/v1/Systems/1/Memory/1\" }, 0 ]\r\n"
+  "}";
+
+STATIC CONST CHAR8  mCompactPayload[] =
+  "{\"@odata.id\":\"/redfish/v1/Systems/1\",\"Name\":\"System \\\"1\\\" caf\xc3\xa9\","
+  "\"MemoryGiB\":9223372036854775807,\"Offset\":-42,"
+  "\"Status\":{\"State\":\"Enabled\",\"Health\":null},"
+  "\"Oem\":{\"Vendor\":{\"Flags\":[true,false,[],{}]}},"
+  "\"Members\":[{\"@odata.id\":\"/redfish/v1/Systems/1/Memory/1\"},0]}";
+
+///
+/// Invalid JSON payload.
+///
+typedef struct {
+  CONST CHAR8    *Payload;
+  UINTN          Flags;
+} JSON_PARSER_INVALID_PAYLOAD;
+
+STATIC CONST JSON_PARSER_INVALID_PAYLOAD  mInvalidPayloads[] = {
+  { "",                               0                            },
+  { "   ",                            0                            },
+  { "{\"a\":}",                       0                            },
+  { "{\"a\" 1}",                      0                            },
+  { "{\"a\":1,}",                     0                            },
+  { "{,}",                            0                            },
+  { "{1:2}",                          0                            },
+  { "[1,]",                           0                            },
+  { "[1 2]",                          0                            },
+  { "]",                              0                            },
+  { "{\"a\":[}",                      0                            },
+  { "[tru]",                          0                            },
+  { "[nul]",                          0                            },
+  { "[01]",                           0                            },
+  { "[1.]",                           0                            },
+  { "[1e]",                           0                            },
+  { "[-]",                            0                            },
+  { "[9223372036854775808]",          0                            },
+  { "[-9223372036854775809]",         0                            },
+  { "[\"\\x\"]",                      0                            },
+  { "[\"\\u12G4\"]",                  0                            },
+  { "[\"\\ud800\"]",                  0                            },
+  { "[\"\\udc00\\ud800\"]",           0                            },
+  { "[\"\\u0000\"]",                  0                            },
+  { "[\"\x01\"]",                     0                            },
+  { "[\"\xff\"]",                     0                            },
+  { "[\"\xc3\"]",                     0                            },
+  { "[\"\xc0\xaf\"]",                 0                            },
+  { "[\"\xed\xa0\x80\"]",             0                            },
+  { "{\"a\":1}x",                     0                            },
+  { "{\"a\":1}{}",                    0                            },
+  { "{\"a\":1,\"a\":2}",              EDKII_JSON_REJECT_DUPLICATES },
+  { "42",                             0                            },
+  { "\"Redfish\"",                    0                            },
+  { "[1",                             EDKII_JSON_DECODE_ANY        },
+};
+
+///
+/// Context of JsonParserTestCallback().
+///
+typedef struct {
+  UINTN    Events;
+  UINTN    OpenContainers;
+  UINTN    MaxDepth;
+  UINTN    AbortAt;
+  BOOLEAN  StatusLoaded;
+  BOOLEAN  OemReported;
+  BOOLEAN  BadEvent;
+} JSON_PARSER_TEST_CONTEXT;
+
+/**
+  Parse the payload given in pieces of PieceSize bytes. Each piece is copied
+  to its own buffer so reading beyond the piece is caught by the address
+  sanitizer.
+
+  @param[in]   Payload       The JSON payload.
+  @param[in]   PayloadSize   The size of Payload in bytes.
+  @param[in]   PieceSize     The size of each piece.
+  @param[in]   Flags         The flags of parser.
+  @param[in]   Callback      The callback of parser. Optional.
+  @param[in]   Context       The context of callback. Optional.
+  @param[out]  JsonValue     The loaded JSON value. Optional.
+
+  @retval EFI_STATUS   The status JsonParserFeed() or JsonParserFinish() returns.
+**/
+STATIC
+EFI_STATUS
+ParsePieces (
+  IN  CONST CHAR8                  *Payload,
+  IN  UINTN                        PayloadSize,
+  IN  UINTN                        PieceSize,
+  IN  UINTN                        Flags,
+  IN  EDKII_JSON_PARSER_CALLBACK   Callback   OPTIONAL,
+  IN  VOID                         *Context   OPTIONAL,
+  OUT EDKII_JSON_VALUE             *JsonValue OPTIONAL
+  )
+{
+  EDKII_JSON_PARSER  Parser;
+  EDKII_JSON_ERROR   Error;
+  EFI_STATUS         Status;
+  UINTN              Offset;
+  UINTN              Length;
+  CHAR8              *Piece;
+
+  Parser = JsonParserCreate (Flags, Callback, Context);
+  if (Parser == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = EFI_SUCCESS;
+  for (Offset = 0; Offset < PayloadSize && !EFI_ERROR (Status); Offset += Length) {
+    Length = MIN (PieceSize, PayloadSize - Offset);
+    Piece  = AllocateCopyPool (Length, Payload + Offset);
+    if (Piece == NULL) {
+      Status = EFI_OUT_OF_RESOURCES;
+      break;
+    }
+
+    Status = JsonParserFeed (Parser, Piece, Length, &Error);
+    FreePool (Piece);
+  }
+
+  if (!EFI_ERROR (Status)) {
+    Status = JsonParserFinish (Parser, JsonValue, &Error);
+  }
+
+  JsonParserFree (Parser);
+  return Status;
+}
+
+/**
+  Callback of parser which skips "Oem", loads "Status", and continues with
+  events for other objects and arrays.
+
+  @param[in]   Context        JSON_PARSER_TEST_CONTEXT.
+  @param[in]   Event          The parser event.
+  @param[in]   Depth          The nesting level of the value.
+  @param[in]   Key            The member name, or NULL.
+  @param[in]   Index          The index in array.
+  @param[in]   Value          The value of EdkiiJsonParserEventValue.
+
+  @retval      EDKII_JSON_PARSER_ACTION  The action to take.
+**/
+STATIC
+EDKII_JSON_PARSER_ACTION
+EFIAPI
+JsonParserTestCallback (
+  IN  VOID                     *Context,
+  IN  EDKII_JSON_PARSER_EVENT  Event,
+  IN  UINTN                    Depth,
+  IN  CONST CHAR8              *Key    OPTIONAL,
+  IN  UINTN                    Index,
+  IN  EDKII_JSON_VALUE         Value
+  )
+{
+  JSON_PARSER_TEST_CONTEXT  *TestContext;
+
+  TestContext = (JSON_PARSER_TEST_CONTEXT *)Context;
+  TestContext->Events++;
+  if (TestContext->Events == TestContext->AbortAt) {
+    return EdkiiJsonParserActionAbort;
+  }
+
+  TestContext->MaxDepth = MAX (TestContext->MaxDepth, Depth);
+  if ((Key != NULL) && (AsciiStrCmp (Key, "Vendor") == 0)) {
+    TestContext->OemReported = TRUE;
+  }
+
+  switch (Event) {
+    case EdkiiJsonParserEventObjectStart:
+    case EdkiiJsonParserEventArrayStart:
+      if ((Key != NULL) && (AsciiStrCmp (Key, "Oem") == 0)) {
+        return EdkiiJsonParserActionSkip;
+      }
+
+      if ((Key != NULL) && (AsciiStrCmp (Key, "Status") == 0)) {
+        return EdkiiJsonParserActionLoad;
+      }
+
+      TestContext->OpenContainers++;
+      break;
+
+    case EdkiiJsonParserEventObjectEnd:
+    case EdkiiJsonParserEventArrayEnd:
+      if (TestContext->OpenContainers == 0) {
+        TestContext->BadEvent = TRUE;
+      } else {
+        TestContext->OpenContainers--;
+      }
+
+      break;
+
+    case EdkiiJsonParserEventValue:
+      if (Value == NULL) {
+        TestContext->BadEvent = TRUE;
+      }
+
+      if ((Key != NULL) && (AsciiStrCmp (Key, "Status") == 0)) {
+        TestContext->StatusLoaded = JsonValueIsObject (Value) &&
+                                    (JsonValueGetAsciiString (JsonObjectGetValue (JsonValueGetObject (Value), "State")) != NULL);
+      }
+
+      break;
+
+    default:
+      TestContext->BadEvent = TRUE;
+      break;
+  }
+
+  return EdkiiJsonParserActionContinue;
+}
+
+/**
+  Valid payload given in pieces of any size is loaded.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+ValidPayloadShouldLoad (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EDKII_JSON_VALUE  JsonValue;
+  CHAR8             *Dump;
+  UINTN             PieceSize;
+
+  for (PieceSize = 1; PieceSize <= sizeof (mPayload); PieceSize++) {
+    JsonValue = NULL;
+    UT_ASSERT_NOT_EFI_ERROR (ParsePieces (mPayload, AsciiStrLen (mPayload), PieceSize, 0, NULL, NULL, &JsonValue));
+    UT_ASSERT_NOT_NULL (JsonValue);
+    Dump = JsonDumpString (JsonValue, EDKII_JSON_COMPACT);
+    UT_ASSERT_NOT_NULL (Dump);
+    UT_ASSERT_EQUAL (AsciiStrCmp (Dump, mCompactPayload), 0);
+    FreePool (Dump);
+    JsonValueFree (JsonValue);
+  }
+
+  //
+  // Scalar root value is accepted with EDKII_JSON_DECODE_ANY.
+  //
+  UT_ASSERT_NOT_EFI_ERROR (ParsePieces (" -7 ", 4, 1, EDKII_JSON_DECODE_ANY, NULL, NULL, &JsonValue));
+  UT_ASSERT_TRUE (JsonValueIsInteger (JsonValue));
+  UT_ASSERT_EQUAL (JsonValueGetInteger (JsonValue), (UINT64)-7);
+  JsonValueFree (JsonValue);
+
+  //
+  // Data after the value is ignored with EDKII_JSON_DISABLE_EOF_CHECK.
+  //
+  UT_ASSERT_NOT_EFI_ERROR (ParsePieces ("[1] x", 5, 2, EDKII_JSON_DISABLE_EOF_CHECK, NULL, NULL, &JsonValue));
+  UT_ASSERT_TRUE (JsonValueIsArray (JsonValue));
+  JsonValueFree (JsonValue);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Parser reports events to the callback, and skips or loads the objects
+  as the callback asks.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+CallbackShouldSkipAndLoad (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  JSON_PARSER_TEST_CONTEXT  TestContext;
+  EDKII_JSON_VALUE          JsonValue;
+  UINTN                     PieceSize;
+  UINTN                     Events;
+
+  Events = 0;
+  for (PieceSize = 1; PieceSize <= sizeof (mPayload); PieceSize += 7) {
+    ZeroMem (&TestContext, sizeof (TestContext));
+    JsonValue = NULL;
+    UT_ASSERT_NOT_EFI_ERROR (ParsePieces (mPayload, AsciiStrLen (mPayload), PieceSize, 0, JsonParserTestCallback, &TestContext, &JsonValue));
+    UT_ASSERT_TRUE (JsonValue == NULL);
+    UT_ASSERT_TRUE (TestContext.StatusLoaded);
+    UT_ASSERT_FALSE (TestContext.OemReported);
+    UT_ASSERT_FALSE (TestContext.BadEvent);
+    UT_ASSERT_EQUAL (TestContext.OpenContainers, 0);
+    UT_ASSERT_EQUAL (TestContext.MaxDepth, 3);
+    if (Events == 0) {
+      Events = TestContext.Events;
+    }
+
+    UT_ASSERT_EQUAL (TestContext.Events, Events);
+  }
+
+  ZeroMem (&TestContext, sizeof (TestContext));
+  TestContext.AbortAt = 3;
+  UT_ASSERT_STATUS_EQUAL (ParsePieces (mPayload, AsciiStrLen (mPayload), 16, 0, JsonParserTestCallback, &TestContext, NULL), EFI_ABORTED);
+  UT_ASSERT_EQUAL (TestContext.Events, 3);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Parsing fails on every truncation of valid payload.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+TruncatedPayloadShouldFail (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EDKII_JSON_VALUE          JsonValue;
+  JSON_PARSER_TEST_CONTEXT  TestContext;
+  UINTN                     Length;
+
+  for (Length = 0; Length < AsciiStrLen (mPayload); Length++) {
+    JsonValue = NULL;
+    UT_ASSERT_STATUS_EQUAL (ParsePieces (mPayload, Length, 5, 0, NULL, NULL, &JsonValue), EFI_VOLUME_CORRUPTED);
+    UT_ASSERT_TRUE (JsonValue == NULL);
+
+    ZeroMem (&TestContext, sizeof (TestContext));
+    UT_ASSERT_STATUS_EQUAL (ParsePieces (mPayload, Length, 5, 0, JsonParserTestCallback, &TestContext, NULL), EFI_VOLUME_CORRUPTED);
+    UT_ASSERT_FALSE (TestContext.BadEvent);
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Parsing fails on invalid payload, both when it is given at once and
+  byte by byte.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+InvalidPayloadShouldFail (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  EDKII_JSON_PARSER  Parser;
+  EDKII_JSON_VALUE   JsonValue;
+  EDKII_JSON_ERROR   Error;
+  UINTN              Index;
+  UINTN              Length;
+
+  for (Index = 0; Index < ARRAY_SIZE (mInvalidPayloads); Index++) {
+    Length = AsciiStrLen (mInvalidPayloads[Index].Payload);
+    UT_LOG_INFO ("Payload %d: %a\n", Index, mInvalidPayloads[Index].Payload);
+
+    JsonValue = NULL;
+    UT_ASSERT_STATUS_EQUAL (ParsePieces (mInvalidPayloads[Index].Payload, Length, MAX (Length, 1), mInvalidPayloads[Index].Flags, NULL, NULL, &JsonValue), EFI_VOLUME_CORRUPTED);
+    UT_ASSERT_TRUE (JsonValue == NULL);
+    UT_ASSERT_STATUS_EQUAL (ParsePieces (mInvalidPayloads[Index].Payload, Length, 1, mInvalidPayloads[Index].Flags, NULL, NULL, &JsonValue), EFI_VOLUME_CORRUPTED);
+    UT_ASSERT_TRUE (JsonValue == NULL);
+  }
+
+  //
+  // Duplicated keys are accepted without EDKII_JSON_REJECT_DUPLICATES.
+  //
+  UT_ASSERT_NOT_EFI_ERROR (ParsePieces ("{\"a\":1,\"a\":2}", 13, 4, 0, NULL, NULL, &JsonValue));
+  UT_ASSERT_EQUAL (JsonValueGetInteger (JsonObjectGetValue (JsonValueGetObject (JsonValue), "a")), 2);
+  JsonValueFree (JsonValue);
+
+  //
+  // Parser can't be used after it finishes.
+  //
+  Parser = JsonParserCreate (0, NULL, NULL);
+  UT_ASSERT_NOT_NULL (Parser);
+  UT_ASSERT_NOT_EFI_ERROR (JsonParserFeed (Parser, "[]", 2, &Error));
+  UT_ASSERT_NOT_EFI_ERROR (JsonParserFinish (Parser, &JsonValue, &Error));
+  UT_ASSERT_STATUS_EQUAL (JsonParserFeed (Parser, "[]", 2, &Error), EFI_ALREADY_STARTED);
+  UT_ASSERT_STATUS_EQUAL (JsonParserFinish (Parser, NULL, &Error), EFI_ALREADY_STARTED);
+  JsonParserFree (Parser);
+  JsonValueFree (JsonValue);
+
+  UT_ASSERT_STATUS_EQUAL (JsonParserFeed (NULL, "[]", 2, &Error), EFI_INVALID_PARAMETER);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  incremental JSON parser and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      ParserTests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  Status = CreateUnitTestSuite (&ParserTests, Framework, "JSON Parser Tests", "JsonParser", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for JSON Parser Tests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite----------Description-----------------------------Name--------Function--------------------Pre---Post---Context
+  //
+  AddTestCase (ParserTests, "Load valid payload in pieces",           "Valid",     ValidPayloadShouldLoad,     NULL, NULL, NULL);
+  AddTestCase (ParserTests, "Report events to callback",              "Callback",  CallbackShouldSkipAndLoad,  NULL, NULL, NULL);
+  AddTestCase (ParserTests, "Reject truncated payload",               "Truncated", TruncatedPayloadShouldFail, NULL, NULL, NULL);
+  AddTestCase (ParserTests, "Reject invalid payload",                 "Invalid",   InvalidPayloadShouldFail,   NULL, NULL, NULL);
+
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+///
+/// Avoid ECC error for function name that starts with lower case letter
+///
+#define JsonParserUnitTestMain  main
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+
+  @param[in] Argc  Number of arguments
+  @param[in] Argv  Array of pointers to arguments
+
+  @retval 0      Success
+  @retval other  Error
+**/
+INT32
+JsonParserUnitTestMain (
+  IN INT32  Argc,
+  IN CHAR8  *Argv[]
+  )
+{
+  UnitTestingEntry ();
+  return 0;
+}
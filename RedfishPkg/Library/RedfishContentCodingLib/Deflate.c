@@ -0,0 +1,348 @@
+/** @file
+  DEFLATE compressor, RFC 1951.
+
+  Request content is small and sent once, so the compressor keeps things
+  simple: LZ77 matching with hash chains and a single block of fixed Huffman
+  codes. This still shrinks JSON content by more than half.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishContentCodingInternal.h"
+
+#define DEFLATE_HASH_BITS       15
+#define DEFLATE_HASH_SIZE       (1 << DEFLATE_HASH_BITS)
+#define DEFLATE_HASH_MASK       (DEFLATE_HASH_SIZE - 1)
+#define DEFLATE_WINDOW_MASK     (DEFLATE_WINDOW_SIZE - 1)
+//
+// The number of earlier positions checked for the longest match.
+//
+#define DEFLATE_MAX_CHAIN       64
+//
+// Block type of fixed Huffman codes.
+//
+#define DEFLATE_BLOCK_FIXED     1
+
+typedef struct {
+  UINT8     *Buffer;
+  UINTN     Index;
+  UINT32    BitBuffer;
+  UINTN     BitCount;
+} DEFLATE_OUTPUT;
+
+typedef struct {
+  CONST UINT8    *Source;
+  UINTN          SourceSize;
+  UINT32         *Head;       ///< Latest position + 1 of each hash, 0 if none.
+  UINT32         *Previous;   ///< Previous position + 1 of the same hash.
+} DEFLATE_MATCHER;
+
+/**
+  Write bits to output, least significant bit first.
+
+  @param[in,out]  Output   Compressor output.
+  @param[in]      Value    The bits to write.
+  @param[in]      Count    Number of bits to write, at most 16.
+
+**/
+STATIC
+VOID
+DeflatePutBits (
+  IN OUT DEFLATE_OUTPUT  *Output,
+  IN     UINT32          Value,
+  IN     UINTN           Count
+  )
+{
+  Output->BitBuffer |= Value << Output->BitCount;
+  Output->BitCount  += Count;
+  while (Output->BitCount >= 8) {
+    Output->Buffer[Output->Index++] = (UINT8)Output->BitBuffer;
+    Output->BitBuffer             >>= 8;
+    Output->BitCount               -= 8;
+  }
+}
+
+/**
+  Write a Huffman code to output. Huffman codes are packed starting
+  with the most significant bit.
+
+  @param[in,out]  Output   Compressor output.
+  @param[in]      Code     The Huffman code.
+  @param[in]      Length   Code length in bits.
+
+**/
+STATIC
+VOID
+DeflatePutCode (
+  IN OUT DEFLATE_OUTPUT  *Output,
+  IN     UINT32          Code,
+  IN     UINTN           Length
+  )
+{
+  UINT32  Reversed;
+  UINTN   Index;
+
+  Reversed = 0;
+  for (Index = 0; Index < Length; Index++) {
+    Reversed = (Reversed << 1) | (Code & 1);
+    Code   >>= 1;
+  }
+
+  DeflatePutBits (Output, Reversed, Length);
+}
+
+/**
+  Write a literal/length symbol with fixed Huffman code.
+
+  @param[in,out]  Output   Compressor output.
+  @param[in]      Symbol   Literal/length symbol, 0..287.
+
+**/
+STATIC
+VOID
+DeflatePutLitLen (
+  IN OUT DEFLATE_OUTPUT  *Output,
+  IN     UINTN           Symbol
+  )
+{
+  if (Symbol < 144) {
+    DeflatePutCode (Output, (UINT32)(0x30 + Symbol), 8);
+  } else if (Symbol < 256) {
+    DeflatePutCode (Output, (UINT32)(0x190 + Symbol - 144), 9);
+  } else if (Symbol < 280) {
+    DeflatePutCode (Output, (UINT32)(Symbol - 256), 7);
+  } else {
+    DeflatePutCode (Output, (UINT32)(0xC0 + Symbol - 280), 8);
+  }
+}
+
+/**
+  Write a length and distance pair with fixed Huffman codes.
+
+  @param[in,out]  Output     Compressor output.
+  @param[in]      Length     Match length, 3..258.
+  @param[in]      Distance   Match distance, 1..32768.
+
+**/
+STATIC
+VOID
+DeflatePutMatch (
+  IN OUT DEFLATE_OUTPUT  *Output,
+  IN     UINTN           Length,
+  IN     UINTN           Distance
+  )
+{
+  UINTN  Code;
+
+  for (Code = ARRAY_SIZE (mDeflateLengthBase) - 1; mDeflateLengthBase[Code] > Length; Code--) {
+  }
+
+  DeflatePutLitLen (Output, DEFLATE_END_OF_BLOCK + 1 + Code);
+  DeflatePutBits (Output, (UINT32)(Length - mDeflateLengthBase[Code]), mDeflateLengthExtra[Code]);
+
+  for (Code = ARRAY_SIZE (mDeflateDistanceBase) - 1; mDeflateDistanceBase[Code] > Distance; Code--) {
+  }
+
+  DeflatePutCode (Output, (UINT32)Code, 5);
+  DeflatePutBits (Output, (UINT32)(Distance - mDeflateDistanceBase[Code]), mDeflateDistanceExtra[Code]);
+}
+
+/**
+  Add the position to hash chains.
+
+  @param[in,out]  Matcher    LZ77 matcher.
+  @param[in]      Position   Position in source.
+
+**/
+STATIC
+VOID
+DeflateInsert (
+  IN OUT DEFLATE_MATCHER  *Matcher,
+  IN     UINTN            Position
+  )
+{
+  CONST UINT8  *Data;
+  UINTN        Hash;
+
+  if (Position + DEFLATE_MIN_MATCH > Matcher->SourceSize) {
+    return;
+  }
+
+  Data = Matcher->Source + Position;
+  Hash = ((Data[0] << 10) ^ (Data[1] << 5) ^ Data[2]) & DEFLATE_HASH_MASK;
+
+  Matcher->Previous[Position & DEFLATE_WINDOW_MASK] = Matcher->Head[Hash];
+  Matcher->Head[Hash]                               = (UINT32)(Position + 1);
+}
+
+/**
+  Find the longest match of the data at Position in the window.
+
+  @param[in]   Matcher    LZ77 matcher.
+  @param[in]   Position   Position in source.
+  @param[out]  Distance   Distance of the longest match.
+
+  @retval The length of longest match, less than DEFLATE_MIN_MATCH if not found.
+
+**/
+STATIC
+UINTN
+DeflateLongestMatch (
+  IN  CONST DEFLATE_MATCHER  *Matcher,
+  IN  UINTN                  Position,
+  OUT UINTN                  *Distance
+  )
+{
+  CONST UINT8  *Data;
+  UINTN        Hash;
+  UINTN        Candidate;
+  UINTN        Match;
+  UINTN        MaxLength;
+  UINTN        Length;
+  UINTN        BestLength;
+  UINTN        Chain;
+
+  BestLength = 0;
+  if (Position + DEFLATE_MIN_MATCH > Matcher->SourceSize) {
+    return 0;
+  }
+
+  Data      = Matcher->Source + Position;
+  Hash      = ((Data[0] << 10) ^ (Data[1] << 5) ^ Data[2]) & DEFLATE_HASH_MASK;
+  MaxLength = MIN (DEFLATE_MAX_MATCH, Matcher->SourceSize - Position);
+  Candidate = Matcher->Head[Hash];
+  Match     = Position;
+
+  for (Chain = 0; Chain < DEFLATE_MAX_CHAIN && Candidate != 0; Chain++) {
+    //
+    // Slots of the window are reused, stop when the chain goes forward
+    // or out of the window.
+    //
+    if ((Candidate - 1 >= Match) || (Position - (Candidate - 1) > DEFLATE_WINDOW_SIZE)) {
+      break;
+    }
+
+    Match = Candidate - 1;
+    for (Length = 0; Length < MaxLength && Matcher->Source[Match + Length] == Data[Length]; Length++) {
+    }
+
+    if (Length > BestLength) {
+      BestLength = Length;
+      *Distance  = Position - Match;
+      if (Length == MaxLength) {
+        break;
+      }
+    }
+
+    Candidate = Matcher->Previous[Match & DEFLATE_WINDOW_MASK];
+  }
+
+  return BestLength;
+}
+
+/**
+  Compress data to raw DEFLATE data. The data is compressed with LZ77
+  and the fixed Huffman codes.
+
+  @param[in]   Source            The data to compress.
+  @param[in]   SourceSize        The size of Source in bytes.
+  @param[in]   HeaderSize        The size in bytes reserved in the front of
+                                 Destination for caller's header.
+  @param[in]   TrailerSize       The size in bytes reserved at the end of
+                                 Destination for caller's trailer.
+  @param[out]  Destination       Pointer to receive the compressed data, with
+                                 HeaderSize bytes before and TrailerSize bytes
+                                 after. Caller frees it.
+  @param[out]  DestinationSize   The size of compressed data in bytes, not
+                                 including header and trailer.
+
+  @retval EFI_SUCCESS            Data is compressed.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+
+**/
+EFI_STATUS
+DeflateCompress (
+  IN  CONST UINT8  *Source,
+  IN  UINTN        SourceSize,
+  IN  UINTN        HeaderSize,
+  IN  UINTN        TrailerSize,
+  OUT UINT8        **Destination,
+  OUT UINTN        *DestinationSize
+  )
+{
+  DEFLATE_MATCHER  Matcher;
+  DEFLATE_OUTPUT   Output;
+  UINTN            Position;
+  UINTN            Length;
+  UINTN            Distance;
+  UINTN            Index;
+
+  //
+  // A literal takes at most 9 bits and a match never takes more bits than
+  // the literals it replaces, plus 3 bits of block header and 7 bits of
+  // end of block.
+  //
+  Output.Buffer = AllocatePool (HeaderSize + (SourceSize * 9 + 7) / 8 + 2 + TrailerSize);
+  if (Output.Buffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Matcher.Source     = Source;
+  Matcher.SourceSize = SourceSize;
+  Matcher.Head       = AllocateZeroPool (DEFLATE_HASH_SIZE * sizeof (UINT32));
+  Matcher.Previous   = AllocateZeroPool (DEFLATE_WINDOW_SIZE * sizeof (UINT32));
+  if ((Matcher.Head == NULL) || (Matcher.Previous == NULL)) {
+    FreePool (Output.Buffer);
+    if (Matcher.Head != NULL) {
+      FreePool (Matcher.Head);
+    }
+
+    if (Matcher.Previous != NULL) {
+      FreePool (Matcher.Previous);
+    }
+
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Output.Index     = HeaderSize;
+  Output.BitBuffer = 0;
+  Output.BitCount  = 0;
+
+  //
+  // BFINAL and BTYPE of the only block.
+  //
+  DeflatePutBits (&Output, 1, 1);
+  DeflatePutBits (&Output, DEFLATE_BLOCK_FIXED, 2);
+
+  Position = 0;
+  while (Position < SourceSize) {
+    Length = DeflateLongestMatch (&Matcher, Position, &Distance);
+    if (Length >= DEFLATE_MIN_MATCH) {
+      DeflatePutMatch (&Output, Length, Distance);
+      for (Index = 0; Index < Length; Index++) {
+        DeflateInsert (&Matcher, Position + Index);
+      }
+
+      Position += Length;
+    } else {
+      DeflatePutLitLen (&Output, Source[Position]);
+      DeflateInsert (&Matcher, Position);
+      Position++;
+    }
+  }
+
+  DeflatePutLitLen (&Output, DEFLATE_END_OF_BLOCK);
+  if (Output.BitCount > 0) {
+    DeflatePutBits (&Output, 0, 8 - Output.BitCount);
+  }
+
+  FreePool (Matcher.Head);
+  FreePool (Matcher.Previous);
+
+  *Destination     = Output.Buffer;
+  *DestinationSize = Output.Index - HeaderSize;
+  return EFI_SUCCESS;
+}
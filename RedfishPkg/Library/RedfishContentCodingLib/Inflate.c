@@ -0,0 +1,607 @@
+/** @file
+  DEFLATE decompressor, RFC 1951.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishContentCodingInternal.h"
+
+//
+// Base length and extra bits of length codes 257..285.
+//
+CONST UINT16  mDeflateLengthBase[29] = {
+  3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+  31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+
+CONST UINT8  mDeflateLengthExtra[29] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+  2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+//
+// Base distance and extra bits of distance codes 0..29.
+//
+CONST UINT16  mDeflateDistanceBase[30] = {
+  1,   2,   3,   4,   5,    7,    9,    13,   17,   25,   33,   49,   65,    97,    129,
+  193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+
+CONST UINT8  mDeflateDistanceExtra[30] = {
+  0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+  6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+//
+// The order of code length code lengths in dynamic block header.
+//
+STATIC CONST UINT8  mCodeLengthOrder[DEFLATE_MAX_CODE_LENGTHS] = {
+  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+//
+// Canonical Huffman code: number of codes of each length and
+// the symbols ordered by code.
+//
+typedef struct {
+  UINT16    Count[DEFLATE_MAX_BITS + 1];
+  UINT16    Symbol[DEFLATE_MAX_LITLEN_CODES];
+} INFLATE_HUFFMAN;
+
+typedef struct {
+  CONST UINT8    *Source;
+  UINTN          SourceSize;
+  UINTN          SourceIndex;
+  UINT32         BitBuffer;
+  UINTN          BitCount;
+  UINT8          *Destination;
+  UINTN          DestinationSize;   ///< Allocated size of Destination.
+  UINTN          DestinationIndex;
+  EFI_STATUS     Status;
+} INFLATE_STATE;
+
+/**
+  Read bits from compressed data, least significant bit first.
+
+  @param[in,out]  State   Decompressor state.
+  @param[in]      Count   Number of bits to read, at most 16.
+
+  @retval The bits read. Zero if input is exhausted, with State->Status set.
+
+**/
+STATIC
+UINT32
+InflateGetBits (
+  IN OUT INFLATE_STATE  *State,
+  IN     UINTN          Count
+  )
+{
+  UINT32  Value;
+
+  while (State->BitCount < Count) {
+    if (State->SourceIndex >= State->SourceSize) {
+      State->Status = EFI_VOLUME_CORRUPTED;
+      return 0;
+    }
+
+    State->BitBuffer |= (UINT32)State->Source[State->SourceIndex++] << State->BitCount;
+    State->BitCount  += 8;
+  }
+
+  Value              = State->BitBuffer & ((1U << Count) - 1);
+  State->BitBuffer >>= Count;
+  State->BitCount   -= Count;
+  return Value;
+}
+
+/**
+  Make sure there are Size more bytes in output buffer.
+
+  @param[in,out]  State   Decompressor state.
+  @param[in]      Size    Number of bytes to write.
+
+  @retval TRUE    Output buffer is large enough.
+  @retval FALSE   Out of memory or output is too large, State->Status is set.
+
+**/
+STATIC
+BOOLEAN
+InflateReserve (
+  IN OUT INFLATE_STATE  *State,
+  IN     UINTN          Size
+  )
+{
+  UINTN  NewSize;
+  UINT8  *NewBuffer;
+
+  if (State->DestinationIndex + Size <= State->DestinationSize) {
+    return TRUE;
+  }
+
+  if (State->DestinationIndex + Size > REDFISH_CONTENT_DECODE_MAX_SIZE) {
+    State->Status = EFI_VOLUME_CORRUPTED;
+    return FALSE;
+  }
+
+  NewSize = State->DestinationSize * 2;
+  while (NewSize < State->DestinationIndex + Size) {
+    NewSize *= 2;
+  }
+
+  NewBuffer = ReallocatePool (State->DestinationSize, NewSize, State->Destination);
+  if (NewBuffer == NULL) {
+    State->Status = EFI_OUT_OF_RESOURCES;
+    return FALSE;
+  }
+
+  State->Destination     = NewBuffer;
+  State->DestinationSize = NewSize;
+  return TRUE;
+}
+
+/**
+  Build canonical Huffman code from code lengths.
+
+  @param[out]  Huffman   The Huffman code.
+  @param[in]   Length    Code length of each symbol.
+  @param[in]   Count     Number of symbols.
+
+  @retval EFI_SUCCESS            Huffman code is built. Incomplete code is allowed
+                                 as RFC 1951 allows single distance code.
+  @retval EFI_VOLUME_CORRUPTED   Code lengths are over-subscribed.
+
+**/
+STATIC
+EFI_STATUS
+InflateBuildHuffman (
+  OUT INFLATE_HUFFMAN  *Huffman,
+  IN  CONST UINT8      *Length,
+  IN  UINTN            Count
+  )
+{
+  UINT16  Offset[DEFLATE_MAX_BITS + 1];
+  UINTN   Symbol;
+  UINTN   Bits;
+  INTN    Left;
+
+  ZeroMem (Huffman->Count, sizeof (Huffman->Count));
+  for (Symbol = 0; Symbol < Count; Symbol++) {
+    Huffman->Count[Length[Symbol]]++;
+  }
+
+  Left = 1;
+  for (Bits = 1; Bits <= DEFLATE_MAX_BITS; Bits++) {
+    Left = (Left << 1) - Huffman->Count[Bits];
+    if (Left < 0) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+  }
+
+  Offset[1] = 0;
+  for (Bits = 1; Bits < DEFLATE_MAX_BITS; Bits++) {
+    Offset[Bits + 1] = Offset[Bits] + Huffman->Count[Bits];
+  }
+
+  for (Symbol = 0; Symbol < Count; Symbol++) {
+    if (Length[Symbol] != 0) {
+      Huffman->Symbol[Offset[Length[Symbol]]++] = (UINT16)Symbol;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Decode one symbol with Huffman code.
+
+  @param[in,out]  State     Decompressor state.
+  @param[in]      Huffman   The Huffman code.
+
+  @retval The decoded symbol, or -1 on error with State->Status set.
+
+**/
+STATIC
+INTN
+InflateDecodeSymbol (
+  IN OUT INFLATE_STATE          *State,
+  IN     CONST INFLATE_HUFFMAN  *Huffman
+  )
+{
+  INTN   Code;
+  INTN   First;
+  INTN   Index;
+  INTN   Count;
+  UINTN  Bits;
+
+  Code  = 0;
+  First = 0;
+  Index = 0;
+  for (Bits = 1; Bits <= DEFLATE_MAX_BITS; Bits++) {
+    Code |= (INTN)InflateGetBits (State, 1);
+    if (EFI_ERROR (State->Status)) {
+      return -1;
+    }
+
+    Count = Huffman->Count[Bits];
+    if (Code - Count < First) {
+      return Huffman->Symbol[Index + (Code - First)];
+    }
+
+    Index  += Count;
+    First  += Count;
+    First <<= 1;
+    Code  <<= 1;
+  }
+
+  State->Status = EFI_VOLUME_CORRUPTED;
+  return -1;
+}
+
+/**
+  Decompress a stored block.
+
+  @param[in,out]  State   Decompressor state.
+
+**/
+STATIC
+VOID
+InflateStored (
+  IN OUT INFLATE_STATE  *State
+  )
+{
+  UINTN  Length;
+
+  //
+  // Stored block starts at byte boundary.
+  //
+  State->BitBuffer = 0;
+  State->BitCount  = 0;
+
+  if (State->SourceIndex + 4 > State->SourceSize) {
+    State->Status = EFI_VOLUME_CORRUPTED;
+    return;
+  }
+
+  Length = State->Source[State->SourceIndex] | (State->Source[State->SourceIndex + 1] << 8);
+  if ((State->Source[State->SourceIndex + 2] != (UINT8) ~State->Source[State->SourceIndex]) ||
+      (State->Source[State->SourceIndex + 3] != (UINT8) ~State->Source[State->SourceIndex + 1]))
+  {
+    State->Status = EFI_VOLUME_CORRUPTED;
+    return;
+  }
+
+  State->SourceIndex += 4;
+  if (State->SourceIndex + Length > State->SourceSize) {
+    State->Status = EFI_VOLUME_CORRUPTED;
+    return;
+  }
+
+  if (!InflateReserve (State, Length)) {
+    return;
+  }
+
+  CopyMem (State->Destination + State->DestinationIndex, State->Source + State->SourceIndex, Length);
+  State->DestinationIndex += Length;
+  State->SourceIndex      += Length;
+}
+
+/**
+  Decompress the symbols of a Huffman compressed block.
+
+  @param[in,out]  State      Decompressor state.
+  @param[in]      LitLen     Literal/length Huffman code.
+  @param[in]      Distance   Distance Huffman code.
+
+**/
+STATIC
+VOID
+InflateCodes (
+  IN OUT INFLATE_STATE          *State,
+  IN     CONST INFLATE_HUFFMAN  *LitLen,
+  IN     CONST INFLATE_HUFFMAN  *Distance
+  )
+{
+  INTN   Symbol;
+  UINTN  Length;
+  UINTN  Offset;
+  UINT8  *Target;
+
+  while (TRUE) {
+    Symbol = InflateDecodeSymbol (State, LitLen);
+    if (Symbol < 0) {
+      return;
+    }
+
+    if (Symbol < DEFLATE_END_OF_BLOCK) {
+      if (!InflateReserve (State, 1)) {
+        return;
+      }
+
+      State->Destination[State->DestinationIndex++] = (UINT8)Symbol;
+      continue;
+    }
+
+    if (Symbol == DEFLATE_END_OF_BLOCK) {
+      return;
+    }
+
+    Symbol -= DEFLATE_END_OF_BLOCK + 1;
+    if (Symbol >= ARRAY_SIZE (mDeflateLengthBase)) {
+      State->Status = EFI_VOLUME_CORRUPTED;
+      return;
+    }
+
+    Length = mDeflateLengthBase[Symbol] + InflateGetBits (State, mDeflateLengthExtra[Symbol]);
+
+    Symbol = InflateDecodeSymbol (State, Distance);
+    if (Symbol < 0) {
+      return;
+    }
+
+    if (Symbol >= ARRAY_SIZE (mDeflateDistanceBase)) {
+      State->Status = EFI_VOLUME_CORRUPTED;
+      return;
+    }
+
+    Offset = mDeflateDistanceBase[Symbol] + InflateGetBits (State, mDeflateDistanceExtra[Symbol]);
+    if (EFI_ERROR (State->Status)) {
+      return;
+    }
+
+    if (Offset > State->DestinationIndex) {
+      State->Status = EFI_VOLUME_CORRUPTED;
+      return;
+    }
+
+    if (!InflateReserve (State, Length)) {
+      return;
+    }
+
+    //
+    // Source and target may overlap, copy byte by byte.
+    //
+    Target = State->Destination + State->DestinationIndex;
+    State->DestinationIndex += Length;
+    while (Length-- > 0) {
+      *Target = *(Target - Offset);
+      Target++;
+    }
+  }
+}
+
+/**
+  Decompress a block compressed with fixed Huffman codes.
+
+  @param[in,out]  State   Decompressor state.
+
+**/
+STATIC
+VOID
+InflateFixed (
+  IN OUT INFLATE_STATE  *State
+  )
+{
+  STATIC BOOLEAN          Built = FALSE;
+  STATIC INFLATE_HUFFMAN  LitLen;
+  STATIC INFLATE_HUFFMAN  Distance;
+  UINT8                   Length[DEFLATE_MAX_LITLEN_CODES];
+  UINTN                   Symbol;
+
+  if (!Built) {
+    for (Symbol = 0; Symbol < 144; Symbol++) {
+      Length[Symbol] = 8;
+    }
+
+    for ( ; Symbol < 256; Symbol++) {
+      Length[Symbol] = 9;
+    }
+
+    for ( ; Symbol < 280; Symbol++) {
+      Length[Symbol] = 7;
+    }
+
+    for ( ; Symbol < DEFLATE_MAX_LITLEN_CODES; Symbol++) {
+      Length[Symbol] = 8;
+    }
+
+    InflateBuildHuffman (&LitLen, Length, DEFLATE_MAX_LITLEN_CODES);
+
+    for (Symbol = 0; Symbol < DEFLATE_MAX_DIST_CODES; Symbol++) {
+      Length[Symbol] = 5;
+    }
+
+    InflateBuildHuffman (&Distance, Length, DEFLATE_MAX_DIST_CODES);
+    Built = TRUE;
+  }
+
+  InflateCodes (State, &LitLen, &Distance);
+}
+
+/**
+  Decompress a block compressed with dynamic Huffman codes.
+
+  @param[in,out]  State   Decompressor state.
+
+**/
+STATIC
+VOID
+InflateDynamic (
+  IN OUT INFLATE_STATE  *State
+  )
+{
+  INFLATE_HUFFMAN  LitLen;
+  INFLATE_HUFFMAN  Distance;
+  UINT8            Length[DEFLATE_MAX_LITLEN_CODES + DEFLATE_MAX_DIST_CODES];
+  UINTN            LitLenCount;
+  UINTN            DistanceCount;
+  UINTN            CodeLengthCount;
+  UINTN            Index;
+  INTN             Symbol;
+  UINT8            Repeat;
+  UINTN            RepeatCount;
+
+  LitLenCount     = InflateGetBits (State, 5) + 257;
+  DistanceCount   = InflateGetBits (State, 5) + 1;
+  CodeLengthCount = InflateGetBits (State, 4) + 4;
+  if (EFI_ERROR (State->Status)) {
+    return;
+  }
+
+  if ((LitLenCount > DEFLATE_MAX_LITLEN_CODES - 2) || (DistanceCount > DEFLATE_MAX_DIST_CODES)) {
+    State->Status = EFI_VOLUME_CORRUPTED;
+    return;
+  }
+
+  ZeroMem (Length, sizeof (Length));
+  for (Index = 0; Index < CodeLengthCount; Index++) {
+    Length[mCodeLengthOrder[Index]] = (UINT8)InflateGetBits (State, 3);
+  }
+
+  if (EFI_ERROR (State->Status)) {
+    return;
+  }
+
+  State->Status = InflateBuildHuffman (&LitLen, Length, DEFLATE_MAX_CODE_LENGTHS);
+  if (EFI_ERROR (State->Status)) {
+    return;
+  }
+
+  Index = 0;
+  while (Index < LitLenCount + DistanceCount) {
+    Symbol = InflateDecodeSymbol (State, &LitLen);
+    if (Symbol < 0) {
+      return;
+    }
+
+    if (Symbol < 16) {
+      Length[Index++] = (UINT8)Symbol;
+      continue;
+    }
+
+    Repeat = 0;
+    if (Symbol == 16) {
+      if (Index == 0) {
+        State->Status = EFI_VOLUME_CORRUPTED;
+        return;
+      }
+
+      Repeat      = Length[Index - 1];
+      RepeatCount = 3 + InflateGetBits (State, 2);
+    } else if (Symbol == 17) {
+      RepeatCount = 3 + InflateGetBits (State, 3);
+    } else {
+      RepeatCount = 11 + InflateGetBits (State, 7);
+    }
+
+    if (EFI_ERROR (State->Status)) {
+      return;
+    }
+
+    if (Index + RepeatCount > LitLenCount + DistanceCount) {
+      State->Status = EFI_VOLUME_CORRUPTED;
+      return;
+    }
+
+    while (RepeatCount-- > 0) {
+      Length[Index++] = Repeat;
+    }
+  }
+
+  if (Length[DEFLATE_END_OF_BLOCK] == 0) {
+    State->Status = EFI_VOLUME_CORRUPTED;
+    return;
+  }
+
+  State->Status = InflateBuildHuffman (&LitLen, Length, LitLenCount);
+  if (EFI_ERROR (State->Status)) {
+    return;
+  }
+
+  State->Status = InflateBuildHuffman (&Distance, Length + LitLenCount, DistanceCount);
+  if (EFI_ERROR (State->Status)) {
+    return;
+  }
+
+  InflateCodes (State, &LitLen, &Distance);
+}
+
+/**
+  Decompress raw DEFLATE data.
+
+  @param[in]   Source            The compressed data.
+  @param[in]   SourceSize        The size of Source in bytes.
+  @param[out]  SourceUsed        The size of compressed data consumed in bytes.
+  @param[out]  Destination       Pointer to receive the decompressed data. Caller
+                                 frees it.
+  @param[out]  DestinationSize   The size of decompressed data in bytes.
+
+  @retval EFI_SUCCESS            Data is decompressed.
+  @retval EFI_VOLUME_CORRUPTED   Source is not valid DEFLATE data.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+
+**/
+EFI_STATUS
+DeflateDecompress (
+  IN  CONST UINT8  *Source,
+  IN  UINTN        SourceSize,
+  OUT UINTN        *SourceUsed,
+  OUT UINT8        **Destination,
+  OUT UINTN        *DestinationSize
+  )
+{
+  INFLATE_STATE  State;
+  UINT32         Final;
+  UINT32         Type;
+
+  ZeroMem (&State, sizeof (State));
+  State.Source     = Source;
+  State.SourceSize = SourceSize;
+
+  //
+  // JSON compresses well, start with four times of compressed size.
+  //
+  State.DestinationSize = MAX (SourceSize * 4, SIZE_4KB);
+  State.Destination     = AllocatePool (State.DestinationSize);
+  if (State.Destination == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  do {
+    Final = InflateGetBits (&State, 1);
+    Type  = InflateGetBits (&State, 2);
+    if (EFI_ERROR (State.Status)) {
+      break;
+    }
+
+    switch (Type) {
+      case 0:
+        InflateStored (&State);
+        break;
+      case 1:
+        InflateFixed (&State);
+        break;
+      case 2:
+        InflateDynamic (&State);
+        break;
+      default:
+        State.Status = EFI_VOLUME_CORRUPTED;
+        break;
+    }
+  } while (!EFI_ERROR (State.Status) && Final == 0);
+
+  if (EFI_ERROR (State.Status)) {
+    FreePool (State.Destination);
+    return State.Status;
+  }
+
+  //
+  // The unused bits of last byte are padding.
+  //
+  *SourceUsed      = State.SourceIndex;
+  *Destination     = State.Destination;
+  *DestinationSize = State.DestinationIndex;
+  return EFI_SUCCESS;
+}
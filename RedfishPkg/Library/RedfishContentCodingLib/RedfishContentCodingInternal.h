@@ -0,0 +1,124 @@
+/** @file
+  Internal definitions of RedfishContentCodingLib.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef REDFISH_CONTENT_CODING_INTERNAL_H_
+#define REDFISH_CONTENT_CODING_INTERNAL_H_
+
+#include <Uefi.h>
+#include <IndustryStandard/Http11.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/RedfishContentCodingLib.h>
+
+//
+// The content codings in Accept-Encoding header, in the order of preference.
+//
+#define REDFISH_CONTENT_ACCEPT_ENCODING   "gzip, deflate"
+
+//
+// Decoded content larger than this is treated as corrupted.
+//
+#define REDFISH_CONTENT_DECODE_MAX_SIZE   SIZE_64MB
+
+//
+// GZIP member header, RFC 1952.
+//
+#define GZIP_ID1            0x1F
+#define GZIP_ID2            0x8B
+#define GZIP_CM_DEFLATE     8
+#define GZIP_FLAG_FHCRC     BIT1
+#define GZIP_FLAG_FEXTRA    BIT2
+#define GZIP_FLAG_FNAME     BIT3
+#define GZIP_FLAG_FCOMMENT  BIT4
+#define GZIP_OS_UNKNOWN     255
+#define GZIP_HEADER_SIZE    10
+#define GZIP_TRAILER_SIZE   8
+
+//
+// ZLIB stream header, RFC 1950.
+//
+#define ZLIB_CM_DEFLATE     8
+#define ZLIB_FLAG_FDICT     BIT5
+#define ZLIB_HEADER_SIZE    2
+#define ZLIB_TRAILER_SIZE   4
+
+//
+// DEFLATE format, RFC 1951.
+//
+#define DEFLATE_MAX_BITS            15
+#define DEFLATE_MAX_LITLEN_CODES    288
+#define DEFLATE_MAX_DIST_CODES      30
+#define DEFLATE_MAX_CODE_LENGTHS    19
+#define DEFLATE_END_OF_BLOCK        256
+#define DEFLATE_MIN_MATCH           3
+#define DEFLATE_MAX_MATCH           258
+#define DEFLATE_WINDOW_SIZE         32768
+
+extern CONST UINT16  mDeflateLengthBase[29];
+extern CONST UINT8   mDeflateLengthExtra[29];
+extern CONST UINT16  mDeflateDistanceBase[30];
+extern CONST UINT8   mDeflateDistanceExtra[30];
+
+/**
+  Decompress raw DEFLATE data.
+
+  @param[in]   Source            The compressed data.
+  @param[in]   SourceSize        The size of Source in bytes.
+  @param[out]  SourceUsed        The size of compressed data consumed in bytes.
+  @param[out]  Destination       Pointer to receive the decompressed data. Caller
+                                 frees it.
+  @param[out]  DestinationSize   The size of decompressed data in bytes.
+
+  @retval EFI_SUCCESS            Data is decompressed.
+  @retval EFI_VOLUME_CORRUPTED   Source is not valid DEFLATE data.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+
+**/
+EFI_STATUS
+DeflateDecompress (
+  IN  CONST UINT8  *Source,
+  IN  UINTN        SourceSize,
+  OUT UINTN        *SourceUsed,
+  OUT UINT8        **Destination,
+  OUT UINTN        *DestinationSize
+  );
+
+/**
+  Compress data to raw DEFLATE data. The data is compressed with LZ77
+  and the fixed Huffman codes.
+
+  @param[in]   Source            The data to compress.
+  @param[in]   SourceSize        The size of Source in bytes.
+  @param[in]   HeaderSize        The size in bytes reserved in the front of
+                                 Destination for caller's header.
+  @param[in]   TrailerSize       The size in bytes reserved at the end of
+                                 Destination for caller's trailer.
+  @param[out]  Destination       Pointer to receive the compressed data, with
+                                 HeaderSize bytes before and TrailerSize bytes
+                                 after. Caller frees it.
+  @param[out]  DestinationSize   The size of compressed data in bytes, not
+                                 including header and trailer.
+
+  @retval EFI_SUCCESS            Data is compressed.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+
+**/
+EFI_STATUS
+DeflateCompress (
+  IN  CONST UINT8  *Source,
+  IN  UINTN        SourceSize,
+  IN  UINTN        HeaderSize,
+  IN  UINTN        TrailerSize,
+  OUT UINT8        **Destination,
+  OUT UINTN        *DestinationSize
+  );
+
+#endif
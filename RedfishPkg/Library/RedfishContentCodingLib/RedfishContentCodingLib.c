@@ -0,0 +1,423 @@
+/** @file
+  RedfishContentCodingLib instance supports gzip and deflate content codings.
+
+  Redfish resources are JSON documents which compress to a fraction of their
+  size. Decoding the compressed response costs much less time than moving
+  the full document over the slow host interface network.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishContentCodingInternal.h"
+
+#define ADLER32_BASE  65521
+
+/**
+  Calculate the Adler-32 checksum of data, RFC 1950.
+
+  @param[in]  Data   The data.
+  @param[in]  Size   The size of Data in bytes.
+
+  @retval The Adler-32 checksum.
+
+**/
+STATIC
+UINT32
+CalculateAdler32 (
+  IN CONST UINT8  *Data,
+  IN UINTN        Size
+  )
+{
+  UINT32  Low;
+  UINT32  High;
+  UINTN   Block;
+
+  Low  = 1;
+  High = 0;
+  while (Size > 0) {
+    //
+    // 5552 is the largest block which doesn't overflow 32 bits before modulo.
+    //
+    Block = MIN (Size, 5552);
+    Size -= Block;
+    while (Block-- > 0) {
+      Low  += *Data++;
+      High += Low;
+    }
+
+    Low  %= ADLER32_BASE;
+    High %= ADLER32_BASE;
+  }
+
+  return (High << 16) | Low;
+}
+
+/**
+  Skip the leading white spaces of content coding name.
+
+  @param[in]  Coding   The content coding name.
+
+  @retval The content coding name without leading white spaces.
+
+**/
+STATIC
+CHAR8 *
+SkipWhiteSpace (
+  IN CHAR8  *Coding
+  )
+{
+  while (*Coding == ' ' || *Coding == '\t') {
+    Coding++;
+  }
+
+  return Coding;
+}
+
+/**
+  Decode gzip content, RFC 1952.
+
+  @param[in]   Content          The encoded content.
+  @param[in]   ContentLength    The length of encoded content.
+  @param[out]  Decoded          Pointer to receive decoded content.
+  @param[out]  DecodedLength    Length of decoded content.
+
+  @retval EFI_SUCCESS            Content is decoded.
+  @retval EFI_VOLUME_CORRUPTED   Content is not valid gzip data.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+
+**/
+STATIC
+EFI_STATUS
+GzipDecode (
+  IN  CONST UINT8  *Content,
+  IN  UINTN        ContentLength,
+  OUT VOID         **Decoded,
+  OUT UINTN        *DecodedLength
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       Index;
+  UINT8       Flags;
+  UINTN       Used;
+  UINT8       *Data;
+  UINTN       DataLength;
+
+  if ((ContentLength < GZIP_HEADER_SIZE + GZIP_TRAILER_SIZE) ||
+      (Content[0] != GZIP_ID1) || (Content[1] != GZIP_ID2) || (Content[2] != GZIP_CM_DEFLATE))
+  {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  Flags = Content[3];
+  Index = GZIP_HEADER_SIZE;
+  if ((Flags & GZIP_FLAG_FEXTRA) != 0) {
+    if (Index + 2 > ContentLength) {
+      return EFI_VOLUME_CORRUPTED;
+    }
+
+    Index += 2 + (Content[Index] | (Content[Index + 1] << 8));
+  }
+
+  if ((Flags & GZIP_FLAG_FNAME) != 0) {
+    while (Index < ContentLength && Content[Index] != 0) {
+      Index++;
+    }
+
+    Index++;
+  }
+
+  if ((Flags & GZIP_FLAG_FCOMMENT) != 0) {
+    while (Index < ContentLength && Content[Index] != 0) {
+      Index++;
+    }
+
+    Index++;
+  }
+
+  if ((Flags & GZIP_FLAG_FHCRC) != 0) {
+    Index += 2;
+  }
+
+  if (Index + GZIP_TRAILER_SIZE > ContentLength) {
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  Status = DeflateDecompress (Content + Index, ContentLength - Index - GZIP_TRAILER_SIZE, &Used, &Data, &DataLength);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Trailer is CRC32 and the size of original data, modulo 2^32.
+  //
+  Index += Used;
+  if ((ReadUnaligned32 ((UINT32 *)(Content + Index)) != CalculateCrc32 (Data, DataLength)) ||
+      (ReadUnaligned32 ((UINT32 *)(Content + Index + 4)) != (UINT32)DataLength))
+  {
+    FreePool (Data);
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  *Decoded       = Data;
+  *DecodedLength = DataLength;
+  return EFI_SUCCESS;
+}
+
+/**
+  Decode deflate content. The content should be zlib format, RFC 1950,
+  but some servers send raw DEFLATE data so that is accepted as well.
+
+  @param[in]   Content          The encoded content.
+  @param[in]   ContentLength    The length of encoded content.
+  @param[out]  Decoded          Pointer to receive decoded content.
+  @param[out]  DecodedLength    Length of decoded content.
+
+  @retval EFI_SUCCESS            Content is decoded.
+  @retval EFI_VOLUME_CORRUPTED   Content is not valid deflate data.
+  @retval EFI_OUT_OF_RESOURCES   Not enough memory.
+
+**/
+STATIC
+EFI_STATUS
+ZlibDecode (
+  IN  CONST UINT8  *Content,
+  IN  UINTN        ContentLength,
+  OUT VOID         **Decoded,
+  OUT UINTN        *DecodedLength
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       Used;
+  UINT8       *Data;
+  UINTN       DataLength;
+  UINT32      Adler32;
+
+  if ((ContentLength < ZLIB_HEADER_SIZE + ZLIB_TRAILER_SIZE) ||
+      ((Content[0] & 0x0F) != ZLIB_CM_DEFLATE) ||
+      ((Content[1] & ZLIB_FLAG_FDICT) != 0) ||
+      ((((UINT32)Content[0] << 8) | Content[1]) % 31 != 0))
+  {
+    Status = DeflateDecompress (Content, ContentLength, &Used, &Data, &DataLength);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    *Decoded       = Data;
+    *DecodedLength = DataLength;
+    return EFI_SUCCESS;
+  }
+
+  Status = DeflateDecompress (
+             Content + ZLIB_HEADER_SIZE,
+             ContentLength - ZLIB_HEADER_SIZE - ZLIB_TRAILER_SIZE,
+             &Used,
+             &Data,
+             &DataLength
+             );
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  //
+  // Adler-32 trailer is in network byte order.
+  //
+  Adler32 = SwapBytes32 (ReadUnaligned32 ((UINT32 *)(Content + ZLIB_HEADER_SIZE + Used)));
+  if (Adler32 != CalculateAdler32 (Data, DataLength)) {
+    FreePool (Data);
+    return EFI_VOLUME_CORRUPTED;
+  }
+
+  *Decoded       = Data;
+  *DecodedLength = DataLength;
+  return EFI_SUCCESS;
+}
+
+/**
+  This is the function to encode the content use the
+  algorithm indicated in ContentEncodedValue. The naming of
+  ContentEncodedValue is follow HTTP spec or could be a
+  platform-specific value.
+
+  @param[in]   ContentEncodedValue   HTTP conent encoded value.
+                                     The value could be one of below
+                                     or any which is platform-specific.
+                                       - HTTP_CONTENT_ENCODING_IDENTITY "identity"
+                                       - HTTP_CONTENT_ENCODING_GZIP     "gzip"
+                                       - HTTP_CONTENT_ENCODING_COMPRESS "compress"
+                                       - HTTP_CONTENT_ENCODING_DEFLATE  "deflate"
+                                       - HTTP_CONTENT_ENCODING_BROTLI   "br"
+  @param[in]   OriginalContent       Original content.
+  @param[in]   OriginalContentLength The length of original content.
+  @param[out]  EncodedContentPointer Pointer to receive the encoded content pointer.
+  @param[out]  EncodedContentLength  Length of encoded content.
+
+  @retval EFI_SUCCESS              Content is encoded successfully.
+  @retval EFI_UNSUPPORTED          No supported encoding funciton,
+  @retval EFI_INVALID_PARAMETER    One of the given parameter is invalid.
+
+**/
+EFI_STATUS
+RedfishContentEncode  (
+  IN CHAR8  *ContentEncodedValue,
+  IN CHAR8  *OriginalContent,
+  IN UINTN  OriginalContentLength,
+  OUT VOID  **EncodedContentPointer,
+  OUT UINTN *EncodedContentLength
+  )
+{
+  EFI_STATUS  Status;
+  CHAR8       *Coding;
+  UINT8       *Encoded;
+  UINTN       Length;
+  UINT32      Adler32;
+
+  if ((ContentEncodedValue == NULL) || (OriginalContent == NULL) ||
+      (EncodedContentPointer == NULL) || (EncodedContentLength == NULL))
+  {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Coding = SkipWhiteSpace (ContentEncodedValue);
+  if (AsciiStriCmp (Coding, HTTP_CONTENT_ENCODING_GZIP) == 0) {
+    Status = DeflateCompress (
+               (UINT8 *)OriginalContent,
+               OriginalContentLength,
+               GZIP_HEADER_SIZE,
+               GZIP_TRAILER_SIZE,
+               &Encoded,
+               &Length
+               );
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    //
+    // No modification time, no extra flags and unknown OS.
+    //
+    ZeroMem (Encoded, GZIP_HEADER_SIZE);
+    Encoded[0] = GZIP_ID1;
+    Encoded[1] = GZIP_ID2;
+    Encoded[2] = GZIP_CM_DEFLATE;
+    Encoded[9] = GZIP_OS_UNKNOWN;
+    Length    += GZIP_HEADER_SIZE;
+    WriteUnaligned32 ((UINT32 *)(Encoded + Length), CalculateCrc32 (OriginalContent, OriginalContentLength));
+    WriteUnaligned32 ((UINT32 *)(Encoded + Length + 4), (UINT32)OriginalContentLength);
+    Length += GZIP_TRAILER_SIZE;
+  } else if (AsciiStriCmp (Coding, HTTP_CONTENT_ENCODING_DEFLATE) == 0) {
+    Status = DeflateCompress (
+               (UINT8 *)OriginalContent,
+               OriginalContentLength,
+               ZLIB_HEADER_SIZE,
+               ZLIB_TRAILER_SIZE,
+               &Encoded,
+               &Length
+               );
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    //
+    // 32K window, default compression level.
+    //
+    Encoded[0] = 0x78;
+    Encoded[1] = 0x9C;
+    Length    += ZLIB_HEADER_SIZE;
+    Adler32    = CalculateAdler32 ((UINT8 *)OriginalContent, OriginalContentLength);
+    WriteUnaligned32 ((UINT32 *)(Encoded + Length), SwapBytes32 (Adler32));
+    Length += ZLIB_TRAILER_SIZE;
+  } else {
+    return EFI_UNSUPPORTED;
+  }
+
+  *EncodedContentPointer = Encoded;
+  *EncodedContentLength  = Length;
+  return EFI_SUCCESS;
+}
+
+/**
+  This is the function to decode the content use the
+  algorithm indicated in ContentEncodedValue. The naming of
+  ContentEncodedValue is follow HTTP spec or could be a
+  platform-specific value.
+
+  @param[in]   ContentDecodedValue   HTTP conent decoded value.
+                                     The value could be one of below
+                                     or any which is platform-specific.
+                                       - HTTP_CONTENT_ENCODING_IDENTITY "identity"
+                                       - HTTP_CONTENT_ENCODING_GZIP     "gzip"
+                                       - HTTP_CONTENT_ENCODING_COMPRESS "compress"
+                                       - HTTP_CONTENT_ENCODING_DEFLATE  "deflate"
+                                       - HTTP_CONTENT_ENCODING_BROTLI   "br"
+  @param[in]   ContentPointer        Original content.
+  @param[in]   ContentLength         The length of original content.
+  @param[out]  DecodedContentPointer Pointer to receive decoded content pointer.
+  @param[out]  DecodedContentLength  Length of decoded content.
+
+  @retval EFI_SUCCESS              Content is decoded successfully.
+  @retval EFI_UNSUPPORTED          No supported decoding funciton,
+  @retval EFI_INVALID_PARAMETER    One of the given parameter is invalid.
+
+**/
+EFI_STATUS
+RedfishContentDecode (
+  IN CHAR8  *ContentDecodedValue,
+  IN VOID   *ContentPointer,
+  IN UINTN  ContentLength,
+  OUT VOID  **DecodedContentPointer,
+  OUT UINTN *DecodedContentLength
+  )
+{
+  EFI_STATUS  Status;
+  CHAR8       *Coding;
+
+  if ((ContentDecodedValue == NULL) || (ContentPointer == NULL) ||
+      (DecodedContentPointer == NULL) || (DecodedContentLength == NULL))
+  {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Coding = SkipWhiteSpace (ContentDecodedValue);
+  if (AsciiStriCmp (Coding, HTTP_CONTENT_ENCODING_GZIP) == 0) {
+    Status = GzipDecode (ContentPointer, ContentLength, DecodedContentPointer, DecodedContentLength);
+  } else if (AsciiStriCmp (Coding, HTTP_CONTENT_ENCODING_DEFLATE) == 0) {
+    Status = ZlibDecode (ContentPointer, ContentLength, DecodedContentPointer, DecodedContentLength);
+  } else if (AsciiStriCmp (Coding, HTTP_CONTENT_ENCODING_IDENTITY) == 0) {
+    //
+    // Caller frees the original content when decoding succeeds.
+    //
+    *DecodedContentPointer = AllocateCopyPool (ContentLength, ContentPointer);
+    if (*DecodedContentPointer == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    *DecodedContentLength = ContentLength;
+    return EFI_SUCCESS;
+  } else {
+    return EFI_UNSUPPORTED;
+  }
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a: failed to decode %a content: %r\n", __FUNCTION__, Coding, Status));
+  }
+
+  return Status;
+}
+
+/**
+  Return the content codings which RedfishContentDecode() supports, in the
+  format of HTTP Accept-Encoding header value.
+
+  @retval CHAR8 *   Accept-Encoding header value.
+  @retval NULL      No content coding is supported.
+
+**/
+CONST CHAR8 *
+RedfishContentAcceptEncoding (
+  VOID
+  )
+{
+  return REDFISH_CONTENT_ACCEPT_ENCODING;
+}
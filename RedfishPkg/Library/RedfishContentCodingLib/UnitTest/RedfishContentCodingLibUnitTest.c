@@ -0,0 +1,414 @@
+/** @file
+  Unit tests of RedfishContentCodingLib.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <Uefi.h>
+#include <IndustryStandard/Http11.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UnitTestLib.h>
+#include <Library/RedfishContentCodingLib.h>
+
+#define UNIT_TEST_APP_NAME     "RedfishContentCodingLib Unit Tests"
+#define UNIT_TEST_APP_VERSION  "1.0"
+
+//
+// mGzipContent is mJsonContent compressed by gzip, fixed Huffman codes.
+//
+STATIC CONST CHAR8  mJsonContent[] =
+  "{\"@odata.id\":\"/redfish/v1/Systems/1\",\"@odata.type\":\"#ComputerSystem.v1_5_0.ComputerSystem\","
+  "\"Id\":\"1\",\"Name\":\"System\",\"Boot\":{\"BootSourceOverrideTarget\":\"None\","
+  "\"BootSourceOverrideEnabled\":\"Disabled\"},\"Members\":[\"/redfish/v1/Systems/1\","
+  "\"/redfish/v1/Systems/2\",\"/redfish/v1/Systems/3\"]}";
+
+STATIC CONST UINT8  mGzipContent[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xab, 0x56,
+  0x72, 0xc8, 0x4f, 0x49, 0x2c, 0x49, 0xd4, 0xcb, 0x4c, 0x51, 0xb2, 0x52,
+  0xd2, 0x2f, 0x4a, 0x4d, 0x49, 0xcb, 0x2c, 0xce, 0xd0, 0x2f, 0x33, 0xd4,
+  0x0f, 0xae, 0x2c, 0x2e, 0x49, 0xcd, 0x2d, 0xd6, 0x37, 0x54, 0xd2, 0x81,
+  0xa9, 0x29, 0xa9, 0x2c, 0x48, 0x05, 0xaa, 0x52, 0x76, 0xce, 0xcf, 0x2d,
+  0x28, 0x2d, 0x49, 0x2d, 0x82, 0x28, 0xd1, 0x2b, 0x33, 0x8c, 0x37, 0x8d,
+  0x37, 0xd0, 0x43, 0x15, 0x05, 0xea, 0xf2, 0x04, 0x19, 0x09, 0xd2, 0xee,
+  0x97, 0x98, 0x0b, 0xd2, 0x07, 0x97, 0x70, 0xca, 0xcf, 0x2f, 0x51, 0xb2,
+  0xaa, 0x06, 0xd3, 0xc1, 0xf9, 0xa5, 0x45, 0xc9, 0xa9, 0xfe, 0x65, 0xa9,
+  0x45, 0x45, 0x99, 0x29, 0xa9, 0x21, 0x89, 0x45, 0xe9, 0xa9, 0x40, 0x39,
+  0x25, 0xbf, 0xfc, 0xbc, 0x54, 0xa8, 0x4a, 0x54, 0x15, 0xae, 0x79, 0x89,
+  0x49, 0x39, 0xa9, 0x20, 0x93, 0x5d, 0x32, 0x8b, 0x21, 0xcc, 0x5a, 0x1d,
+  0x25, 0xdf, 0xd4, 0xdc, 0xa4, 0xd4, 0xa2, 0x62, 0x25, 0xab, 0x68, 0x9c,
+  0x7e, 0xc0, 0x26, 0x6e, 0x84, 0x43, 0xdc, 0x58, 0x29, 0xb6, 0x16, 0x00,
+  0xb5, 0x16, 0x58, 0x59, 0x1a, 0x01, 0x00, 0x00
+};
+
+//
+// mZlibContent is mStatusContent compressed by zlib, dynamic Huffman codes.
+//
+STATIC CONST CHAR8  mStatusContent[] =
+  "{\"Status\":{\"State\":\"Enabled\",\"Health\":\"OK\"}}"
+  "{\"Status\":{\"State\":\"Enabled\",\"Health\":\"OK\"}}";
+
+STATIC CONST UINT8  mZlibContent[] = {
+  0x78, 0x01, 0x05, 0xc1, 0x31, 0x0a, 0x80, 0x40, 0x0c, 0x45, 0xc1, 0xbb,
+  0xbc, 0xda, 0x13, 0xa4, 0x17, 0x04, 0x0b, 0x8b, 0x9c, 0x20, 0x62, 0xc0,
+  0x22, 0xd8, 0xec, 0xdf, 0x6a, 0xc9, 0xdd, 0x9d, 0x59, 0xb8, 0x42, 0x73,
+  0x60, 0x0b, 0x57, 0x28, 0x31, 0xf6, 0x2f, 0xee, 0xca, 0x87, 0x8d, 0x23,
+  0xa3, 0xf4, 0x62, 0x5c, 0x27, 0xdd, 0x0b, 0x57, 0x68, 0x0e, 0x6c, 0xe1,
+  0x0a, 0x25, 0xc6, 0xfe, 0xc5, 0x5d, 0xf9, 0xb0, 0x71, 0x64, 0x94, 0x5e,
+  0x8c, 0xeb, 0xa4, 0xfb, 0x07, 0x05, 0xbd, 0x1c, 0x7d
+};
+
+//
+// Raw DEFLATE data without zlib header, stored block and fixed Huffman codes.
+//
+STATIC CONST UINT8  mRawStoredContent[] = {
+  0x01, 0x0f, 0x00, 0xf0, 0xff, 'H',  'e',  'l',  'l',  'o',  ',',  ' ',
+  'R',  'e',  'd',  'f',  'i',  's',  'h',  '!'
+};
+
+STATIC CONST UINT8  mRawFixedContent[] = {
+  0x4b, 0x4c, 0x4a, 0x4e, 0x44, 0x45, 0x00
+};
+
+//
+// Corrupted raw DEFLATE data.
+//
+STATIC CONST UINT8  mDistanceTooFarContent[]   = { 0x03, 0x02, 0x00 };
+STATIC CONST UINT8  mInvalidBlockTypeContent[] = { 0x07, 0x00, 0x00 };
+STATIC CONST UINT8  mStoredLengthContent[]     = {
+  0x01, 0x0f, 0x00, 0xf1, 0xff, 'H',  'e',  'l',  'l',  'o',  ',',  ' ',
+  'R',  'e',  'd',  'f',  'i',  's',  'h',  '!'
+};
+
+/**
+  Decode the content and check the decoded data.
+
+  @param[in]  Coding           The content coding.
+  @param[in]  Content          The encoded content.
+  @param[in]  ContentLength    The length of encoded content.
+  @param[in]  Expected         The expected decoded content.
+  @param[in]  ExpectedLength   The length of expected decoded content.
+
+  @retval TRUE    Content is decoded to the expected data.
+  @retval FALSE   Decoding failed or the decoded data is different.
+**/
+STATIC
+BOOLEAN
+DecodeAndCompare (
+  IN CHAR8        *Coding,
+  IN CONST VOID   *Content,
+  IN UINTN        ContentLength,
+  IN CONST VOID   *Expected,
+  IN UINTN        ExpectedLength
+  )
+{
+  EFI_STATUS  Status;
+  VOID        *Decoded;
+  UINTN       DecodedLength;
+  BOOLEAN     Match;
+
+  Decoded = NULL;
+  Status  = RedfishContentDecode (Coding, (VOID *)Content, ContentLength, &Decoded, &DecodedLength);
+  if (EFI_ERROR (Status)) {
+    return FALSE;
+  }
+
+  Match = (DecodedLength == ExpectedLength) && (CompareMem (Decoded, Expected, ExpectedLength) == 0);
+  FreePool (Decoded);
+  return Match;
+}
+
+/**
+  Valid gzip, zlib and raw DEFLATE content is decoded.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+DecodeValidContentShouldSucceed (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  VOID   *Decoded;
+  UINTN  DecodedLength;
+
+  UT_ASSERT_TRUE (DecodeAndCompare (HTTP_CONTENT_ENCODING_GZIP, mGzipContent, sizeof (mGzipContent), mJsonContent, AsciiStrLen (mJsonContent)));
+  UT_ASSERT_TRUE (DecodeAndCompare (HTTP_CONTENT_ENCODING_DEFLATE, mZlibContent, sizeof (mZlibContent), mStatusContent, AsciiStrLen (mStatusContent)));
+  UT_ASSERT_TRUE (DecodeAndCompare (HTTP_CONTENT_ENCODING_DEFLATE, mRawStoredContent, sizeof (mRawStoredContent), "Hello, Redfish!", AsciiStrLen ("Hello, Redfish!")));
+  UT_ASSERT_TRUE (DecodeAndCompare (HTTP_CONTENT_ENCODING_DEFLATE, mRawFixedContent, sizeof (mRawFixedContent), "abcabcabcabcabcabc", AsciiStrLen ("abcabcabcabcabcabc")));
+  UT_ASSERT_TRUE (DecodeAndCompare (" GZIP", mGzipContent, sizeof (mGzipContent), mJsonContent, AsciiStrLen (mJsonContent)));
+  UT_ASSERT_TRUE (DecodeAndCompare (HTTP_CONTENT_ENCODING_IDENTITY, mJsonContent, AsciiStrLen (mJsonContent), mJsonContent, AsciiStrLen (mJsonContent)));
+
+  UT_ASSERT_STATUS_EQUAL (RedfishContentDecode ("br", (VOID *)mGzipContent, sizeof (mGzipContent), &Decoded, &DecodedLength), EFI_UNSUPPORTED);
+  UT_ASSERT_STATUS_EQUAL (RedfishContentDecode (NULL, (VOID *)mGzipContent, sizeof (mGzipContent), &Decoded, &DecodedLength), EFI_INVALID_PARAMETER);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Content encoded by RedfishContentEncode() is decoded to the original data.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+EncodeShouldRoundTrip (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  CHAR8  *Original;
+  UINTN  OriginalLength;
+  UINTN  Index;
+  VOID   *Encoded;
+  UINTN  EncodedLength;
+
+  //
+  // Repeated data longer than the DEFLATE window, with some variation so
+  // both literals and matches are produced.
+  //
+  OriginalLength = SIZE_64KB + 123;
+  Original       = AllocatePool (OriginalLength);
+  UT_ASSERT_NOT_NULL (Original);
+  for (Index = 0; Index < OriginalLength; Index++) {
+    Original[Index] = mJsonContent[Index % AsciiStrLen (mJsonContent)];
+    if (Index % 997 == 0) {
+      Original[Index] = (CHAR8)Index;
+    }
+  }
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishContentEncode (HTTP_CONTENT_ENCODING_GZIP, Original, OriginalLength, &Encoded, &EncodedLength));
+  UT_ASSERT_TRUE (EncodedLength < OriginalLength / 4);
+  UT_ASSERT_TRUE (DecodeAndCompare (HTTP_CONTENT_ENCODING_GZIP, Encoded, EncodedLength, Original, OriginalLength));
+  FreePool (Encoded);
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishContentEncode (HTTP_CONTENT_ENCODING_DEFLATE, Original, OriginalLength, &Encoded, &EncodedLength));
+  UT_ASSERT_TRUE (EncodedLength < OriginalLength / 4);
+  UT_ASSERT_TRUE (DecodeAndCompare (HTTP_CONTENT_ENCODING_DEFLATE, Encoded, EncodedLength, Original, OriginalLength));
+  FreePool (Encoded);
+
+  UT_ASSERT_NOT_EFI_ERROR (RedfishContentEncode (HTTP_CONTENT_ENCODING_GZIP, Original, 1, &Encoded, &EncodedLength));
+  UT_ASSERT_TRUE (DecodeAndCompare (HTTP_CONTENT_ENCODING_GZIP, Encoded, EncodedLength, Original, 1));
+  FreePool (Encoded);
+
+  UT_ASSERT_STATUS_EQUAL (RedfishContentEncode ("br", Original, OriginalLength, &Encoded, &EncodedLength), EFI_UNSUPPORTED);
+
+  FreePool (Original);
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Decoding fails on every truncation of valid content.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+DecodeTruncatedContentShouldFail (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINTN  Length;
+  UINT8  *Content;
+  VOID   *Decoded;
+  UINTN  DecodedLength;
+
+  //
+  // Copy each truncated content to its own buffer so reading beyond the
+  // end is caught by the address sanitizer.
+  //
+  for (Length = 1; Length < sizeof (mGzipContent); Length++) {
+    Content = AllocateCopyPool (Length, mGzipContent);
+    UT_ASSERT_NOT_NULL (Content);
+    UT_ASSERT_TRUE (EFI_ERROR (RedfishContentDecode (HTTP_CONTENT_ENCODING_GZIP, Content, Length, &Decoded, &DecodedLength)));
+    FreePool (Content);
+  }
+
+  for (Length = 1; Length < sizeof (mZlibContent); Length++) {
+    Content = AllocateCopyPool (Length, mZlibContent);
+    UT_ASSERT_NOT_NULL (Content);
+    UT_ASSERT_TRUE (EFI_ERROR (RedfishContentDecode (HTTP_CONTENT_ENCODING_DEFLATE, Content, Length, &Decoded, &DecodedLength)));
+    FreePool (Content);
+  }
+
+  for (Length = 1; Length < sizeof (mRawStoredContent); Length++) {
+    Content = AllocateCopyPool (Length, mRawStoredContent);
+    UT_ASSERT_NOT_NULL (Content);
+    UT_ASSERT_TRUE (EFI_ERROR (RedfishContentDecode (HTTP_CONTENT_ENCODING_DEFLATE, Content, Length, &Decoded, &DecodedLength)));
+    FreePool (Content);
+  }
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Decoding fails on corrupted content, and never returns wrong data.
+
+  @param[in]  Context    Unused.
+
+  @retval  UNIT_TEST_PASSED             The test passed.
+  @retval  UNIT_TEST_ERROR_TEST_FAILED  A test case assertion has failed.
+**/
+UNIT_TEST_STATUS
+EFIAPI
+DecodeCorruptedContentShouldFail (
+  IN UNIT_TEST_CONTEXT  Context
+  )
+{
+  UINT8       *Content;
+  UINTN       Index;
+  UINTN       Bit;
+  VOID        *Decoded;
+  UINTN       DecodedLength;
+  EFI_STATUS  Status;
+
+  UT_ASSERT_STATUS_EQUAL (RedfishContentDecode (HTTP_CONTENT_ENCODING_DEFLATE, (VOID *)mDistanceTooFarContent, sizeof (mDistanceTooFarContent), &Decoded, &DecodedLength), EFI_VOLUME_CORRUPTED);
+  UT_ASSERT_STATUS_EQUAL (RedfishContentDecode (HTTP_CONTENT_ENCODING_DEFLATE, (VOID *)mInvalidBlockTypeContent, sizeof (mInvalidBlockTypeContent), &Decoded, &DecodedLength), EFI_VOLUME_CORRUPTED);
+  UT_ASSERT_STATUS_EQUAL (RedfishContentDecode (HTTP_CONTENT_ENCODING_DEFLATE, (VOID *)mStoredLengthContent, sizeof (mStoredLengthContent), &Decoded, &DecodedLength), EFI_VOLUME_CORRUPTED);
+
+  Content = AllocateCopyPool (sizeof (mGzipContent), mGzipContent);
+  UT_ASSERT_NOT_NULL (Content);
+
+  //
+  // Wrong magic, CRC32 and size in the trailer.
+  //
+  Content[1] ^= 0xFF;
+  UT_ASSERT_STATUS_EQUAL (RedfishContentDecode (HTTP_CONTENT_ENCODING_GZIP, Content, sizeof (mGzipContent), &Decoded, &DecodedLength), EFI_VOLUME_CORRUPTED);
+  Content[1] ^= 0xFF;
+  Content[sizeof (mGzipContent) - 8] ^= 0x01;
+  UT_ASSERT_STATUS_EQUAL (RedfishContentDecode (HTTP_CONTENT_ENCODING_GZIP, Content, sizeof (mGzipContent), &Decoded, &DecodedLength), EFI_VOLUME_CORRUPTED);
+  Content[sizeof (mGzipContent) - 8] ^= 0x01;
+  Content[sizeof (mGzipContent) - 4] ^= 0x01;
+  UT_ASSERT_STATUS_EQUAL (RedfishContentDecode (HTTP_CONTENT_ENCODING_GZIP, Content, sizeof (mGzipContent), &Decoded, &DecodedLength), EFI_VOLUME_CORRUPTED);
+  Content[sizeof (mGzipContent) - 4] ^= 0x01;
+
+  //
+  // Flip every bit of the content. Bits in the gzip header which are not
+  // checked, such as modification time, don't change the decoded data.
+  // Otherwise decoding must fail.
+  //
+  for (Index = 0; Index < sizeof (mGzipContent); Index++) {
+    for (Bit = 0; Bit < 8; Bit++) {
+      Content[Index] ^= (UINT8)(1 << Bit);
+      Decoded         = NULL;
+      Status          = RedfishContentDecode (HTTP_CONTENT_ENCODING_GZIP, Content, sizeof (mGzipContent), &Decoded, &DecodedLength);
+      if (!EFI_ERROR (Status)) {
+        UT_ASSERT_EQUAL (DecodedLength, AsciiStrLen (mJsonContent));
+        UT_ASSERT_MEM_EQUAL (Decoded, mJsonContent, DecodedLength);
+        FreePool (Decoded);
+      }
+
+      Content[Index] ^= (UINT8)(1 << Bit);
+    }
+  }
+
+  FreePool (Content);
+
+  //
+  // Wrong Adler-32 of zlib content.
+  //
+  Content = AllocateCopyPool (sizeof (mZlibContent), mZlibContent);
+  UT_ASSERT_NOT_NULL (Content);
+  Content[sizeof (mZlibContent) - 1] ^= 0x01;
+  UT_ASSERT_STATUS_EQUAL (RedfishContentDecode (HTTP_CONTENT_ENCODING_DEFLATE, Content, sizeof (mZlibContent), &Decoded, &DecodedLength), EFI_VOLUME_CORRUPTED);
+  FreePool (Content);
+
+  return UNIT_TEST_PASSED;
+}
+
+/**
+  Initialize the unit test framework, suite, and unit tests for the
+  Redfish content coding library and run the unit tests.
+
+  @retval  EFI_SUCCESS           All test cases were dispatched.
+  @retval  EFI_OUT_OF_RESOURCES  There are not enough resources available to
+                                 initialize the unit tests.
+**/
+STATIC
+EFI_STATUS
+EFIAPI
+UnitTestingEntry (
+  VOID
+  )
+{
+  EFI_STATUS                  Status;
+  UNIT_TEST_FRAMEWORK_HANDLE  Framework;
+  UNIT_TEST_SUITE_HANDLE      ContentCodingTests;
+
+  Framework = NULL;
+
+  DEBUG ((DEBUG_INFO, "%a v%a\n", UNIT_TEST_APP_NAME, UNIT_TEST_APP_VERSION));
+
+  Status = InitUnitTestFramework (&Framework, UNIT_TEST_APP_NAME, gEfiCallerBaseName, UNIT_TEST_APP_VERSION);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in InitUnitTestFramework. Status = %r\n", Status));
+    goto EXIT;
+  }
+
+  Status = CreateUnitTestSuite (&ContentCodingTests, Framework, "Redfish Content Coding Tests", "RedfishContentCodingLib", NULL, NULL);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "Failed in CreateUnitTestSuite for Redfish Content Coding Tests\n"));
+    Status = EFI_OUT_OF_RESOURCES;
+    goto EXIT;
+  }
+
+  //
+  // --------------Suite-----------------Description-----------------------Name--------Function--------------------------Pre---Post---Context
+  //
+  AddTestCase (ContentCodingTests, "Decode valid content",            "Valid",     DecodeValidContentShouldSucceed,  NULL, NULL, NULL);
+  AddTestCase (ContentCodingTests, "Encode and decode content",       "RoundTrip", EncodeShouldRoundTrip,            NULL, NULL, NULL);
+  AddTestCase (ContentCodingTests, "Decode truncated content",        "Truncated", DecodeTruncatedContentShouldFail, NULL, NULL, NULL);
+  AddTestCase (ContentCodingTests, "Decode corrupted content",        "Corrupted", DecodeCorruptedContentShouldFail, NULL, NULL, NULL);
+
+  Status = RunAllTestSuites (Framework);
+
+EXIT:
+  if (Framework) {
+    FreeUnitTestFramework (Framework);
+  }
+
+  return Status;
+}
+
+///
+/// Avoid ECC error for function name that starts with lower case letter
+///
+#define RedfishContentCodingLibUnitTestMain  main
+
+/**
+  Standard POSIX C entry point for host based unit test execution.
+
+  @param[in] Argc  Number of arguments
+  @param[in] Argv  Array of pointers to arguments
+
+  @retval 0      Success
+  @retval other  Error
+**/
+INT32
+RedfishContentCodingLibUnitTestMain (
+  IN INT32  Argc,
+  IN CHAR8  *Argv[]
+  )
+{
+  UnitTestingEntry ();
+  return 0;
+}
@@ -79,3 +79,19 @@ RedfishContentDecode (
 {
   return EFI_UNSUPPORTED;
 }
+
+/**
+  Return the content codings which RedfishContentDecode() supports, in the
+  format of HTTP Accept-Encoding header value.
+
+  @retval CHAR8 *   Accept-Encoding header value.
+  @retval NULL      No content coding is supported.
+
+**/
+CONST CHAR8 *
+RedfishContentAcceptEncoding (
+  VOID
+  )
+{
+  return NULL;
+}
@@ -0,0 +1,163 @@
+/** @file
+  RedfishPerfLib measures Redfish operations. The measurement is reported to
+  EDKII_REDFISH_PERF_PROTOCOL, if it is installed, and to the performance
+  measurement log of PerformanceLib, which can be shown by DP command.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include <Uefi.h>
+#include <Library/BaseLib.h>
+#include <Library/DebugLib.h>
+#include <Library/PcdLib.h>
+#include <Library/PerformanceLib.h>
+#include <Library/RedfishPerfLib.h>
+#include <Library/TimerLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+
+//
+// Maximum length of the Unicode key converted to ASCII. Longer key is
+// truncated.
+//
+#define REDFISH_PERF_KEY_MAX_LENGTH  255
+
+CONST CHAR8                  *mRedfishPerfCategoryName[RedfishPerfCategoryMax] = REDFISH_PERF_CATEGORY_NAMES;
+EDKII_REDFISH_PERF_PROTOCOL  *mRedfishPerfProtocol                             = NULL;
+
+/**
+  Start to measure an operation.
+
+  @return   The time stamp to pass to RedfishPerfEnd(), or 0 if the measurement
+            is disabled.
+
+**/
+UINT64
+EFIAPI
+RedfishPerfStart (
+  VOID
+  )
+{
+  if (!FeaturePcdGet (PcdRedfishPerfEnable)) {
+    return 0;
+  }
+
+  return GetPerformanceCounter ();
+}
+
+/**
+  End the measurement of operations started by RedfishPerfStart(), and record it.
+
+  @param[in]  Category        Category of the measured operations.
+  @param[in]  Key             URI, schema or feature the operations are for.
+  @param[in]  StartTick       The time stamp returned by RedfishPerfStart().
+  @param[in]  Count           Number of operations measured at once.
+  @param[in]  Bytes           Bytes sent and received.
+  @param[in]  Failed          TRUE if the operations failed.
+
+**/
+VOID
+EFIAPI
+RedfishPerfEnd (
+  IN REDFISH_PERF_CATEGORY  Category,
+  IN CONST CHAR8            *Key,
+  IN UINT64                 StartTick,
+  IN UINTN                  Count,
+  IN UINT64                 Bytes,
+  IN BOOLEAN                Failed
+  )
+{
+  EFI_STATUS  Status;
+  UINT64      EndTick;
+  UINT64      CounterStart;
+  UINT64      CounterEnd;
+  UINT64      Elapsed;
+
+  if (!FeaturePcdGet (PcdRedfishPerfEnable) || (StartTick == 0) || (Category >= RedfishPerfCategoryMax)) {
+    return;
+  }
+
+  EndTick = GetPerformanceCounter ();
+
+  if (Key == NULL) {
+    Key = "";
+  }
+
+  //
+  // The performance counter may count down.
+  //
+  GetPerformanceCounterProperties (&CounterStart, &CounterEnd);
+  if (CounterStart > CounterEnd) {
+    Elapsed = StartTick - EndTick;
+  } else {
+    Elapsed = EndTick - StartTick;
+  }
+
+  PERF_START_EX (&gEfiCallerIdGuid, mRedfishPerfCategoryName[Category], Key, StartTick, 0);
+  PERF_END_EX (&gEfiCallerIdGuid, mRedfishPerfCategoryName[Category], Key, EndTick, 0);
+
+  if (mRedfishPerfProtocol == NULL) {
+    Status = gBS->LocateProtocol (&gEdkIIRedfishPerfProtocolGuid, NULL, (VOID **)&mRedfishPerfProtocol);
+    if (EFI_ERROR (Status)) {
+      mRedfishPerfProtocol = NULL;
+      return;
+    }
+  }
+
+  mRedfishPerfProtocol->Record (
+                          mRedfishPerfProtocol,
+                          Category,
+                          &gEfiCallerIdGuid,
+                          Key,
+                          (Count == 0 ? 1 : Count),
+                          GetTimeInNanoSecond (Elapsed),
+                          Bytes,
+                          Failed
+                          );
+}
+
+/**
+  Same as RedfishPerfEnd(), but the key is a Unicode string.
+
+  @param[in]  Category        Category of the measured operations.
+  @param[in]  Key             URI, schema or feature the operations are for.
+  @param[in]  StartTick       The time stamp returned by RedfishPerfStart().
+  @param[in]  Count           Number of operations measured at once.
+  @param[in]  Bytes           Bytes sent and received.
+  @param[in]  Failed          TRUE if the operations failed.
+
+**/
+VOID
+EFIAPI
+RedfishPerfEndUnicode (
+  IN REDFISH_PERF_CATEGORY  Category,
+  IN CONST CHAR16           *Key,
+  IN UINT64                 StartTick,
+  IN UINTN                  Count,
+  IN UINT64                 Bytes,
+  IN BOOLEAN                Failed
+  )
+{
+  CHAR8  AsciiKey[REDFISH_PERF_KEY_MAX_LENGTH + 1];
+  UINTN  Index;
+
+  if (!FeaturePcdGet (PcdRedfishPerfEnable) || (StartTick == 0)) {
+    return;
+  }
+
+  //
+  // Keys are URIs and schema names, which are all ASCII characters.
+  //
+  Index = 0;
+  if (Key != NULL) {
+    for ( ; Index < REDFISH_PERF_KEY_MAX_LENGTH && Key[Index] != L'\0'; Index++) {
+      AsciiKey[Index] = (Key[Index] < 0x80) ? (CHAR8)Key[Index] : '?';
+    }
+  }
+
+  AsciiKey[Index] = '\0';
+
+  RedfishPerfEnd (Category, AsciiKey, StartTick, Count, Bytes, Failed);
+}
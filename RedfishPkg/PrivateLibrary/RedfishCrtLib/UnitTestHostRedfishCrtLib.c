@@ -0,0 +1,17 @@
+/** @file
+  Global variables of the Redfish C runtime library for host-based unit
+  tests. The other CRT wrappers are provided by the host C library.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+    SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+#include <Uefi.h>
+#include <Library/RedfishCrtLib.h>
+
+//
+// RedfishCrtLib.h declares errno as a plain global, which can't be bound to
+// the thread-local errno of the host C library.
+//
+int  errno = 0;
@@ -400,6 +400,108 @@ CheckIsIpVersion6 (
   return FALSE;
 }
 
+/**
+  This function gets Redfish host interface device descriptor and protocol
+  data from SMBIOS type 42h record.
+
+  @param[out]   DeviceDescriptor  Pointer to REDFISH_INTERFACE_DATA.
+  @param[out]   ProtocolData      Pointer to REDFISH_OVER_IP_PROTOCOL_DATA.
+
+  @retval EFI_SUCCESS        Redfish host interface is found in SMBIOS.
+  @retval Others             There is no Redfish host interface in SMBIOS.
+
+**/
+EFI_STATUS
+GetSmbiosHostInterface (
+  OUT REDFISH_INTERFACE_DATA        **DeviceDescriptor,
+  OUT REDFISH_OVER_IP_PROTOCOL_DATA **ProtocolData
+  )
+{
+  EFI_STATUS Status;
+
+  *DeviceDescriptor = NULL;
+  *ProtocolData = NULL;
+  if (mSmbios == NULL) {
+    Status = gBS->LocateProtocol(&gEfiSmbiosProtocolGuid, NULL, (VOID **)&mSmbios);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+  Status = RedfishGetHostInterfaceProtocolData (mSmbios, DeviceDescriptor, ProtocolData); // Search for SMBIOS type 42h
+  if (!EFI_ERROR (Status) && (*ProtocolData == NULL || *DeviceDescriptor == NULL)) {
+    Status = EFI_NOT_FOUND;
+  }
+  return Status;
+}
+
+/**
+  This function checks if Redfish service described in SMBIOS host interface
+  can be reached out through this network interface.
+
+  @param[in]    NetworkInterface   EFI_REDFISH_DISCOVER_NETWORK_INTERFACE_INTERNAL
+  @param[in]    DeviceDescriptor   Pointer to REDFISH_INTERFACE_DATA.
+
+  @retval TRUE  MAC address of network interface is the one in device descriptor.
+
+**/
+BOOLEAN
+IsHostInterfaceNetworkInterface (
+  IN EFI_REDFISH_DISCOVER_NETWORK_INTERFACE_INTERNAL *NetworkInterface,
+  IN REDFISH_INTERFACE_DATA                          *DeviceDescriptor
+  )
+{
+  //
+  // Check with MAC address using Device Descroptor Data Device Type 04 and Type 05.
+  // Those two types of Redfish host interface device has MAC information.
+  //
+  if (DeviceDescriptor->DeviceType == REDFISH_HOST_INTERFACE_DEVICE_TYPE_PCI_PCIE_V2) {
+    return (BOOLEAN)(CompareMem(&NetworkInterface->MacAddress, &DeviceDescriptor->DeviceDescriptor.PciPcieDeviceV2.MacAddress, 6) == 0);
+  } else if (DeviceDescriptor->DeviceType == REDFISH_HOST_INTERFACE_DEVICE_TYPE_USB_V2){
+    return (BOOLEAN)(CompareMem(&NetworkInterface->MacAddress, &DeviceDescriptor->DeviceDescriptor.UsbDeviceV2.MacAddress, 6) == 0);
+  }
+  return FALSE;
+}
+
+/**
+  This function restores the IPv4 subnet information of the network interface
+  from the last known-good Redfish host interface discovery, so the network
+  interface needn't be configured to retrieve it again. It is restored only
+  when the host IP address in SMBIOS type 42h is assigned statically.
+
+  @param[in]    NetworkInterface   EFI_REDFISH_DISCOVER_NETWORK_INTERFACE_INTERNAL
+
+  @retval TRUE  Subnet information is restored.
+
+**/
+BOOLEAN
+RestoreHostInterfaceSubnetInfo (
+  IN EFI_REDFISH_DISCOVER_NETWORK_INTERFACE_INTERNAL *NetworkInterface
+  )
+{
+  REDFISH_OVER_IP_PROTOCOL_DATA *Data;
+  REDFISH_INTERFACE_DATA  *DeviceDescriptor;
+  REDFISH_DISCOVER_HOST_INTERFACE_CACHE *Cache;
+
+  if (CheckIsIpVersion6 (NetworkInterface)) {
+    return FALSE;
+  }
+  if (EFI_ERROR (GetSmbiosHostInterface (&DeviceDescriptor, &Data)) ||
+      !IsHostInterfaceNetworkInterface (NetworkInterface, DeviceDescriptor)) {
+    return FALSE;
+  }
+  Cache = RedfishGetHostInterfaceCache (DeviceDescriptor, Data);
+  if (Cache == NULL || Cache->IsIpv6 || !Cache->GotSubnetInfo ||
+      CompareMem (&Cache->MacAddress, &NetworkInterface->MacAddress, NetworkInterface->HwAddressSize) != 0) {
+    return FALSE;
+  }
+  IP4_COPY_ADDRESS (&NetworkInterface->SubnetAddr.v4, &Cache->SubnetAddr.v4);
+  IP4_COPY_ADDRESS (&NetworkInterface->SubnetMask.v4, &Cache->SubnetMask.v4);
+  NetworkInterface->SubnetPrefixLength = Cache->SubnetPrefixLength;
+  NetworkInterface->GotSubnetInfo = TRUE;
+  DEBUG ((DEBUG_INFO,"%a:Subnet information of MAC address %s is restored.\n", __FUNCTION__, NetworkInterface->StrMacAddr));
+  return TRUE;
+}
+
 /**
   This function discover Redfish service through SMBIOS host interface.
 
@@ -419,33 +521,14 @@ DiscoverRedfishHostInterface (IN EFI_REDFISH_DISCOVERED_INTERNAL_INSTANCE *Insta
   CHAR16 Ipv6Str [sizeof"ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff" + 1];
   CHAR8 RedfishServiceLocateStr [sizeof"ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff" + 1];
   UINTN StrSize;
-  UINTN MacCompareStstus;
   BOOLEAN IsHttps;
 
-  Data = NULL;
-  DeviceDescriptor = NULL;
-
-  if (mSmbios == NULL) {
-    Status = gBS->LocateProtocol(&gEfiSmbiosProtocolGuid, NULL, (VOID **)&mSmbios);
-    if (EFI_ERROR (Status)) {
-      return Status;
-    }
-  }
-  Status = RedfishGetHostInterfaceProtocolData (mSmbios, &DeviceDescriptor, &Data); // Search for SMBIOS type 42h
-  if (!EFI_ERROR (Status) && Data != NULL && DeviceDescriptor != NULL) {
+  Status = GetSmbiosHostInterface (&DeviceDescriptor, &Data);
+  if (!EFI_ERROR (Status)) {
     //
     // Chceck if we can reach out Redfish service using this network interface.
-    // Check with MAC address using Device Descroptor Data Device Type 04 and Type 05.
-    // Those two types of Redfish host interface device has MAC information.
     //
-    if (DeviceDescriptor->DeviceType == REDFISH_HOST_INTERFACE_DEVICE_TYPE_PCI_PCIE_V2) {
-      MacCompareStstus = CompareMem(&Instance->NetworkInterface->MacAddress, &DeviceDescriptor->DeviceDescriptor.PciPcieDeviceV2.MacAddress, 6);
-    } else if (DeviceDescriptor->DeviceType == REDFISH_HOST_INTERFACE_DEVICE_TYPE_USB_V2){
-      MacCompareStstus = CompareMem(&Instance->NetworkInterface->MacAddress, &DeviceDescriptor->DeviceDescriptor.UsbDeviceV2.MacAddress, 6);
-    } else {
-      return EFI_UNSUPPORTED;
-    }
-    if (MacCompareStstus != 0) {
+    if (!IsHostInterfaceNetworkInterface (Instance->NetworkInterface, DeviceDescriptor)) {
       return EFI_UNSUPPORTED;
     }
 
@@ -525,6 +608,13 @@ DiscoverRedfishHostInterface (IN EFI_REDFISH_DISCOVERED_INTERNAL_INSTANCE *Insta
             NULL,
             IsHttps
             );
+      if (!EFI_ERROR (Status)) {
+        RedfishSetHostInterfaceCache (
+          Instance->NetworkInterface,
+          DeviceDescriptor,
+          Data
+          );
+      }
     }
   }
   return Status;
@@ -842,7 +932,7 @@ NetworkInterfaceGetSubnetInfo (
   EFI_IP6_ADDRESS_INFO *ThisSubnetAddrInfoIPv6;
   EFI_REDFISH_DISCOVER_NETWORK_INTERFACE_INTERNAL *NewNetworkInterface;
 
-  if (Instance->GotSubnetInfo) {
+  if (Instance->GotSubnetInfo || RestoreHostInterfaceSubnetInfo (Instance)) {
     return EFI_SUCCESS;
   }
 
@@ -1023,6 +1113,8 @@ RedfishServiceAcquireService (
   UINTN NumNetworkInterfaces;
   UINTN NetworkInterfacesIndex;
   EFI_REDFISH_DISCOVER_NETWORK_INTERFACE_INTERNAL *TargetNetworkInterfaceInternal;
+  REDFISH_OVER_IP_PROTOCOL_DATA *Data;
+  REDFISH_INTERFACE_DATA  *DeviceDescriptor;
 
   DEBUG ((DEBUG_INFO,"%a:Entry.\n", __FUNCTION__));
 
@@ -1050,7 +1142,21 @@ RedfishServiceAcquireService (
       return EFI_UNSUPPORTED;
     }
   }
+  //
+  // Redfish host interface discovery only needs the network interface
+  // described in SMBIOS type 42h, don't bring up the others.
+  //
+  DeviceDescriptor = NULL;
+  if ((Flags & ~EFI_REDFISH_DISCOVER_VALIDATION) == EFI_REDFISH_DISCOVER_HOST_INTERFACE) {
+    GetSmbiosHostInterface (&DeviceDescriptor, &Data);
+  }
   for (NetworkInterfacesIndex = 0; NetworkInterfacesIndex < NumNetworkInterfaces; NetworkInterfacesIndex ++) {
+    if (DeviceDescriptor != NULL && !IsHostInterfaceNetworkInterface (TargetNetworkInterfaceInternal, DeviceDescriptor)) {
+      if (TargetNetworkInterface == NULL) {
+        TargetNetworkInterfaceInternal = (EFI_REDFISH_DISCOVER_NETWORK_INTERFACE_INTERNAL *)GetNextNode(&mEfiRedfishDiscoverNetworkInterface, &TargetNetworkInterfaceInternal->Entry);
+      }
+      continue;
+    }
     Status1 = EFI_SUCCESS;
     Status2 = EFI_SUCCESS;
     NewInstance = FALSE;
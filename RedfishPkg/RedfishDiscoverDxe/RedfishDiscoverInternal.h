@@ -30,6 +30,7 @@
 #include <Library/UefiLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiDriverEntryPoint.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
 
 #include <IndustryStandard/RedfishHostInterface.h>
 
@@ -55,6 +56,14 @@
     0xc44a6076, 0xd42a, 0x4d54, { 0x85, 0x6d, 0x98, 0x8a, 0x85, 0x8f, 0xa1, 0x11 } \
   }
 
+#define REDFISH_DISCOVER_HOST_INTERFACE_CACHE_GUID \
+  { \
+    0xfce6be61, 0xc0dc, 0x414e, { 0x8b, 0xb6, 0x5b, 0x62, 0x6e, 0x27, 0xe9, 0x65 } \
+  }
+
+#define REDFISH_DISCOVER_HOST_INTERFACE_CACHE_VARIABLE   L"RedfishDiscoverHostInterface"
+#define REDFISH_DISCOVER_HOST_INTERFACE_CACHE_SIGNATURE  SIGNATURE_32 ('R', 'F', 'H', 'I')
+
 extern EFI_COMPONENT_NAME_PROTOCOL   gRedfishDiscoverComponentName;
 extern EFI_COMPONENT_NAME2_PROTOCOL  gRedfishDiscoverComponentName2;
 extern EFI_UNICODE_STRING_TABLE      *gRedfishDiscoverControllerNameTable;
@@ -177,6 +186,23 @@ typedef struct {
   EFI_IP_ADDRESS  TargetIpAddress;                      ///< Target IP address reported in Redfish Host interface.
 } EFI_REDFISH_DISCOVERED_INTERNAL_INSTANCE;
 
+//
+// The last known-good subnet information of the Redfish Host interface network
+// interface. It is kept in UEFI variable and only used while the host IP address
+// is assigned statically and SMBIOS type 42h record is the same as the one the
+// subnet information was retrieved with.
+//
+typedef struct {
+  UINT32          Signature;                            ///< REDFISH_DISCOVER_HOST_INTERFACE_CACHE_SIGNATURE
+  UINT32          HostInterfaceCrc;                     ///< CRC32 of device descriptor and protocol data in SMBIOS type 42h.
+  EFI_MAC_ADDRESS MacAddress;                           ///< MAC address of network interface used to reach the service.
+  BOOLEAN         IsIpv6;                               ///< Network interface is IPv6 network interface.
+  BOOLEAN         GotSubnetInfo;                        ///< Subnet information below is valid.
+  EFI_IP_ADDRESS  SubnetAddr;                           ///< Subnet ID.
+  EFI_IP_ADDRESS  SubnetMask;                           ///< Subnet mask (IPv4 only)
+  UINT8           SubnetPrefixLength;                   ///< Subnet prefix.
+} REDFISH_DISCOVER_HOST_INTERFACE_CACHE;
+
 /**
   The function adds a new foudn Redfish service to internal list and
   notify clinet.
@@ -228,6 +254,45 @@ RedfishGetHostInterfaceProtocolData (
   OUT REDFISH_OVER_IP_PROTOCOL_DATA   **ProtocolData
   );
 
+/**
+  Get the last known-good subnet information of the Redfish Host interface
+  network interface. It is returned only when the host IP address is assigned
+  statically, and SMBIOS type 42h record is the same as the one the subnet
+  information was retrieved with.
+
+  @param[in]  DeviceDescriptor Pointer to REDFISH_INTERFACE_DATA in SMBIOS type 42h.
+  @param[in]  ProtocolData     Pointer to REDFISH_OVER_IP_PROTOCOL_DATA in SMBIOS type 42h.
+
+  @return     Pointer to REDFISH_DISCOVER_HOST_INTERFACE_CACHE, or NULL if there is
+              no last known-good subnet information, the host IP address is not
+              static or SMBIOS type 42h record is changed.
+
+**/
+REDFISH_DISCOVER_HOST_INTERFACE_CACHE *
+RedfishGetHostInterfaceCache (
+  IN REDFISH_INTERFACE_DATA           *DeviceDescriptor,
+  IN REDFISH_OVER_IP_PROTOCOL_DATA    *ProtocolData
+  );
+
+/**
+  Keep the subnet information of the Redfish Host interface network interface
+  as the last known-good one. It is kept only when the host IP address is
+  assigned statically, the subnet of a DHCP or auto-configured address may be
+  different on next boot. The UEFI variable is written only when the subnet
+  information differs from the kept one.
+
+  @param[in]  NetworkInterface Network interface used to reach the service.
+  @param[in]  DeviceDescriptor Pointer to REDFISH_INTERFACE_DATA in SMBIOS type 42h.
+  @param[in]  ProtocolData     Pointer to REDFISH_OVER_IP_PROTOCOL_DATA in SMBIOS type 42h.
+
+**/
+VOID
+RedfishSetHostInterfaceCache (
+  IN EFI_REDFISH_DISCOVER_NETWORK_INTERFACE_INTERNAL *NetworkInterface,
+  IN REDFISH_INTERFACE_DATA           *DeviceDescriptor,
+  IN REDFISH_OVER_IP_PROTOCOL_DATA    *ProtocolData
+  );
+
 extern EFI_GUID gRedfishDiscoverTcp4Instance;
 extern EFI_GUID gRedfishDiscoverTcp6Instance;
 extern EFI_GUID gRedfishDiscoverRestEXInstance;
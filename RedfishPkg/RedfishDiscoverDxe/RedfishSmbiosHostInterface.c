@@ -13,6 +13,17 @@
 
 SMBIOS_TABLE_TYPE42  *mType42Record;
 
+//
+// SMBIOS type 42h record is parsed once, the network interfaces
+// share the result.
+//
+REDFISH_INTERFACE_DATA         *mHostInterfaceDeviceDescriptor = NULL;
+REDFISH_OVER_IP_PROTOCOL_DATA  *mHostInterfaceProtocolData = NULL;
+
+EFI_GUID                               mRedfishDiscoverHostInterfaceCacheGuid = REDFISH_DISCOVER_HOST_INTERFACE_CACHE_GUID;
+REDFISH_DISCOVER_HOST_INTERFACE_CACHE  mHostInterfaceCache;
+BOOLEAN                                mHostInterfaceCacheLoaded = FALSE;
+
 /**
   The function gets information reported in Redfish Host Interface.
 
@@ -35,6 +46,7 @@ RedfishGetHostInterfaceProtocolData (
 {
   EFI_STATUS                        Status;
   EFI_SMBIOS_HANDLE                 SmbiosHandle;
+  EFI_SMBIOS_TYPE                   SmbiosType;
   EFI_SMBIOS_TABLE_HEADER           *Record;
   UINT16                            Offset;
   UINT8                             *RecordTmp;
@@ -45,8 +57,18 @@ RedfishGetHostInterfaceProtocolData (
     return EFI_INVALID_PARAMETER;
   }
 
+  if (mHostInterfaceProtocolData != NULL) {
+    *DeviceDescriptor = mHostInterfaceDeviceDescriptor;
+    *ProtocolData = mHostInterfaceProtocolData;
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Only walk through type 42h records.
+  //
+  SmbiosType = SMBIOS_TYPE_MANAGEMENT_CONTROLLER_HOST_INTERFACE;
   SmbiosHandle = SMBIOS_HANDLE_PI_RESERVED;
-  Status = Smbios->GetNext (Smbios, &SmbiosHandle, NULL, &Record, NULL);
+  Status = Smbios->GetNext (Smbios, &SmbiosHandle, &SmbiosType, &Record, NULL);
   while (!EFI_ERROR (Status) && SmbiosHandle != SMBIOS_HANDLE_PI_RESERVED) {
     if (Record->Type == SMBIOS_TYPE_MANAGEMENT_CONTROLLER_HOST_INTERFACE) {
       //
@@ -105,14 +127,170 @@ RedfishGetHostInterfaceProtocolData (
               return EFI_SECURITY_VIOLATION;
             }
             *ProtocolData = (REDFISH_OVER_IP_PROTOCOL_DATA *)RecordTmp;
+            mHostInterfaceDeviceDescriptor = *DeviceDescriptor;
+            mHostInterfaceProtocolData = *ProtocolData;
             return EFI_SUCCESS;
           }
         }
       }
     }
-    Status = Smbios->GetNext (Smbios, &SmbiosHandle, NULL, &Record, NULL);
+    Status = Smbios->GetNext (Smbios, &SmbiosHandle, &SmbiosType, &Record, NULL);
   }
 
   *ProtocolData = NULL;
   return EFI_NOT_FOUND;
 }
+
+/**
+  Calculate CRC32 of device descriptor and protocol data in SMBIOS type 42h.
+  Both are in the same record, the protocol data follows the device descriptor.
+
+  @param[in]  DeviceDescriptor Pointer to REDFISH_INTERFACE_DATA.
+  @param[in]  ProtocolData     Pointer to REDFISH_OVER_IP_PROTOCOL_DATA.
+
+  @return     CRC32 of host interface data, or 0 if error happens.
+
+**/
+UINT32
+RedfishHostInterfaceCrc (
+  IN REDFISH_INTERFACE_DATA           *DeviceDescriptor,
+  IN REDFISH_OVER_IP_PROTOCOL_DATA    *ProtocolData
+  )
+{
+  UINTN   Length;
+  UINT32  Crc;
+
+  Length = (UINTN)((UINT8 *)ProtocolData - (UINT8 *)DeviceDescriptor) +
+           sizeof (REDFISH_OVER_IP_PROTOCOL_DATA) - 1 + ProtocolData->RedfishServiceHostnameLength;
+  if (EFI_ERROR (gBS->CalculateCrc32 ((VOID *)DeviceDescriptor, Length, &Crc))) {
+    return 0;
+  }
+  return Crc;
+}
+
+/**
+  Read the last known-good Redfish host interface discovery from UEFI variable.
+  It is read once, mHostInterfaceCache is zeroed if there is no valid one.
+
+**/
+VOID
+RedfishLoadHostInterfaceCache (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       DataSize;
+
+  if (mHostInterfaceCacheLoaded) {
+    return;
+  }
+  mHostInterfaceCacheLoaded = TRUE;
+
+  DataSize = sizeof (REDFISH_DISCOVER_HOST_INTERFACE_CACHE);
+  Status = gRT->GetVariable (
+                  REDFISH_DISCOVER_HOST_INTERFACE_CACHE_VARIABLE,
+                  &mRedfishDiscoverHostInterfaceCacheGuid,
+                  NULL,
+                  &DataSize,
+                  (VOID *)&mHostInterfaceCache
+                  );
+  if (EFI_ERROR (Status) ||
+      DataSize != sizeof (REDFISH_DISCOVER_HOST_INTERFACE_CACHE) ||
+      mHostInterfaceCache.Signature != REDFISH_DISCOVER_HOST_INTERFACE_CACHE_SIGNATURE) {
+    ZeroMem ((VOID *)&mHostInterfaceCache, sizeof (REDFISH_DISCOVER_HOST_INTERFACE_CACHE));
+  }
+}
+
+/**
+  Get the last known-good subnet information of the Redfish Host interface
+  network interface. It is returned only when the host IP address is assigned
+  statically, and SMBIOS type 42h record is the same as the one the subnet
+  information was retrieved with.
+
+  @param[in]  DeviceDescriptor Pointer to REDFISH_INTERFACE_DATA in SMBIOS type 42h.
+  @param[in]  ProtocolData     Pointer to REDFISH_OVER_IP_PROTOCOL_DATA in SMBIOS type 42h.
+
+  @return     Pointer to REDFISH_DISCOVER_HOST_INTERFACE_CACHE, or NULL if there is
+              no last known-good subnet information, the host IP address is not
+              static or SMBIOS type 42h record is changed.
+
+**/
+REDFISH_DISCOVER_HOST_INTERFACE_CACHE *
+RedfishGetHostInterfaceCache (
+  IN REDFISH_INTERFACE_DATA           *DeviceDescriptor,
+  IN REDFISH_OVER_IP_PROTOCOL_DATA    *ProtocolData
+  )
+{
+  if (DeviceDescriptor == NULL || ProtocolData == NULL ||
+      ProtocolData->HostIpAssignmentType != REDFISH_HOST_INTERFACE_HOST_IP_ASSIGNMENT_TYPE_STATIC) {
+    return NULL;
+  }
+
+  RedfishLoadHostInterfaceCache ();
+  if (mHostInterfaceCache.Signature != REDFISH_DISCOVER_HOST_INTERFACE_CACHE_SIGNATURE) {
+    return NULL;
+  }
+
+  if (mHostInterfaceCache.HostInterfaceCrc != RedfishHostInterfaceCrc (DeviceDescriptor, ProtocolData)) {
+    DEBUG ((DEBUG_INFO, "%a:SMBIOS host interface is changed since last discovery.\n", __FUNCTION__));
+    return NULL;
+  }
+  return &mHostInterfaceCache;
+}
+
+/**
+  Keep the subnet information of the Redfish Host interface network interface
+  as the last known-good one. It is kept only when the host IP address is
+  assigned statically, the subnet of a DHCP or auto-configured address may be
+  different on next boot. The UEFI variable is written only when the subnet
+  information differs from the kept one.
+
+  @param[in]  NetworkInterface Network interface used to reach the service.
+  @param[in]  DeviceDescriptor Pointer to REDFISH_INTERFACE_DATA in SMBIOS type 42h.
+  @param[in]  ProtocolData     Pointer to REDFISH_OVER_IP_PROTOCOL_DATA in SMBIOS type 42h.
+
+**/
+VOID
+RedfishSetHostInterfaceCache (
+  IN EFI_REDFISH_DISCOVER_NETWORK_INTERFACE_INTERNAL *NetworkInterface,
+  IN REDFISH_INTERFACE_DATA           *DeviceDescriptor,
+  IN REDFISH_OVER_IP_PROTOCOL_DATA    *ProtocolData
+  )
+{
+  EFI_STATUS                             Status;
+  REDFISH_DISCOVER_HOST_INTERFACE_CACHE  Cache;
+
+  if (NetworkInterface == NULL || DeviceDescriptor == NULL || ProtocolData == NULL ||
+      ProtocolData->HostIpAssignmentType != REDFISH_HOST_INTERFACE_HOST_IP_ASSIGNMENT_TYPE_STATIC ||
+      !NetworkInterface->GotSubnetInfo) {
+    return;
+  }
+
+  ZeroMem ((VOID *)&Cache, sizeof (REDFISH_DISCOVER_HOST_INTERFACE_CACHE));
+  Cache.Signature = REDFISH_DISCOVER_HOST_INTERFACE_CACHE_SIGNATURE;
+  Cache.HostInterfaceCrc = RedfishHostInterfaceCrc (DeviceDescriptor, ProtocolData);
+  CopyMem ((VOID *)&Cache.MacAddress, (VOID *)&NetworkInterface->MacAddress, NetworkInterface->HwAddressSize);
+  Cache.IsIpv6 = (BOOLEAN)(NetworkInterface->NetworkProtocolType == ProtocolTypeTcp6);
+  Cache.GotSubnetInfo = TRUE;
+  CopyMem ((VOID *)&Cache.SubnetAddr, (VOID *)&NetworkInterface->SubnetAddr, sizeof (EFI_IP_ADDRESS));
+  CopyMem ((VOID *)&Cache.SubnetMask, (VOID *)&NetworkInterface->SubnetMask, sizeof (EFI_IP_ADDRESS));
+  Cache.SubnetPrefixLength = NetworkInterface->SubnetPrefixLength;
+
+  RedfishLoadHostInterfaceCache ();
+  if (CompareMem ((VOID *)&Cache, (VOID *)&mHostInterfaceCache, sizeof (REDFISH_DISCOVER_HOST_INTERFACE_CACHE)) == 0) {
+    return;
+  }
+
+  Status = gRT->SetVariable (
+                  REDFISH_DISCOVER_HOST_INTERFACE_CACHE_VARIABLE,
+                  &mRedfishDiscoverHostInterfaceCacheGuid,
+                  EFI_VARIABLE_NON_VOLATILE | EFI_VARIABLE_BOOTSERVICE_ACCESS,
+                  sizeof (REDFISH_DISCOVER_HOST_INTERFACE_CACHE),
+                  (VOID *)&Cache
+                  );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a:Fail to keep Redfish host interface subnet information: %r.\n", __FUNCTION__, Status));
+    return;
+  }
+  CopyMem ((VOID *)&mHostInterfaceCache, (VOID *)&Cache, sizeof (REDFISH_DISCOVER_HOST_INTERFACE_CACHE));
+}
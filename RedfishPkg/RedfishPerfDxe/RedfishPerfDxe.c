@@ -0,0 +1,394 @@
+/** @file
+  RedfishPerfDxe produces EDKII_REDFISH_PERF_PROTOCOL. It aggregates the
+  measurements reported by Redfish modules, so they can be dumped by
+  RedfishPerfDump application.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#include "RedfishPerfDxe.h"
+
+REDFISH_PERF_PRIVATE_DATA  *mRedfishPerfPrivate = NULL;
+
+/**
+  Calculate the hash value of given category, module and key.
+
+  @param[in]  Category        Category of the measured operations.
+  @param[in]  Module          FILE_GUID of the module performs the operations.
+  @param[in]  Key             URI, schema or feature the operations are for.
+
+  @return     The hash value.
+
+**/
+UINT32
+RedfishPerfHash (
+  IN REDFISH_PERF_CATEGORY  Category,
+  IN CONST EFI_GUID         *Module,
+  IN CONST CHAR8            *Key
+  )
+{
+  UINT32       Hash;
+  CONST UINT8  *Byte;
+  UINTN        Index;
+
+  //
+  // FNV-1a
+  //
+  Hash = 0x811C9DC5 ^ (UINT32)Category;
+  Byte = (CONST UINT8 *)Module;
+  for (Index = 0; Index < sizeof (EFI_GUID); Index++) {
+    Hash = (Hash ^ Byte[Index]) * 0x01000193;
+  }
+
+  for (Byte = (CONST UINT8 *)Key; *Byte != '\0'; Byte++) {
+    Hash = (Hash ^ *Byte) * 0x01000193;
+  }
+
+  return Hash;
+}
+
+/**
+  Find the record of given category, module and key.
+
+  @param[in]  Private         Pointer to private data.
+  @param[in]  Hash            Hash value of Category, Module and Key.
+  @param[in]  Category        Category of the measured operations.
+  @param[in]  Module          FILE_GUID of the module performs the operations.
+  @param[in]  Key             URI, schema or feature the operations are for.
+
+  @retval REDFISH_PERF_RECORD *   The record is found.
+  @retval NULL                    The record is not found.
+
+**/
+REDFISH_PERF_RECORD *
+RedfishPerfFindRecord (
+  IN REDFISH_PERF_PRIVATE_DATA  *Private,
+  IN UINT32                     Hash,
+  IN REDFISH_PERF_CATEGORY      Category,
+  IN CONST EFI_GUID             *Module,
+  IN CONST CHAR8                *Key
+  )
+{
+  LIST_ENTRY           *Bucket;
+  LIST_ENTRY           *Node;
+  REDFISH_PERF_RECORD  *Record;
+
+  Bucket = &Private->Bucket[Hash & (REDFISH_PERF_BUCKET_COUNT - 1)];
+  for (Node = GetFirstNode (Bucket); !IsNull (Bucket, Node); Node = GetNextNode (Bucket, Node)) {
+    Record = REDFISH_PERF_RECORD_FROM_LIST (Node);
+    if ((Record->Hash == Hash) &&
+        (Record->Entry.Category == Category) &&
+        CompareGuid (&Record->Entry.Module, Module) &&
+        (AsciiStrCmp (Record->Entry.Key, Key) == 0))
+    {
+      return Record;
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Record a measurement.
+
+  @param[in]  This            Pointer to EDKII_REDFISH_PERF_PROTOCOL instance.
+  @param[in]  Category        Category of the measured operations.
+  @param[in]  Module          FILE_GUID of the module performs the operations.
+  @param[in]  Key             URI, schema or feature the operations are for.
+  @param[in]  Count           Number of operations measured at once.
+  @param[in]  Time            Time of the operations in nanoseconds.
+  @param[in]  Bytes           Bytes sent and received.
+  @param[in]  Failed          TRUE if the operations failed.
+
+  @retval EFI_SUCCESS             The measurement is recorded.
+  @retval EFI_INVALID_PARAMETER   This, Module or Key is NULL, or Category is invalid.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to record.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishPerfRecord (
+  IN EDKII_REDFISH_PERF_PROTOCOL  *This,
+  IN REDFISH_PERF_CATEGORY        Category,
+  IN CONST EFI_GUID               *Module,
+  IN CONST CHAR8                  *Key,
+  IN UINTN                        Count,
+  IN UINT64                       Time,
+  IN UINT64                       Bytes,
+  IN BOOLEAN                      Failed
+  )
+{
+  REDFISH_PERF_PRIVATE_DATA  *Private;
+  REDFISH_PERF_RECORD        *Record;
+  UINT32                     Hash;
+  UINTN                      KeySize;
+  EFI_TPL                    OldTpl;
+
+  if ((This == NULL) || (Module == NULL) || (Key == NULL) || (Category >= RedfishPerfCategoryMax)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Private = REDFISH_PERF_PRIVATE_FROM_THIS (This);
+  Hash    = RedfishPerfHash (Category, Module, Key);
+
+  //
+  // Measurements may be reported from event notification functions.
+  //
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+
+  Record = RedfishPerfFindRecord (Private, Hash, Category, Module, Key);
+  if (Record == NULL) {
+    KeySize = AsciiStrSize (Key);
+    Record  = AllocateZeroPool (sizeof (REDFISH_PERF_RECORD) + KeySize);
+    if (Record == NULL) {
+      gBS->RestoreTPL (OldTpl);
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    Record->Hash           = Hash;
+    Record->Entry.Category = Category;
+    Record->Entry.Key      = (CHAR8 *)(Record + 1);
+    CopyGuid (&Record->Entry.Module, Module);
+    CopyMem ((VOID *)Record->Entry.Key, Key, KeySize);
+    InsertTailList (&Private->Bucket[Hash & (REDFISH_PERF_BUCKET_COUNT - 1)], &Record->List);
+    Private->RecordCount++;
+  }
+
+  Record->Entry.Count     += Count;
+  Record->Entry.TotalTime += Time;
+  Record->Entry.Bytes     += Bytes;
+  if (Failed) {
+    Record->Entry.ErrorCount += Count;
+  }
+
+  //
+  // A batch of operations is measured as a whole, so use the average of the
+  // batch as the longest time.
+  //
+  if (Count > 1) {
+    Time = DivU64x64Remainder (Time, Count, NULL);
+  }
+
+  if (Time > Record->Entry.MaxTime) {
+    Record->Entry.MaxTime = Time;
+  }
+
+  gBS->RestoreTPL (OldTpl);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Get the aggregated measurements.
+
+  @param[in]  This            Pointer to EDKII_REDFISH_PERF_PROTOCOL instance.
+  @param[out] EntryCount      Number of entries returned in EntryList.
+  @param[out] EntryList       Newly allocated array of entries, caller frees it.
+                              The Key strings are owned by this protocol and
+                              valid until Reset() is called.
+
+  @retval EFI_SUCCESS             The entries are returned.
+  @retval EFI_INVALID_PARAMETER   This, EntryCount or EntryList is NULL.
+  @retval EFI_NOT_FOUND           Nothing is recorded.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishPerfGetEntries (
+  IN  EDKII_REDFISH_PERF_PROTOCOL  *This,
+  OUT UINTN                        *EntryCount,
+  OUT REDFISH_PERF_ENTRY           **EntryList
+  )
+{
+  REDFISH_PERF_PRIVATE_DATA  *Private;
+  REDFISH_PERF_ENTRY         *Entries;
+  LIST_ENTRY                 *Node;
+  UINTN                      Index;
+  UINTN                      Count;
+  EFI_TPL                    OldTpl;
+
+  if ((This == NULL) || (EntryCount == NULL) || (EntryList == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  *EntryCount = 0;
+  *EntryList  = NULL;
+  Private     = REDFISH_PERF_PRIVATE_FROM_THIS (This);
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  if (Private->RecordCount == 0) {
+    gBS->RestoreTPL (OldTpl);
+    return EFI_NOT_FOUND;
+  }
+
+  Entries = AllocatePool (Private->RecordCount * sizeof (REDFISH_PERF_ENTRY));
+  if (Entries == NULL) {
+    gBS->RestoreTPL (OldTpl);
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Count = 0;
+  for (Index = 0; Index < REDFISH_PERF_BUCKET_COUNT; Index++) {
+    for (Node = GetFirstNode (&Private->Bucket[Index]); !IsNull (&Private->Bucket[Index], Node); Node = GetNextNode (&Private->Bucket[Index], Node)) {
+      CopyMem (&Entries[Count], &REDFISH_PERF_RECORD_FROM_LIST (Node)->Entry, sizeof (REDFISH_PERF_ENTRY));
+      Count++;
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+
+  *EntryCount = Count;
+  *EntryList  = Entries;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Free all the records.
+
+  @param[in]  Private         Pointer to private data.
+
+**/
+VOID
+RedfishPerfFreeRecords (
+  IN REDFISH_PERF_PRIVATE_DATA  *Private
+  )
+{
+  LIST_ENTRY  *Node;
+  UINTN       Index;
+
+  for (Index = 0; Index < REDFISH_PERF_BUCKET_COUNT; Index++) {
+    while (!IsListEmpty (&Private->Bucket[Index])) {
+      Node = GetFirstNode (&Private->Bucket[Index]);
+      RemoveEntryList (Node);
+      FreePool (REDFISH_PERF_RECORD_FROM_LIST (Node));
+    }
+  }
+
+  Private->RecordCount = 0;
+}
+
+/**
+  Drop all the recorded measurements.
+
+  @param[in]  This            Pointer to EDKII_REDFISH_PERF_PROTOCOL instance.
+
+  @retval EFI_SUCCESS             The measurements are dropped.
+  @retval EFI_INVALID_PARAMETER   This is NULL.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishPerfReset (
+  IN EDKII_REDFISH_PERF_PROTOCOL  *This
+  )
+{
+  EFI_TPL  OldTpl;
+
+  if (This == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  RedfishPerfFreeRecords (REDFISH_PERF_PRIVATE_FROM_THIS (This));
+  gBS->RestoreTPL (OldTpl);
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Unloads an image.
+
+  @param[in]  ImageHandle           Handle that identifies the image to be unloaded.
+
+  @retval EFI_SUCCESS           The image has been unloaded.
+  @retval EFI_INVALID_PARAMETER ImageHandle is not a valid image handle.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishPerfDriverUnload (
+  IN EFI_HANDLE  ImageHandle
+  )
+{
+  EFI_STATUS  Status;
+
+  if (mRedfishPerfPrivate != NULL) {
+    Status = gBS->UninstallProtocolInterface (
+                    mRedfishPerfPrivate->ImageHandle,
+                    &gEdkIIRedfishPerfProtocolGuid,
+                    (VOID *)&mRedfishPerfPrivate->Protocol
+                    );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a, can not uninstall gEdkIIRedfishPerfProtocolGuid: %r\n", __FUNCTION__, Status));
+      return Status;
+    }
+
+    RedfishPerfFreeRecords (mRedfishPerfPrivate);
+    FreePool (mRedfishPerfPrivate);
+    mRedfishPerfPrivate = NULL;
+  }
+
+  return EFI_SUCCESS;
+}
+
+//
+// EDKII_REDFISH_PERF_PROTOCOL.
+//
+EDKII_REDFISH_PERF_PROTOCOL  mRedfishPerfProtocol = {
+  RedfishPerfRecord,
+  RedfishPerfGetEntries,
+  RedfishPerfReset
+};
+
+/**
+  This is the declaration of an EFI image entry point. This entry point is
+  the same for UEFI Applications, UEFI OS Loaders, and UEFI Drivers including
+  both device drivers and bus drivers.
+
+  @param[in]  ImageHandle       The firmware allocated handle for the UEFI image.
+  @param[in]  SystemTable       A pointer to the EFI System Table.
+
+  @retval EFI_SUCCESS           The operation completed successfully.
+  @retval Others                An unexpected error occurred.
+**/
+EFI_STATUS
+EFIAPI
+RedfishPerfDriverEntryPoint (
+  IN EFI_HANDLE        ImageHandle,
+  IN EFI_SYSTEM_TABLE  *SystemTable
+  )
+{
+  EFI_STATUS  Status;
+  UINTN       Index;
+
+  mRedfishPerfPrivate = AllocateZeroPool (sizeof (REDFISH_PERF_PRIVATE_DATA));
+  if (mRedfishPerfPrivate == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  for (Index = 0; Index < REDFISH_PERF_BUCKET_COUNT; Index++) {
+    InitializeListHead (&mRedfishPerfPrivate->Bucket[Index]);
+  }
+
+  mRedfishPerfPrivate->ImageHandle = ImageHandle;
+  CopyMem (&mRedfishPerfPrivate->Protocol, &mRedfishPerfProtocol, sizeof (EDKII_REDFISH_PERF_PROTOCOL));
+
+  Status = gBS->InstallProtocolInterface (
+                  &ImageHandle,
+                  &gEdkIIRedfishPerfProtocolGuid,
+                  EFI_NATIVE_INTERFACE,
+                  (VOID *)&mRedfishPerfPrivate->Protocol
+                  );
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, can not install gEdkIIRedfishPerfProtocolGuid: %r\n", __FUNCTION__, Status));
+    FreePool (mRedfishPerfPrivate);
+    mRedfishPerfPrivate = NULL;
+  }
+
+  return Status;
+}
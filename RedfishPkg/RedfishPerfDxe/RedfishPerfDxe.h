@@ -0,0 +1,56 @@
+/** @file
+  Common header file for RedfishPerfDxe driver.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+
+#ifndef REDFISH_PERF_DXE_H_
+#define REDFISH_PERF_DXE_H_
+
+#include <Uefi.h>
+
+//
+// Libraries
+//
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DebugLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiDriverEntryPoint.h>
+
+#include <Protocol/EdkIIRedfishPerf.h>
+
+//
+// Number of hash buckets the records are kept in. Must be power of 2.
+//
+#define REDFISH_PERF_BUCKET_COUNT  64
+
+//
+// Definition of REDFISH_PERF_RECORD. The key string is allocated together
+// with the record and follows it.
+//
+typedef struct {
+  LIST_ENTRY            List;
+  UINT32                Hash;
+  REDFISH_PERF_ENTRY    Entry;
+} REDFISH_PERF_RECORD;
+
+#define REDFISH_PERF_RECORD_FROM_LIST(a)  BASE_CR (a, REDFISH_PERF_RECORD, List)
+
+//
+// Definition of REDFISH_PERF_PRIVATE_DATA
+//
+typedef struct {
+  EFI_HANDLE                     ImageHandle;
+  LIST_ENTRY                     Bucket[REDFISH_PERF_BUCKET_COUNT];
+  UINTN                          RecordCount;
+  EDKII_REDFISH_PERF_PROTOCOL    Protocol;
+} REDFISH_PERF_PRIVATE_DATA;
+
+#define REDFISH_PERF_PRIVATE_FROM_THIS(a)  BASE_CR (a, REDFISH_PERF_PRIVATE_DATA, Protocol)
+
+#endif
@@ -800,12 +800,10 @@ RedfishPlatformConfigGetStatementCommon (
 }
 
 /**
-  Get Redfish value with the given Schema and Configure Language.
+  Convert the current value of HII statement to Redfish value.
 
-  @param[in]   This                Pointer to EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL instance.
-  @param[in]   Schema              The Redfish schema to query.
-  @param[in]   Version             The Redfish version to query.
-  @param[in]   ConfigureLang       The target value which match this configure Language.
+  @param[in]   TargetStatement     Statement private instance which keeps current value.
+  @param[in]   FullSchema          Redfish schema string.
   @param[out]  Value               The returned value.
 
   @retval EFI_SUCCESS              Value is returned successfully.
@@ -813,46 +811,23 @@ RedfishPlatformConfigGetStatementCommon (
 
 **/
 EFI_STATUS
-EFIAPI
-RedfishPlatformConfigProtocolGetValue (
-  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL *This,
-  IN     CHAR8                                  *Schema,
-  IN     CHAR8                                  *Version,
-  IN     EFI_STRING                             ConfigureLang,
-  OUT    EDKII_REDFISH_VALUE                    *Value
+RedfishPlatformConfigStatementToRedfishValue (
+  IN     REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE  *TargetStatement,
+  IN     CHAR8                                      *FullSchema,
+  OUT    EDKII_REDFISH_VALUE                        *Value
   )
 {
   EFI_STATUS                                Status;
-  REDFISH_PLATFORM_CONFIG_PRIVATE           *RedfishPlatformConfigPrivate;
-  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE *TargetStatement;
   EFI_STRING_ID                             StringId;
   EFI_STRING_ID                             *StringIdArray;
-  CHAR8                                     *FullSchema;
-  EFI_STRING                                HiiString;
   UINTN                                     Count;
   UINTN                                     Index;
 
-  if (This == NULL || IS_EMPTY_STRING (Schema) || IS_EMPTY_STRING (Version) || IS_EMPTY_STRING (ConfigureLang) || Value == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
-  RedfishPlatformConfigPrivate = REDFISH_PLATFORM_CONFIG_PRIVATE_FROM_THIS (This);
-  Value->Type = REDFISH_VALUE_TYPE_UNKNOWN;
-  Value->ArrayCount = 0;
+  Status = EFI_SUCCESS;
   Count = 0;
-  FullSchema = NULL;
-  HiiString = NULL;
   StringIdArray = NULL;
-
-  FullSchema = GetFullSchemaString (Schema, Version);
-  if (FullSchema == NULL) {
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  Status = RedfishPlatformConfigGetStatementCommon (RedfishPlatformConfigPrivate, FullSchema, ConfigureLang, &TargetStatement);
-  if (EFI_ERROR (Status)) {
-    goto RELEASE_RESOURCE;
-  }
+  Value->Type = REDFISH_VALUE_TYPE_UNKNOWN;
+  Value->ArrayCount = 0;
 
   switch (TargetStatement->HiiStatement->Operand) {
     case EFI_IFR_ONE_OF_OP:
@@ -860,13 +835,13 @@ RedfishPlatformConfigProtocolGetValue (
       if (StringId == 0) {
         ASSERT (FALSE);
         Status = EFI_DEVICE_ERROR;
-        goto RELEASE_RESOURCE;
+        goto ON_EXIT;
       }
 
       Value->Value.Buffer = HiiGetRedfishAsciiString (TargetStatement->ParentForm->ParentFormset->HiiHandle, FullSchema, StringId);
       if (Value->Value.Buffer == NULL) {
         Status = EFI_OUT_OF_RESOURCES;
-        goto RELEASE_RESOURCE;
+        goto ON_EXIT;
       }
 
       Value->Type = REDFISH_VALUE_TYPE_STRING;
@@ -875,7 +850,7 @@ RedfishPlatformConfigProtocolGetValue (
       if (TargetStatement->HiiStatement->Value.Type != EFI_IFR_TYPE_STRING) {
         ASSERT (FALSE);
         Status = EFI_DEVICE_ERROR;
-        goto RELEASE_RESOURCE;
+        goto ON_EXIT;
       }
 
       Value->Type = REDFISH_VALUE_TYPE_STRING;
@@ -887,14 +862,14 @@ RedfishPlatformConfigProtocolGetValue (
       Status = HiiValueToRedfishNumeric (&TargetStatement->HiiStatement->Value, Value);
       if (EFI_ERROR (Status)) {
         DEBUG ((DEBUG_ERROR, "%a, failed to convert HII value to Redfish value: %r\n", __FUNCTION__, Status));
-        goto RELEASE_RESOURCE;
+        goto ON_EXIT;
       }
       break;
     case EFI_IFR_ACTION_OP:
       if (TargetStatement->HiiStatement->Value.Type != EFI_IFR_TYPE_ACTION) {
         ASSERT (FALSE);
         Status = EFI_DEVICE_ERROR;
-        goto RELEASE_RESOURCE;
+        goto ON_EXIT;
       }
 
       //
@@ -907,14 +882,14 @@ RedfishPlatformConfigProtocolGetValue (
       if (StringIdArray == NULL) {
         ASSERT (FALSE);
         Status = EFI_DEVICE_ERROR;
-        goto RELEASE_RESOURCE;
+        goto ON_EXIT;
       }
 
       Value->Value.StringArray = AllocatePool (sizeof (CHAR8 *) * Count);
       if (Value->Value.StringArray == NULL) {
         ASSERT (FALSE);
         Status = EFI_OUT_OF_RESOURCES;
-        goto RELEASE_RESOURCE;
+        goto ON_EXIT;
       }
 
       for (Index = 0; Index < Count; Index++) {
@@ -929,23 +904,77 @@ RedfishPlatformConfigProtocolGetValue (
       DEBUG ((DEBUG_ERROR, "%a, catch unsupported type: 0x%x! Please contact with author if we need to support this type.\n", __FUNCTION__, TargetStatement->HiiStatement->Operand));
       ASSERT (FALSE);
       Status = EFI_UNSUPPORTED;
-      goto RELEASE_RESOURCE;
+      goto ON_EXIT;
   }
 
-RELEASE_RESOURCE:
+ON_EXIT:
 
-  if (FullSchema != NULL) {
-    FreePool (FullSchema);
+  if (StringIdArray != NULL) {
+    FreePool (StringIdArray);
   }
 
-  if (HiiString != NULL) {
-    FreePool (HiiString);
+  return Status;
+}
+
+/**
+  Get Redfish value with the given Schema and Configure Language.
+
+  @param[in]   This                Pointer to EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL instance.
+  @param[in]   Schema              The Redfish schema to query.
+  @param[in]   Version             The Redfish version to query.
+  @param[in]   ConfigureLang       The target value which match this configure Language.
+  @param[out]  Value               The returned value.
+
+  @retval EFI_SUCCESS              Value is returned successfully.
+  @retval Others                   Some error happened.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishPlatformConfigProtocolGetValue (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL *This,
+  IN     CHAR8                                  *Schema,
+  IN     CHAR8                                  *Version,
+  IN     EFI_STRING                             ConfigureLang,
+  OUT    EDKII_REDFISH_VALUE                    *Value
+  )
+{
+  EFI_STATUS                                Status;
+  REDFISH_PLATFORM_CONFIG_PRIVATE           *RedfishPlatformConfigPrivate;
+  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE *TargetStatement;
+  CHAR8                                     *FullSchema;
+  UINT64                                    StartTick;
+
+  if (This == NULL || IS_EMPTY_STRING (Schema) || IS_EMPTY_STRING (Version) || IS_EMPTY_STRING (ConfigureLang) || Value == NULL) {
+    return EFI_INVALID_PARAMETER;
   }
 
-  if (StringIdArray != NULL) {
-    FreePool (StringIdArray);
+  StartTick = RedfishPerfStart ();
+  RedfishPlatformConfigPrivate = REDFISH_PLATFORM_CONFIG_PRIVATE_FROM_THIS (This);
+  Value->Type = REDFISH_VALUE_TYPE_UNKNOWN;
+  Value->ArrayCount = 0;
+  FullSchema = NULL;
+
+  FullSchema = GetFullSchemaString (Schema, Version);
+  if (FullSchema == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = RedfishPlatformConfigGetStatementCommon (RedfishPlatformConfigPrivate, FullSchema, ConfigureLang, &TargetStatement);
+  if (EFI_ERROR (Status)) {
+    goto RELEASE_RESOURCE;
+  }
+
+  Status = RedfishPlatformConfigStatementToRedfishValue (TargetStatement, FullSchema, Value);
+
+RELEASE_RESOURCE:
+
+  if (FullSchema != NULL) {
+    FreePool (FullSchema);
   }
 
+  RedfishPerfEnd (RedfishPerfHiiGet, Schema, StartTick, 1, 0, EFI_ERROR (Status));
+
   return Status;
 }
 
@@ -996,52 +1025,33 @@ RedfishPlatformConfigSaveQuestionValue (
 }
 
 /**
-  Common implementation to set statement private instance.
+  Patch the value from Redfish to the value type of HII statement.
 
-  @param[in]   RedfishPlatformConfigPrivate   Private instance.
-  @param[in]   Schema                         Redfish schema string.
-  @param[in]   ConfigureLang                  Configure language that refers to this statement.
-  @param[in]   Statement                      Statement instance
+  @param[in]      TargetStatement   Statement private instance.
+  @param[in]      Schema            Redfish schema string.
+  @param[in,out]  StatementValue    Value to be patched.
 
-  @retval EFI_SUCCESS       HII value is returned successfully.
+  @retval EFI_SUCCESS       HII value is patched successfully.
   @retval Others            Errors occur
 
 **/
 EFI_STATUS
-RedfishPlatformConfigSetStatementCommon (
-  IN     REDFISH_PLATFORM_CONFIG_PRIVATE  *RedfishPlatformConfigPrivate,
-  IN     CHAR8                            *Schema,
-  IN     EFI_STRING                       ConfigureLang,
-  IN     HII_STATEMENT_VALUE              *StatementValue
+RedfishPlatformConfigConvertStatementValue (
+  IN     REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE  *TargetStatement,
+  IN     CHAR8                                      *Schema,
+  IN OUT HII_STATEMENT_VALUE                        *StatementValue
   )
 {
   EFI_STATUS                                Status;
-  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE *TargetStatement;
   EFI_STRING                                TempBuffer;
   UINT8                                     *StringArray;
   UINTN                                     Index;
   UINT64                                    Value;
   CHAR8                                     **CharArray;
 
-  if (RedfishPlatformConfigPrivate == NULL || IS_EMPTY_STRING (Schema) || IS_EMPTY_STRING (ConfigureLang) || StatementValue == NULL) {
-    return EFI_INVALID_PARAMETER;
-  }
-
   TempBuffer = NULL;
   StringArray = NULL;
 
-  Status = ProcessPendingList (&RedfishPlatformConfigPrivate->FormsetList, &RedfishPlatformConfigPrivate->PendingList);
-  if (EFI_ERROR (Status)) {
-    DEBUG ((DEBUG_ERROR, "%a, ProcessPendingList failure: %r\n", __FUNCTION__, Status));
-    return Status;
-  }
-
-  TargetStatement = GetStatementPrivateByConfigureLang (&RedfishPlatformConfigPrivate->FormsetList, Schema, ConfigureLang);
-  if (TargetStatement == NULL) {
-    DEBUG ((DEBUG_ERROR, "%a, No match HII statement is found by the given %s in schema %a\n", __FUNCTION__, ConfigureLang, Schema));
-    return EFI_NOT_FOUND;
-  }
-
   if (StatementValue->Type != TargetStatement->HiiStatement->Value.Type) {
     //
     // We treat one-of type as string in Redfish. But one-of statement is not
@@ -1110,6 +1120,53 @@ RedfishPlatformConfigSetStatementCommon (
     }
   }
 
+  return EFI_SUCCESS;
+}
+
+/**
+  Common implementation to set statement private instance.
+
+  @param[in]   RedfishPlatformConfigPrivate   Private instance.
+  @param[in]   Schema                         Redfish schema string.
+  @param[in]   ConfigureLang                  Configure language that refers to this statement.
+  @param[in]   Statement                      Statement instance
+
+  @retval EFI_SUCCESS       HII value is returned successfully.
+  @retval Others            Errors occur
+
+**/
+EFI_STATUS
+RedfishPlatformConfigSetStatementCommon (
+  IN     REDFISH_PLATFORM_CONFIG_PRIVATE  *RedfishPlatformConfigPrivate,
+  IN     CHAR8                            *Schema,
+  IN     EFI_STRING                       ConfigureLang,
+  IN     HII_STATEMENT_VALUE              *StatementValue
+  )
+{
+  EFI_STATUS                                Status;
+  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE *TargetStatement;
+
+  if (RedfishPlatformConfigPrivate == NULL || IS_EMPTY_STRING (Schema) || IS_EMPTY_STRING (ConfigureLang) || StatementValue == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Status = ProcessPendingList (&RedfishPlatformConfigPrivate->FormsetList, &RedfishPlatformConfigPrivate->PendingList);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, ProcessPendingList failure: %r\n", __FUNCTION__, Status));
+    return Status;
+  }
+
+  TargetStatement = GetStatementPrivateByConfigureLang (&RedfishPlatformConfigPrivate->FormsetList, Schema, ConfigureLang);
+  if (TargetStatement == NULL) {
+    DEBUG ((DEBUG_ERROR, "%a, No match HII statement is found by the given %s in schema %a\n", __FUNCTION__, ConfigureLang, Schema));
+    return EFI_NOT_FOUND;
+  }
+
+  Status = RedfishPlatformConfigConvertStatementValue (TargetStatement, Schema, StatementValue);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   Status = RedfishPlatformConfigSaveQuestionValue (
              TargetStatement->ParentForm->ParentFormset->HiiFormSet,
              TargetStatement->ParentForm->HiiForm,
@@ -1124,6 +1181,57 @@ RedfishPlatformConfigSetStatementCommon (
   return EFI_SUCCESS;
 }
 
+/**
+  Convert Redfish value to the value in HII statement format.
+
+  @param[in]   Value               Redfish value.
+  @param[out]  NewValue            Value in HII statement format.
+
+  @retval EFI_SUCCESS       Value is converted successfully.
+  @retval Others            Errors occur
+
+**/
+EFI_STATUS
+RedfishValueToHiiStatementValue (
+  IN     EDKII_REDFISH_VALUE  *Value,
+  OUT    HII_STATEMENT_VALUE  *NewValue
+  )
+{
+  EFI_STATUS  Status;
+
+  Status = EFI_SUCCESS;
+  ZeroMem (NewValue, sizeof (HII_STATEMENT_VALUE));
+
+  switch (Value->Type) {
+    case REDFISH_VALUE_TYPE_INTEGER:
+    case REDFISH_VALUE_TYPE_BOOLEAN:
+      Status = RedfishNumericToHiiValue (Value, NewValue);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_ERROR, "%a, failed to convert Redfish value to Hii value: %r\n", __FUNCTION__, Status));
+        return Status;
+      }
+      break;
+    case REDFISH_VALUE_TYPE_STRING:
+      NewValue->Type = EFI_IFR_TYPE_STRING;
+      NewValue->BufferLen = (UINT16)AsciiStrSize (Value->Value.Buffer);
+      NewValue->Buffer = AllocateCopyPool (NewValue->BufferLen, Value->Value.Buffer);
+      if (NewValue->Buffer == NULL) {
+        return EFI_OUT_OF_RESOURCES;
+      }
+      break;
+    case REDFISH_VALUE_TYPE_STRING_ARRAY:
+      NewValue->Type = EFI_IFR_TYPE_STRING;
+      NewValue->BufferLen = (UINT16)Value->ArrayCount;
+      NewValue->Buffer = (UINT8 *)Value->Value.StringArray;
+      break;
+    default:
+      ASSERT (FALSE);
+      break;
+  }
+
+  return Status;
+}
+
 /**
   Set Redfish value with the given Schema and Configure Language.
 
@@ -1151,6 +1259,7 @@ RedfishPlatformConfigProtocolSetValue (
   REDFISH_PLATFORM_CONFIG_PRIVATE           *RedfishPlatformConfigPrivate;
   CHAR8                                     *FullSchema;
   HII_STATEMENT_VALUE                       NewValue;
+  UINT64                                    StartTick;
 
   if (This == NULL || IS_EMPTY_STRING (Schema) || IS_EMPTY_STRING (Version) || IS_EMPTY_STRING (ConfigureLang)) {
     return EFI_INVALID_PARAMETER;
@@ -1160,6 +1269,7 @@ RedfishPlatformConfigProtocolSetValue (
     return EFI_INVALID_PARAMETER;
   }
 
+  StartTick = RedfishPerfStart ();
   RedfishPlatformConfigPrivate = REDFISH_PLATFORM_CONFIG_PRIVATE_FROM_THIS (This);
   FullSchema = NULL;
 
@@ -1168,34 +1278,9 @@ RedfishPlatformConfigProtocolSetValue (
     return EFI_OUT_OF_RESOURCES;
   }
 
-  ZeroMem (&NewValue, sizeof (HII_STATEMENT_VALUE));
-
-  switch (Value.Type) {
-    case REDFISH_VALUE_TYPE_INTEGER:
-    case REDFISH_VALUE_TYPE_BOOLEAN:
-      Status = RedfishNumericToHiiValue (&Value, &NewValue);
-      if (EFI_ERROR (Status)) {
-        DEBUG ((DEBUG_ERROR, "%a, failed to convert Redfish value to Hii value: %r\n", __FUNCTION__, Status));
-        goto RELEASE_RESOURCE;
-      }
-      break;
-    case REDFISH_VALUE_TYPE_STRING:
-      NewValue.Type = EFI_IFR_TYPE_STRING;
-      NewValue.BufferLen = (UINT16)AsciiStrSize (Value.Value.Buffer);
-      NewValue.Buffer = AllocateCopyPool (NewValue.BufferLen, Value.Value.Buffer);
-      if (NewValue.Buffer == NULL) {
-        Status = EFI_OUT_OF_RESOURCES;
-        goto RELEASE_RESOURCE;
-      }
-      break;
-    case REDFISH_VALUE_TYPE_STRING_ARRAY:
-      NewValue.Type = EFI_IFR_TYPE_STRING;
-      NewValue.BufferLen = (UINT16)Value.ArrayCount;
-      NewValue.Buffer = (UINT8 *)Value.Value.StringArray;
-      break;
-    default:
-      ASSERT (FALSE);
-      break;
+  Status = RedfishValueToHiiStatementValue (&Value, &NewValue);
+  if (EFI_ERROR (Status)) {
+    goto RELEASE_RESOURCE;
   }
 
   Status = RedfishPlatformConfigSetStatementCommon (RedfishPlatformConfigPrivate, FullSchema, ConfigureLang, &NewValue);
@@ -1209,6 +1294,8 @@ RELEASE_RESOURCE:
     FreePool (FullSchema);
   }
 
+  RedfishPerfEnd (RedfishPerfHiiSet, Schema, StartTick, 1, 0, EFI_ERROR (Status));
+
   return Status;
 }
 
@@ -1242,7 +1329,6 @@ RedfishPlatformConfigProtocolGetConfigureLang (
   REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE_LIST  StatementList;
   REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE_REF   *StatementRef;
   LIST_ENTRY                                      *NextLink;
-  EFI_STRING                                      TmpString;
   EFI_STRING                                      *TmpConfigureLangList;
   UINTN                                           Index;
   CHAR8                                           *FullSchema;
@@ -1269,6 +1355,7 @@ RedfishPlatformConfigProtocolGetConfigureLang (
 
   Status = GetStatementPrivateByConfigureLangRegex (
              RedfishPlatformConfigPrivate->RegularExpressionProtocol,
+             RedfishPlatformConfigPrivate->RegularExpressionExProtocol,
              &RedfishPlatformConfigPrivate->FormsetList,
              FullSchema,
              RegexPattern,
@@ -1293,16 +1380,14 @@ RedfishPlatformConfigProtocolGetConfigureLang (
       StatementRef = REDFISH_PLATFORM_CONFIG_STATEMENT_REF_FROM_LINK (NextLink);
       NextLink = GetNextNode (&StatementList.StatementList, NextLink);
 
-      ASSERT (StatementRef->Statement->Description != 0);
-      if (StatementRef->Statement->Description != 0) {
-        TmpString = HiiGetRedfishString (StatementRef->Statement->ParentForm->ParentFormset->HiiHandle, FullSchema, StatementRef->Statement->Description);
-        ASSERT (TmpString != NULL);
-        if (TmpString != NULL) {
-          TmpConfigureLangList[Index] = AllocateCopyPool (StrSize (TmpString), TmpString);
-          ASSERT (TmpConfigureLangList[Index] != NULL);
-          FreePool (TmpString);
-          ++Index;
-        }
+      //
+      // Configure language is kept in index, no need to retrieve it from HII database again.
+      //
+      ASSERT (StatementRef->ConfigureLang != NULL);
+      if (StatementRef->ConfigureLang != NULL) {
+        TmpConfigureLangList[Index] = AllocateCopyPool (StrSize (StatementRef->ConfigureLang), StatementRef->ConfigureLang);
+        ASSERT (TmpConfigureLangList[Index] != NULL);
+        ++Index;
       }
     }
   }
@@ -1433,6 +1518,368 @@ RedfishPlatformConfigProtocolGetSupportedSchema (
   return EFI_SUCCESS;
 }
 
+/**
+  Get full schema string of the given value entry. The full schema string of
+  previous entry is reused when the entries have the same schema and version.
+
+  @param[in]      Entry            Value entry.
+  @param[in,out]  LastEntry        The entry which FullSchema belongs to.
+  @param[in,out]  FullSchema       Full schema string. Caller is responsible to release it.
+
+  @retval EFI_SUCCESS              FullSchema is returned successfully.
+  @retval EFI_INVALID_PARAMETER    Schema or version of Entry is empty.
+  @retval EFI_OUT_OF_RESOURCES     System is out of memory.
+
+**/
+EFI_STATUS
+RedfishPlatformConfigGetEntryFullSchema (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *Entry,
+  IN OUT EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  **LastEntry,
+  IN OUT CHAR8                                      **FullSchema
+  )
+{
+  if (IS_EMPTY_STRING (Entry->Schema) || IS_EMPTY_STRING (Entry->Version) || IS_EMPTY_STRING (Entry->ConfigureLang)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (*FullSchema != NULL && *LastEntry != NULL &&
+      AsciiStrCmp ((*LastEntry)->Schema, Entry->Schema) == 0 &&
+      AsciiStrCmp ((*LastEntry)->Version, Entry->Version) == 0) {
+    return EFI_SUCCESS;
+  }
+
+  if (*FullSchema != NULL) {
+    FreePool (*FullSchema);
+  }
+
+  *LastEntry = Entry;
+  *FullSchema = GetFullSchemaString (Entry->Schema, Entry->Version);
+  if (*FullSchema == NULL) {
+    *LastEntry = NULL;
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Get Redfish values with the given list of Schema and Configure Language. All
+  entries are resolved in one pass. The result of each entry is returned in its
+  Status field.
+
+  @param[in]      This             Pointer to EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL instance.
+  @param[in]      Count            The number of entries in ValueList.
+  @param[in,out]  ValueList        The list of Schema, Version and Configure Language to query.
+                                   Value and Status of each entry are returned.
+
+  @retval EFI_SUCCESS              All values are returned successfully.
+  @retval Others                   Some error happened. Check Status of each entry.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishPlatformConfigProtocolGetValues (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL     *This,
+  IN     UINTN                                      Count,
+  IN OUT EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *ValueList
+  )
+{
+  EFI_STATUS                                 Status;
+  EFI_STATUS                                 ReturnStatus;
+  REDFISH_PLATFORM_CONFIG_PRIVATE            *RedfishPlatformConfigPrivate;
+  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE  *TargetStatement;
+  EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *Entry;
+  EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *LastEntry;
+  CHAR8                                      *FullSchema;
+  UINTN                                      Index;
+  UINT64                                     StartTick;
+
+  if (This == NULL || Count == 0 || ValueList == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  StartTick = RedfishPerfStart ();
+
+  RedfishPlatformConfigPrivate = REDFISH_PLATFORM_CONFIG_PRIVATE_FROM_THIS (This);
+  FullSchema = NULL;
+  LastEntry = NULL;
+  ReturnStatus = EFI_SUCCESS;
+
+  Status = ProcessPendingList (&RedfishPlatformConfigPrivate->FormsetList, &RedfishPlatformConfigPrivate->PendingList);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, ProcessPendingList failure: %r\n", __FUNCTION__, Status));
+    return Status;
+  }
+
+  for (Index = 0; Index < Count; Index++) {
+    Entry = &ValueList[Index];
+    Entry->Value.Type = REDFISH_VALUE_TYPE_UNKNOWN;
+    Entry->Value.ArrayCount = 0;
+
+    Status = RedfishPlatformConfigGetEntryFullSchema (Entry, &LastEntry, &FullSchema);
+    if (EFI_ERROR (Status)) {
+      goto NEXT_ENTRY;
+    }
+
+    TargetStatement = GetStatementPrivateByConfigureLang (&RedfishPlatformConfigPrivate->FormsetList, FullSchema, Entry->ConfigureLang);
+    if (TargetStatement == NULL) {
+      DEBUG ((DEBUG_ERROR, "%a, No match HII statement is found by the given %s in schema %a\n", __FUNCTION__, Entry->ConfigureLang, FullSchema));
+      Status = EFI_NOT_FOUND;
+      goto NEXT_ENTRY;
+    }
+
+    //
+    // Find current HII question value.
+    //
+    Status = GetQuestionValue (
+               TargetStatement->ParentForm->ParentFormset->HiiFormSet,
+               TargetStatement->ParentForm->HiiForm,
+               TargetStatement->HiiStatement,
+               GetSetValueWithHiiDriver
+               );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a, failed to get question current value of %s: %r\n", __FUNCTION__, Entry->ConfigureLang, Status));
+      goto NEXT_ENTRY;
+    }
+
+    if (TargetStatement->HiiStatement->Value.Type == EFI_IFR_TYPE_UNDEFINED) {
+      Status = EFI_DEVICE_ERROR;
+      goto NEXT_ENTRY;
+    }
+
+    Status = RedfishPlatformConfigStatementToRedfishValue (TargetStatement, FullSchema, &Entry->Value);
+
+NEXT_ENTRY:
+
+    Entry->Status = Status;
+    if (EFI_ERROR (Status)) {
+      ReturnStatus = Status;
+    }
+  }
+
+  if (FullSchema != NULL) {
+    FreePool (FullSchema);
+  }
+
+  //
+  // The batch is measured as a whole, and recorded with the schema of first entry.
+  //
+  RedfishPerfEnd (RedfishPerfHiiGet, ValueList[0].Schema != NULL ? ValueList[0].Schema : "Unknown", StartTick, Count, 0, EFI_ERROR (ReturnStatus));
+
+  return ReturnStatus;
+}
+
+/**
+  Save the value of given entry to the HII statement in memory. The value is
+  not submitted to HII driver.
+
+  @param[in]   RedfishPlatformConfigPrivate   Private instance.
+  @param[in]   FullSchema                     Redfish schema string.
+  @param[in]   Entry                          Value entry to set.
+  @param[out]  Statement                      Statement which keeps new value.
+
+  @retval EFI_SUCCESS       HII value is saved successfully.
+  @retval Others            Errors occur
+
+**/
+EFI_STATUS
+RedfishPlatformConfigSaveEntryValue (
+  IN     REDFISH_PLATFORM_CONFIG_PRIVATE            *RedfishPlatformConfigPrivate,
+  IN     CHAR8                                      *FullSchema,
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *Entry,
+  OUT    REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE  **Statement
+  )
+{
+  EFI_STATUS                                Status;
+  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE *TargetStatement;
+  HII_STATEMENT_VALUE                       NewValue;
+
+  *Statement = NULL;
+
+  if (Entry->Value.Type == REDFISH_VALUE_TYPE_UNKNOWN || Entry->Value.Type >= REDFISH_VALUE_TYPE_MAX) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  TargetStatement = GetStatementPrivateByConfigureLang (&RedfishPlatformConfigPrivate->FormsetList, FullSchema, Entry->ConfigureLang);
+  if (TargetStatement == NULL) {
+    DEBUG ((DEBUG_ERROR, "%a, No match HII statement is found by the given %s in schema %a\n", __FUNCTION__, Entry->ConfigureLang, FullSchema));
+    return EFI_NOT_FOUND;
+  }
+
+  Status = RedfishValueToHiiStatementValue (&Entry->Value, &NewValue);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = RedfishPlatformConfigConvertStatementValue (TargetStatement, FullSchema, &NewValue);
+  if (!EFI_ERROR (Status)) {
+    Status = SetQuestionValue (
+               TargetStatement->ParentForm->ParentFormset->HiiFormSet,
+               TargetStatement->ParentForm->HiiForm,
+               TargetStatement->HiiStatement,
+               &NewValue
+               );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a, failed to set question value of %s: %r\n", __FUNCTION__, Entry->ConfigureLang, Status));
+    }
+  }
+
+  //
+  // The string array belongs to caller. Other buffers are allocated in conversion.
+  //
+  if (NewValue.Buffer != NULL && NewValue.Buffer != (UINT8 *)Entry->Value.Value.StringArray) {
+    FreePool (NewValue.Buffer);
+  }
+
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  *Statement = TargetStatement;
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Set Redfish values with the given list of Schema and Configure Language. All
+  entries are resolved in one pass, and the changes on the same HII storage are
+  submitted to the configuration driver together. The result of each entry is
+  returned in its Status field.
+
+  @param[in]      This             Pointer to EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL instance.
+  @param[in]      Count            The number of entries in ValueList.
+  @param[in,out]  ValueList        The list of Schema, Version, Configure Language and value to set.
+                                   Status of each entry is returned.
+
+  @retval EFI_SUCCESS              All values are set successfully.
+  @retval Others                   Some error happened. Check Status of each entry.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishPlatformConfigProtocolSetValues (
+  IN     EDKII_REDFISH_PLATFORM_CONFIG_PROTOCOL     *This,
+  IN     UINTN                                      Count,
+  IN OUT EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *ValueList
+  )
+{
+  EFI_STATUS                                 Status;
+  EFI_STATUS                                 ReturnStatus;
+  REDFISH_PLATFORM_CONFIG_PRIVATE            *RedfishPlatformConfigPrivate;
+  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE  **StatementList;
+  REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE   *FormsetPrivate;
+  HII_FORM                                   **HiiFormList;
+  HII_STATEMENT                              **HiiStatementList;
+  UINTN                                      *EntryIndexList;
+  EDKII_REDFISH_PLATFORM_CONFIG_VALUE_ENTRY  *LastEntry;
+  CHAR8                                      *FullSchema;
+  UINTN                                      SubmitCount;
+  UINTN                                      Index;
+  UINTN                                      Index2;
+  UINT64                                     StartTick;
+
+  if (This == NULL || Count == 0 || ValueList == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  StartTick = RedfishPerfStart ();
+
+  RedfishPlatformConfigPrivate = REDFISH_PLATFORM_CONFIG_PRIVATE_FROM_THIS (This);
+  FullSchema = NULL;
+  LastEntry = NULL;
+  ReturnStatus = EFI_SUCCESS;
+
+  Status = ProcessPendingList (&RedfishPlatformConfigPrivate->FormsetList, &RedfishPlatformConfigPrivate->PendingList);
+  if (EFI_ERROR (Status)) {
+    DEBUG ((DEBUG_ERROR, "%a, ProcessPendingList failure: %r\n", __FUNCTION__, Status));
+    return Status;
+  }
+
+  StatementList = AllocateZeroPool (sizeof (REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE *) * Count);
+  HiiFormList = AllocatePool (sizeof (HII_FORM *) * Count);
+  HiiStatementList = AllocatePool (sizeof (HII_STATEMENT *) * Count);
+  EntryIndexList = AllocatePool (sizeof (UINTN) * Count);
+  if (StatementList == NULL || HiiFormList == NULL || HiiStatementList == NULL || EntryIndexList == NULL) {
+    ReturnStatus = EFI_OUT_OF_RESOURCES;
+    goto RELEASE_RESOURCE;
+  }
+
+  //
+  // Resolve all entries and keep new values in memory.
+  //
+  for (Index = 0; Index < Count; Index++) {
+    Status = RedfishPlatformConfigGetEntryFullSchema (&ValueList[Index], &LastEntry, &FullSchema);
+    if (!EFI_ERROR (Status)) {
+      Status = RedfishPlatformConfigSaveEntryValue (RedfishPlatformConfigPrivate, FullSchema, &ValueList[Index], &StatementList[Index]);
+    }
+
+    ValueList[Index].Status = Status;
+    if (EFI_ERROR (Status)) {
+      ReturnStatus = Status;
+    }
+  }
+
+  //
+  // Submit new values formset by formset. The values on the same storage
+  // are routed to HII driver at once.
+  //
+  for (Index = 0; Index < Count; Index++) {
+    if (StatementList[Index] == NULL) {
+      continue;
+    }
+
+    FormsetPrivate = StatementList[Index]->ParentForm->ParentFormset;
+    SubmitCount = 0;
+    for (Index2 = Index; Index2 < Count; Index2++) {
+      if (StatementList[Index2] == NULL || StatementList[Index2]->ParentForm->ParentFormset != FormsetPrivate) {
+        continue;
+      }
+
+      HiiFormList[SubmitCount] = StatementList[Index2]->ParentForm->HiiForm;
+      HiiStatementList[SubmitCount] = StatementList[Index2]->HiiStatement;
+      EntryIndexList[SubmitCount] = Index2;
+      StatementList[Index2] = NULL;
+      ++SubmitCount;
+    }
+
+    Status = SubmitQuestions (FormsetPrivate->HiiFormSet, HiiFormList, HiiStatementList, SubmitCount);
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a, failed to submit %d values in formset %g: %r\n", __FUNCTION__, SubmitCount, &FormsetPrivate->Guid, Status));
+      for (Index2 = 0; Index2 < SubmitCount; Index2++) {
+        ValueList[EntryIndexList[Index2]].Status = Status;
+      }
+
+      ReturnStatus = Status;
+    }
+  }
+
+RELEASE_RESOURCE:
+
+  if (FullSchema != NULL) {
+    FreePool (FullSchema);
+  }
+
+  if (StatementList != NULL) {
+    FreePool (StatementList);
+  }
+
+  if (HiiFormList != NULL) {
+    FreePool (HiiFormList);
+  }
+
+  if (HiiStatementList != NULL) {
+    FreePool (HiiStatementList);
+  }
+
+  if (EntryIndexList != NULL) {
+    FreePool (EntryIndexList);
+  }
+
+  RedfishPerfEnd (RedfishPerfHiiSet, ValueList[0].Schema != NULL ? ValueList[0].Schema : "Unknown", StartTick, Count, 0, EFI_ERROR (ReturnStatus));
+
+  return ReturnStatus;
+}
+
 /**
   Functions which are registered to receive notification of
   database events have this prototype. The actual event is encoded
@@ -1620,6 +2067,18 @@ RegexProtocolInstalled (
     return;
   }
 
+  //
+  // The extended protocol is optional, MatchString() is used without it.
+  //
+  Status = gBS->LocateProtocol (
+                  &gEdkiiRegularExpressionExProtocolGuid,
+                  NULL,
+                  (VOID **)&mRedfishPlatformConfigPrivate->RegularExpressionExProtocol
+                  );
+  if (EFI_ERROR (Status)) {
+    mRedfishPlatformConfigPrivate->RegularExpressionExProtocol = NULL;
+  }
+
   gBS->CloseEvent (Event);
   mRedfishPlatformConfigPrivate->RegexNotify.ProtocolEvent = NULL;
 
@@ -1719,6 +2178,8 @@ RedfishPlatformConfigDxeEntryPoint (
   mRedfishPlatformConfigPrivate->Protocol.SetValue = RedfishPlatformConfigProtocolSetValue;
   mRedfishPlatformConfigPrivate->Protocol.GetConfigureLang = RedfishPlatformConfigProtocolGetConfigureLang;
   mRedfishPlatformConfigPrivate->Protocol.GetSupportedSchema = RedfishPlatformConfigProtocolGetSupportedSchema;
+  mRedfishPlatformConfigPrivate->Protocol.GetValues = RedfishPlatformConfigProtocolGetValues;
+  mRedfishPlatformConfigPrivate->Protocol.SetValues = RedfishPlatformConfigProtocolSetValues;
 
   InitializeListHead (&mRedfishPlatformConfigPrivate->FormsetList);
   InitializeListHead (&mRedfishPlatformConfigPrivate->PendingList);
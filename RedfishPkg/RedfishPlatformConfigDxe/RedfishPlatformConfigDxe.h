@@ -20,6 +20,7 @@
 #include <Library/DebugLib.h>
 #include <Library/MemoryAllocationLib.h>
 #include <Library/PrintLib.h>
+#include <Library/RedfishPerfLib.h>
 #include <Library/UefiLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiDriverEntryPoint.h>
@@ -31,6 +32,7 @@
 #include <Protocol/HiiDatabase.h>
 #include <Protocol/HiiString.h>
 #include <Protocol/RegularExpressionProtocol.h>
+#include <Protocol/RegularExpressionEx.h>
 
 //
 // Definition of EDKII_REDFISH_PLATFORM_CONFIG_NOTIFY.
@@ -52,6 +54,7 @@ typedef struct {
   EFI_HII_STRING_PROTOCOL                   *HiiString;                 // HII String Protocol.
   REDFISH_PLATFORM_CONFIG_NOTIFY            RegexNotify;
   EFI_REGULAR_EXPRESSION_PROTOCOL           *RegularExpressionProtocol; // Regular Expression Protocol.
+  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL      *RegularExpressionExProtocol; // Regular Expression Extended Protocol, optional.
   EFI_HANDLE                                NotifyHandle;               // The notify handle.
   LIST_ENTRY                                FormsetList;                // The list to keep cached HII formset.
   LIST_ENTRY                                PendingList;                // The list to keep updated HII handle.
@@ -424,11 +424,434 @@ GetSupportedSchema (
   return EFI_SUCCESS;
 }
 
+/**
+  Calculate the hash value of configure language.
+
+  @param[in]  ConfigureLang   Configure language.
+
+  @retval UINT32              Hash value of ConfigureLang.
+
+**/
+UINT32
+ConfigureLangHash (
+  IN  EFI_STRING  ConfigureLang
+  )
+{
+  UINT32  Hash;
+
+  //
+  // FNV-1a
+  //
+  Hash = 2166136261U;
+  while (*ConfigureLang != L'\0') {
+    Hash ^= (UINT32)*ConfigureLang;
+    Hash *= 16777619U;
+    ConfigureLang++;
+  }
+
+  return Hash;
+}
+
+/**
+  Compare two configure language index entries for sorting.
+
+  @param[in]  Buffer1   Pointer to the pointer of first index entry.
+  @param[in]  Buffer2   Pointer to the pointer of second index entry.
+
+  @retval 0             Configure languages are identical.
+  @retval <0            First configure language is less than second one.
+  @retval >0            First configure language is greater than second one.
+
+**/
+INTN
+EFIAPI
+CompareConfigureLangIndexEntry (
+  IN CONST VOID  *Buffer1,
+  IN CONST VOID  *Buffer2
+  )
+{
+  return StrCmp (
+           (*(REDFISH_PLATFORM_CONFIG_INDEX_ENTRY **)Buffer1)->ConfigureLang,
+           (*(REDFISH_PLATFORM_CONFIG_INDEX_ENTRY **)Buffer2)->ConfigureLang
+           );
+}
+
+/**
+  Release configure language index of all schema in formset.
+
+  @param[in]  FormsetPrivate  Formset private instance.
+
+**/
+VOID
+ReleaseConfigureLangIndex (
+  IN  REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *FormsetPrivate
+  )
+{
+  UINTN                          SchemaIndex;
+  UINTN                          Index;
+  REDFISH_PLATFORM_CONFIG_INDEX  *ConfigureLangIndex;
+
+  if (FormsetPrivate == NULL || FormsetPrivate->ConfigureLangIndex == NULL) {
+    return;
+  }
+
+  for (SchemaIndex = 0; SchemaIndex < FormsetPrivate->SupportedSchema.Count; SchemaIndex++) {
+    ConfigureLangIndex = &FormsetPrivate->ConfigureLangIndex[SchemaIndex];
+
+    if (ConfigureLangIndex->EntryList != NULL) {
+      for (Index = 0; Index < ConfigureLangIndex->Count; Index++) {
+        FreePool (ConfigureLangIndex->EntryList[Index].ConfigureLang);
+      }
+
+      FreePool (ConfigureLangIndex->EntryList);
+    }
+
+    if (ConfigureLangIndex->Bucket != NULL) {
+      FreePool (ConfigureLangIndex->Bucket);
+    }
+
+    if (ConfigureLangIndex->SortedList != NULL) {
+      FreePool (ConfigureLangIndex->SortedList);
+    }
+  }
+
+  FreePool (FormsetPrivate->ConfigureLangIndex);
+  FormsetPrivate->ConfigureLangIndex = NULL;
+}
+
+/**
+  Get configure language index of given schema in formset.
+
+  @param[in]  FormsetPrivate  Formset private instance.
+  @param[in]  Schema          Schema to be matched.
+
+  @retval REDFISH_PLATFORM_CONFIG_INDEX *   Pointer to index. NULL if schema is not supported.
+
+**/
+REDFISH_PLATFORM_CONFIG_INDEX *
+GetConfigureLangIndex (
+  IN  REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *FormsetPrivate,
+  IN  CHAR8                                     *Schema
+  )
+{
+  UINTN  Index;
+
+  if (FormsetPrivate->ConfigureLangIndex == NULL) {
+    return NULL;
+  }
+
+  for (Index = 0; Index < FormsetPrivate->SupportedSchema.Count; Index++) {
+    if (AsciiStrCmp (FormsetPrivate->SupportedSchema.SchemaList[Index], Schema) == 0) {
+      return &FormsetPrivate->ConfigureLangIndex[Index];
+    }
+  }
+
+  return NULL;
+}
+
+/**
+  Find the form in previous formset whose configure languages can be reused
+  by the form with given form ID. The form can be reused when its IFR is not
+  changed since previous formset is loaded.
+
+  @param[in]  PreviousFormset     Previous formset of the same HII handle.
+  @param[in]  UpdatedFormIdList   The forms which are changed since previous formset is loaded.
+  @param[in]  UpdatedFormIdCount  Number of form ID in UpdatedFormIdList.
+  @param[in]  FormId              Form ID to search.
+
+  @retval REDFISH_PLATFORM_CONFIG_FORM_PRIVATE *  Pointer to form in previous formset.
+  @retval NULL                                    There is no form to reuse.
+
+**/
+REDFISH_PLATFORM_CONFIG_FORM_PRIVATE *
+GetReusableForm (
+  IN  REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *PreviousFormset OPTIONAL,
+  IN  UINT16                                    *UpdatedFormIdList OPTIONAL,
+  IN  UINTN                                     UpdatedFormIdCount,
+  IN  UINT16                                    FormId
+  )
+{
+  LIST_ENTRY                            *HiiFormLink;
+  REDFISH_PLATFORM_CONFIG_FORM_PRIVATE  *HiiFormPrivate;
+  UINTN                                 Index;
+
+  if (PreviousFormset == NULL) {
+    return NULL;
+  }
+
+  for (Index = 0; Index < UpdatedFormIdCount; Index++) {
+    if (UpdatedFormIdList[Index] == FormId) {
+      return NULL;
+    }
+  }
+
+  HiiFormLink = GetFirstNode (&PreviousFormset->HiiFormList);
+  while (!IsNull (&PreviousFormset->HiiFormList, HiiFormLink)) {
+    HiiFormPrivate = REDFISH_PLATFORM_CONFIG_FORM_FROM_LINK (HiiFormLink);
+    if (HiiFormPrivate->Id == FormId) {
+      return HiiFormPrivate;
+    }
+
+    HiiFormLink = GetNextNode (&PreviousFormset->HiiFormList, HiiFormLink);
+  }
+
+  return NULL;
+}
+
+/**
+  Build configure language index of all schema in formset. Configure language
+  of each statement is retrieved from HII database once and kept in index so
+  search functions don't have to retrieve it again.
+
+  When previous formset of the same HII handle is given, the configure languages
+  of the forms which are not changed are copied from previous index instead of
+  being retrieved from HII database again.
+
+  @param[in]  FormsetPrivate      Formset private instance.
+  @param[in]  PreviousFormset     Previous formset of the same HII handle. Optional.
+  @param[in]  UpdatedFormIdList   The forms which are changed since previous formset is loaded.
+  @param[in]  UpdatedFormIdCount  Number of form ID in UpdatedFormIdList.
+
+  @retval EFI_SUCCESS             Index is built.
+  @retval EFI_INVALID_PARAMETER   FormsetPrivate is NULL.
+  @retval EFI_OUT_OF_RESOURCES    System is out of memory.
+
+**/
+EFI_STATUS
+BuildConfigureLangIndex (
+  IN  REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *FormsetPrivate,
+  IN  REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *PreviousFormset OPTIONAL,
+  IN  UINT16                                    *UpdatedFormIdList OPTIONAL,
+  IN  UINTN                                     UpdatedFormIdCount
+  )
+{
+  LIST_ENTRY                                 *HiiFormLink;
+  REDFISH_PLATFORM_CONFIG_FORM_PRIVATE       *HiiFormPrivate;
+  LIST_ENTRY                                 *HiiStatementLink;
+  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE  *HiiStatementPrivate;
+  REDFISH_PLATFORM_CONFIG_INDEX              *ConfigureLangIndex;
+  REDFISH_PLATFORM_CONFIG_INDEX_ENTRY        *Entry;
+  REDFISH_PLATFORM_CONFIG_INDEX_ENTRY        *SortBuffer;
+  UINTN                                      StatementCount;
+  UINTN                                      SchemaIndex;
+  UINTN                                      Index;
+  EFI_STRING                                 ConfigureLang;
+  REDFISH_PLATFORM_CONFIG_FORM_PRIVATE       *PreviousForm;
+  REDFISH_PLATFORM_CONFIG_INDEX              *PreviousIndex;
+  LIST_ENTRY                                 *PreviousStatementLink;
+  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE  *PreviousStatement;
+  UINTN                                      PreviousEntry;
+
+  if (FormsetPrivate == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (FormsetPrivate->SupportedSchema.Count == 0) {
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Count the statements which may have configure language.
+  //
+  StatementCount = 0;
+  HiiFormLink = GetFirstNode (&FormsetPrivate->HiiFormList);
+  while (!IsNull (&FormsetPrivate->HiiFormList, HiiFormLink)) {
+    HiiFormPrivate = REDFISH_PLATFORM_CONFIG_FORM_FROM_LINK (HiiFormLink);
+
+    HiiStatementLink = GetFirstNode (&HiiFormPrivate->StatementList);
+    while (!IsNull (&HiiFormPrivate->StatementList, HiiStatementLink)) {
+      HiiStatementPrivate = REDFISH_PLATFORM_CONFIG_STATEMENT_FROM_LINK (HiiStatementLink);
+      if (HiiStatementPrivate->Description != 0) {
+        ++StatementCount;
+      }
+
+      HiiStatementLink = GetNextNode (&HiiFormPrivate->StatementList, HiiStatementLink);
+    }
+
+    HiiFormLink = GetNextNode (&FormsetPrivate->HiiFormList, HiiFormLink);
+  }
+
+  FormsetPrivate->ConfigureLangIndex = AllocateZeroPool (sizeof (REDFISH_PLATFORM_CONFIG_INDEX) * FormsetPrivate->SupportedSchema.Count);
+  if (FormsetPrivate->ConfigureLangIndex == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  if (StatementCount == 0) {
+    return EFI_SUCCESS;
+  }
+
+  for (SchemaIndex = 0; SchemaIndex < FormsetPrivate->SupportedSchema.Count; SchemaIndex++) {
+    ConfigureLangIndex = &FormsetPrivate->ConfigureLangIndex[SchemaIndex];
+
+    ConfigureLangIndex->BucketCount = CONFIGURE_LANG_INDEX_MIN_BUCKET;
+    while (ConfigureLangIndex->BucketCount < StatementCount) {
+      ConfigureLangIndex->BucketCount <<= 1;
+    }
+
+    ConfigureLangIndex->EntryList  = AllocateZeroPool (sizeof (REDFISH_PLATFORM_CONFIG_INDEX_ENTRY) * StatementCount);
+    ConfigureLangIndex->SortedList = AllocateZeroPool (sizeof (REDFISH_PLATFORM_CONFIG_INDEX_ENTRY *) * StatementCount);
+    ConfigureLangIndex->Bucket     = AllocatePool (sizeof (LIST_ENTRY) * ConfigureLangIndex->BucketCount);
+    if (ConfigureLangIndex->EntryList == NULL || ConfigureLangIndex->SortedList == NULL || ConfigureLangIndex->Bucket == NULL) {
+      ReleaseConfigureLangIndex (FormsetPrivate);
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    for (Index = 0; Index < ConfigureLangIndex->BucketCount; Index++) {
+      InitializeListHead (&ConfigureLangIndex->Bucket[Index]);
+    }
+
+    HiiFormLink = GetFirstNode (&FormsetPrivate->HiiFormList);
+    while (!IsNull (&FormsetPrivate->HiiFormList, HiiFormLink)) {
+      HiiFormPrivate = REDFISH_PLATFORM_CONFIG_FORM_FROM_LINK (HiiFormLink);
+
+      //
+      // Statements of unchanged form are in the same order as previous form,
+      // and so are their entries in previous index.
+      //
+      PreviousIndex = NULL;
+      PreviousStatementLink = NULL;
+      PreviousEntry = 0;
+      PreviousForm = GetReusableForm (PreviousFormset, UpdatedFormIdList, UpdatedFormIdCount, HiiFormPrivate->Id);
+      if (PreviousForm != NULL) {
+        PreviousIndex = GetConfigureLangIndex (PreviousFormset, FormsetPrivate->SupportedSchema.SchemaList[SchemaIndex]);
+      }
+
+      if (PreviousIndex != NULL) {
+        PreviousStatementLink = GetFirstNode (&PreviousForm->StatementList);
+        while (PreviousEntry < PreviousIndex->Count && PreviousIndex->EntryList[PreviousEntry].Statement->ParentForm != PreviousForm) {
+          ++PreviousEntry;
+        }
+      }
+
+      HiiStatementLink = GetFirstNode (&HiiFormPrivate->StatementList);
+      while (!IsNull (&HiiFormPrivate->StatementList, HiiStatementLink)) {
+        HiiStatementPrivate = REDFISH_PLATFORM_CONFIG_STATEMENT_FROM_LINK (HiiStatementLink);
+        HiiStatementLink = GetNextNode (&HiiFormPrivate->StatementList, HiiStatementLink);
+
+        PreviousStatement = NULL;
+        if (PreviousStatementLink != NULL && !IsNull (&PreviousForm->StatementList, PreviousStatementLink)) {
+          PreviousStatement = REDFISH_PLATFORM_CONFIG_STATEMENT_FROM_LINK (PreviousStatementLink);
+          PreviousStatementLink = GetNextNode (&PreviousForm->StatementList, PreviousStatementLink);
+        }
+
+        if (HiiStatementPrivate->Description == 0) {
+          continue;
+        }
+
+        if (PreviousStatement != NULL) {
+          //
+          // Statement without entry in previous index has no configure language.
+          //
+          if (PreviousEntry >= PreviousIndex->Count || PreviousIndex->EntryList[PreviousEntry].Statement != PreviousStatement) {
+            continue;
+          }
+
+          ConfigureLang = AllocateCopyPool (StrSize (PreviousIndex->EntryList[PreviousEntry].ConfigureLang), PreviousIndex->EntryList[PreviousEntry].ConfigureLang);
+          ++PreviousEntry;
+        } else {
+          ConfigureLang = HiiGetRedfishString (FormsetPrivate->HiiHandle, FormsetPrivate->SupportedSchema.SchemaList[SchemaIndex], HiiStatementPrivate->Description);
+        }
+
+        if (ConfigureLang == NULL) {
+          continue;
+        }
+
+        Entry = &ConfigureLangIndex->EntryList[ConfigureLangIndex->Count];
+        Entry->ConfigureLang = ConfigureLang;
+        Entry->Statement     = HiiStatementPrivate;
+        Entry->Hash          = ConfigureLangHash (ConfigureLang);
+        InsertTailList (&ConfigureLangIndex->Bucket[Entry->Hash & (ConfigureLangIndex->BucketCount - 1)], &Entry->Link);
+        ConfigureLangIndex->SortedList[ConfigureLangIndex->Count] = Entry;
+        ++ConfigureLangIndex->Count;
+      }
+
+      HiiFormLink = GetNextNode (&FormsetPrivate->HiiFormList, HiiFormLink);
+    }
+
+    if (ConfigureLangIndex->Count > 1) {
+      QuickSort (
+        ConfigureLangIndex->SortedList,
+        ConfigureLangIndex->Count,
+        sizeof (REDFISH_PLATFORM_CONFIG_INDEX_ENTRY *),
+        CompareConfigureLangIndexEntry,
+        &SortBuffer
+        );
+    }
+
+    DEBUG ((DEBUG_INFO, "%a, %a: %d configure languages in formset: %g\n", __FUNCTION__, FormsetPrivate->SupportedSchema.SchemaList[SchemaIndex], ConfigureLangIndex->Count, &FormsetPrivate->Guid));
+  }
+
+  return EFI_SUCCESS;
+}
+
+/**
+  Find the literal prefix of regular expression pattern. Only the pattern
+  anchored with '^' and without alternation has literal prefix. Every string
+  that matches the pattern starts with the prefix.
+
+  @param[in]  Pattern         Regular expression pattern.
+  @param[out] PrefixLength    Number of characters in prefix.
+
+  @retval CHAR16 *            Pointer to the prefix in Pattern. NULL if there is no prefix.
+
+**/
+CHAR16 *
+GetRegexLiteralPrefix (
+  IN  EFI_STRING  Pattern,
+  OUT UINTN       *PrefixLength
+  )
+{
+  CONST CHAR16  *MetaChar;
+  UINTN         Index;
+
+  *PrefixLength = 0;
+
+  if (Pattern[0] != L'^') {
+    return NULL;
+  }
+
+  for (Index = 1; Pattern[Index] != L'\0'; Index++) {
+    if (Pattern[Index] == L'|') {
+      return NULL;
+    }
+  }
+
+  for (Index = 1; Pattern[Index] != L'\0'; Index++) {
+    for (MetaChar = L"\\.^$|?*+()[]{}"; *MetaChar != L'\0'; MetaChar++) {
+      if (Pattern[Index] == *MetaChar) {
+        break;
+      }
+    }
+
+    if (*MetaChar != L'\0') {
+      break;
+    }
+  }
+
+  *PrefixLength = Index - 1;
+
+  //
+  // The last literal character is optional when it is followed by these quantifiers.
+  //
+  if (*PrefixLength > 0 && (Pattern[Index] == L'?' || Pattern[Index] == L'*' || Pattern[Index] == L'{')) {
+    --(*PrefixLength);
+  }
+
+  if (*PrefixLength == 0) {
+    return NULL;
+  }
+
+  return &Pattern[1];
+}
+
 /**
   Search and find statement private instance by given regular expression patthern
   which describes the Configure Language.
 
   @param[in]  RegularExpressionProtocol   Regular express protocol.
+  @param[in]  RegularExpressionExProtocol Regular express extended protocol. If it is
+                                          not NULL, the pattern is compiled once and
+                                          matched against every configure language.
   @param[in]  FormsetList                 Form-set list to search.
   @param[in]  Schema                      Schema to be matched.
   @param[in]  Pattern                     Regular expression pattern.
@@ -444,6 +867,7 @@ GetSupportedSchema (
 EFI_STATUS
 GetStatementPrivateByConfigureLangRegex (
   IN  EFI_REGULAR_EXPRESSION_PROTOCOL                 *RegularExpressionProtocol,
+  IN  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL            *RegularExpressionExProtocol OPTIONAL,
   IN  LIST_ENTRY                                      *FormsetList,
   IN  CHAR8                                           *Schema,
   IN  EFI_STRING                                      Pattern,
@@ -453,17 +877,19 @@ GetStatementPrivateByConfigureLangRegex (
   LIST_ENTRY                      *HiiFormsetLink;
   LIST_ENTRY                      *HiiFormsetNextLink;
   REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *HiiFormsetPrivate;
-  LIST_ENTRY                      *HiiFormLink;
-  LIST_ENTRY                      *HiiNextFormLink;
-  REDFISH_PLATFORM_CONFIG_FORM_PRIVATE      *HiiFormPrivate;
-  LIST_ENTRY                      *HiiStatementLink;
-  LIST_ENTRY                      *HiiNextStatementLink;
-  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE *HiiStatementPrivate;
-  EFI_STRING                      TmpString;
+  REDFISH_PLATFORM_CONFIG_INDEX   *ConfigureLangIndex;
+  REDFISH_PLATFORM_CONFIG_INDEX_ENTRY *Entry;
+  CHAR16                          *Prefix;
+  UINTN                           PrefixLength;
+  UINTN                           Index;
+  UINTN                           Low;
+  UINTN                           High;
+  UINTN                           Middle;
   UINTN                           CaptureCount;
   BOOLEAN                         IsMatch;
   EFI_STATUS                      Status;
   REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE_REF *StatementRef;
+  EDKII_REGEX_COMPILED_PATTERN    CompiledPattern;
 
   if (FormsetList == NULL || IS_EMPTY_STRING (Schema) || IS_EMPTY_STRING (Pattern) || StatementList == NULL) {
     return EFI_INVALID_PARAMETER;
@@ -480,6 +906,27 @@ GetStatementPrivateByConfigureLangRegex (
     return EFI_NOT_FOUND;
   }
 
+  Prefix = GetRegexLiteralPrefix (Pattern, &PrefixLength);
+
+  //
+  // Compile the pattern once instead of in every MatchString() call.
+  //
+  CompiledPattern = NULL;
+  if (RegularExpressionExProtocol != NULL) {
+    Status = RegularExpressionExProtocol->CompilePattern (
+                                            RegularExpressionExProtocol,
+                                            Pattern,
+                                            &gEfiRegexSyntaxTypePerlGuid,
+                                            &CompiledPattern
+                                            );
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a, CompilePattern \"%s\" failed: %r\n", __FUNCTION__, Pattern, Status));
+      ASSERT (FALSE);
+      return Status;
+    }
+  }
+
+  Status = EFI_SUCCESS;
   HiiFormsetLink = GetFirstNode (FormsetList);
   while (!IsNull (FormsetList, HiiFormsetLink)) {
     HiiFormsetNextLink = GetNextNode (FormsetList, HiiFormsetLink);
@@ -489,67 +936,88 @@ GetStatementPrivateByConfigureLangRegex (
     // Performance check.
     // If there is no desired Redfish schema found, skip this formset.
     //
-    if (!CheckSupportedSchema (&HiiFormsetPrivate->SupportedSchema, Schema)) {
+    ConfigureLangIndex = GetConfigureLangIndex (HiiFormsetPrivate, Schema);
+    if (ConfigureLangIndex == NULL || ConfigureLangIndex->Count == 0) {
       HiiFormsetLink = HiiFormsetNextLink;
       continue;
     }
 
-    HiiFormLink = GetFirstNode (&HiiFormsetPrivate->HiiFormList);
-    while (!IsNull (&HiiFormsetPrivate->HiiFormList, HiiFormLink)) {
-      HiiNextFormLink = GetNextNode (&HiiFormsetPrivate->HiiFormList, HiiFormLink);
-      HiiFormPrivate = REDFISH_PLATFORM_CONFIG_FORM_FROM_LINK (HiiFormLink);
+    //
+    // Only the configure languages start with the literal prefix of pattern
+    // can match. Find the first one in sorted list.
+    //
+    Low = 0;
+    if (Prefix != NULL) {
+      High = ConfigureLangIndex->Count;
+      while (Low < High) {
+        Middle = Low + (High - Low) / 2;
+        if (StrnCmp (ConfigureLangIndex->SortedList[Middle]->ConfigureLang, Prefix, PrefixLength) < 0) {
+          Low = Middle + 1;
+        } else {
+          High = Middle;
+        }
+      }
+    }
 
-      HiiStatementLink =GetFirstNode (&HiiFormPrivate->StatementList);
-      while (!IsNull (&HiiFormPrivate->StatementList, HiiStatementLink)) {
-        HiiNextStatementLink = GetNextNode (&HiiFormPrivate->StatementList, HiiStatementLink);
-        HiiStatementPrivate = REDFISH_PLATFORM_CONFIG_STATEMENT_FROM_LINK (HiiStatementLink);
+    for (Index = Low; Index < ConfigureLangIndex->Count; Index++) {
+      Entry = ConfigureLangIndex->SortedList[Index];
+      if (Prefix != NULL && StrnCmp (Entry->ConfigureLang, Prefix, PrefixLength) != 0) {
+        break;
+      }
 
-        if (HiiStatementPrivate->Description != 0) {
-          TmpString = HiiGetRedfishString (HiiFormsetPrivate->HiiHandle, Schema, HiiStatementPrivate->Description);
-          if (TmpString != NULL) {
-            Status = RegularExpressionProtocol->MatchString (
-                                                  RegularExpressionProtocol,
-                                                  TmpString,
-                                                  Pattern,
-                                                  &gEfiRegexSyntaxTypePerlGuid,
-                                                  &IsMatch,
-                                                  NULL,
-                                                  &CaptureCount
-                                                  );
-            if (EFI_ERROR (Status)) {
-              DEBUG ((DEBUG_ERROR, "%a, MatchString \"%s\" failed: %r\n", __FUNCTION__, Pattern, Status));
-              ASSERT (FALSE);
-              return Status;
-            }
-
-            //
-            // Found
-            //
-            if (IsMatch) {
-              StatementRef = AllocateZeroPool (sizeof (REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE_REF));
-              if (StatementRef == NULL) {
-                return EFI_OUT_OF_RESOURCES;
-              }
-
-              StatementRef->Statement = HiiStatementPrivate;
-              InsertTailList (&StatementList->StatementList, &StatementRef->Link);
-              ++StatementList->Count;
-            }
-
-            FreePool (TmpString);
-          }
+      if (CompiledPattern != NULL) {
+        Status = RegularExpressionExProtocol->MatchCompiled (
+                                                RegularExpressionExProtocol,
+                                                CompiledPattern,
+                                                Entry->ConfigureLang,
+                                                &IsMatch,
+                                                NULL,
+                                                &CaptureCount
+                                                );
+      } else {
+        Status = RegularExpressionProtocol->MatchString (
+                                              RegularExpressionProtocol,
+                                              Entry->ConfigureLang,
+                                              Pattern,
+                                              &gEfiRegexSyntaxTypePerlGuid,
+                                              &IsMatch,
+                                              NULL,
+                                              &CaptureCount
+                                              );
+      }
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_ERROR, "%a, MatchString \"%s\" failed: %r\n", __FUNCTION__, Pattern, Status));
+        ASSERT (FALSE);
+        goto ON_EXIT;
+      }
+
+      //
+      // Found
+      //
+      if (IsMatch) {
+        StatementRef = AllocateZeroPool (sizeof (REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE_REF));
+        if (StatementRef == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          goto ON_EXIT;
         }
 
-        HiiStatementLink = HiiNextStatementLink;
+        StatementRef->Statement     = Entry->Statement;
+        StatementRef->ConfigureLang = Entry->ConfigureLang;
+        InsertTailList (&StatementList->StatementList, &StatementRef->Link);
+        ++StatementList->Count;
       }
-
-      HiiFormLink = HiiNextFormLink;
     }
 
     HiiFormsetLink = HiiFormsetNextLink;
   }
 
-  return EFI_SUCCESS;
+ON_EXIT:
+
+  if (CompiledPattern != NULL) {
+    RegularExpressionExProtocol->FreePattern (RegularExpressionExProtocol, CompiledPattern);
+  }
+
+  return Status;
 }
 
 /**
@@ -572,13 +1040,11 @@ GetStatementPrivateByConfigureLang (
   LIST_ENTRY                      *HiiFormsetLink;
   LIST_ENTRY                      *HiiFormsetNextLink;
   REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *HiiFormsetPrivate;
-  LIST_ENTRY                      *HiiFormLink;
-  LIST_ENTRY                      *HiiNextFormLink;
-  REDFISH_PLATFORM_CONFIG_FORM_PRIVATE      *HiiFormPrivate;
-  LIST_ENTRY                      *HiiStatementLink;
-  LIST_ENTRY                      *HiiNextStatementLink;
-  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE *HiiStatementPrivate;
-  EFI_STRING                      TmpString;
+  REDFISH_PLATFORM_CONFIG_INDEX   *ConfigureLangIndex;
+  REDFISH_PLATFORM_CONFIG_INDEX_ENTRY *Entry;
+  LIST_ENTRY                      *Bucket;
+  LIST_ENTRY                      *EntryLink;
+  UINT32                          Hash;
 
   if (FormsetList == NULL || IS_EMPTY_STRING (Schema) || IS_EMPTY_STRING (ConfigureLang)) {
     return NULL;
@@ -588,6 +1054,8 @@ GetStatementPrivateByConfigureLang (
     return NULL;
   }
 
+  Hash = ConfigureLangHash (ConfigureLang);
+
   HiiFormsetLink = GetFirstNode (FormsetList);
   while (!IsNull (FormsetList, HiiFormsetLink)) {
     HiiFormsetNextLink = GetNextNode (FormsetList, HiiFormsetLink);
@@ -597,42 +1065,25 @@ GetStatementPrivateByConfigureLang (
     // Performance check.
     // If there is no desired Redfish schema found, skip this formset.
     //
-    if (!CheckSupportedSchema (&HiiFormsetPrivate->SupportedSchema, Schema)) {
+    ConfigureLangIndex = GetConfigureLangIndex (HiiFormsetPrivate, Schema);
+    if (ConfigureLangIndex == NULL || ConfigureLangIndex->Count == 0) {
       HiiFormsetLink = HiiFormsetNextLink;
       continue;
     }
 
-    HiiFormLink = GetFirstNode (&HiiFormsetPrivate->HiiFormList);
-    while (!IsNull (&HiiFormsetPrivate->HiiFormList, HiiFormLink)) {
-      HiiNextFormLink = GetNextNode (&HiiFormsetPrivate->HiiFormList, HiiFormLink);
-      HiiFormPrivate = REDFISH_PLATFORM_CONFIG_FORM_FROM_LINK (HiiFormLink);
-
-      HiiStatementLink =GetFirstNode (&HiiFormPrivate->StatementList);
-      while (!IsNull (&HiiFormPrivate->StatementList, HiiStatementLink)) {
-        HiiNextStatementLink = GetNextNode (&HiiFormPrivate->StatementList, HiiStatementLink);
-        HiiStatementPrivate = REDFISH_PLATFORM_CONFIG_STATEMENT_FROM_LINK (HiiStatementLink);
-
-        DEBUG_CODE (
-          STATIC UINTN Index = 0;
-          DEBUG ((DEBUG_INFO, "%a, [%d] search %s in QID: 0x%x form: 0x%x formset: %g\n", __FUNCTION__, ++Index, ConfigureLang, HiiStatementPrivate->QuestionId, HiiFormPrivate->Id, &HiiFormsetPrivate->Guid));
-        );
-
-        if (HiiStatementPrivate->Description != 0) {
-          TmpString = HiiGetRedfishString (HiiFormsetPrivate->HiiHandle, Schema, HiiStatementPrivate->Description);
-          if (TmpString != NULL) {
-            if (StrCmp (TmpString, ConfigureLang) == 0) {
-              FreePool (TmpString);
-              return HiiStatementPrivate;
-            }
-
-            FreePool (TmpString);
-          }
-        }
-
-        HiiStatementLink = HiiNextStatementLink;
+    //
+    // Statements are added to hash bucket in formset order, so the first
+    // statement in formset wins when configure language is duplicated.
+    //
+    Bucket = &ConfigureLangIndex->Bucket[Hash & (ConfigureLangIndex->BucketCount - 1)];
+    EntryLink = GetFirstNode (Bucket);
+    while (!IsNull (Bucket, EntryLink)) {
+      Entry = REDFISH_PLATFORM_CONFIG_INDEX_ENTRY_FROM_LINK (EntryLink);
+      if (Entry->Hash == Hash && StrCmp (Entry->ConfigureLang, ConfigureLang) == 0) {
+        return Entry->Statement;
       }
 
-      HiiFormLink = HiiNextFormLink;
+      EntryLink = GetNextNode (Bucket, EntryLink);
     }
 
     HiiFormsetLink = HiiFormsetNextLink;
@@ -708,6 +1159,11 @@ ReleaseFormset (
     return EFI_INVALID_PARAMETER;
   }
 
+  //
+  // Index refers to statements, release it first.
+  //
+  ReleaseConfigureLangIndex (FormsetPrivate);
+
   HiiFormLink = GetFirstNode (&FormsetPrivate->HiiFormList);
   while (!IsNull (&FormsetPrivate->HiiFormList, HiiFormLink)) {
     HiiFormPrivate = REDFISH_PLATFORM_CONFIG_FORM_FROM_LINK (HiiFormLink);
@@ -795,8 +1251,12 @@ NewFormsetPrivate (
 /**
   Load the HII formset from the given HII handle.
 
-  @param[in]  HiiHandle       Target HII handle to load.
-  @param[out] FormsetPrivate  The formset private data.
+  @param[in]  HiiHandle           Target HII handle to load.
+  @param[out] FormsetPrivate      The formset private data.
+  @param[in]  PreviousFormset     Previous formset of the same HII handle whose
+                                  configure languages can be reused. Optional.
+  @param[in]  UpdatedFormIdList   The forms which are changed since previous formset is loaded.
+  @param[in]  UpdatedFormIdCount  Number of form ID in UpdatedFormIdList.
 
   @retval EFI_STATUS
 
@@ -804,7 +1264,10 @@ NewFormsetPrivate (
 EFI_STATUS
 LoadFormset (
   IN  EFI_HII_HANDLE                  HiiHandle,
-  OUT REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *FormsetPrivate
+  OUT REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *FormsetPrivate,
+  IN  REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *PreviousFormset OPTIONAL,
+  IN  UINT16                          *UpdatedFormIdList OPTIONAL,
+  IN  UINTN                           UpdatedFormIdCount
   )
 {
   EFI_STATUS                      Status;
@@ -903,6 +1366,15 @@ LoadFormset (
     HiiFormLink = GetNextNode (&HiiFormSet->FormListHead, HiiFormLink);
   }
 
+  //
+  // Build configure language index so statements can be found without
+  // retrieving HII strings again.
+  //
+  Status = BuildConfigureLangIndex (FormsetPrivate, PreviousFormset, UpdatedFormIdList, UpdatedFormIdCount);
+  if (EFI_ERROR (Status)) {
+    goto ErrorExit;
+  }
+
   return EFI_SUCCESS;
 
 ErrorExit:
@@ -958,7 +1430,7 @@ LoadFormsetList (
   //
   // Load formset on the given HII handle.
   //
-  Status = LoadFormset (HiiHandle, FormsetPrivate);
+  Status = LoadFormset (HiiHandle, FormsetPrivate, NULL, NULL, 0);
   if (EFI_ERROR (Status)) {
     DEBUG ((DEBUG_ERROR, "%a, failed to load formset: %r\n", __FUNCTION__, Status));
     FreePool (FormsetPrivate);
@@ -977,6 +1449,71 @@ LoadFormsetList (
   return EFI_SUCCESS;
 }
 
+/**
+  Reload the formset whose HII handle is updated. Nothing is done when neither
+  IFR nor strings of the formset is changed. Otherwise the formset is parsed
+  again, and the configure languages of unchanged forms are taken from current
+  formset when strings are not changed.
+
+  @param[in]  FormsetPrivate  The formset to reload. It is replaced by the
+                              reloaded formset in formset list and released.
+
+  @retval EFI_SUCCESS         Formset is up to date.
+  @retval Others              Failed to reload formset. FormsetPrivate is not changed.
+
+**/
+EFI_STATUS
+ReloadFormset (
+  IN  REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *FormsetPrivate
+  )
+{
+  EFI_STATUS                                Status;
+  REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE  *NewFormset;
+  BOOLEAN                                   StringUpdated;
+  UINT16                                    *FormIdList;
+  UINTN                                     FormIdCount;
+
+  Status = GetFormSetUpdate (FormsetPrivate->HiiFormSet, &StringUpdated, &FormIdList, &FormIdCount);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  if (!StringUpdated && FormIdCount == 0) {
+    DEBUG ((DEBUG_INFO, "%a, formset: %g is not changed. Keep current formset\n", __FUNCTION__, &FormsetPrivate->Guid));
+    return EFI_SUCCESS;
+  }
+
+  DEBUG ((DEBUG_INFO, "%a, formset: %g is updated, %d form(s) changed, string %a\n", __FUNCTION__, &FormsetPrivate->Guid, FormIdCount, (StringUpdated ? "changed" : "not changed")));
+
+  NewFormset = NewFormsetPrivate ();
+  if (NewFormset == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto ON_EXIT;
+  }
+
+  Status = LoadFormset (FormsetPrivate->HiiHandle, NewFormset, (StringUpdated ? NULL : FormsetPrivate), FormIdList, FormIdCount);
+  if (EFI_ERROR (Status)) {
+    FreePool (NewFormset);
+    goto ON_EXIT;
+  }
+
+  //
+  // Replace current formset in the same position of formset list.
+  //
+  InsertHeadList (&FormsetPrivate->Link, &NewFormset->Link);
+  RemoveEntryList (&FormsetPrivate->Link);
+  ReleaseFormset (FormsetPrivate);
+  FreePool (FormsetPrivate);
+
+ON_EXIT:
+
+  if (FormIdList != NULL) {
+    FreePool (FormIdList);
+  }
+
+  return Status;
+}
+
 /**
   Release formset list and all the forms that belong to this formset.
 
@@ -1224,17 +1761,26 @@ ProcessPendingList (
       FormsetPrivate = GetFormsetPrivateByHiiHandle (Target->HiiHandle, FormsetList);
       if (FormsetPrivate != NULL) {
         //
-        // HII formset already exist, release it and query again.
+        // HII formset already exist, reload the changed part only.
         //
-        DEBUG ((DEBUG_INFO, "%a, formset: %g is updated. Release current formset\n", __FUNCTION__, &FormsetPrivate->Guid));
-        RemoveEntryList (&FormsetPrivate->Link);
-        ReleaseFormset (FormsetPrivate);
-        FreePool (FormsetPrivate);
+        Status = ReloadFormset (FormsetPrivate);
+        if (EFI_ERROR (Status)) {
+          //
+          // Release it and query again.
+          //
+          DEBUG ((DEBUG_INFO, "%a, formset: %g reload failed: %r. Release current formset\n", __FUNCTION__, &FormsetPrivate->Guid, Status));
+          RemoveEntryList (&FormsetPrivate->Link);
+          ReleaseFormset (FormsetPrivate);
+          FreePool (FormsetPrivate);
+          FormsetPrivate = NULL;
+        }
       }
 
-      Status = LoadFormsetList (Target->HiiHandle, FormsetList);
-      if (EFI_ERROR (Status)) {
-        DEBUG ((DEBUG_ERROR, "%a, load formset from HII handle: 0x%x failed: %r\n", __FUNCTION__, Target->HiiHandle, Status));
+      if (FormsetPrivate == NULL) {
+        Status = LoadFormsetList (Target->HiiHandle, FormsetList);
+        if (EFI_ERROR (Status)) {
+          DEBUG ((DEBUG_ERROR, "%a, load formset from HII handle: 0x%x failed: %r\n", __FUNCTION__, Target->HiiHandle, Status));
+        }
       }
     }
 
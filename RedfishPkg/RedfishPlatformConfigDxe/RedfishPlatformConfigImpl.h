@@ -28,6 +28,7 @@
 #define IS_EMPTY_STRING(a)                               (a == NULL || a[0] == L'\0')
 #define ENGLISH_LANGUAGE_CODE                            "en-US"
 #define X_UEFI_SCHEMA_PREFIX                             "x-uefi-redfish-"
+#define CONFIGURE_LANG_INDEX_MIN_BUCKET                  16
 
 //
 // Definition of REDFISH_PLATFORM_CONFIG_PRIVATE.
@@ -45,6 +46,32 @@ typedef struct {
   CHAR8   **SchemaList;                         // Schema list
 } REDFISH_PLATFORM_CONFIG_SCHEMA;
 
+typedef struct _REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE;
+
+//
+// Definition of REDFISH_PLATFORM_CONFIG_INDEX_ENTRY
+//
+typedef struct {
+  LIST_ENTRY                                Link;           // Link in hash bucket.
+  UINT32                                    Hash;           // Hash value of ConfigureLang.
+  EFI_STRING                                ConfigureLang;  // Configure language of this statement.
+  REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE *Statement;
+} REDFISH_PLATFORM_CONFIG_INDEX_ENTRY;
+
+#define REDFISH_PLATFORM_CONFIG_INDEX_ENTRY_FROM_LINK(a)  BASE_CR (a, REDFISH_PLATFORM_CONFIG_INDEX_ENTRY, Link)
+
+//
+// Definition of REDFISH_PLATFORM_CONFIG_INDEX. There is one index for each
+// schema supported in formset.
+//
+typedef struct {
+  UINTN                                 Count;        // Number of entries.
+  REDFISH_PLATFORM_CONFIG_INDEX_ENTRY   *EntryList;   // Entries of all statements which have configure language.
+  UINTN                                 BucketCount;  // Number of hash buckets. Always power of two.
+  LIST_ENTRY                            *Bucket;      // Hash buckets for exact search.
+  REDFISH_PLATFORM_CONFIG_INDEX_ENTRY   **SortedList; // Entries sorted by configure language for prefix and regex search.
+} REDFISH_PLATFORM_CONFIG_INDEX;
+
 //
 // Definition of REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE
 //
@@ -56,6 +83,7 @@ typedef struct {
   LIST_ENTRY                      HiiFormList;     // Form list that keep form data under this formset.
   CHAR16                          *DevicePathStr;  // Device path of this formset.
   REDFISH_PLATFORM_CONFIG_SCHEMA  SupportedSchema; // Schema that is supported in this formset.
+  REDFISH_PLATFORM_CONFIG_INDEX   *ConfigureLangIndex; // Configure language index of each schema in SupportedSchema.
 } REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE;
 
 #define REDFISH_PLATFORM_CONFIG_FORMSET_FROM_LINK(a)  BASE_CR (a, REDFISH_PLATFORM_CONFIG_FORM_SET_PRIVATE, Link)
@@ -77,14 +105,14 @@ typedef struct {
 //
 // Definition of REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE
 //
-typedef struct {
+struct _REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE {
   LIST_ENTRY                            Link;
   REDFISH_PLATFORM_CONFIG_FORM_PRIVATE  *ParentForm;
   HII_STATEMENT                         *HiiStatement;  // Pointer to HII statement data.
   EFI_QUESTION_ID                       QuestionId;     // Question ID of this statement.
   EFI_STRING_ID                         Description;    // String token of this question.
   EFI_STRING                            DesStringCache; // The string cache for search function.
-} REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE;
+};
 
 #define REDFISH_PLATFORM_CONFIG_STATEMENT_FROM_LINK(a)  BASE_CR (a, REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE, Link)
 
@@ -94,6 +122,7 @@ typedef struct {
 typedef struct {
   LIST_ENTRY                                Link;
   REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE *Statement;
+  EFI_STRING                                ConfigureLang;  // Configure language in index, not owned by this reference.
 } REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE_REF;
 
 #define REDFISH_PLATFORM_CONFIG_STATEMENT_REF_FROM_LINK(a)  BASE_CR (a, REDFISH_PLATFORM_CONFIG_STATEMENT_PRIVATE_REF, Link)
@@ -193,6 +222,9 @@ GetStatementPrivateByConfigureLang (
   which describes the Configure Language.
 
   @param[in]  RegularExpressionProtocol   Regular express protocol.
+  @param[in]  RegularExpressionExProtocol Regular express extended protocol. If it is
+                                          not NULL, the pattern is compiled once and
+                                          matched against every configure language.
   @param[in]  FormsetList                 Form-set list to search.
   @param[in]  Schema                      Schema to be matched.
   @param[in]  Pattern                     Regular expression pattern.
@@ -208,6 +240,7 @@ GetStatementPrivateByConfigureLang (
 EFI_STATUS
 GetStatementPrivateByConfigureLangRegex (
   IN  EFI_REGULAR_EXPRESSION_PROTOCOL                 *RegularExpressionProtocol,
+  IN  EDKII_REGULAR_EXPRESSION_EX_PROTOCOL            *RegularExpressionExProtocol OPTIONAL,
   IN  LIST_ENTRY                                      *FormsetList,
   IN  CHAR8                                           *Schema,
   IN  EFI_STRING                                      Pattern,
@@ -0,0 +1,657 @@
+/** @file
+  Implementation of EFI_REST_EX_PROTOCOL.AsyncSendReceive().
+
+  The asynchronous HTTP GET requests are queued on the REST EX instance and
+  written to the kept alive connection without waiting for the responses of
+  the earlier requests, up to PcdRedfishRestExPipelineDepth requests are in
+  flight. The responses are received in the order of requests and the event
+  of each REST EX token is signaled when its response arrives. The requests
+  are processed in a periodic timer, or by the caller through
+  EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL.Poll() while the timer is blocked.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+#include <Uefi.h>
+#include <Library/PcdLib.h>
+#include "RedfishRestExInternal.h"
+
+/**
+  Check whether the timeout of the asynchronous request expires.
+
+  @param[in]  Request             The asynchronous request.
+
+  @retval TRUE                    The timeout expires.
+  @retval FALSE                   The request has no timeout or it doesn't expire yet.
+
+**/
+BOOLEAN
+RedfishRestExAsyncIsTimeout (
+  IN RESTEX_ASYNC_REQUEST  *Request
+  )
+{
+  if (Request->TimeoutEvent == NULL) {
+    return FALSE;
+  }
+
+  return (BOOLEAN)!EFI_ERROR (gBS->CheckEvent (Request->TimeoutEvent));
+}
+
+/**
+  Return the status of the asynchronous request to the caller and signal
+  the event of its REST EX token. The request is not touched by caller after
+  this, the response is discarded if it arrives later.
+
+  @param[in]  Request             The asynchronous request.
+  @param[in]  Status              The status to return in REST EX token.
+
+**/
+VOID
+RedfishRestExAsyncSignal (
+  IN RESTEX_ASYNC_REQUEST  *Request,
+  IN EFI_STATUS            Status
+  )
+{
+  if (Request->RestExToken == NULL) {
+    return;
+  }
+
+  Request->RestExToken->Status = Status;
+  gBS->SignalEvent (Request->RestExToken->Event);
+  Request->RestExToken = NULL;
+}
+
+/**
+  Release the asynchronous request.
+
+  @param[in]  Request             The asynchronous request.
+
+**/
+VOID
+RedfishRestExAsyncFreeRequest (
+  IN RESTEX_ASYNC_REQUEST  *Request
+  )
+{
+  if (Request->PipelineToken.HttpToken.Event != NULL) {
+    gBS->CloseEvent (Request->PipelineToken.HttpToken.Event);
+  }
+
+  if (Request->TimeoutEvent != NULL) {
+    gBS->CloseEvent (Request->TimeoutEvent);
+  }
+
+  FreePool (Request);
+}
+
+/**
+  Give up the connection which the in flight requests are sent on. The
+  requests which are still wanted by caller are queued again in the same
+  order, and the connection is reset so they are sent on a new one.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+
+**/
+VOID
+RedfishRestExAsyncRestart (
+  IN RESTEX_INSTANCE  *Instance
+  )
+{
+  LIST_ENTRY            *Entry;
+  RESTEX_ASYNC_REQUEST  *Request;
+
+  while (!IsListEmpty (&Instance->AsyncInFlight)) {
+    Entry   = GetPreviousNode (&Instance->AsyncInFlight, &Instance->AsyncInFlight);
+    Request = RESTEX_ASYNC_REQUEST_FROM_LINK (Entry);
+    RemoveEntryList (Entry);
+    if (Request->RestExToken == NULL) {
+      RedfishRestExAsyncFreeRequest (Request);
+    } else {
+      InsertHeadList (&Instance->AsyncQueue, Entry);
+    }
+  }
+
+  Instance->AsyncInFlightCount = 0;
+  Instance->AsyncRxPending     = FALSE;
+
+  //
+  // Resetting HTTP instance drops the tokens of the requests above, they
+  // can be released or sent again from now on.
+  //
+  Instance->Flags |= RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE;
+  RedfishRestExPrepareConnection (Instance);
+}
+
+/**
+  Receive the HTTP response of the first in flight request. Waiting for the
+  response status and headers doesn't block, the message body is received
+  once the headers arrive.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+  @param[out] ResponseMessage     Pointer to receive the HTTP response message.
+
+  @retval EFI_SUCCESS             The complete HTTP response is received.
+  @retval EFI_NOT_READY           The response doesn't arrive yet.
+  @retval Others                  Fail to receive the response.
+
+**/
+EFI_STATUS
+RedfishRestExAsyncReceive (
+  IN  RESTEX_INSTANCE   *Instance,
+  OUT EFI_HTTP_MESSAGE  *ResponseMessage
+  )
+{
+  EFI_STATUS             Status;
+  HTTP_IO                *HttpIo;
+  HTTP_IO_RESPONSE_DATA  *ResponseData;
+
+  HttpIo       = &Instance->HttpIo;
+  ResponseData = &Instance->AsyncResponseData;
+
+  if (!Instance->AsyncRxPending) {
+    ZeroMem (ResponseData, sizeof (HTTP_IO_RESPONSE_DATA));
+    HttpIo->RspToken.Status                 = EFI_NOT_READY;
+    HttpIo->RspToken.Message->Data.Response = &ResponseData->Response;
+    HttpIo->RspToken.Message->HeaderCount   = 0;
+    HttpIo->RspToken.Message->Headers       = NULL;
+    HttpIo->RspToken.Message->BodyLength    = 0;
+    HttpIo->RspToken.Message->Body          = NULL;
+    HttpIo->IsRxDone                        = FALSE;
+
+    Status = HttpIo->Http->Response (HttpIo->Http, &HttpIo->RspToken);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    Instance->AsyncRxPending = TRUE;
+  }
+
+  if (!HttpIo->IsRxDone) {
+    HttpIo->Http->Poll (HttpIo->Http);
+    if (!HttpIo->IsRxDone) {
+      return EFI_NOT_READY;
+    }
+  }
+
+  Instance->AsyncRxPending = FALSE;
+  HttpIo->IsRxDone         = FALSE;
+
+  if ((HttpIo->RspToken.Status != EFI_SUCCESS) && (HttpIo->RspToken.Status != EFI_HTTP_ERROR)) {
+    return HttpIo->RspToken.Status;
+  }
+
+  ResponseData->Status      = HttpIo->RspToken.Status;
+  ResponseData->HeaderCount = HttpIo->RspToken.Message->HeaderCount;
+  ResponseData->Headers     = HttpIo->RspToken.Message->Headers;
+  ResponseData->BodyLength  = HttpIo->RspToken.Message->BodyLength;
+
+  ZeroMem (ResponseMessage, sizeof (EFI_HTTP_MESSAGE));
+  Status = RedfishRestExReceiveResponseMessage (Instance, ResponseData, ResponseMessage);
+  if (EFI_ERROR (Status)) {
+    RedfishRestExPipelineFreeResponse (ResponseMessage);
+  }
+
+  return Status;
+}
+
+/**
+  Make progress on the asynchronous requests at TPL_CALLBACK. It does
+  nothing if the connection is in use.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+
+**/
+VOID
+RedfishRestExAsyncProcess (
+  IN RESTEX_INSTANCE  *Instance
+  )
+{
+  EFI_STATUS            Status;
+  EFI_TPL               OldTpl;
+  LIST_ENTRY            *Entry;
+  LIST_ENTRY            *NextEntry;
+  RESTEX_ASYNC_REQUEST  *Request;
+  EFI_HTTP_MESSAGE      ResponseMessage;
+  BOOLEAN               HeadTimeout;
+  UINTN                 Depth;
+
+  OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
+
+  if (Instance->ConnectionBusy) {
+    gBS->RestoreTPL (OldTpl);
+    return;
+  }
+
+  Instance->ConnectionBusy = TRUE;
+
+  Depth = (UINTN)PcdGet32 (PcdRedfishRestExPipelineDepth);
+  if (Depth == 0) {
+    Depth = 1;
+  }
+
+  //
+  // Drop the queued requests which are canceled or timed out.
+  //
+  NET_LIST_FOR_EACH_SAFE (Entry, NextEntry, &Instance->AsyncQueue) {
+    Request = RESTEX_ASYNC_REQUEST_FROM_LINK (Entry);
+    if (RedfishRestExAsyncIsTimeout (Request)) {
+      RedfishRestExAsyncSignal (Request, EFI_TIMEOUT);
+    }
+
+    if (Request->RestExToken == NULL) {
+      RemoveEntryList (Entry);
+      RedfishRestExAsyncFreeRequest (Request);
+    }
+  }
+
+  //
+  // The timed out in flight requests stay on the connection until their
+  // responses arrive. If the first one times out, the responses are not
+  // coming, send the rest of requests on a new connection.
+  //
+  HeadTimeout = FALSE;
+  NET_LIST_FOR_EACH (Entry, &Instance->AsyncInFlight) {
+    Request = RESTEX_ASYNC_REQUEST_FROM_LINK (Entry);
+    if (RedfishRestExAsyncIsTimeout (Request)) {
+      RedfishRestExAsyncSignal (Request, EFI_TIMEOUT);
+      if (Entry == GetFirstNode (&Instance->AsyncInFlight)) {
+        HeadTimeout = TRUE;
+      }
+    }
+  }
+
+  if (HeadTimeout) {
+    DEBUG ((DEBUG_ERROR, "%a: No response in time, reconnect.\n", __FUNCTION__));
+    RedfishRestExAsyncRestart (Instance);
+  }
+
+  //
+  // Send the queued requests until the in flight window is full.
+  //
+  while (!IsListEmpty (&Instance->AsyncQueue) && (Instance->AsyncInFlightCount < Depth)) {
+    Request = RESTEX_ASYNC_REQUEST_FROM_LINK (GetFirstNode (&Instance->AsyncQueue));
+
+    Status = EFI_SUCCESS;
+    if (Instance->AsyncInFlightCount == 0) {
+      Status = RedfishRestExPrepareConnection (Instance);
+    }
+
+    if (!EFI_ERROR (Status)) {
+      Status = RedfishRestExPipelineSend (Instance, &Request->PipelineToken, Request->RequestMessage);
+    }
+
+    if (EFI_ERROR (Status)) {
+      DEBUG ((DEBUG_ERROR, "%a: Send request fail: %r\n", __FUNCTION__, Status));
+      if (Instance->AsyncInFlightCount != 0) {
+        RedfishRestExAsyncRestart (Instance);
+      } else if (!Request->Retried) {
+        Request->Retried = TRUE;
+        Instance->Flags |= RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE;
+      } else {
+        Instance->Flags |= RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE;
+        RemoveEntryList (&Request->Link);
+        RedfishRestExAsyncSignal (Request, Status);
+        RedfishRestExAsyncFreeRequest (Request);
+      }
+
+      continue;
+    }
+
+    RemoveEntryList (&Request->Link);
+    InsertTailList (&Instance->AsyncInFlight, &Request->Link);
+    Instance->AsyncInFlightCount++;
+  }
+
+  //
+  // Receive the responses which have arrived, in the order of requests.
+  //
+  while (!IsListEmpty (&Instance->AsyncInFlight)) {
+    Status = RedfishRestExAsyncReceive (Instance, &ResponseMessage);
+    if (Status == EFI_NOT_READY) {
+      break;
+    }
+
+    Request = RESTEX_ASYNC_REQUEST_FROM_LINK (GetFirstNode (&Instance->AsyncInFlight));
+    if (EFI_ERROR (Status)) {
+      //
+      // The connection is broken. Send the request again on a new connection
+      // once, and the requests behind it as well.
+      //
+      DEBUG ((DEBUG_ERROR, "%a: Receive response fail: %r\n", __FUNCTION__, Status));
+      if (Request->Retried) {
+        RemoveEntryList (&Request->Link);
+        Instance->AsyncInFlightCount--;
+        RedfishRestExAsyncSignal (Request, Status);
+        RedfishRestExAsyncFreeRequest (Request);
+      } else {
+        Request->Retried = TRUE;
+      }
+
+      RedfishRestExAsyncRestart (Instance);
+      break;
+    }
+
+    RemoveEntryList (&Request->Link);
+    Instance->AsyncInFlightCount--;
+    if (Request->RestExToken != NULL) {
+      CopyMem (Request->RestExToken->ResponseMessage, &ResponseMessage, sizeof (EFI_HTTP_MESSAGE));
+      RedfishRestExAsyncSignal (Request, EFI_SUCCESS);
+    } else {
+      RedfishRestExPipelineFreeResponse (&ResponseMessage);
+    }
+
+    RedfishRestExAsyncFreeRequest (Request);
+
+    //
+    // REST service closes the connection after this response, the requests
+    // behind it are not answered.
+    //
+    if ((Instance->Flags & RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE) != 0) {
+      RedfishRestExAsyncRestart (Instance);
+      break;
+    }
+  }
+
+  if (IsListEmpty (&Instance->AsyncQueue) && IsListEmpty (&Instance->AsyncInFlight)) {
+    gBS->SetTimer (Instance->AsyncTimer, TimerCancel, 0);
+  }
+
+  Instance->ConnectionBusy = FALSE;
+  gBS->RestoreTPL (OldTpl);
+}
+
+/**
+  The periodic timer to make progress on the asynchronous requests.
+
+  @param[in]  Event                 The event signaled.
+  @param[in]  Context               Pointer to RESTEX_INSTANCE.
+
+**/
+VOID
+EFIAPI
+RedfishRestExAsyncTimerHandler (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  RedfishRestExAsyncProcess ((RESTEX_INSTANCE *)Context);
+}
+
+/**
+  Make progress on the asynchronous requests: drop the timed out requests,
+  send the queued requests up to the in flight window and receive the
+  responses which have arrived.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+
+  @retval EFI_SUCCESS             There is no asynchronous request in progress.
+  @retval EFI_NOT_READY           Some asynchronous requests are still in progress.
+
+**/
+EFI_STATUS
+RedfishRestExAsyncPoll (
+  IN RESTEX_INSTANCE  *Instance
+  )
+{
+  RedfishRestExAsyncProcess (Instance);
+
+  if (IsListEmpty (&Instance->AsyncQueue) && IsListEmpty (&Instance->AsyncInFlight)) {
+    return EFI_SUCCESS;
+  }
+
+  return EFI_NOT_READY;
+}
+
+/**
+  Wait for all asynchronous requests to complete, so the connection can be
+  used by a synchronous request. The requests which are not complete in
+  PcdRedfishRestExAsyncDrainTimeout milliseconds are canceled, and the events
+  of their REST EX tokens are signaled with EFI_TIMEOUT.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+
+  @retval EFI_SUCCESS             There is no asynchronous request in progress.
+  @retval EFI_ACCESS_DENIED       The connection is owned by the caller of this
+                                  function, e.g. this is called from the
+                                  notification of a completed request.
+
+**/
+EFI_STATUS
+RedfishRestExAsyncDrain (
+  IN RESTEX_INSTANCE  *Instance
+  )
+{
+  EFI_STATUS            Status;
+  EFI_EVENT             TimeoutEvent;
+  EFI_TPL               OldTpl;
+  LIST_ENTRY            *Entry;
+  RESTEX_ASYNC_REQUEST  *Request;
+
+  if (Instance->ConnectionBusy) {
+    return EFI_ACCESS_DENIED;
+  }
+
+  if (RedfishRestExAsyncPoll (Instance) == EFI_SUCCESS) {
+    return EFI_SUCCESS;
+  }
+
+  Status = gBS->CreateEvent (EVT_TIMER, TPL_CALLBACK, NULL, NULL, &TimeoutEvent);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = gBS->SetTimer (
+                  TimeoutEvent,
+                  TimerRelative,
+                  MultU64x32 ((UINT64)PcdGet32 (PcdRedfishRestExAsyncDrainTimeout), TICKS_PER_MS)
+                  );
+  if (EFI_ERROR (Status)) {
+    gBS->CloseEvent (TimeoutEvent);
+    return Status;
+  }
+
+  while (RedfishRestExAsyncPoll (Instance) == EFI_NOT_READY) {
+    if (!EFI_ERROR (gBS->CheckEvent (TimeoutEvent))) {
+      //
+      // REST service doesn't answer in time. Give up the requests which
+      // are still in progress, so the connection can be used again.
+      //
+      DEBUG ((DEBUG_ERROR, "%a: Asynchronous requests are not complete in time, cancel them.\n", __FUNCTION__));
+      OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
+      NET_LIST_FOR_EACH (Entry, &Instance->AsyncQueue) {
+        Request = RESTEX_ASYNC_REQUEST_FROM_LINK (Entry);
+        RedfishRestExAsyncSignal (Request, EFI_TIMEOUT);
+      }
+
+      NET_LIST_FOR_EACH (Entry, &Instance->AsyncInFlight) {
+        Request = RESTEX_ASYNC_REQUEST_FROM_LINK (Entry);
+        RedfishRestExAsyncSignal (Request, EFI_TIMEOUT);
+      }
+
+      RedfishRestExAsyncCancelAll (Instance);
+      gBS->RestoreTPL (OldTpl);
+      break;
+    }
+  }
+
+  gBS->CloseEvent (TimeoutEvent);
+  return EFI_SUCCESS;
+}
+
+/**
+  Queue an HTTP GET request submitted by AsyncSendReceive(). The request is
+  sent once there is room in the in flight window, and RestExToken is
+  signaled when its response is received.
+
+  @param[in]  Instance              Pointer to RESTEX_INSTANCE.
+  @param[in]  RequestMessage        The HTTP request message. It must be valid until
+                                    RestExToken is signaled.
+  @param[in]  RestExToken           REST EX token to signal on completion.
+  @param[in]  TimeOutInMilliSeconds The pointer to the timeout in milliseconds, NULL
+                                    means no timeout.
+
+  @retval EFI_SUCCESS             The request is queued.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to queue the request.
+  @retval Others                  Fail to create the events of the request.
+
+**/
+EFI_STATUS
+RedfishRestExAsyncSubmit (
+  IN RESTEX_INSTANCE    *Instance,
+  IN EFI_HTTP_MESSAGE   *RequestMessage,
+  IN EFI_REST_EX_TOKEN  *RestExToken,
+  IN UINTN              *TimeOutInMilliSeconds OPTIONAL
+  )
+{
+  EFI_STATUS            Status;
+  EFI_TPL               OldTpl;
+  RESTEX_ASYNC_REQUEST  *Request;
+
+  Request = AllocateZeroPool (sizeof (RESTEX_ASYNC_REQUEST));
+  if (Request == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Request->Signature      = RESTEX_ASYNC_REQUEST_SIGNATURE;
+  Request->RestExToken    = RestExToken;
+  Request->RequestMessage = RequestMessage;
+
+  Status = gBS->CreateEvent (
+                  EVT_NOTIFY_SIGNAL,
+                  TPL_NOTIFY,
+                  RedfishRestExPipelineNotify,
+                  &Request->PipelineToken.IsTxDone,
+                  &Request->PipelineToken.HttpToken.Event
+                  );
+  if (EFI_ERROR (Status)) {
+    goto ON_ERROR;
+  }
+
+  if (TimeOutInMilliSeconds != NULL) {
+    Status = gBS->CreateEvent (EVT_TIMER, TPL_CALLBACK, NULL, NULL, &Request->TimeoutEvent);
+    if (EFI_ERROR (Status)) {
+      goto ON_ERROR;
+    }
+
+    Status = gBS->SetTimer (Request->TimeoutEvent, TimerRelative, MultU64x32 (*TimeOutInMilliSeconds, TICKS_PER_MS));
+    if (EFI_ERROR (Status)) {
+      goto ON_ERROR;
+    }
+  }
+
+  ZeroMem (RestExToken->ResponseMessage, sizeof (EFI_HTTP_MESSAGE));
+  RestExToken->Status = EFI_NOT_READY;
+
+  OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
+  InsertTailList (&Instance->AsyncQueue, &Request->Link);
+  gBS->SetTimer (Instance->AsyncTimer, TimerPeriodic, RESTEX_ASYNC_POLL_INTERVAL);
+  gBS->RestoreTPL (OldTpl);
+
+  //
+  // Send it right away if the in flight window has room.
+  //
+  RedfishRestExAsyncProcess (Instance);
+  return EFI_SUCCESS;
+
+ON_ERROR:
+  RedfishRestExAsyncFreeRequest (Request);
+  return Status;
+}
+
+/**
+  Cancel the asynchronous request of RestExToken. The event of RestExToken
+  is signaled with EFI_ABORTED.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+  @param[in]  RestExToken         REST EX token of the request to cancel.
+
+  @retval EFI_ABORTED             The request is canceled.
+  @retval EFI_NOT_FOUND           There is no request of RestExToken in progress.
+
+**/
+EFI_STATUS
+RedfishRestExAsyncCancel (
+  IN RESTEX_INSTANCE    *Instance,
+  IN EFI_REST_EX_TOKEN  *RestExToken
+  )
+{
+  EFI_STATUS            Status;
+  EFI_TPL               OldTpl;
+  LIST_ENTRY            *Entry;
+  RESTEX_ASYNC_REQUEST  *Request;
+
+  Status = EFI_NOT_FOUND;
+  OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
+
+  //
+  // The request is released later. A queued one is dropped before it is
+  // sent, an in flight one is dropped when its response arrives.
+  //
+  NET_LIST_FOR_EACH (Entry, &Instance->AsyncQueue) {
+    Request = RESTEX_ASYNC_REQUEST_FROM_LINK (Entry);
+    if (Request->RestExToken == RestExToken) {
+      RedfishRestExAsyncSignal (Request, EFI_ABORTED);
+      Status = EFI_ABORTED;
+    }
+  }
+
+  NET_LIST_FOR_EACH (Entry, &Instance->AsyncInFlight) {
+    Request = RESTEX_ASYNC_REQUEST_FROM_LINK (Entry);
+    if (Request->RestExToken == RestExToken) {
+      RedfishRestExAsyncSignal (Request, EFI_ABORTED);
+      Status = EFI_ABORTED;
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return Status;
+}
+
+/**
+  Cancel all asynchronous requests of this instance and stop the timer. It
+  is called when the instance is unconfigured or destroyed.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+
+**/
+VOID
+RedfishRestExAsyncCancelAll (
+  IN RESTEX_INSTANCE  *Instance
+  )
+{
+  EFI_TPL               OldTpl;
+  LIST_ENTRY            *Entry;
+  RESTEX_ASYNC_REQUEST  *Request;
+
+  OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
+
+  gBS->SetTimer (Instance->AsyncTimer, TimerCancel, 0);
+
+  if (!IsListEmpty (&Instance->AsyncInFlight)) {
+    //
+    // Drop the tokens of in flight requests from HTTP instance before they
+    // are released.
+    //
+    Instance->HttpIo.Http->Configure (Instance->HttpIo.Http, NULL);
+    Instance->Flags         |= RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE;
+    Instance->AsyncRxPending = FALSE;
+  }
+
+  while (!IsListEmpty (&Instance->AsyncInFlight)) {
+    Entry = GetFirstNode (&Instance->AsyncInFlight);
+    RemoveEntryList (Entry);
+    InsertTailList (&Instance->AsyncQueue, Entry);
+  }
+
+  while (!IsListEmpty (&Instance->AsyncQueue)) {
+    Entry   = GetFirstNode (&Instance->AsyncQueue);
+    Request = RESTEX_ASYNC_REQUEST_FROM_LINK (Entry);
+    RemoveEntryList (Entry);
+    RedfishRestExAsyncSignal (Request, EFI_ABORTED);
+    RedfishRestExAsyncFreeRequest (Request);
+  }
+
+  Instance->AsyncInFlightCount = 0;
+  gBS->RestoreTPL (OldTpl);
+}
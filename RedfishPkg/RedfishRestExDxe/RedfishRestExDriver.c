@@ -74,6 +74,9 @@ RestExDestroyInstance (
   IN RESTEX_INSTANCE         *Instance
   )
 {
+  RedfishRestExAsyncCancelAll (Instance);
+  gBS->CloseEvent (Instance->AsyncTimer);
+
   HttpIoDestroyIo (&(Instance->HttpIo));
 
   FreePool (Instance);
@@ -112,6 +115,21 @@ RestExCreateInstance (
   RestExIns->Service   = Service;
 
   CopyMem (&RestExIns->RestEx, &mRedfishRestExProtocol, sizeof (RestExIns->RestEx));
+  CopyMem (&RestExIns->Pipeline, &mRedfishRestExPipelineProtocol, sizeof (RestExIns->Pipeline));
+
+  InitializeListHead (&RestExIns->AsyncQueue);
+  InitializeListHead (&RestExIns->AsyncInFlight);
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  TPL_CALLBACK,
+                  RedfishRestExAsyncTimerHandler,
+                  RestExIns,
+                  &RestExIns->AsyncTimer
+                  );
+  if (EFI_ERROR (Status)) {
+    FreePool (RestExIns);
+    return Status;
+  }
 
   //
   // Create a HTTP_IO to access the HTTP service.
@@ -126,6 +144,7 @@ RestExCreateInstance (
              &(RestExIns->HttpIo)
              );
   if (EFI_ERROR (Status)) {
+    gBS->CloseEvent (RestExIns->AsyncTimer);
     FreePool (RestExIns);
     return Status;
   }
@@ -630,12 +649,14 @@ RedfishRestExServiceBindingCreateChild (
   ASSERT (Instance != NULL);
 
   //
-  // Install the RestEx protocol onto ChildHandle
+  // Install the RestEx protocol and the pipeline protocol onto ChildHandle
   //
   Status = gBS->InstallMultipleProtocolInterfaces (
                   ChildHandle,
                   &gEfiRestExProtocolGuid,
                   &Instance->RestEx,
+                  &gEdkIIRedfishRestExPipelineProtocolGuid,
+                  &Instance->Pipeline,
                   NULL
                   );
   if (EFI_ERROR (Status)) {
@@ -660,6 +681,8 @@ RedfishRestExServiceBindingCreateChild (
            Instance->ChildHandle,
            &gEfiRestExProtocolGuid,
            &Instance->RestEx,
+           &gEdkIIRedfishRestExPipelineProtocolGuid,
+           &Instance->Pipeline,
            NULL
            );
 
@@ -692,6 +715,8 @@ RedfishRestExServiceBindingCreateChild (
             Instance->ChildHandle,
             &gEfiRestExProtocolGuid,
             &Instance->RestEx,
+            &gEdkIIRedfishRestExPipelineProtocolGuid,
+            &Instance->Pipeline,
             NULL
             );
 
@@ -806,10 +831,13 @@ RedfishRestExServiceBindingDestroyChild (
   //
   // Uninstall the RestEx protocol first to enable a top down destruction.
   //
-  Status = gBS->UninstallProtocolInterface (
+  Status = gBS->UninstallMultipleProtocolInterfaces (
                   ChildHandle,
                   &gEfiRestExProtocolGuid,
-                  RestEx
+                  RestEx,
+                  &gEdkIIRedfishRestExPipelineProtocolGuid,
+                  &Instance->Pipeline,
+                  NULL
                   );
 
   OldTpl = gBS->RaiseTPL (TPL_CALLBACK);
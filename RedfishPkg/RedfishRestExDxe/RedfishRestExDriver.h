@@ -29,6 +29,7 @@
 /// UEFI Driver Model Protocols
 ///
 #include <Protocol/DriverBinding.h>
+#include <Protocol/EdkIIRedfishRestExPipeline.h>
 #include <Protocol/RestEx.h>
 #include <Protocol/ServiceBinding.h>
 
@@ -42,6 +43,7 @@ extern EFI_UNICODE_STRING_TABLE      *gRedfishRestExControllerNameTable;
 extern EFI_DRIVER_BINDING_PROTOCOL   gRedfishRestExDriverBinding;
 extern EFI_SERVICE_BINDING_PROTOCOL  mRedfishRestExServiceBinding;
 extern EFI_REST_EX_PROTOCOL          mRedfishRestExProtocol;
+extern EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL  mRedfishRestExPipelineProtocol;
 ///
 /// RestEx service block
 ///
@@ -66,6 +68,9 @@ typedef struct _RESTEX_INSTANCE RESTEX_INSTANCE;
 #define RESTEX_INSTANCE_FROM_THIS(a)  \
   CR (a, RESTEX_INSTANCE, RestEx, RESTEX_INSTANCE_SIGNATURE)
 
+#define RESTEX_INSTANCE_FROM_PIPELINE(a)  \
+  CR (a, RESTEX_INSTANCE, Pipeline, RESTEX_INSTANCE_SIGNATURE)
+
 
 #define RESTEX_STATE_UNCONFIGED     0
 #define RESTEX_STATE_CONFIGED       1
@@ -92,12 +97,14 @@ struct _RESTEX_SERVICE {
 
 #define RESTEX_INSTANCE_FLAGS_TLS_RETRY       0x00000001
 #define RESTEX_INSTANCE_FLAGS_TCP_ERROR_RETRY 0x00000002
+#define RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE 0x00000004  ///< REST service closes the connection after last response.
 
 struct _RESTEX_INSTANCE {
   UINT32                        Signature;
   LIST_ENTRY                    Link;
 
   EFI_REST_EX_PROTOCOL          RestEx;
+  EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL  Pipeline;
 
   INTN                          State;
   BOOLEAN                       InDestroy;
@@ -113,6 +120,24 @@ struct _RESTEX_INSTANCE {
   HTTP_IO                       HttpIo;
 
   UINT32                        Flags;
+
+  //
+  // TRUE while a request owns the connection, the asynchronous requests
+  // are not processed meanwhile.
+  //
+  BOOLEAN                       ConnectionBusy;
+
+  //
+  // Requests of AsyncSendReceive(). The queued requests are not sent yet,
+  // the in flight requests wait for their responses in the order they are
+  // sent.
+  //
+  LIST_ENTRY                    AsyncQueue;
+  LIST_ENTRY                    AsyncInFlight;
+  UINTN                         AsyncInFlightCount;
+  EFI_EVENT                     AsyncTimer;
+  BOOLEAN                       AsyncRxPending;       ///< Response token of the first in flight request is queued.
+  HTTP_IO_RESPONSE_DATA         AsyncResponseData;
 };
 
 typedef struct {
@@ -374,6 +399,31 @@ ResetHttpTslSession (
   IN   RESTEX_INSTANCE  *Instance
 );
 
+/**
+  Cancel all asynchronous requests of this instance and stop the timer. It
+  is called when the instance is unconfigured or destroyed.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+
+**/
+VOID
+RedfishRestExAsyncCancelAll (
+  IN RESTEX_INSTANCE  *Instance
+  );
+
+/**
+  The periodic timer to make progress on the asynchronous requests.
+
+  @param[in]  Event                 The event signaled.
+  @param[in]  Context               Pointer to RESTEX_INSTANCE.
+
+**/
+VOID
+EFIAPI
+RedfishRestExAsyncTimerHandler (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  );
 
 /**
   Callback function which provided by user to remove one node in NetDestroyLinkList process.
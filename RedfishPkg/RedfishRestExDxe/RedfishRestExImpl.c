@@ -80,19 +80,23 @@ RedfishCheckHttpReceiveStatus (
       ReturnStatus = EFI_DEVICE_ERROR;
     }
   } else {
-      if (HttpIoReceiveStatus == EFI_CONNECTION_FIN) {
-        if ((Instance->Flags & RESTEX_INSTANCE_FLAGS_TLS_RETRY) != 0) {
-          DEBUG ((DEBUG_ERROR, "%a: REST_EX Send and receive fail even with a new TLS session.\n", __FUNCTION__));
-          ReturnStatus = EFI_DEVICE_ERROR;
-        }
-        Instance->Flags |= RESTEX_INSTANCE_FLAGS_TLS_RETRY;
-        Status = ResetHttpTslSession (Instance);
-        if (EFI_ERROR (Status)) {
-          DEBUG ((DEBUG_ERROR, "%a: Reset HTTP instance fail.\n", __FUNCTION__));
-          ReturnStatus = EFI_DEVICE_ERROR;
-        }
+    //
+    // EFI_CONNECTION_FIN, REST service closed the connection. Send the
+    // request again on a new session, but only once.
+    //
+    if ((Instance->Flags & RESTEX_INSTANCE_FLAGS_TLS_RETRY) != 0) {
+      DEBUG ((DEBUG_ERROR, "%a: REST_EX Send and receive fail even with a new TLS session.\n", __FUNCTION__));
+      ReturnStatus = EFI_DEVICE_ERROR;
+    } else {
+      Instance->Flags |= RESTEX_INSTANCE_FLAGS_TLS_RETRY;
+      Status = ResetHttpTslSession (Instance);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_ERROR, "%a: Reset HTTP instance fail.\n", __FUNCTION__));
+        ReturnStatus = EFI_DEVICE_ERROR;
+      } else {
         return EFI_NOT_READY;
       }
+    }
   }
   //
   // Clean TLS new session retry and error try flags.
@@ -101,6 +105,209 @@ RedfishCheckHttpReceiveStatus (
   return ReturnStatus;
 }
 
+/**
+  This function makes the connection ready for the next HTTP request. The
+  connection to REST service is kept alive across the requests, it is only
+  reset when REST service indicated it closes the connection after the last
+  response, so the next request goes to a new connection instead of failing
+  on the closed one.
+
+  @param[in]  Instance            Pointer to EFI_REST_EX_PROTOCOL instance for a particular
+                                  REST service.
+
+  @retval EFI_SUCCESS             The connection is ready.
+  @retval Others                  Fail to reset the HTTP instance.
+
+**/
+EFI_STATUS
+RedfishRestExPrepareConnection (
+  IN RESTEX_INSTANCE  *Instance
+  )
+{
+  if ((Instance->Flags & RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE) == 0) {
+    return EFI_SUCCESS;
+  }
+
+  DEBUG ((DEBUG_INFO, "%a: Connection is closed by REST service, reconnect.\n", __FUNCTION__));
+  Instance->Flags &= ~RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE;
+  return ResetHttpTslSession (Instance);
+}
+
+/**
+  This function checks the "Connection" header in HTTP response, and records
+  whether REST service closes the connection after this response.
+
+  @param[in]  Instance            Pointer to EFI_REST_EX_PROTOCOL instance for a particular
+                                  REST service.
+  @param[in]  HeaderCount         Number of headers in Headers.
+  @param[in]  Headers             HTTP response headers.
+
+**/
+VOID
+RedfishRestExCheckConnectionHeader (
+  IN RESTEX_INSTANCE  *Instance,
+  IN UINTN            HeaderCount,
+  IN EFI_HTTP_HEADER  *Headers
+  )
+{
+  EFI_HTTP_HEADER *Header;
+
+  if (HeaderCount == 0 || Headers == NULL) {
+    return;
+  }
+
+  Header = HttpFindHeader (HeaderCount, Headers, REDFISH_HTTP_HEADER_CONNECTION);
+  if (Header != NULL && Header->FieldValue != NULL &&
+      AsciiStriCmp (Header->FieldValue, REDFISH_HTTP_CONNECTION_CLOSE) == 0) {
+    Instance->Flags |= RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE;
+  }
+}
+
+/**
+  This function receives the rest of HTTP response after the response status
+  and headers are received in ResponseData. The status code and headers are
+  handed over to ResponseMessage, and the body of response is received to
+  ResponseMessage according to Content-Length or chunked transfer coding.
+
+  @param[in]      Instance            Pointer to EFI_REST_EX_PROTOCOL instance for a particular
+                                      REST service.
+  @param[in]      ResponseData        The HTTP response status and headers received by
+                                      HttpIoRecvResponse().
+  @param[in,out]  ResponseMessage     Pointer to the HTTP response message to return.
+
+  @retval EFI_SUCCESS             The HTTP response is received.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to process.
+  @retval Others                  Other errors as indicated.
+
+**/
+EFI_STATUS
+RedfishRestExReceiveResponseMessage (
+  IN     RESTEX_INSTANCE        *Instance,
+  IN     HTTP_IO_RESPONSE_DATA  *ResponseData,
+  IN OUT EFI_HTTP_MESSAGE       *ResponseMessage
+  )
+{
+  EFI_STATUS      Status;
+  UINTN           TotalReceivedSize;
+  UINTN           Index;
+  LIST_ENTRY      *ChunkListLink;
+  HTTP_IO_CHUNKS  *ThisChunk;
+  BOOLEAN         CopyChunkData;
+  BOOLEAN         IsGetChunkedTransfer;
+
+  Status               = EFI_SUCCESS;
+  IsGetChunkedTransfer = FALSE;
+
+  //
+  // Ready to return the StatusCode, Header info and BodyLength.
+  //
+  ResponseMessage->Data.Response = AllocateZeroPool (sizeof (EFI_HTTP_RESPONSE_DATA));
+  if (ResponseMessage->Data.Response == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  ResponseMessage->Data.Response->StatusCode = ResponseData->Response.StatusCode;
+  ResponseMessage->HeaderCount = ResponseData->HeaderCount;
+  ResponseMessage->Headers = ResponseData->Headers;
+
+  RedfishRestExCheckConnectionHeader (Instance, ResponseMessage->HeaderCount, ResponseMessage->Headers);
+
+  //
+  // Get response message body.
+  //
+  if (ResponseMessage->HeaderCount > 0) {
+    Status = HttpIoGetContentLength (ResponseMessage->HeaderCount, ResponseMessage->Headers, &ResponseMessage->BodyLength);
+    if (EFI_ERROR (Status) && Status != EFI_NOT_FOUND) {
+      return Status;
+    }
+
+    if (Status == EFI_NOT_FOUND) {
+      ASSERT (ResponseMessage->BodyLength == 0);
+    }
+
+    if (ResponseMessage->BodyLength == 0) {
+      //
+      // Check if Chunked Transfer Coding.
+      //
+      Status = HttpIoGetChunkedTransferContent (
+                 &(Instance->HttpIo),
+                 ResponseMessage->HeaderCount,
+                 ResponseMessage->Headers,
+                 &ChunkListLink,
+                 &ResponseMessage->BodyLength
+                 );
+      if (EFI_ERROR (Status) && Status != EFI_NOT_FOUND) {
+        return Status;
+      }
+      if (Status == EFI_SUCCESS &&
+          ChunkListLink != NULL &&
+          !IsListEmpty(ChunkListLink) &&
+          ResponseMessage->BodyLength != 0) {
+        IsGetChunkedTransfer = TRUE;
+        //
+        // Copy data to Message body.
+        //
+        CopyChunkData = TRUE;
+        ResponseMessage->Body = AllocateZeroPool (ResponseMessage->BodyLength);
+        if (ResponseMessage->Body == NULL) {
+          Status = EFI_OUT_OF_RESOURCES;
+          CopyChunkData = FALSE;
+        }
+        Index = 0;
+        while (!IsListEmpty(ChunkListLink)) {
+          ThisChunk = (HTTP_IO_CHUNKS *)GetFirstNode (ChunkListLink);
+          if (CopyChunkData) {
+            CopyMem(((UINT8 *)ResponseMessage->Body + Index), (UINT8 *)ThisChunk->Data, ThisChunk->Length);
+            Index += ThisChunk->Length;
+          }
+          RemoveEntryList (&ThisChunk->NextChunk);
+          FreePool ((VOID *)ThisChunk->Data);
+          FreePool ((VOID *)ThisChunk);
+        };
+        FreePool ((VOID *)ChunkListLink);
+        if (!CopyChunkData) {
+          return Status;
+        }
+      }
+    }
+    Status = EFI_SUCCESS;
+  }
+
+  //
+  // Ready to return the Body from REST service if have any.
+  //
+  if (ResponseMessage->BodyLength > 0 && !IsGetChunkedTransfer) {
+    ResponseData->HeaderCount = 0;
+    ResponseData->Headers = NULL;
+
+    ResponseMessage->Body = AllocateZeroPool (ResponseMessage->BodyLength);
+    if (ResponseMessage->Body == NULL) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    //
+    // Only receive the Body.
+    //
+    TotalReceivedSize = 0;
+    while (TotalReceivedSize < ResponseMessage->BodyLength) {
+      ResponseData->BodyLength = ResponseMessage->BodyLength - TotalReceivedSize;
+      ResponseData->Body = (CHAR8 *) ResponseMessage->Body + TotalReceivedSize;
+      Status = HttpIoRecvResponse (
+                 &(Instance->HttpIo),
+                 FALSE,
+                 ResponseData
+                 );
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+
+      TotalReceivedSize += ResponseData->BodyLength;
+    }
+    DEBUG ((DEBUG_INFO, "Total of lengh of Response :%d\n", TotalReceivedSize));
+  }
+  return Status;
+}
+
 /**
   This function send the HTTP request without body to see
   if the write to URL is permitted by Redfish service. This function
@@ -24,6 +24,7 @@
 #include <Library/UefiLib.h>
 #include <Library/UefiBootServicesTableLib.h>
 #include <Library/UefiDriverEntryPoint.h>
+#include <Library/RedfishPerfLib.h>
 
 ///
 /// UEFI Driver Model Protocols
@@ -34,6 +35,38 @@
 
 #include "RedfishRestExDriver.h"
 
+#define REDFISH_HTTP_HEADER_CONNECTION   "Connection"
+#define REDFISH_HTTP_CONNECTION_CLOSE    "close"
+
+#define RESTEX_ASYNC_POLL_INTERVAL       EFI_TIMER_PERIOD_MILLISECONDS (10)
+
+///
+/// The HTTP token of one outstanding request on the connection.
+///
+typedef struct {
+  EFI_HTTP_TOKEN    HttpToken;
+  EFI_HTTP_MESSAGE  HttpMessage;
+  BOOLEAN           IsTxDone;
+} RESTEX_PIPELINE_TOKEN;
+
+#define RESTEX_ASYNC_REQUEST_SIGNATURE   SIGNATURE_32 ('R', 'E', 'A', 'R')
+
+///
+/// The request submitted by AsyncSendReceive().
+///
+typedef struct {
+  UINT32                 Signature;
+  LIST_ENTRY             Link;
+  EFI_REST_EX_TOKEN      *RestExToken;      ///< NULL once the caller is signaled.
+  EFI_HTTP_MESSAGE       *RequestMessage;
+  RESTEX_PIPELINE_TOKEN  PipelineToken;
+  EFI_EVENT              TimeoutEvent;
+  BOOLEAN                Retried;
+} RESTEX_ASYNC_REQUEST;
+
+#define RESTEX_ASYNC_REQUEST_FROM_LINK(a)  \
+  CR (a, RESTEX_ASYNC_REQUEST, Link, RESTEX_ASYNC_REQUEST_SIGNATURE)
+
 /**
   This function check
 
@@ -53,6 +86,235 @@ RedfishCheckHttpReceiveStatus (
   IN EFI_STATUS HttpIoReceiveStatus
   );
 
+/**
+  This function makes the connection ready for the next HTTP request. The
+  connection to REST service is kept alive across the requests, it is only
+  reset when REST service indicated it closes the connection after the last
+  response, so the next request goes to a new connection instead of failing
+  on the closed one.
+
+  @param[in]  Instance            Pointer to EFI_REST_EX_PROTOCOL instance for a particular
+                                  REST service.
+
+  @retval EFI_SUCCESS             The connection is ready.
+  @retval Others                  Fail to reset the HTTP instance.
+
+**/
+EFI_STATUS
+RedfishRestExPrepareConnection (
+  IN RESTEX_INSTANCE  *Instance
+  );
+
+/**
+  This function checks the "Connection" header in HTTP response, and records
+  whether REST service closes the connection after this response.
+
+  @param[in]  Instance            Pointer to EFI_REST_EX_PROTOCOL instance for a particular
+                                  REST service.
+  @param[in]  HeaderCount         Number of headers in Headers.
+  @param[in]  Headers             HTTP response headers.
+
+**/
+VOID
+RedfishRestExCheckConnectionHeader (
+  IN RESTEX_INSTANCE  *Instance,
+  IN UINTN            HeaderCount,
+  IN EFI_HTTP_HEADER  *Headers
+  );
+
+/**
+  This function receives the rest of HTTP response after the response status
+  and headers are received in ResponseData. The status code and headers are
+  handed over to ResponseMessage, and the body of response is received to
+  ResponseMessage according to Content-Length or chunked transfer coding.
+
+  @param[in]      Instance            Pointer to EFI_REST_EX_PROTOCOL instance for a particular
+                                      REST service.
+  @param[in]      ResponseData        The HTTP response status and headers received by
+                                      HttpIoRecvResponse().
+  @param[in,out]  ResponseMessage     Pointer to the HTTP response message to return.
+
+  @retval EFI_SUCCESS             The HTTP response is received.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to process.
+  @retval Others                  Other errors as indicated.
+
+**/
+EFI_STATUS
+RedfishRestExReceiveResponseMessage (
+  IN     RESTEX_INSTANCE        *Instance,
+  IN     HTTP_IO_RESPONSE_DATA  *ResponseData,
+  IN OUT EFI_HTTP_MESSAGE       *ResponseMessage
+  );
+
+/**
+  Request RedfishRestExPipelineNotifyDpc as a DPC at TPL_CALLBACK.
+
+  @param[in]  Event                 The event signaled.
+  @param[in]  Context               The opaque parameter to the function.
+
+**/
+VOID
+EFIAPI
+RedfishRestExPipelineNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  );
+
+/**
+  Release the HTTP response message.
+
+  @param[in]  ResponseMessage     The HTTP response message to release.
+
+**/
+VOID
+RedfishRestExPipelineFreeResponse (
+  IN EFI_HTTP_MESSAGE  *ResponseMessage
+  );
+
+/**
+  Write the HTTP request to the connection. This function returns once the
+  request is transmitted, it doesn't wait for the response.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+  @param[in]  PipelineToken       The token of this request.
+  @param[in]  RequestMessage      The HTTP request message.
+
+  @retval EFI_SUCCESS             The request is transmitted.
+  @retval Others                  Fail to transmit the request.
+
+**/
+EFI_STATUS
+RedfishRestExPipelineSend (
+  IN RESTEX_INSTANCE        *Instance,
+  IN RESTEX_PIPELINE_TOKEN  *PipelineToken,
+  IN EFI_HTTP_MESSAGE       *RequestMessage
+  );
+
+/**
+  Send a list of HTTP GET requests to REST service and receive the responses
+  in the order of the requests. See EDKII_REDFISH_REST_EX_PIPELINE_SEND_RECEIVE.
+
+  @param[in]  This                Pointer to EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL instance.
+  @param[in]  RequestCount        Number of messages in RequestMessage, ResponseMessage
+                                  and ResponseStatus.
+  @param[in]  RequestMessage      Array of HTTP GET request messages.
+  @param[out] ResponseMessage     Array to receive the HTTP response messages.
+  @param[out] ResponseStatus      Array to receive the status of each request.
+
+  @retval EFI_SUCCESS             All requests are processed. Check ResponseStatus for
+                                  the result of each request.
+  @retval EFI_INVALID_PARAMETER   This, RequestMessage, ResponseMessage or ResponseStatus
+                                  is NULL, or RequestCount is zero.
+  @retval EFI_UNSUPPORTED         Any of the requests is not HTTP GET.
+  @retval EFI_NO_MEDIA            There is no media on the network interface.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to process.
+  @retval EFI_ACCESS_DENIED       The connection is in use by the caller of this function.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishRestExPipelineSendReceive (
+  IN  EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL  *This,
+  IN  UINTN                                    RequestCount,
+  IN  EFI_HTTP_MESSAGE                         *RequestMessage,
+  OUT EFI_HTTP_MESSAGE                         *ResponseMessage,
+  OUT EFI_STATUS                               *ResponseStatus
+  );
+
+/**
+  Make progress on the asynchronous requests of this REST EX child. See
+  EDKII_REDFISH_REST_EX_PIPELINE_POLL.
+
+  @param[in]  This                Pointer to EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL instance.
+
+  @retval EFI_SUCCESS             There is no asynchronous request in progress.
+  @retval EFI_NOT_READY           Some asynchronous requests are still in progress.
+  @retval EFI_INVALID_PARAMETER   This is NULL.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishRestExPipelinePoll (
+  IN  EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL  *This
+  );
+
+/**
+  Queue an HTTP GET request submitted by AsyncSendReceive(). The request is
+  sent once there is room in the in flight window, and RestExToken is
+  signaled when its response is received.
+
+  @param[in]  Instance              Pointer to RESTEX_INSTANCE.
+  @param[in]  RequestMessage        The HTTP request message. It must be valid until
+                                    RestExToken is signaled.
+  @param[in]  RestExToken           REST EX token to signal on completion.
+  @param[in]  TimeOutInMilliSeconds The pointer to the timeout in milliseconds, NULL
+                                    means no timeout.
+
+  @retval EFI_SUCCESS             The request is queued.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to queue the request.
+  @retval Others                  Fail to create the events of the request.
+
+**/
+EFI_STATUS
+RedfishRestExAsyncSubmit (
+  IN RESTEX_INSTANCE    *Instance,
+  IN EFI_HTTP_MESSAGE   *RequestMessage,
+  IN EFI_REST_EX_TOKEN  *RestExToken,
+  IN UINTN              *TimeOutInMilliSeconds OPTIONAL
+  );
+
+/**
+  Cancel the asynchronous request of RestExToken. The event of RestExToken
+  is signaled with EFI_ABORTED.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+  @param[in]  RestExToken         REST EX token of the request to cancel.
+
+  @retval EFI_ABORTED             The request is canceled.
+  @retval EFI_NOT_FOUND           There is no request of RestExToken in progress.
+
+**/
+EFI_STATUS
+RedfishRestExAsyncCancel (
+  IN RESTEX_INSTANCE    *Instance,
+  IN EFI_REST_EX_TOKEN  *RestExToken
+  );
+
+/**
+  Make progress on the asynchronous requests: drop the timed out requests,
+  send the queued requests up to the in flight window and receive the
+  responses which have arrived.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+
+  @retval EFI_SUCCESS             There is no asynchronous request in progress.
+  @retval EFI_NOT_READY           Some asynchronous requests are still in progress.
+
+**/
+EFI_STATUS
+RedfishRestExAsyncPoll (
+  IN RESTEX_INSTANCE  *Instance
+  );
+
+/**
+  Wait for all asynchronous requests to complete, so the connection can be
+  used by a synchronous request. The requests which are not complete in
+  PcdRedfishRestExAsyncDrainTimeout milliseconds are canceled, and the events
+  of their REST EX tokens are signaled with EFI_TIMEOUT.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+
+  @retval EFI_SUCCESS             There is no asynchronous request in progress.
+  @retval EFI_ACCESS_DENIED       The connection is owned by the caller of this
+                                  function, e.g. this is called from the
+                                  notification of a completed request.
+
+**/
+EFI_STATUS
+RedfishRestExAsyncDrain (
+  IN RESTEX_INSTANCE  *Instance
+  );
+
 /**
   This function send the HTTP request without body to see
   if the write to URL is permitted by Redfish service. This function
@@ -0,0 +1,365 @@
+/** @file
+  Implementation of EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL interfaces.
+
+  The HTTP GET requests are written to the kept alive connection one after
+  another without waiting for the responses. Then the responses are received
+  in the order of requests, so the list of requests costs about one round
+  trip to REST service instead of one round trip per request.
+
+  (C) Copyright 2026 Hewlett Packard Enterprise Development LP<BR>
+
+  SPDX-License-Identifier: BSD-2-Clause-Patent
+
+**/
+#include <Uefi.h>
+#include <Library/PcdLib.h>
+#include "RedfishRestExInternal.h"
+
+EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL  mRedfishRestExPipelineProtocol = {
+  RedfishRestExPipelineSendReceive,
+  RedfishRestExPipelinePoll
+};
+
+/**
+  Notify the callback function when the request is transmitted.
+
+  @param[in]  Context         The opaque parameter to the function.
+
+**/
+VOID
+EFIAPI
+RedfishRestExPipelineNotifyDpc (
+  IN VOID  *Context
+  )
+{
+  *((BOOLEAN *) Context) = TRUE;
+}
+
+/**
+  Request RedfishRestExPipelineNotifyDpc as a DPC at TPL_CALLBACK.
+
+  @param[in]  Event                 The event signaled.
+  @param[in]  Context               The opaque parameter to the function.
+
+**/
+VOID
+EFIAPI
+RedfishRestExPipelineNotify (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  QueueDpc (TPL_CALLBACK, RedfishRestExPipelineNotifyDpc, Context);
+}
+
+/**
+  Release the HTTP response message.
+
+  @param[in]  ResponseMessage     The HTTP response message to release.
+
+**/
+VOID
+RedfishRestExPipelineFreeResponse (
+  IN EFI_HTTP_MESSAGE  *ResponseMessage
+  )
+{
+  if (ResponseMessage->Data.Response != NULL) {
+    FreePool (ResponseMessage->Data.Response);
+  }
+
+  if (ResponseMessage->Headers != NULL) {
+    HttpFreeHeaderFields (ResponseMessage->Headers, ResponseMessage->HeaderCount);
+  }
+
+  if (ResponseMessage->Body != NULL) {
+    FreePool (ResponseMessage->Body);
+  }
+
+  ZeroMem (ResponseMessage, sizeof (EFI_HTTP_MESSAGE));
+}
+
+/**
+  Write the HTTP request to the connection. This function returns once the
+  request is transmitted, it doesn't wait for the response.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+  @param[in]  PipelineToken       The token of this request.
+  @param[in]  RequestMessage      The HTTP request message.
+
+  @retval EFI_SUCCESS             The request is transmitted.
+  @retval Others                  Fail to transmit the request.
+
+**/
+EFI_STATUS
+RedfishRestExPipelineSend (
+  IN RESTEX_INSTANCE        *Instance,
+  IN RESTEX_PIPELINE_TOKEN  *PipelineToken,
+  IN EFI_HTTP_MESSAGE       *RequestMessage
+  )
+{
+  EFI_STATUS         Status;
+  EFI_HTTP_PROTOCOL  *Http;
+
+  CopyMem (&PipelineToken->HttpMessage, RequestMessage, sizeof (EFI_HTTP_MESSAGE));
+  PipelineToken->HttpToken.Status  = EFI_NOT_READY;
+  PipelineToken->HttpToken.Message = &PipelineToken->HttpMessage;
+  PipelineToken->IsTxDone          = FALSE;
+
+  Http   = Instance->HttpIo.Http;
+  Status = Http->Request (Http, &PipelineToken->HttpToken);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  while (!PipelineToken->IsTxDone) {
+    Http->Poll (Http);
+  }
+
+  return PipelineToken->HttpToken.Status;
+}
+
+/**
+  Receive the HTTP response of the oldest outstanding request on the connection.
+
+  @param[in]  Instance            Pointer to RESTEX_INSTANCE.
+  @param[out] ResponseMessage     Pointer to receive the HTTP response message.
+
+  @retval EFI_SUCCESS             The complete HTTP response is received.
+  @retval Others                  Fail to receive the response.
+
+**/
+EFI_STATUS
+RedfishRestExPipelineReceive (
+  IN  RESTEX_INSTANCE   *Instance,
+  OUT EFI_HTTP_MESSAGE  *ResponseMessage
+  )
+{
+  EFI_STATUS             Status;
+  HTTP_IO_RESPONSE_DATA  ResponseData;
+
+  ZeroMem (&ResponseData, sizeof (HTTP_IO_RESPONSE_DATA));
+  Status = HttpIoRecvResponse (&(Instance->HttpIo), TRUE, &ResponseData);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Status = RedfishRestExReceiveResponseMessage (Instance, &ResponseData, ResponseMessage);
+  if (EFI_ERROR (Status)) {
+    RedfishRestExPipelineFreeResponse (ResponseMessage);
+  }
+
+  return Status;
+}
+
+/**
+  Send a list of HTTP GET requests to REST service and receive the responses
+  in the order of the requests. See EDKII_REDFISH_REST_EX_PIPELINE_SEND_RECEIVE.
+
+  @param[in]  This                Pointer to EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL instance.
+  @param[in]  RequestCount        Number of messages in RequestMessage, ResponseMessage
+                                  and ResponseStatus.
+  @param[in]  RequestMessage      Array of HTTP GET request messages.
+  @param[out] ResponseMessage     Array to receive the HTTP response messages.
+  @param[out] ResponseStatus      Array to receive the status of each request.
+
+  @retval EFI_SUCCESS             All requests are processed. Check ResponseStatus for
+                                  the result of each request.
+  @retval EFI_INVALID_PARAMETER   This, RequestMessage, ResponseMessage or ResponseStatus
+                                  is NULL, or RequestCount is zero.
+  @retval EFI_UNSUPPORTED         Any of the requests is not HTTP GET.
+  @retval EFI_NO_MEDIA            There is no media on the network interface.
+  @retval EFI_OUT_OF_RESOURCES    Not enough memory to process.
+  @retval EFI_ACCESS_DENIED       The connection is in use by the caller of this function.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishRestExPipelineSendReceive (
+  IN  EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL  *This,
+  IN  UINTN                                    RequestCount,
+  IN  EFI_HTTP_MESSAGE                         *RequestMessage,
+  OUT EFI_HTTP_MESSAGE                         *ResponseMessage,
+  OUT EFI_STATUS                               *ResponseStatus
+  )
+{
+  EFI_STATUS             Status;
+  RESTEX_INSTANCE        *Instance;
+  RESTEX_PIPELINE_TOKEN  *Tokens;
+  BOOLEAN                MediaPresent;
+  BOOLEAN                Retried;
+  UINTN                  Depth;
+  UINTN                  Window;
+  UINTN                  Sent;
+  UINTN                  Received;
+  UINTN                  Index;
+
+  if ((This == NULL) || (RequestMessage == NULL) || (ResponseMessage == NULL) ||
+      (ResponseStatus == NULL) || (RequestCount == 0)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  for (Index = 0; Index < RequestCount; Index++) {
+    if ((RequestMessage[Index].Data.Request == NULL) ||
+        (RequestMessage[Index].Data.Request->Method != HttpMethodGet)) {
+      return EFI_UNSUPPORTED;
+    }
+  }
+
+  Instance = RESTEX_INSTANCE_FROM_PIPELINE (This);
+
+  MediaPresent = TRUE;
+  NetLibDetectMedia (Instance->Service->ControllerHandle, &MediaPresent);
+  if (!MediaPresent) {
+    DEBUG ((DEBUG_INFO, "%a: No MediaPresent.\n", __FUNCTION__));
+    return EFI_NO_MEDIA;
+  }
+
+  Depth = (UINTN)PcdGet32 (PcdRedfishRestExPipelineDepth);
+  if (Depth == 0) {
+    Depth = 1;
+  }
+  Depth = MIN (Depth, RequestCount);
+
+  //
+  // The connection is shared with the asynchronous requests, let them
+  // finish first.
+  //
+  Status = RedfishRestExAsyncDrain (Instance);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Tokens = AllocateZeroPool (Depth * sizeof (RESTEX_PIPELINE_TOKEN));
+  if (Tokens == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Instance->ConnectionBusy = TRUE;
+
+  for (Index = 0; Index < Depth; Index++) {
+    Status = gBS->CreateEvent (
+                    EVT_NOTIFY_SIGNAL,
+                    TPL_NOTIFY,
+                    RedfishRestExPipelineNotify,
+                    &Tokens[Index].IsTxDone,
+                    &Tokens[Index].HttpToken.Event
+                    );
+    if (EFI_ERROR (Status)) {
+      goto ON_EXIT;
+    }
+  }
+
+  ZeroMem (ResponseMessage, RequestCount * sizeof (EFI_HTTP_MESSAGE));
+  for (Index = 0; Index < RequestCount; Index++) {
+    ResponseStatus[Index] = EFI_NOT_READY;
+  }
+
+  DEBUG ((DEBUG_INFO, "%a: %d requests, pipeline depth %d\n", __FUNCTION__, RequestCount, Depth));
+
+  Retried = FALSE;
+  Index   = 0;
+  while (Index < RequestCount) {
+    Status = RedfishRestExPrepareConnection (Instance);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+
+    //
+    // Write the requests in this window back to back.
+    //
+    Window = MIN (Depth, RequestCount - Index);
+    for (Sent = 0; Sent < Window; Sent++) {
+      Status = RedfishRestExPipelineSend (Instance, &Tokens[Sent], &RequestMessage[Index + Sent]);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_ERROR, "%a: Send request %d fail: %r\n", __FUNCTION__, Index + Sent, Status));
+        break;
+      }
+    }
+
+    //
+    // Receive the responses in the order of requests. Stop at the response
+    // after which REST service closes the connection, the requests after it
+    // are not answered on this connection.
+    //
+    for (Received = 0; Received < Sent; Received++) {
+      Status = RedfishRestExPipelineReceive (Instance, &ResponseMessage[Index + Received]);
+      if (EFI_ERROR (Status)) {
+        DEBUG ((DEBUG_ERROR, "%a: Receive response %d fail: %r\n", __FUNCTION__, Index + Received, Status));
+        break;
+      }
+
+      ResponseStatus[Index + Received] = EFI_SUCCESS;
+      if ((Instance->Flags & RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE) != 0) {
+        Received++;
+        break;
+      }
+    }
+
+    if (Received < Window) {
+      //
+      // The outstanding requests are dropped with the connection. Send them
+      // again on a new connection.
+      //
+      Instance->Flags |= RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE;
+      if (Received == 0) {
+        if (Retried) {
+          ResponseStatus[Index] = EFI_ERROR (Status) ? Status : EFI_DEVICE_ERROR;
+          Received = 1;
+          Retried  = FALSE;
+        } else {
+          Retried = TRUE;
+        }
+      } else {
+        Retried = FALSE;
+      }
+    } else {
+      Retried = FALSE;
+    }
+
+    Index += Received;
+  }
+
+  //
+  // Fail the requests which have no chance to be sent.
+  //
+  for ( ; Index < RequestCount; Index++) {
+    ResponseStatus[Index] = Status;
+  }
+
+  Status = EFI_SUCCESS;
+
+ON_EXIT:
+  for (Index = 0; Index < Depth; Index++) {
+    if (Tokens[Index].HttpToken.Event != NULL) {
+      gBS->CloseEvent (Tokens[Index].HttpToken.Event);
+    }
+  }
+
+  FreePool (Tokens);
+  Instance->ConnectionBusy = FALSE;
+  return Status;
+}
+
+/**
+  Make progress on the asynchronous requests of this REST EX child. See
+  EDKII_REDFISH_REST_EX_PIPELINE_POLL.
+
+  @param[in]  This                Pointer to EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL instance.
+
+  @retval EFI_SUCCESS             There is no asynchronous request in progress.
+  @retval EFI_NOT_READY           Some asynchronous requests are still in progress.
+  @retval EFI_INVALID_PARAMETER   This is NULL.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishRestExPipelinePoll (
+  IN  EDKII_REDFISH_REST_EX_PIPELINE_PROTOCOL  *This
+  )
+{
+  if (This == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  return RedfishRestExAsyncPoll (RESTEX_INSTANCE_FROM_PIPELINE (This));
+}
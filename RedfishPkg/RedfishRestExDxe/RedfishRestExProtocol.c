@@ -43,8 +43,7 @@ EFI_REST_EX_PROTOCOL  mRedfishRestExProtocol = {
 
 **/
 EFI_STATUS
-EFIAPI
-RedfishRestExSendReceive (
+RedfishRestExSendReceiveInternal (
   IN      EFI_REST_EX_PROTOCOL   *This,
   IN      EFI_HTTP_MESSAGE       *RequestMessage,
   OUT     EFI_HTTP_MESSAGE       *ResponseMessage
@@ -53,22 +52,15 @@ RedfishRestExSendReceive (
   EFI_STATUS             Status;
   RESTEX_INSTANCE        *Instance;
   HTTP_IO_RESPONSE_DATA  *ResponseData;
-  UINTN                  TotalReceivedSize;
-  UINTN                  Index;
-  LIST_ENTRY             *ChunkListLink;
-  HTTP_IO_CHUNKS        *ThisChunk;
-  BOOLEAN                CopyChunkData;
   BOOLEAN                MediaPresent;
   EFI_HTTP_HEADER        *PreservedRequestHeaders;
   BOOLEAN                ItsWrite;
-  BOOLEAN                IsGetChunkedTransfer;
   HTTP_IO_SEND_CHUNK_PROCESS     SendChunkProcess;
   HTTP_IO_SEND_NON_CHUNK_PROCESS SendNonChunkProcess;
   EFI_HTTP_MESSAGE       ChunkTransferRequestMessage;
 
   Status            = EFI_SUCCESS;
   ResponseData      = NULL;
-  IsGetChunkedTransfer = FALSE;
   SendChunkProcess = HttpIoSendChunkNone;
   SendNonChunkProcess = HttpIoSendNonChunkNone;
 
@@ -94,11 +86,33 @@ RedfishRestExSendReceive (
   DEBUG ((DEBUG_INFO, "\nRedfishRestExSendReceive():\n"));
   DEBUG ((DEBUG_INFO, "*** Perform HTTP Request Method - %d, URL: %s\n", RequestMessage->Data.Request->Method, RequestMessage->Data.Request->Url));
 
+  //
+  // The connection is shared with the asynchronous requests, let them
+  // finish first.
+  //
+  Status = RedfishRestExAsyncDrain (Instance);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  Instance->ConnectionBusy = TRUE;
+
+  //
+  // The connection is kept alive across requests. Reconnect only if REST
+  // service closed it after the last response.
+  //
+  Status = RedfishRestExPrepareConnection (Instance);
+  if (EFI_ERROR (Status)) {
+    Instance->ConnectionBusy = FALSE;
+    return Status;
+  }
+
   //
   // Add header "Expect" to server, only for URL write.
   //
   Status = RedfishHttpAddExpectation (This, RequestMessage, &PreservedRequestHeaders, &ItsWrite);
   if (EFI_ERROR (Status)) {
+    Instance->ConnectionBusy = FALSE;
     return Status;
   }
   if (ItsWrite == TRUE) {
@@ -162,6 +176,15 @@ ReSendRequest:;
                RequestMessage->BodyLength,
                RequestMessage->Body
                );
+    if (EFI_ERROR (Status)) {
+      //
+      // The kept alive connection may be dropped by REST service while it
+      // is idle. Reconnect and send the read request again.
+      //
+      if (RedfishCheckHttpReceiveStatus (Instance, Status) == EFI_NOT_READY) {
+        goto ReSendRequest;
+      }
+    }
   }
   if (EFI_ERROR (Status)) {
     goto ON_EXIT;
@@ -202,6 +225,8 @@ ReSendRequest:;
                   )
              );
   if (Status == EFI_NOT_READY) {
+     FreePool (ResponseData);
+     ResponseData = NULL;
      goto ReSendRequest;
   } else if (Status == EFI_DEVICE_ERROR) {
     goto ON_EXIT;
@@ -279,109 +304,13 @@ ReSendRequest:;
   }
 
   //
-  // Ready to return the StatusCode, Header info and BodyLength.
+  // Return the StatusCode, headers and the body from REST service if have any.
   //
-  ResponseMessage->Data.Response = AllocateZeroPool (sizeof (EFI_HTTP_RESPONSE_DATA));
-  if (ResponseMessage->Data.Response == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
+  Status = RedfishRestExReceiveResponseMessage (Instance, ResponseData, ResponseMessage);
+  if (EFI_ERROR (Status)) {
     goto ON_EXIT;
   }
 
-  ResponseMessage->Data.Response->StatusCode = ResponseData->Response.StatusCode;
-  ResponseMessage->HeaderCount = ResponseData->HeaderCount;
-  ResponseMessage->Headers = ResponseData->Headers;
-
-  //
-  // Get response message body.
-  //
-  if (ResponseMessage->HeaderCount > 0) {
-    Status = HttpIoGetContentLength (ResponseMessage->HeaderCount, ResponseMessage->Headers, &ResponseMessage->BodyLength);
-    if (EFI_ERROR (Status) && Status != EFI_NOT_FOUND) {
-      goto ON_EXIT;
-    }
-
-    if (Status == EFI_NOT_FOUND) {
-      ASSERT (ResponseMessage->BodyLength == 0);
-    }
-
-    if (ResponseMessage->BodyLength == 0) {
-      //
-      // Check if Chunked Transfer Coding.
-      //
-      Status = HttpIoGetChunkedTransferContent (
-                 &(Instance->HttpIo),
-                 ResponseMessage->HeaderCount,
-                 ResponseMessage->Headers,
-                 &ChunkListLink,
-                 &ResponseMessage->BodyLength
-                 );
-      if (EFI_ERROR (Status) && Status != EFI_NOT_FOUND) {
-        goto ON_EXIT;
-      }
-      if (Status == EFI_SUCCESS &&
-          ChunkListLink != NULL &&
-          !IsListEmpty(ChunkListLink) &&
-          ResponseMessage->BodyLength != 0) {
-        IsGetChunkedTransfer = TRUE;
-        //
-        // Copy data to Message body.
-        //
-        CopyChunkData = TRUE;
-        ResponseMessage->Body = AllocateZeroPool (ResponseMessage->BodyLength);
-        if (ResponseMessage->Body == NULL) {
-          Status = EFI_OUT_OF_RESOURCES;
-          CopyChunkData = FALSE;
-        }
-        Index = 0;
-        while (!IsListEmpty(ChunkListLink)) {
-          ThisChunk = (HTTP_IO_CHUNKS *)GetFirstNode (ChunkListLink);
-          if (CopyChunkData) {
-            CopyMem(((UINT8 *)ResponseMessage->Body + Index), (UINT8 *)ThisChunk->Data, ThisChunk->Length);
-            Index += ThisChunk->Length;
-          }
-          RemoveEntryList (&ThisChunk->NextChunk);
-          FreePool ((VOID *)ThisChunk->Data);
-          FreePool ((VOID *)ThisChunk);
-        };
-        FreePool ((VOID *)ChunkListLink);
-      }
-    }
-    Status = EFI_SUCCESS;
-  }
-
-  //
-  // Ready to return the Body from REST service if have any.
-  //
-  if (ResponseMessage->BodyLength > 0 && !IsGetChunkedTransfer) {
-    ResponseData->HeaderCount = 0;
-    ResponseData->Headers = NULL;
-
-    ResponseMessage->Body = AllocateZeroPool (ResponseMessage->BodyLength);
-    if (ResponseMessage->Body == NULL) {
-      Status = EFI_OUT_OF_RESOURCES;
-      goto ON_EXIT;
-    }
-
-    //
-    // Only receive the Body.
-    //
-    TotalReceivedSize = 0;
-    while (TotalReceivedSize < ResponseMessage->BodyLength) {
-      ResponseData->BodyLength = ResponseMessage->BodyLength - TotalReceivedSize;
-      ResponseData->Body = (CHAR8 *) ResponseMessage->Body + TotalReceivedSize;
-      Status = HttpIoRecvResponse (
-                 &(Instance->HttpIo),
-                 FALSE,
-                 ResponseData
-                 );
-      if (EFI_ERROR (Status)) {
-        goto ON_EXIT;
-      }
-
-      TotalReceivedSize += ResponseData->BodyLength;
-    }
-    DEBUG ((DEBUG_INFO, "Total of lengh of Response :%d\n", TotalReceivedSize));
-  }
   DEBUG ((DEBUG_INFO, "RedfishRestExSendReceive()- EFI_STATUS: %r\n", Status));
 
 ON_EXIT:
@@ -391,6 +320,12 @@ ON_EXIT:
   }
 
   if (EFI_ERROR (Status)) {
+    //
+    // The rest of response may be left unread on the connection, don't
+    // reuse it for the next request.
+    //
+    Instance->Flags |= RESTEX_INSTANCE_FLAGS_CONNECTION_CLOSE;
+
     if (ResponseMessage->Data.Response != NULL) {
       FreePool (ResponseMessage->Data.Response);
       ResponseMessage->Data.Response = NULL;
@@ -401,6 +336,56 @@ ON_EXIT:
       ResponseMessage->Body = NULL;
     }
   }
+
+  Instance->ConnectionBusy = FALSE;
+  return Status;
+}
+
+/**
+  Provides a simple HTTP-like interface to send and receive resources from a REST service.
+
+  The SendReceive() function sends an HTTP request to this REST service, and returns a
+  response when the data is retrieved from the service. RequestMessage contains the HTTP
+  request to the REST resource identified by RequestMessage.Request.Url. The
+  ResponseMessage is the returned HTTP response for that request, including any HTTP
+  status. The time spent is measured by RedfishPerfLib.
+
+  @param[in]  This                Pointer to EFI_REST_EX_PROTOCOL instance for a particular
+                                  REST service.
+  @param[in]  RequestMessage      Pointer to the HTTP request data for this resource
+  @param[out] ResponseMessage     Pointer to the HTTP response data obtained for this requested.
+
+  @retval EFI_SUCCESS             operation succeeded.
+  @retval EFI_INVALID_PARAMETER   This, RequestMessage, or ResponseMessage are NULL.
+  @retval EFI_DEVICE_ERROR        An unexpected system or network error occurred.
+  @retval EFI_ACCESS_DENIED       HTTP method is not allowed on this URL.
+  @retval EFI_BAD_BUFFER_SIZE     The payload is to large to be handled on server side.
+  @retval EFI_UNSUPPORTED         Unsupported HTTP response.
+
+**/
+EFI_STATUS
+EFIAPI
+RedfishRestExSendReceive (
+  IN      EFI_REST_EX_PROTOCOL   *This,
+  IN      EFI_HTTP_MESSAGE       *RequestMessage,
+  OUT     EFI_HTTP_MESSAGE       *ResponseMessage
+  )
+{
+  EFI_STATUS  Status;
+  UINT64      StartTick;
+  UINT64      Bytes;
+
+  StartTick = RedfishPerfStart ();
+  Status    = RedfishRestExSendReceiveInternal (This, RequestMessage, ResponseMessage);
+  if ((StartTick != 0) && (RequestMessage != NULL) && (RequestMessage->Data.Request != NULL)) {
+    Bytes = RequestMessage->BodyLength;
+    if (!EFI_ERROR (Status)) {
+      Bytes += ResponseMessage->BodyLength;
+    }
+
+    RedfishPerfEndUnicode (RedfishPerfRestEx, RequestMessage->Data.Request->Url, StartTick, 1, Bytes, EFI_ERROR (Status));
+  }
+
   return Status;
 }
 
@@ -597,6 +582,7 @@ RedfishRestExConfigure (
     //
     // Set RestExConfigData to NULL means to put EFI REST EX child instance into the unconfigured state.
     //
+    RedfishRestExAsyncCancelAll (Instance);
     HttpIoDestroyIo (&(Instance->HttpIo));
 
     if (Instance->ConfigData != NULL) {
@@ -661,6 +647,12 @@ ON_EXIT:
   to REST service asynchronous request mechanism. Caller will get the notification once the response
   is returned from REST service.
 
+  Only HTTP GET request is accepted. The requests are queued and sent on the kept alive connection,
+  up to PcdRedfishRestExPipelineDepth requests wait for their responses at the same time. The
+  response is returned in RestExToken->ResponseMessage with RestExToken->Status set to EFI_SUCCESS,
+  caller checks the HTTP status code and frees the response data, headers and body. RequestMessage
+  must be valid until RestExToken->Event is signaled.
+
   @param[in]  This                  This is the EFI_REST_EX_PROTOCOL instance.
   @param[in]  RequestMessage        This is the HTTP request message sent to REST service. Set RequestMessage
                                     to NULL to cancel the previous asynchronous request associated with the
@@ -676,10 +668,12 @@ ON_EXIT:
                                     TimeOutInMilliSeconds.
 
   @retval EFI_SUCCESS               Asynchronous REST request is established.
-  @retval EFI_UNSUPPORTED           This REST EX Protocol driver instance doesn't support asynchronous request.
-  @retval EFI_TIMEOUT               Asynchronous REST request is not established and timeout is expired.
+  @retval EFI_INVALID_PARAMETER     This or RestExToken is NULL, or RestExToken->Event or
+                                    RestExToken->ResponseMessage is NULL.
+  @retval EFI_UNSUPPORTED           The request is not HTTP GET.
   @retval EFI_ABORT                 Previous asynchronous REST request has been canceled.
-  @retval EFI_DEVICE_ERROR          Otherwise, returns EFI_DEVICE_ERROR for other errors according to HTTP Status Code.
+  @retval EFI_NOT_FOUND             There is no previous asynchronous REST request of RestExToken to cancel.
+  @retval EFI_OUT_OF_RESOURCES      Not enough memory to queue the request.
   @retval EFI_NOT_READY             The configuration of this instance is not set yet. Configure() must be executed
                                     and returns successfully prior to invoke this function.
 
@@ -693,7 +687,39 @@ RedfishRestExAyncSendReceive (
   IN      UINTN                  *TimeOutInMilliSeconds OPTIONAL
   )
 {
-  return EFI_UNSUPPORTED;
+  RESTEX_INSTANCE  *Instance;
+
+  if ((This == NULL) || (RestExToken == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  Instance = RESTEX_INSTANCE_FROM_THIS (This);
+
+  //
+  // Set RequestMessage to NULL means to cancel the previous request of RestExToken.
+  //
+  if (RequestMessage == NULL) {
+    return RedfishRestExAsyncCancel (Instance, RestExToken);
+  }
+
+  if ((RestExToken->Event == NULL) || (RestExToken->ResponseMessage == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if (Instance->State != RESTEX_STATE_CONFIGED) {
+    return EFI_NOT_READY;
+  }
+
+  //
+  // The asynchronous requests are pipelined on the connection, which is
+  // only safe for the idempotent requests.
+  //
+  if ((RequestMessage->Data.Request == NULL) ||
+      (RequestMessage->Data.Request->Method != HttpMethodGet)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  return RedfishRestExAsyncSubmit (Instance, RequestMessage, RestExToken, TimeOutInMilliSeconds);
 }
 
 /**
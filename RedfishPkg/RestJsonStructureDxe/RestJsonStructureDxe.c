@@ -16,6 +16,221 @@
 LIST_ENTRY mRestJsonStructureList;
 EFI_HANDLE mProtocolHandle;
 
+//
+// Convertor indexes. Resource type identifier with version is looked up in
+// mRestJsonStructureIndex, identifier without version is looked up in
+// mRestJsonStructureTypeIndex.
+//
+REST_JSON_STRUCTURE_INDEX mRestJsonStructureIndex     = { NULL, 0, 0, FALSE };
+REST_JSON_STRUCTURE_INDEX mRestJsonStructureTypeIndex = { NULL, 0, 0, TRUE };
+
+/**
+  This function calculates the hash value of the given resource type name space.
+
+  @param[in]    NameSpace       Resource type name space.
+  @param[in]    TypeNameOnly    TRUE to hash resource type name only.
+
+  @retval UINT32                Hash value of NameSpace.
+
+**/
+UINT32
+RestJsonStructureHash (
+  IN EFI_REST_JSON_RESOURCE_TYPE_NAMESPACE  *NameSpace,
+  IN BOOLEAN                                TypeNameOnly
+  )
+{
+  CHAR8  *String[4];
+  UINTN  StringCount;
+  UINTN  Index;
+  CHAR8  *Char;
+  UINT32 Hash;
+
+  String[0] = NameSpace->ResourceTypeName;
+  String[1] = NameSpace->MajorVersion;
+  String[2] = NameSpace->MinorVersion;
+  String[3] = NameSpace->ErrataVersion;
+  StringCount = TypeNameOnly ? 1 : 4;
+
+  //
+  // FNV-1a, strings are separated by the null terminator so
+  // "1", "11" and "11", "1" don't produce the same hash value.
+  //
+  Hash = 2166136261U;
+  for (Index = 0; Index < StringCount; Index ++) {
+    for (Char = String[Index]; *Char != '\0'; Char ++) {
+      Hash ^= (UINT32)(UINT8)*Char;
+      Hash *= 16777619U;
+    }
+    Hash *= 16777619U;
+  }
+  return Hash;
+}
+
+/**
+  This function returns the index which serves the given resource type
+  name space.
+
+  @param[in]    NameSpace       Resource type name space.
+
+  @retval REST_JSON_STRUCTURE_INDEX  The index serves NameSpace.
+  @retval NULL                       NameSpace is not a valid key.
+
+**/
+REST_JSON_STRUCTURE_INDEX *
+RestJsonStructureGetIndex (
+  IN EFI_REST_JSON_RESOURCE_TYPE_NAMESPACE  *NameSpace
+  )
+{
+  if (NameSpace->ResourceTypeName == NULL) {
+    return NULL;
+  }
+  if ((NameSpace->MajorVersion == NULL) &&
+      (NameSpace->MinorVersion == NULL) &&
+      (NameSpace->ErrataVersion == NULL)
+      ) {
+    return &mRestJsonStructureTypeIndex;
+  }
+  if ((NameSpace->MajorVersion == NULL) ||
+      (NameSpace->MinorVersion == NULL) ||
+      (NameSpace->ErrataVersion == NULL)
+      ) {
+    return NULL;
+  }
+  return &mRestJsonStructureIndex;
+}
+
+/**
+  This function makes sure the index has room for the given number of new
+  entries without exceeding one entry per bucket on average. Buckets are
+  doubled and entries are rehashed when the index grows.
+
+  @param[in, out]   Index           The index to grow.
+  @param[in]        NewEntryCount   Number of entries about to be inserted.
+
+  @retval EFI_SUCCESS               Index is ready for insertion.
+  @retval EFI_OUT_OF_RESOURCES      No bucket can be allocated.
+
+**/
+EFI_STATUS
+RestJsonStructureIndexReserve (
+  IN OUT REST_JSON_STRUCTURE_INDEX  *Index,
+  IN     UINTN                      NewEntryCount
+  )
+{
+  UINTN      BucketCount;
+  UINTN      BucketIndex;
+  LIST_ENTRY *Bucket;
+  LIST_ENTRY *Node;
+  REST_JSON_STRUCTURE_INDEX_ENTRY *Entry;
+
+  BucketCount = (Index->BucketCount == 0) ? REST_JSON_STRUCTURE_INDEX_INITIAL_BUCKETS : Index->BucketCount;
+  while (BucketCount < Index->Count + NewEntryCount) {
+    BucketCount *= 2;
+  }
+  if (BucketCount == Index->BucketCount) {
+    return EFI_SUCCESS;
+  }
+
+  Bucket = AllocatePool (BucketCount * sizeof (LIST_ENTRY));
+  if (Bucket == NULL) {
+    //
+    // Index still works with longer chains as long as there is a bucket.
+    //
+    return (Index->Bucket == NULL) ? EFI_OUT_OF_RESOURCES : EFI_SUCCESS;
+  }
+  for (BucketIndex = 0; BucketIndex < BucketCount; BucketIndex ++) {
+    InitializeListHead (&Bucket[BucketIndex]);
+  }
+
+  //
+  // Move entries to new buckets. Entries are moved in order, so
+  // convertors with the same key stay in registration order.
+  //
+  for (BucketIndex = 0; BucketIndex < Index->BucketCount; BucketIndex ++) {
+    while (!IsListEmpty (&Index->Bucket[BucketIndex])) {
+      Node = GetFirstNode (&Index->Bucket[BucketIndex]);
+      RemoveEntryList (Node);
+      Entry = BASE_CR (Node, REST_JSON_STRUCTURE_INDEX_ENTRY, NextIndexEntry);
+      InsertTailList (&Bucket[Entry->Hash & (BucketCount - 1)], Node);
+    }
+  }
+  if (Index->Bucket != NULL) {
+    FreePool (Index->Bucket);
+  }
+  Index->Bucket = Bucket;
+  Index->BucketCount = BucketCount;
+  return EFI_SUCCESS;
+}
+
+/**
+  This function adds the entry to index. The room for entry must be
+  reserved by RestJsonStructureIndexReserve() in advance.
+
+  @param[in, out]   Index    The index.
+  @param[in]        Entry    The entry to insert. The hash value and resource
+                             type identifier are set by caller.
+
+**/
+VOID
+RestJsonStructureIndexInsert (
+  IN OUT REST_JSON_STRUCTURE_INDEX        *Index,
+  IN     REST_JSON_STRUCTURE_INDEX_ENTRY  *Entry
+  )
+{
+  InsertTailList (&Index->Bucket[Entry->Hash & (Index->BucketCount - 1)], &Entry->NextIndexEntry);
+  Index->Count ++;
+}
+
+/**
+  This function finds the next convertor which supports the given resource
+  type name space.
+
+  @param[in]    Index       The index to search.
+  @param[in]    NameSpace   Resource type name space.
+  @param[in]    Hash        Hash value of NameSpace for this index.
+  @param[in]    Entry       The entry returned in previous call. NULL to find
+                            the first entry.
+
+  @retval REST_JSON_STRUCTURE_INDEX_ENTRY  The entry matches NameSpace.
+  @retval NULL                             No more entry matches NameSpace.
+
+**/
+REST_JSON_STRUCTURE_INDEX_ENTRY *
+RestJsonStructureIndexFind (
+  IN REST_JSON_STRUCTURE_INDEX              *Index,
+  IN EFI_REST_JSON_RESOURCE_TYPE_NAMESPACE  *NameSpace,
+  IN UINT32                                 Hash,
+  IN REST_JSON_STRUCTURE_INDEX_ENTRY        *Entry OPTIONAL
+  )
+{
+  LIST_ENTRY *Bucket;
+  LIST_ENTRY *Node;
+  EFI_REST_JSON_RESOURCE_TYPE_NAMESPACE *ThisNameSpace;
+
+  if (Index->Bucket == NULL) {
+    return NULL;
+  }
+  Bucket = &Index->Bucket[Hash & (Index->BucketCount - 1)];
+  Node = (Entry == NULL) ? GetFirstNode (Bucket) : GetNextNode (Bucket, &Entry->NextIndexEntry);
+  for (; !IsNull (Bucket, Node); Node = GetNextNode (Bucket, Node)) {
+    Entry = BASE_CR (Node, REST_JSON_STRUCTURE_INDEX_ENTRY, NextIndexEntry);
+    if (Entry->Hash != Hash) {
+      continue;
+    }
+    ThisNameSpace = &Entry->RsrcTypeIdentifier->NameSpace;
+    if (AsciiStrCmp (NameSpace->ResourceTypeName, ThisNameSpace->ResourceTypeName) != 0) {
+      continue;
+    }
+    if (Index->TypeNameOnly ||
+        ((AsciiStrCmp (NameSpace->MajorVersion, ThisNameSpace->MajorVersion) == 0) &&
+         (AsciiStrCmp (NameSpace->MinorVersion, ThisNameSpace->MinorVersion) == 0) &&
+         (AsciiStrCmp (NameSpace->ErrataVersion, ThisNameSpace->ErrataVersion) == 0))) {
+      return Entry;
+    }
+  }
+  return NULL;
+}
+
 /**
   This function registers Restful resource interpreter for the
   specific schema.
@@ -41,12 +256,16 @@ RestJsonStructureRegister (
   IN EFI_REST_JSON_STRUCTURE_DESTORY_STRUCTURE DestroyStructure
 )
 {
+  EFI_STATUS Status;
   UINTN NumberOfNS;
   UINTN Index;
+  UINTN PrevIndex;
   LIST_ENTRY *ThisList;
   REST_JSON_STRUCTURE_INSTANCE *Instance;
   EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER *CloneSupportedInterpId;
   EFI_REST_JSON_STRUCTURE_SUPPORTED *ThisSupportedInterp;
+  REST_JSON_STRUCTURE_INDEX *RsrcIndex;
+  REST_JSON_STRUCTURE_INDEX_ENTRY *Entry;
 
   if (This == NULL ||
       ToStructure == NULL ||
@@ -71,14 +290,32 @@ RestJsonStructureRegister (
     }
   };
 
+  //
+  // Each supported name space may have one entry in version index and one
+  // in type name index.
+  //
+  Status = RestJsonStructureIndexReserve (&mRestJsonStructureIndex, NumberOfNS);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+  Status = RestJsonStructureIndexReserve (&mRestJsonStructureTypeIndex, NumberOfNS);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
   Instance =
-    (REST_JSON_STRUCTURE_INSTANCE *)AllocateZeroPool (sizeof (REST_JSON_STRUCTURE_INSTANCE) + NumberOfNS * sizeof (EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER));
+    (REST_JSON_STRUCTURE_INSTANCE *)AllocateZeroPool (
+                                      sizeof (REST_JSON_STRUCTURE_INSTANCE) +
+                                      NumberOfNS * sizeof (EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER) +
+                                      NumberOfNS * 2 * sizeof (REST_JSON_STRUCTURE_INDEX_ENTRY)
+                                      );
   if (Instance == NULL) {
     return EFI_OUT_OF_RESOURCES;
   }
   InitializeListHead (&Instance->NextRestJsonStructureInstance);
   Instance->NumberOfNameSpaceToConvert = NumberOfNS;
   Instance->SupportedRsrcIndentifier = (EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER *)((REST_JSON_STRUCTURE_INSTANCE *)Instance + 1);
+  Instance->IndexEntry = (REST_JSON_STRUCTURE_INDEX_ENTRY *)(Instance->SupportedRsrcIndentifier + NumberOfNS);
   //
   // Copy supported resource identifer interpreter.
   //
@@ -93,255 +330,319 @@ RestJsonStructureRegister (
   Instance->StructureToJson = ToJson;
   Instance->DestroyStructure = DestroyStructure;
   InsertTailList (&mRestJsonStructureList, &Instance->NextRestJsonStructureInstance);
+
+  //
+  // Index supported name spaces.
+  //
+  CloneSupportedInterpId = Instance->SupportedRsrcIndentifier;
+  for (Index = 0; Index < NumberOfNS; Index ++) {
+    RsrcIndex = RestJsonStructureGetIndex (&CloneSupportedInterpId[Index].NameSpace);
+    if (RsrcIndex == NULL) {
+      //
+      // Resource type name or partial version is missing, this name
+      // space can't be matched.
+      //
+      continue;
+    }
+    if (RsrcIndex == &mRestJsonStructureIndex) {
+      Entry = &Instance->IndexEntry[Index];
+      Entry->Hash = RestJsonStructureHash (&CloneSupportedInterpId[Index].NameSpace, FALSE);
+      Entry->RsrcTypeIdentifier = &CloneSupportedInterpId[Index];
+      Entry->Instance = Instance;
+      RestJsonStructureIndexInsert (&mRestJsonStructureIndex, Entry);
+    }
+
+    //
+    // Only the first name space of the same resource type is indexed by
+    // type name, so this convertor is invoked once for the version-less
+    // lookup.
+    //
+    for (PrevIndex = 0; PrevIndex < Index; PrevIndex ++) {
+      if (CloneSupportedInterpId[PrevIndex].NameSpace.ResourceTypeName != NULL &&
+          AsciiStrCmp (
+            CloneSupportedInterpId[PrevIndex].NameSpace.ResourceTypeName,
+            CloneSupportedInterpId[Index].NameSpace.ResourceTypeName) == 0) {
+        break;
+      }
+    }
+    if (PrevIndex == Index) {
+      Entry = &Instance->IndexEntry[NumberOfNS + Index];
+      Entry->Hash = RestJsonStructureHash (&CloneSupportedInterpId[Index].NameSpace, TRUE);
+      Entry->RsrcTypeIdentifier = &CloneSupportedInterpId[Index];
+      Entry->Instance = Instance;
+      RestJsonStructureIndexInsert (&mRestJsonStructureTypeIndex, Entry);
+    }
+  }
   return EFI_SUCCESS;
 }
 
 /**
-  This function check if this interpreter instance support the given namesapce.
+  This function invokes the interpreter instance to convert the given Restful
+  resource.
 
   @param[in]    This                EFI_REST_JSON_STRUCTURE_PROTOCOL instance.
   @param[in]    InterpreterInstance REST_JSON_STRUCTURE_INSTANCE
   @param[in]    RsrcTypeIdentifier  Resource type identifier.
-  @param[in]    ResourceRaw         Given Restful resource.
-  @param[out]   RestJSonHeader      Property interpreted from given ResourceRaw.
+  @param[in]    ResourceRaw         Given Restful resource in text format.
+  @param[out]   RestJSonHeader      Property interpreted from given resource.
 
   @retval EFI_SUCCESS
   @retval Others.
 
 **/
 EFI_STATUS
-InterpreterInstanceToStruct (
-  IN EFI_REST_JSON_STRUCTURE_PROTOCOL         *This,
-  IN REST_JSON_STRUCTURE_INSTANCE             *InterpreterInstance,
-  IN EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER   *RsrcTypeIdentifier OPTIONAL,
-  IN CHAR8                                    *ResourceRaw,
-  OUT EFI_REST_JSON_STRUCTURE_HEADER          **RestJSonHeader
- )
+InterpreterInstanceInvokeToStruct (
+  IN  EFI_REST_JSON_STRUCTURE_PROTOCOL         *This,
+  IN  REST_JSON_STRUCTURE_INSTANCE             *InterpreterInstance,
+  IN  EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER   *RsrcTypeIdentifier OPTIONAL,
+  IN  CHAR8                                    *ResourceRaw,
+  OUT EFI_REST_JSON_STRUCTURE_HEADER           **RestJSonHeader
+  )
 {
-  UINTN Index;
-  EFI_STATUS Status;
-  EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER *ThisSupportedRsrcTypeId;
+  EFI_STATUS  Status;
+  UINT64      StartTick;
 
-  if (This == NULL ||
-      InterpreterInstance == NULL ||
-      ResourceRaw == NULL ||
-      RestJSonHeader == NULL
-      ) {
-      return EFI_INVALID_PARAMETER;
-  }
+  StartTick = RedfishPerfStart ();
+  Status = InterpreterInstance->JsonToStructure (
+                                  This,
+                                  RsrcTypeIdentifier,
+                                  ResourceRaw,
+                                  RestJSonHeader
+                                  );
 
-  Status = EFI_UNSUPPORTED;
-  if (RsrcTypeIdentifier == NULL) {
-    //
-    // No resource type identifier, send to intepreter anyway.
-    // Interpreter may recognize this resource.
-    //
-    Status = InterpreterInstance->JsonToStructure (
-                This,
-                NULL,
-                ResourceRaw,
-                RestJSonHeader
-                );
-  } else {
-    //
-    // Check if the namesapce and version is supported by this interpreter.
-    //
-    ThisSupportedRsrcTypeId = InterpreterInstance->SupportedRsrcIndentifier;
-    for (Index = 0; Index < InterpreterInstance->NumberOfNameSpaceToConvert; Index ++){
-      if (AsciiStrCmp (
-            RsrcTypeIdentifier->NameSpace.ResourceTypeName,
-            ThisSupportedRsrcTypeId->NameSpace.ResourceTypeName) == 0){
-        if ((RsrcTypeIdentifier->NameSpace.MajorVersion == NULL) &&
-            (RsrcTypeIdentifier->NameSpace.MinorVersion == NULL) &&
-            (RsrcTypeIdentifier->NameSpace.ErrataVersion == NULL)
-            ) {
-          //
-          // Don't check version of this resource type identifier.
-          //
-          Status = InterpreterInstance->JsonToStructure (
-                      This,
-                      RsrcTypeIdentifier,
-                      ResourceRaw,
-                      RestJSonHeader
-                      );
-          break;
-        } else {
-          //
-          // Check version.
-          //
-          if ((AsciiStrCmp (
-                RsrcTypeIdentifier->NameSpace.MajorVersion,
-                ThisSupportedRsrcTypeId->NameSpace.MajorVersion) == 0) &&
-              (AsciiStrCmp (
-                RsrcTypeIdentifier->NameSpace.MinorVersion,
-                ThisSupportedRsrcTypeId->NameSpace.MinorVersion) == 0) &&
-              (AsciiStrCmp (
-                RsrcTypeIdentifier->NameSpace.ErrataVersion,
-                ThisSupportedRsrcTypeId->NameSpace.ErrataVersion) == 0)) {
-            Status = InterpreterInstance->JsonToStructure (
-                      This,
-                      RsrcTypeIdentifier,
-                      ResourceRaw,
-                      RestJSonHeader
-                      );
-            break;
-          }
-        }
-      }
-      ThisSupportedRsrcTypeId ++;
-    }
-  }
+  //
+  // EFI_UNSUPPORTED only means the resource is for another interpreter.
+  //
+  RedfishPerfEnd (
+    RedfishPerfJsonConvert,
+    (RsrcTypeIdentifier != NULL && RsrcTypeIdentifier->NameSpace.ResourceTypeName != NULL) ? RsrcTypeIdentifier->NameSpace.ResourceTypeName : "Unknown",
+    StartTick,
+    1,
+    0,
+    (BOOLEAN)(EFI_ERROR (Status) && Status != EFI_UNSUPPORTED)
+    );
   return Status;
 }
-/**
-  This function converts JSON C structure to JSON property.
-
-  @param[in]    This                 EFI_REST_JSON_STRUCTURE_PROTOCOL instance.
-  @param[in]    InterpreterInstance  REST_JSON_STRUCTURE_INSTANCE
-  @param[in]    RestJSonHeader       Resource type identifier.
-  @param[out]   ResourceRaw          Output in JSON text format.
 
-  @retval EFI_SUCCESS
-  @retval Others.
+/**
+  This function gets the resource type name space from "@odata.type" of the
+  given Restful resource. "#Memory.v1_7_1.Memory" gives resource type "Memory"
+  with version "1", "7" and "1". "#MemoryCollection.MemoryCollection" gives
+  resource type "MemoryCollection" with version "NOVERSIONED", which is the
+  version registered by convertors of resource without version.
+
+  @param[in]    JsonValue       Given Restful resource in JSON value.
+  @param[out]   NameSpace       Resource type name space. The strings point to
+                                the memory returned in Buffer.
+  @param[out]   Buffer          Memory of the strings in NameSpace. Caller frees
+                                it with FreePool().
+
+  @retval EFI_SUCCESS           NameSpace is returned.
+  @retval EFI_NOT_FOUND         No "@odata.type" in JsonValue.
+  @retval EFI_UNSUPPORTED       "@odata.type" is not in the expected format.
+  @retval EFI_OUT_OF_RESOURCES  System is out of memory.
 
 **/
 EFI_STATUS
-InterpreterEfiStructToInstance (
-  IN EFI_REST_JSON_STRUCTURE_PROTOCOL   *This,
-  IN REST_JSON_STRUCTURE_INSTANCE       *InterpreterInstance,
-  IN EFI_REST_JSON_STRUCTURE_HEADER     *RestJSonHeader,
-  OUT CHAR8 **ResourceRaw
-)
+OdataTypeToNameSpace (
+  IN  EDKII_JSON_VALUE                       JsonValue,
+  OUT EFI_REST_JSON_RESOURCE_TYPE_NAMESPACE  *NameSpace,
+  OUT CHAR8                                  **Buffer
+  )
 {
-  UINTN Index;
-  EFI_STATUS Status;
-  EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER *ThisSupportedRsrcTypeId;
-  EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER *RsrcTypeIdentifier;
+  CONST CHAR8 *OdataType;
+  CHAR8       *TypeString;
+  CHAR8       *Char;
 
-  if (This == NULL ||
-      InterpreterInstance == NULL ||
-      RestJSonHeader == NULL ||
-      ResourceRaw == NULL
-      ) {
-    return EFI_INVALID_PARAMETER;
+  if (!JsonValueIsObject (JsonValue)) {
+    return EFI_NOT_FOUND;
   }
-  RsrcTypeIdentifier = &RestJSonHeader->JsonRsrcIdentifier;
-  if (RsrcTypeIdentifier == NULL ||
-      RsrcTypeIdentifier->NameSpace.ResourceTypeName == NULL ||
-      RsrcTypeIdentifier->NameSpace.MajorVersion == NULL ||
-      RsrcTypeIdentifier->NameSpace.MinorVersion == NULL ||
-      RsrcTypeIdentifier->NameSpace.ErrataVersion == NULL
-      ) {
-    return EFI_INVALID_PARAMETER;
+  OdataType = JsonValueGetAsciiString (JsonObjectGetValue (JsonValueGetObject (JsonValue), REST_JSON_STRUCTURE_ODATA_TYPE));
+  if (OdataType == NULL || *OdataType != '#') {
+    return EFI_NOT_FOUND;
+  }
+  TypeString = AllocateCopyPool (AsciiStrSize (OdataType), OdataType);
+  if (TypeString == NULL) {
+    return EFI_OUT_OF_RESOURCES;
   }
 
   //
-  // Check if the namesapce and version is supported by this interpreter.
+  // Resource type name.
   //
-  Status = EFI_UNSUPPORTED;
-  ThisSupportedRsrcTypeId = InterpreterInstance->SupportedRsrcIndentifier;
-  for (Index = 0; Index < InterpreterInstance->NumberOfNameSpaceToConvert; Index ++){
-    if (AsciiStrCmp (
-          RsrcTypeIdentifier->NameSpace.ResourceTypeName,
-          ThisSupportedRsrcTypeId->NameSpace.ResourceTypeName) == 0){
-      //
-      // Check version.
-      //
-      if ((AsciiStrCmp (
-            RsrcTypeIdentifier->NameSpace.MajorVersion,
-            ThisSupportedRsrcTypeId->NameSpace.MajorVersion) == 0) &&
-          (AsciiStrCmp (
-            RsrcTypeIdentifier->NameSpace.MinorVersion,
-            ThisSupportedRsrcTypeId->NameSpace.MinorVersion) == 0) &&
-          (AsciiStrCmp (
-            RsrcTypeIdentifier->NameSpace.ErrataVersion,
-            ThisSupportedRsrcTypeId->NameSpace.ErrataVersion) == 0)) {
-        Status = InterpreterInstance->StructureToJson (
-                  This,
-                  RestJSonHeader,
-                  ResourceRaw
-                  );
-        break;
-      }
-    }
-    ThisSupportedRsrcTypeId ++;
+  NameSpace->ResourceTypeName = TypeString + 1;
+  for (Char = NameSpace->ResourceTypeName; *Char != '.' && *Char != '\0'; Char ++);
+  if (*Char != '.' || Char == NameSpace->ResourceTypeName) {
+    FreePool (TypeString);
+    return EFI_UNSUPPORTED;
   }
-  return Status;
+  *Char = '\0';
+  Char ++;
+
+  if (*Char != 'v' || *(Char + 1) < '0' || *(Char + 1) > '9') {
+    NameSpace->MajorVersion = REST_JSON_STRUCTURE_NOVERSIONED;
+    NameSpace->MinorVersion = REST_JSON_STRUCTURE_NOVERSIONED;
+    NameSpace->ErrataVersion = REST_JSON_STRUCTURE_NOVERSIONED;
+    *Buffer = TypeString;
+    return EFI_SUCCESS;
+  }
+
+  //
+  // Version in "vMajor_Minor_Errata." format.
+  //
+  NameSpace->MajorVersion = ++ Char;
+  for (; *Char != '_' && *Char != '\0'; Char ++);
+  if (*Char != '_') {
+    FreePool (TypeString);
+    return EFI_UNSUPPORTED;
+  }
+  *Char = '\0';
+  NameSpace->MinorVersion = ++ Char;
+  for (; *Char != '_' && *Char != '\0'; Char ++);
+  if (*Char != '_') {
+    FreePool (TypeString);
+    return EFI_UNSUPPORTED;
+  }
+  *Char = '\0';
+  NameSpace->ErrataVersion = ++ Char;
+  for (; *Char != '.' && *Char != '\0'; Char ++);
+  if (*Char != '.') {
+    FreePool (TypeString);
+    return EFI_UNSUPPORTED;
+  }
+  *Char = '\0';
+  *Buffer = TypeString;
+  return EFI_SUCCESS;
 }
 
 /**
-  This function destory REST property structure.
+  This function converts the given Restful resource to JSON C structure by the
+  convertor which supports it. The convertor is looked up in the index by the
+  given resource type identifier. If no identifier is given, the identifier
+  is taken from "@odata.type" of the resource, and all the convertors are tried
+  if none of the indexed convertors recognizes the resource.
 
-  @param[in]    This                 EFI_REST_JSON_STRUCTURE_PROTOCOL instance.
-  @param[in]    InterpreterInstance  REST_JSON_STRUCTURE_INSTANCE
-  @param[in]    RestJSonHeader       Property interpreted from given ResourceRaw.
+  The resource is always handed to convertors in text format. Each convertor
+  image links its own copy of JsonLib, so a JSON value parsed in this image
+  must not be used by the convertor.
+
+  @param[in]    This                EFI_REST_JSON_STRUCTURE_PROTOCOL instance.
+  @param[in]    RsrcTypeIdentifier  Resource type identifier.
+  @param[in]    ResourceRaw         Given Restful resource in text format.
+  @param[out]   JsonStructure       Property interpreted from given resource.
 
   @retval EFI_SUCCESS
+  @retval EFI_UNSUPPORTED         No convertor supports this resource.
   @retval Others.
 
 **/
 EFI_STATUS
-InterpreterInstanceDestoryJsonStruct (
-  IN EFI_REST_JSON_STRUCTURE_PROTOCOL       *This,
-  IN REST_JSON_STRUCTURE_INSTANCE           *InterpreterInstance,
-  IN EFI_REST_JSON_STRUCTURE_HEADER         *RestJSonHeader
- )
+RestJsonStructureDispatchToStruct (
+  IN  EFI_REST_JSON_STRUCTURE_PROTOCOL         *This,
+  IN  EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER   *RsrcTypeIdentifier OPTIONAL,
+  IN  CHAR8                                    *ResourceRaw,
+  OUT EFI_REST_JSON_STRUCTURE_HEADER           **JsonStructure
+  )
 {
-  UINTN Index;
   EFI_STATUS Status;
-  EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER *ThisSupportedRsrcTypeId;
+  EFI_STATUS LookupStatus;
+  EFI_REST_JSON_RESOURCE_TYPE_NAMESPACE NameSpace;
+  REST_JSON_STRUCTURE_INDEX *RsrcIndex;
+  REST_JSON_STRUCTURE_INDEX_ENTRY *Entry;
+  REST_JSON_STRUCTURE_INSTANCE *Instance;
+  EDKII_JSON_VALUE JsonValue;
+  CHAR8 *OdataTypeBuffer;
+  UINT32 Hash;
+  LIST_ENTRY *Node;
 
-  if (This == NULL ||
-      InterpreterInstance == NULL ||
-      RestJSonHeader == NULL
-      ) {
-    return EFI_INVALID_PARAMETER;
+  if (IsListEmpty (&mRestJsonStructureList)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  if (RsrcTypeIdentifier != NULL) {
+    //
+    // Only the convertors support this resource type identifier are invoked.
+    //
+    RsrcIndex = RestJsonStructureGetIndex (&RsrcTypeIdentifier->NameSpace);
+    if (RsrcIndex == NULL) {
+      return EFI_UNSUPPORTED;
+    }
+    Hash = RestJsonStructureHash (&RsrcTypeIdentifier->NameSpace, RsrcIndex->TypeNameOnly);
+    for (Entry = RestJsonStructureIndexFind (RsrcIndex, &RsrcTypeIdentifier->NameSpace, Hash, NULL);
+         Entry != NULL;
+         Entry = RestJsonStructureIndexFind (RsrcIndex, &RsrcTypeIdentifier->NameSpace, Hash, Entry)) {
+      Status = InterpreterInstanceInvokeToStruct (
+                 This,
+                 Entry->Instance,
+                 RsrcTypeIdentifier,
+                 ResourceRaw,
+                 JsonStructure
+                 );
+      if (!EFI_ERROR (Status)) {
+        return Status;
+      }
+    }
+    return EFI_UNSUPPORTED;
   }
 
-  Status = EFI_UNSUPPORTED;
   //
-  // Check if the namesapce and version is supported by this interpreter.
+  // No resource type identifier. Find out the resource type here, instead
+  // of having each convertor parse the resource in turn.
   //
-  ThisSupportedRsrcTypeId = InterpreterInstance->SupportedRsrcIndentifier;
-  for (Index = 0; Index < InterpreterInstance->NumberOfNameSpaceToConvert; Index ++){
-    if (AsciiStrCmp (
-          RestJSonHeader->JsonRsrcIdentifier.NameSpace.ResourceTypeName,
-          ThisSupportedRsrcTypeId->NameSpace.ResourceTypeName) == 0) {
-      if ((RestJSonHeader->JsonRsrcIdentifier.NameSpace.MajorVersion == NULL) &&
-          (RestJSonHeader->JsonRsrcIdentifier.NameSpace.MinorVersion == NULL) &&
-          (RestJSonHeader->JsonRsrcIdentifier.NameSpace.ErrataVersion == NULL)
-          ) {
-        //
-        // Don't check version of this resource type identifier.
-        //
-        Status = InterpreterInstance->DestroyStructure (
-                    This,
-                    RestJSonHeader
-                    );
+  Status = EFI_UNSUPPORTED;
+  OdataTypeBuffer = NULL;
+  LookupStatus = EFI_NOT_FOUND;
+  JsonValue = JsonLoadString (ResourceRaw, 0, NULL);
+  if (JsonValue != NULL) {
+    LookupStatus = OdataTypeToNameSpace (JsonValue, &NameSpace, &OdataTypeBuffer);
+    JsonValueFree (JsonValue);
+  }
+  if (!EFI_ERROR (LookupStatus)) {
+    Hash = RestJsonStructureHash (&NameSpace, FALSE);
+    for (Entry = RestJsonStructureIndexFind (&mRestJsonStructureIndex, &NameSpace, Hash, NULL);
+         Entry != NULL;
+         Entry = RestJsonStructureIndexFind (&mRestJsonStructureIndex, &NameSpace, Hash, Entry)) {
+      //
+      // Keep the identifier NULL, convertor validates the resource by itself.
+      //
+      Status = InterpreterInstanceInvokeToStruct (
+                 This,
+                 Entry->Instance,
+                 NULL,
+                 ResourceRaw,
+                 JsonStructure
+                 );
+      if (!EFI_ERROR (Status)) {
         break;
-      } else {
-        //
-        // Check version.
-        //
-        if ((AsciiStrCmp (
-              RestJSonHeader->JsonRsrcIdentifier.NameSpace.MajorVersion,
-              ThisSupportedRsrcTypeId->NameSpace.MajorVersion) == 0) &&
-            (AsciiStrCmp (
-              RestJSonHeader->JsonRsrcIdentifier.NameSpace.MinorVersion,
-              ThisSupportedRsrcTypeId->NameSpace.MinorVersion) == 0) &&
-            (AsciiStrCmp (
-              RestJSonHeader->JsonRsrcIdentifier.NameSpace.ErrataVersion,
-              ThisSupportedRsrcTypeId->NameSpace.ErrataVersion) == 0)) {
-          Status = InterpreterInstance->DestroyStructure (
-                    This,
-                    RestJSonHeader
-                    );
-          break;
-        }
       }
     }
-    ThisSupportedRsrcTypeId ++;
+    FreePool (OdataTypeBuffer);
   }
+
+  if (EFI_ERROR (Status)) {
+    //
+    // Resource type is not recognized from the resource. Send it to
+    // each intepreter anyway, interpreter may recognize this resource.
+    //
+    for (Node = GetFirstNode (&mRestJsonStructureList);
+         !IsNull (&mRestJsonStructureList, Node);
+         Node = GetNextNode (&mRestJsonStructureList, Node)) {
+      Instance = (REST_JSON_STRUCTURE_INSTANCE *)Node;
+      Status = InterpreterInstanceInvokeToStruct (
+                 This,
+                 Instance,
+                 NULL,
+                 ResourceRaw,
+                 JsonStructure
+                 );
+      if (!EFI_ERROR (Status)) {
+        break;
+      }
+    }
+    if (EFI_ERROR (Status)) {
+      Status = EFI_UNSUPPORTED;
+    }
+  }
+
   return Status;
 }
 
@@ -366,9 +667,6 @@ RestJsonStructureToStruct (
   OUT EFI_REST_JSON_STRUCTURE_HEADER        **JsonStructure
 )
 {
-  EFI_STATUS Status;
-  REST_JSON_STRUCTURE_INSTANCE *Instance;
-
   if (This == NULL ||
       ResourceJsonText == NULL ||
       JsonStructure == NULL
@@ -376,29 +674,12 @@ RestJsonStructureToStruct (
     return EFI_INVALID_PARAMETER;
   }
 
-  if (IsListEmpty (&mRestJsonStructureList)) {
-    return EFI_UNSUPPORTED;
-  }
-  Status = EFI_SUCCESS;
-  Instance = (REST_JSON_STRUCTURE_INSTANCE *)GetFirstNode (&mRestJsonStructureList);
-  while (TRUE) {
-    Status = InterpreterInstanceToStruct (
-                This,
-                Instance,
-                RsrcTypeIdentifier,
-                ResourceJsonText,
-                JsonStructure
-              );
-    if (!EFI_ERROR (Status)) {
-      break;
-    }
-    if (IsNodeAtEnd(&mRestJsonStructureList, &Instance->NextRestJsonStructureInstance)) {
-      Status = EFI_UNSUPPORTED;
-      break;
-    }
-    Instance = (REST_JSON_STRUCTURE_INSTANCE *)GetNextNode (&mRestJsonStructureList, &Instance->NextRestJsonStructureInstance);
-  };
-  return Status;
+  return RestJsonStructureDispatchToStruct (
+           This,
+           RsrcTypeIdentifier,
+           ResourceJsonText,
+           JsonStructure
+           );
 }
 
 /**
@@ -420,33 +701,33 @@ RestJsonStructureDestroyStruct (
 )
 {
   EFI_STATUS Status;
-  REST_JSON_STRUCTURE_INSTANCE *Instance;
+  EFI_REST_JSON_RESOURCE_TYPE_NAMESPACE *NameSpace;
+  REST_JSON_STRUCTURE_INDEX *RsrcIndex;
+  REST_JSON_STRUCTURE_INDEX_ENTRY *Entry;
+  UINT32 Hash;
 
   if (This == NULL || RestJSonHeader == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
-  if (IsListEmpty (&mRestJsonStructureList)) {
+  NameSpace = &RestJSonHeader->JsonRsrcIdentifier.NameSpace;
+  RsrcIndex = RestJsonStructureGetIndex (NameSpace);
+  if (RsrcIndex == NULL) {
     return EFI_UNSUPPORTED;
   }
-  Status = EFI_SUCCESS;
-  Instance = (REST_JSON_STRUCTURE_INSTANCE *)GetFirstNode (&mRestJsonStructureList);
-  while (TRUE) {
-    Status = InterpreterInstanceDestoryJsonStruct (
-                This,
-                Instance,
-                RestJSonHeader
-              );
+  Hash = RestJsonStructureHash (NameSpace, RsrcIndex->TypeNameOnly);
+  for (Entry = RestJsonStructureIndexFind (RsrcIndex, NameSpace, Hash, NULL);
+       Entry != NULL;
+       Entry = RestJsonStructureIndexFind (RsrcIndex, NameSpace, Hash, Entry)) {
+    Status = Entry->Instance->DestroyStructure (
+                                This,
+                                RestJSonHeader
+                                );
     if (!EFI_ERROR (Status)) {
-      break;
+      return Status;
     }
-    if (IsNodeAtEnd(&mRestJsonStructureList, &Instance->NextRestJsonStructureInstance)) {
-      Status = EFI_UNSUPPORTED;
-      break;
-    }
-    Instance = (REST_JSON_STRUCTURE_INSTANCE *)GetNextNode (&mRestJsonStructureList, &Instance->NextRestJsonStructureInstance);
-  };
-  return Status;
+  }
+  return EFI_UNSUPPORTED;
 }
 
 /**
@@ -469,33 +750,42 @@ RestJsonStructureToJson (
 )
 {
   EFI_STATUS Status;
-  REST_JSON_STRUCTURE_INSTANCE *Instance;
+  EFI_REST_JSON_RESOURCE_TYPE_NAMESPACE *NameSpace;
+  REST_JSON_STRUCTURE_INDEX_ENTRY *Entry;
+  UINT32 Hash;
+  UINT64 StartTick;
 
   if (This == NULL || RestJSonHeader == NULL || ResourceRaw == NULL) {
     return EFI_INVALID_PARAMETER;
   }
 
-  if (IsListEmpty (&mRestJsonStructureList)) {
-    return EFI_UNSUPPORTED;
+  NameSpace = &RestJSonHeader->JsonRsrcIdentifier.NameSpace;
+  if (NameSpace->ResourceTypeName == NULL ||
+      NameSpace->MajorVersion == NULL ||
+      NameSpace->MinorVersion == NULL ||
+      NameSpace->ErrataVersion == NULL
+      ) {
+    return EFI_INVALID_PARAMETER;
   }
-  Status = EFI_SUCCESS;
-  Instance = (REST_JSON_STRUCTURE_INSTANCE *)GetFirstNode (&mRestJsonStructureList);
-  while (TRUE) {
-    Status = InterpreterEfiStructToInstance (
-                This,
-                Instance,
-                RestJSonHeader,
-                ResourceRaw
-              );
+
+  StartTick = RedfishPerfStart ();
+  Status    = EFI_UNSUPPORTED;
+  Hash = RestJsonStructureHash (NameSpace, FALSE);
+  for (Entry = RestJsonStructureIndexFind (&mRestJsonStructureIndex, NameSpace, Hash, NULL);
+       Entry != NULL;
+       Entry = RestJsonStructureIndexFind (&mRestJsonStructureIndex, NameSpace, Hash, Entry)) {
+    Status = Entry->Instance->StructureToJson (
+                                This,
+                                RestJSonHeader,
+                                ResourceRaw
+                                );
     if (!EFI_ERROR (Status)) {
       break;
     }
-    if (IsNodeAtEnd(&mRestJsonStructureList, &Instance->NextRestJsonStructureInstance)) {
-      Status = EFI_UNSUPPORTED;
-      break;
-    }
-    Instance = (REST_JSON_STRUCTURE_INSTANCE *)GetNextNode (&mRestJsonStructureList, &Instance->NextRestJsonStructureInstance);
-  };
+    Status = EFI_UNSUPPORTED;
+  }
+
+  RedfishPerfEnd (RedfishPerfJsonConvert, NameSpace->ResourceTypeName, StartTick, 1, 0, EFI_ERROR (Status));
   return Status;
 }
 
@@ -529,11 +819,11 @@ RestJsonStructureEntryPoint (
   // Install the Restful Resource Interpreter Protocol.
   //
   mProtocolHandle = NULL;
-  Status = gBS->InstallProtocolInterface (
+  Status = gBS->InstallMultipleProtocolInterfaces (
                   &mProtocolHandle,
                   &gEfiRestJsonStructureProtocolGuid,
-                  EFI_NATIVE_INTERFACE,
-                  (VOID *)&mRestJsonStructureProtocol
+                  (VOID *)&mRestJsonStructureProtocol,
+                  NULL
                   );
   return Status;
 }
@@ -560,10 +850,11 @@ RestJsonStructureUnload (
   REST_JSON_STRUCTURE_INSTANCE *Instance;
   REST_JSON_STRUCTURE_INSTANCE *NextInstance;
 
-  Status = gBS->UninstallProtocolInterface (
+  Status = gBS->UninstallMultipleProtocolInterfaces (
                   mProtocolHandle,
                   &gEfiRestJsonStructureProtocolGuid,
-                  (VOID *)&mRestJsonStructureProtocol
+                  (VOID *)&mRestJsonStructureProtocol,
+                  NULL
                   );
 
   if (IsListEmpty (&mRestJsonStructureList)) {
@@ -582,5 +873,12 @@ RestJsonStructureUnload (
     Instance = NextInstance;
   } while (Instance != NULL);
 
+  if (mRestJsonStructureIndex.Bucket != NULL) {
+    FreePool (mRestJsonStructureIndex.Bucket);
+  }
+  if (mRestJsonStructureTypeIndex.Bucket != NULL) {
+    FreePool (mRestJsonStructureTypeIndex.Bucket);
+  }
+
   return Status;
 }
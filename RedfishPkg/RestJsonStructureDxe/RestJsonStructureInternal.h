@@ -17,17 +17,55 @@
 #include <Library/UefiDriverEntryPoint.h>
 #include <Library/BaseMemoryLib.h>
 #include <Library/MemoryAllocationLib.h>
+#include <Library/JsonLib.h>
+#include <Library/RedfishPerfLib.h>
+
+#include <Protocol/RestJsonStructure.h>
+
+#define REST_JSON_STRUCTURE_INDEX_INITIAL_BUCKETS  64
+#define REST_JSON_STRUCTURE_NOVERSIONED            "NOVERSIONED"
+#define REST_JSON_STRUCTURE_ODATA_TYPE             "@odata.type"
+
+typedef struct _REST_JSON_STRUCTURE_INSTANCE REST_JSON_STRUCTURE_INSTANCE;
+
+///
+/// Entry of convertor index. Each entry maps one supported resource
+/// type identifier to the convertor which supports it.
+///
+typedef struct {
+  LIST_ENTRY                              NextIndexEntry;      ///< Next entry in the same hash bucket.
+  UINT32                                  Hash;                ///< Hash value of the key.
+  EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER  *RsrcTypeIdentifier; ///< Supported resource type identifier.
+  REST_JSON_STRUCTURE_INSTANCE            *Instance;           ///< Convertor supports RsrcTypeIdentifier.
+} REST_JSON_STRUCTURE_INDEX_ENTRY;
+
+///
+/// Hash index of convertors. The key is either resource type name and
+/// version, or resource type name only.
+///
+typedef struct {
+  LIST_ENTRY    *Bucket;         ///< Hash buckets, number of buckets is power of two.
+  UINTN         BucketCount;     ///< Number of hash buckets.
+  UINTN         Count;           ///< Number of entries in this index.
+  BOOLEAN       TypeNameOnly;    ///< TRUE if the key is resource type name only.
+} REST_JSON_STRUCTURE_INDEX;
 
 ///
 /// Internal structure to maintain the information of JSON to
 /// C structure convertor.
 ///
-typedef struct _REST_JSON_STRUCTURE_INSTANCE {
+struct _REST_JSON_STRUCTURE_INSTANCE {
   LIST_ENTRY NextRestJsonStructureInstance;  ///< Next convertor instance
   UINTN NumberOfNameSpaceToConvert;          ///< Number of resource type this convertor supports.
   EFI_REST_JSON_RESOURCE_TYPE_IDENTIFIER     *SupportedRsrcIndentifier; ///< The resource type linklist
   EFI_REST_JSON_STRUCTURE_TO_STRUCTURE        JsonToStructure;          ///< JSON to C structure function
   EFI_REST_JSON_STRUCTURE_TO_JSON             StructureToJson;          ///< C structure to JSON function
   EFI_REST_JSON_STRUCTURE_DESTORY_STRUCTURE   DestroyStructure;         ///< Destory C struture function.
-} REST_JSON_STRUCTURE_INSTANCE;
+  REST_JSON_STRUCTURE_INDEX_ENTRY             *IndexEntry;              ///< Index entries of supported resource types,
+                                                                          ///< versioned entries are followed by type name
+                                                                          ///< entries.
+};
+
+extern EFI_REST_JSON_STRUCTURE_PROTOCOL mRestJsonStructureProtocol;
+
 #endif